@@ -0,0 +1,33 @@
+#pragma once
+
+#include "setup.hpp"
+#include <cstddef>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <functional>
+
+namespace glm{
+namespace detail
+{
+	// Number of threads to split Count items over: at most Threads, and at least Grain items per thread.
+	// Below Grain items per thread, threads cost more than they save.
+	GLM_FUNC_QUALIFIER unsigned int parallel_threads(std::size_t Count, std::size_t Grain, unsigned int Threads)
+	{
+		std::size_t const Max = Count / Grain + 1;
+		return static_cast<unsigned int>(std::max<std::size_t>(std::min<std::size_t>(Threads, Max), 1));
+	}
+
+	// Calls Function(Begin, End, Chunk) on Threads chunks of [0, Count), the first one on the calling thread
+	template<typename functionType>
+	GLM_FUNC_QUALIFIER void parallel_for(std::size_t Count, unsigned int Threads, functionType const& Function)
+	{
+		std::vector<std::thread> Workers;
+		for(unsigned int t = 1; t < Threads; ++t)
+			Workers.push_back(std::thread(std::cref(Function), Count * t / Threads, Count * (t + 1) / Threads, t));
+		Function(0, Count / Threads, 0u);
+		for(std::size_t i = 0; i < Workers.size(); ++i)
+			Workers[i].join();
+	}
+}//namespace detail
+}//namespace glm
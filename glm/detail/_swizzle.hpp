@@ -45,6 +45,56 @@ namespace detail
 		GLM_FUNC_QUALIFIER vec<4, T, Q> operator ()()  const { return vec<4, T, Q>(this->elem(E0), this->elem(E1), this->elem(E2), this->elem(E3)); }
 	};
 
+	// Lanes of the source vector read by a swizzle of N components, the lanes after N repeat the last component.
+	// A swizzle that only reads the first two components may belong to a vec2: Wide is false and only 8 bytes may be loaded.
+	template<length_t N, int E0, int E1, int E2, int E3>
+	struct _swizzle_lanes
+	{
+		enum
+		{
+			L0 = E0,
+			L1 = N > 1 ? E1 : L0,
+			L2 = N > 2 ? E2 : L1,
+			L3 = N > 3 ? E3 : L2,
+			Wide = L0 > 1 || L1 > 1 || L2 > 1 || L3 > 1,
+			Shuffle = (L3 << 6) | (L2 << 4) | (L1 << 2) | L0
+		};
+	};
+
+	// Lanes of the assigned vector written by a swizzle assignment: lane i of the destination receives component j when Ej == i.
+	// An assignment to three components leaves the Kept lane of the destination unchanged.
+	template<length_t N, int E0, int E1, int E2, int E3>
+	struct _swizzle_assign_lanes
+	{
+		enum
+		{
+			L0 = E0 == 0 ? 0 : E1 == 0 ? 1 : E2 == 0 ? 2 : 3,
+			L1 = E0 == 1 ? 0 : E1 == 1 ? 1 : E2 == 1 ? 2 : 3,
+			L2 = E0 == 2 ? 0 : E1 == 2 ? 1 : E2 == 2 ? 2 : 3,
+			L3 = E0 == 3 ? 0 : E1 == 3 ? 1 : E2 == 3 ? 2 : 3,
+			Shuffle = (L3 << 6) | (L2 << 4) | (L1 << 2) | L0,
+			Kept = N > 3 ? 3 : 6 - E0 - E1 - E2
+		};
+	};
+
+	// Applies an assignment operator to the components of a swizzle, one component at a time
+	template<length_t N, typename T, qualifier Q, int E0, int E1, int E2, int E3, bool UseSimd>
+	struct _swizzle_apply
+	{
+		template<typename S, typename U>
+		GLM_FUNC_QUALIFIER static void call(S& Swizzle, vec<N, T, Q> const& that, U const& op)
+		{
+			// Make a copy of the data in this == &that.
+			// The copier should optimize out the copy in cases where the function is
+			// properly inlined and the copy is not necessary.
+			T t[N];
+			for (int i = 0; i < N; ++i)
+				t[i] = that[i];
+			for (int i = 0; i < N; ++i)
+				op( Swizzle[i], t[i] );
+		}
+	};
+
 	// Internal class for implementing swizzle operators
 	/*
 		Template parameters:
@@ -59,29 +109,35 @@ namespace detail
 	template<length_t N, typename T, qualifier Q, int E0, int E1, int E2, int E3, int DUPLICATE_ELEMENTS>
 	struct _swizzle_base2 : public _swizzle_base1<N, T, Q, E0,E1,E2,E3, detail::is_aligned<Q>::value>
 	{
+		// Applied to each component, or to whole vectors by the SIMD specializations of _swizzle_apply
 		struct op_equal
 		{
-			GLM_FUNC_QUALIFIER void operator() (T& e, T& t) const{ e = t; }
+			template<typename U>
+			GLM_FUNC_QUALIFIER void operator() (U& e, U const& t) const{ e = t; }
 		};
 
 		struct op_minus
 		{
-			GLM_FUNC_QUALIFIER void operator() (T& e, T& t) const{ e -= t; }
+			template<typename U>
+			GLM_FUNC_QUALIFIER void operator() (U& e, U const& t) const{ e -= t; }
 		};
 
 		struct op_plus
 		{
-			GLM_FUNC_QUALIFIER void operator() (T& e, T& t) const{ e += t; }
+			template<typename U>
+			GLM_FUNC_QUALIFIER void operator() (U& e, U const& t) const{ e += t; }
 		};
 
 		struct op_mul
 		{
-			GLM_FUNC_QUALIFIER void operator() (T& e, T& t) const{ e *= t; }
+			template<typename U>
+			GLM_FUNC_QUALIFIER void operator() (U& e, U const& t) const{ e *= t; }
 		};
 
 		struct op_div
 		{
-			GLM_FUNC_QUALIFIER void operator() (T& e, T& t) const{ e /= t; }
+			template<typename U>
+			GLM_FUNC_QUALIFIER void operator() (U& e, U const& t) const{ e /= t; }
 		};
 
 	public:
@@ -133,14 +189,7 @@ namespace detail
 		template<typename U>
 		GLM_FUNC_QUALIFIER void _apply_op(vec<N, T, Q> const& that, const U& op)
 		{
-			// Make a copy of the data in this == &that.
-			// The copier should optimize out the copy in cases where the function is
-			// properly inlined and the copy is not necessary.
-			T t[N];
-			for (int i = 0; i < N; ++i)
-				t[i] = that[i];
-			for (int i = 0; i < N; ++i)
-				op( (*this)[i], t[i] );
+			_swizzle_apply<N, T, Q, E0, E1, E2, E3, detail::is_aligned<Q>::value>::call(*this, that, op);
 		}
 	};
 
@@ -0,0 +1,238 @@
+#pragma once
+
+#include "setup.hpp"
+#include <cmath>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// True while a constant expression is evaluated, where neither <cmath> nor the SIMD intrinsics may be called
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR bool is_constant_evaluated()
+	{
+#		if GLM_HAS_CONSTANT_EVALUATED
+			return std::is_constant_evaluated();
+#		else
+			return false;
+#		endif
+	}
+
+	// Newton iterations from above, they decrease until the result is reached
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T constexpr_sqrt(T x)
+	{
+		if(!(x >= static_cast<T>(0)))
+			return std::numeric_limits<T>::quiet_NaN();
+		if(x == static_cast<T>(0) || x > std::numeric_limits<T>::max())
+			return x;
+
+		T Result = x > static_cast<T>(1) ? x : static_cast<T>(1);
+		for(;;)
+		{
+			T const Next = static_cast<T>(0.5) * (Result + x / Result);
+			if(!(Next < Result))
+				return Result;
+			Result = Next;
+		}
+	}
+
+	// a + b rounded, Error receives the rounding error
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR double constexpr_two_sum(double a, double b, double& Error)
+	{
+		double const Sum = a + b;
+		double const b2 = Sum - a;
+		Error = (a - (Sum - b2)) + (b - b2);
+		return Sum;
+	}
+
+	// Bits of 2 / pi after the binary point in chunks of 24 bits, enough for the largest double
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR unsigned long long constexpr_two_over_pi(int Index)
+	{
+		unsigned long long const Bits[] = {
+			0xA2F983, 0x6E4E44, 0x1529FC, 0x2757D1, 0xF534DD, 0xC0DB62, 0x95993C, 0x439041,
+			0xFE5163, 0xABDEBB, 0xC561B7, 0x246E3A, 0x424DD2, 0xE00649, 0x2EEA09, 0xD1921C,
+			0xFE1DEB, 0x1CB129, 0xA73EE8, 0x8235F5, 0x2EBB44, 0x84E99C, 0x7026B4, 0x5F7E41,
+			0x3991D6, 0x398353, 0x39F49C, 0x845F8B, 0xBDF928, 0x3B1FF8, 0x97FFDE, 0x05980F,
+			0xEF2F11, 0x8B5A0A, 0x6D1F6D, 0x367ECF, 0x27CB09, 0xB74F46, 0x3F669E, 0x5FEA2D,
+			0x7527BA, 0xC7EBE5, 0xF17B3D, 0x0739F7, 0x8A5292, 0xEA6BFB, 0x5FB11F, 0x8D5D08,
+			0x560330, 0x46FC7B, 0x6BABF0, 0xCFBC20
+		};
+		return Index < 0 || Index >= static_cast<int>(sizeof(Bits) / sizeof(Bits[0])) ? 0ull : Bits[Index];
+	}
+
+	// Remainder of x >= 2^20 pi / 2 by pi / 2 (Payne-Hanek), returns the quotient modulo 4.
+	// The mantissa is multiplied by the bits of 2 / pi that contribute to the last two bits of the integer part and to the first 192 bits of the fraction.
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int constexpr_rem_half_pi_large(double x, double& Remainder)
+	{
+		// x = Mantissa * 2^Exponent with an integer Mantissa of 53 bits
+		double Mantissa = x;
+		int Exponent = 0;
+		for(; Mantissa >= 9007199254740992.0 * 4294967296.0; Exponent += 32)
+			Mantissa *= 1.0 / 4294967296.0;
+		for(; Mantissa >= 9007199254740992.0; ++Exponent)
+			Mantissa *= 0.5;
+		for(; Mantissa < 4503599627370496.0; --Exponent)
+			Mantissa *= 2.0;
+
+		// x = sum(Limbs[j] * 2^(24 * (j + Offset))) with Limbs of 24 bits
+		int const Shift = (Exponent % 24 + 24) % 24;
+		int const Offset = (Exponent - Shift) / 24;
+		unsigned long long const Bits = static_cast<unsigned long long>(Mantissa);
+		unsigned long long Limbs[4] = {0, 0, 0, 0};
+		for(int j = 0; j < 4; ++j)
+			Limbs[j] = (j * 24 < Shift ? Bits << (Shift - j * 24) : (j * 24 - Shift < 64 ? Bits >> (j * 24 - Shift) : 0ull)) & 0xFFFFFF;
+
+		// x * 2 / pi modulo 4 = sum(Products[q] * 2^(-24 * q)), the other products are multiples of 4
+		unsigned long long Products[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+		for(int q = 0; q < 9; ++q)
+			for(int j = 0; j < 4; ++j)
+				Products[q] += Limbs[j] * constexpr_two_over_pi(j + Offset - 1 + q);
+		for(int q = 8; q > 0; --q)
+		{
+			Products[q - 1] += Products[q] >> 24;
+			Products[q] &= 0xFFFFFF;
+		}
+
+		// Rounded to the nearest quotient, the fraction becomes 1 - fraction
+		int Quadrant = static_cast<int>(Products[0] & 3);
+		double Sign = 1.0;
+		if(Products[1] >= 0x800000)
+		{
+			Quadrant = (Quadrant + 1) % 4;
+			Sign = -1.0;
+			unsigned long long Carry = 1;
+			for(int q = 8; q > 0; --q)
+			{
+				Products[q] = (0xFFFFFF - Products[q]) + Carry;
+				Carry = Products[q] >> 24;
+				Products[q] &= 0xFFFFFF;
+			}
+		}
+
+		// The fraction as High + Low from its first non zero chunk, High is exact
+		int Lead = 1;
+		double Scale = 1.0 / 16777216.0;
+		for(; Lead < 8 && Products[Lead] == 0; ++Lead)
+			Scale *= 1.0 / 16777216.0;
+		double const High = static_cast<double>(Products[Lead]) * Scale + static_cast<double>(Lead < 8 ? Products[Lead + 1] : 0ull) * (Scale / 16777216.0);
+		double Low = 0.0;
+		double LowScale = Scale / 16777216.0;
+		for(int q = Lead + 2; q < 9; ++q)
+		{
+			LowScale *= 1.0 / 16777216.0;
+			Low += static_cast<double>(Products[q]) * LowScale;
+		}
+
+		// pi / 2 = HalfPi + HalfPiLow
+		double const HalfPi = 1.5707963267948966;
+		double const HalfPiLow = 6.123233995736766e-17;
+		Remainder = Sign * (High * HalfPi + (High * HalfPiLow + Low * HalfPi));
+		return Quadrant;
+	}
+
+	// Remainder of x by pi / 2 in [-pi/4, pi/4], returns the quotient modulo 4
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int constexpr_rem_half_pi(double x, double& Remainder)
+	{
+		double const Quotient = x * 0.63661977236758134;
+		if(Quotient > 1048575.0 || Quotient < -1048575.0)
+		{
+			int const Quadrant = constexpr_rem_half_pi_large(x < 0.0 ? -x : x, Remainder);
+			if(x < 0.0)
+				Remainder = -Remainder;
+			return x < 0.0 ? (4 - Quadrant) % 4 : Quadrant;
+		}
+
+		// Cody-Waite: pi / 2 split in three parts of 33 bits and a remainder, n * HalfPi1, n * HalfPi2 and n * HalfPi3 are exact for |n| < 2^20
+		double const HalfPi1 = 1.5707963267341256;
+		double const HalfPi2 = 6.077100506303966e-11;
+		double const HalfPi3 = 2.0222662487111665e-21;
+		double const HalfPi3Low = 8.4784276603689e-32;
+
+		long long const n = static_cast<long long>(Quotient < 0.0 ? Quotient - 0.5 : Quotient + 0.5);
+		double const N = static_cast<double>(n);
+
+		// x - N * HalfPi1 is exact, the rounding errors of the next subtractions are kept in Low
+		double Error = 0.0;
+		double Low = 0.0;
+		double High = constexpr_two_sum(x - N * HalfPi1, -N * HalfPi2, Error);
+		Low += Error;
+		High = constexpr_two_sum(High, -N * HalfPi3, Error);
+		Low += Error - N * HalfPi3Low;
+
+		Remainder = High + Low;
+		return static_cast<int>((n % 4 + 4) % 4);
+	}
+
+	// Reduction to [-pi/4, pi/4] then Taylor series, evaluated in double precision
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR double constexpr_sin_quadrant(double x, int Quadrant)
+	{
+		if(x != x || x > std::numeric_limits<double>::max() || x < -std::numeric_limits<double>::max())
+			return std::numeric_limits<double>::quiet_NaN();
+
+		double r = 0.0;
+		int const n = constexpr_rem_half_pi(x, r);
+		double const r2 = r * r;
+
+		// sin(r + k pi / 2) is sin(r), cos(r), -sin(r) or -cos(r), the Taylor series evaluated from its smallest terms
+		int const k = (n + Quadrant) % 4;
+		int const First = k % 2 == 0 ? 2 : 1;
+		double Sum = 1.0;
+		for(int i = First + 24; i >= First; i -= 2)
+			Sum = 1.0 - r2 / static_cast<double>(i * (i + 1)) * Sum;
+		if(k % 2 == 0)
+			Sum *= r;
+		return k < 2 ? Sum : -Sum;
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T constexpr_sin(T x)
+	{
+		return static_cast<T>(constexpr_sin_quadrant(static_cast<double>(x), 0));
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T constexpr_cos(T x)
+	{
+		return static_cast<T>(constexpr_sin_quadrant(static_cast<double>(x), 1));
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T constexpr_tan(T x)
+	{
+		return static_cast<T>(constexpr_sin_quadrant(static_cast<double>(x), 0) / constexpr_sin_quadrant(static_cast<double>(x), 1));
+	}
+
+	// <cmath> at run time, the scalar code above in constant expressions
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T evaluate_sqrt(T x)
+	{
+		if(is_constant_evaluated())
+			return constexpr_sqrt(x);
+		return std::sqrt(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T evaluate_sin(T x)
+	{
+		if(is_constant_evaluated())
+			return constexpr_sin(x);
+		return std::sin(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T evaluate_cos(T x)
+	{
+		if(is_constant_evaluated())
+			return constexpr_cos(x);
+		return std::cos(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T evaluate_tan(T x)
+	{
+		if(is_constant_evaluated())
+			return constexpr_tan(x);
+		return std::tan(x);
+	}
+}//namespace detail
+}//namespace glm
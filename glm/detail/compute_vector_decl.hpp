@@ -1,16 +1,62 @@
 
 #pragma once
-#include <functional>
+#include <limits>
 #include "_vectorize.hpp"
 
 namespace glm {
 	namespace detail
 	{
+		// Arithmetic function objects of the component wise operators, <functional> costs more to parse than all the vector types
+		template<typename T>
+		struct compute_plus
+		{
+			GLM_FUNC_QUALIFIER GLM_CONSTEXPR T operator()(T const& a, T const& b) const
+			{
+				return static_cast<T>(a + b);
+			}
+		};
+
+		template<typename T>
+		struct compute_minus
+		{
+			GLM_FUNC_QUALIFIER GLM_CONSTEXPR T operator()(T const& a, T const& b) const
+			{
+				return static_cast<T>(a - b);
+			}
+		};
+
+		template<typename T>
+		struct compute_multiplies
+		{
+			GLM_FUNC_QUALIFIER GLM_CONSTEXPR T operator()(T const& a, T const& b) const
+			{
+				return static_cast<T>(a * b);
+			}
+		};
+
+		template<typename T>
+		struct compute_divides
+		{
+			GLM_FUNC_QUALIFIER GLM_CONSTEXPR T operator()(T const& a, T const& b) const
+			{
+				return static_cast<T>(a / b);
+			}
+		};
+
+		template<typename T>
+		struct compute_modulus
+		{
+			GLM_FUNC_QUALIFIER GLM_CONSTEXPR T operator()(T const& a, T const& b) const
+			{
+				return static_cast<T>(a % b);
+			}
+		};
+
 		template<length_t L, typename T, qualifier Q, bool UseSimd>
 		struct compute_vec_add {
 			GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<L, T, Q> call(vec<L, T, Q> const& a, vec<L, T, Q> const& b)
 			{
-				return detail::functor2<vec, L, T, Q>::call(std::plus<T>(), a, b);
+				return detail::functor2<vec, L, T, Q>::call(compute_plus<T>(), a, b);
 			}
 		};
 
@@ -18,7 +64,7 @@ namespace glm {
 		struct compute_vec_sub {
 			GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<L, T, Q> call(vec<L, T, Q> const& a, vec<L, T, Q> const& b)
 			{
-				return detail::functor2<vec, L, T, Q>::call(std::minus<T>(), a, b);
+				return detail::functor2<vec, L, T, Q>::call(compute_minus<T>(), a, b);
 			}
 		};
 
@@ -26,7 +72,7 @@ namespace glm {
 		struct compute_vec_mul {
 			GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<L, T, Q> call(vec<L, T, Q> const& a, vec<L, T, Q> const& b)
 			{
-				return detail::functor2<vec, L, T, Q>::call(std::multiplies<T>(), a, b);
+				return detail::functor2<vec, L, T, Q>::call(compute_multiplies<T>(), a, b);
 			}
 		};
 
@@ -34,7 +80,7 @@ namespace glm {
 		struct compute_vec_div {
 			GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<L, T, Q> call(vec<L, T, Q> const& a, vec<L, T, Q> const& b)
 			{
-				return detail::functor2<vec, L, T, Q>::call(std::divides<T>(), a, b);
+				return detail::functor2<vec, L, T, Q>::call(compute_divides<T>(), a, b);
 			}
 		};
 
@@ -42,7 +88,7 @@ namespace glm {
 		struct compute_vec_mod {
 			GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<L, T, Q> call(vec<L, T, Q> const& a, vec<L, T, Q> const& b)
 			{
-				return detail::functor2<vec, L, T, Q>::call(std::modulus<T>(), a, b);
+				return detail::functor2<vec, L, T, Q>::call(compute_modulus<T>(), a, b);
 			}
 		};
 
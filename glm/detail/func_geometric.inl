@@ -1,5 +1,6 @@
 #include "../exponential.hpp"
 #include "../common.hpp"
+#include "compute_constexpr.hpp"
 
 namespace glm{
 namespace detail
@@ -7,16 +8,16 @@ namespace detail
 	template<length_t L, typename T, qualifier Q, bool Aligned>
 	struct compute_length
 	{
-		GLM_FUNC_QUALIFIER static T call(vec<L, T, Q> const& v)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static T call(vec<L, T, Q> const& v)
 		{
-			return sqrt(dot(v, v));
+			return evaluate_sqrt(dot(v, v));
 		}
 	};
 
 	template<length_t L, typename T, qualifier Q, bool Aligned>
 	struct compute_distance
 	{
-		GLM_FUNC_QUALIFIER static T call(vec<L, T, Q> const& p0, vec<L, T, Q> const& p1)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static T call(vec<L, T, Q> const& p0, vec<L, T, Q> const& p1)
 		{
 			return length(p1 - p0);
 		}
@@ -97,10 +98,12 @@ namespace detail
 	template<length_t L, typename T, qualifier Q, bool Aligned>
 	struct compute_normalize
 	{
-		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& v)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<L, T, Q> call(vec<L, T, Q> const& v)
 		{
 			static_assert(std::numeric_limits<T>::is_iec559, "'normalize' accepts only floating-point inputs");
 
+			if(is_constant_evaluated())
+				return v * (static_cast<T>(1) / constexpr_sqrt(dot(v, v)));
 			return v * inversesqrt(dot(v, v));
 		}
 	};
@@ -108,7 +111,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q, bool Aligned>
 	struct compute_faceforward
 	{
-		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& N, vec<L, T, Q> const& I, vec<L, T, Q> const& Nref)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<L, T, Q> call(vec<L, T, Q> const& N, vec<L, T, Q> const& I, vec<L, T, Q> const& Nref)
 		{
 			static_assert(std::numeric_limits<T>::is_iec559, "'normalize' accepts only floating-point inputs");
 
@@ -119,7 +122,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q, bool Aligned>
 	struct compute_reflect
 	{
-		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& I, vec<L, T, Q> const& N)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<L, T, Q> call(vec<L, T, Q> const& I, vec<L, T, Q> const& N)
 		{
 			return I - N * dot(N, I) * static_cast<T>(2);
 		}
@@ -128,12 +131,12 @@ namespace detail
 	template<length_t L, typename T, qualifier Q, bool Aligned>
 	struct compute_refract
 	{
-		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& I, vec<L, T, Q> const& N, T eta)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<L, T, Q> call(vec<L, T, Q> const& I, vec<L, T, Q> const& N, T eta)
 		{
 			T const dotValue(dot(N, I));
 			T const k(static_cast<T>(1) - eta * eta * (static_cast<T>(1) - dotValue * dotValue));
 			vec<L, T, Q> const Result =
-                (k >= static_cast<T>(0)) ? (eta * I - (eta * dotValue + std::sqrt(k)) * N) : vec<L, T, Q>(0);
+                (k >= static_cast<T>(0)) ? (eta * I - (eta * dotValue + evaluate_sqrt(k)) * N) : vec<L, T, Q>(0);
 			return Result;
 		}
 	};
@@ -141,7 +144,7 @@ namespace detail
 
 	// length
 	template<typename genType>
-	GLM_FUNC_QUALIFIER genType length(genType x)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType length(genType x)
 	{
 		static_assert(std::numeric_limits<genType>::is_iec559, "'length' accepts only floating-point inputs");
 
@@ -149,7 +152,7 @@ namespace detail
 	}
 
 	template<length_t L, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER T length(vec<L, T, Q> const& v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T length(vec<L, T, Q> const& v)
 	{
 		static_assert(std::numeric_limits<T>::is_iec559, "'length' accepts only floating-point inputs");
 
@@ -158,7 +161,7 @@ namespace detail
 
 	// distance
 	template<typename genType>
-	GLM_FUNC_QUALIFIER genType distance(genType const& p0, genType const& p1)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType distance(genType const& p0, genType const& p1)
 	{
 		static_assert(std::numeric_limits<genType>::is_iec559, "'distance' accepts only floating-point inputs");
 
@@ -166,7 +169,7 @@ namespace detail
 	}
 
 	template<length_t L, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER T distance(vec<L, T, Q> const& p0, vec<L, T, Q> const& p1)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T distance(vec<L, T, Q> const& p0, vec<L, T, Q> const& p1)
 	{
 		return detail::compute_distance<L, T, Q, detail::is_aligned<Q>::value>::call(p0, p1);
 	}
@@ -203,7 +206,7 @@ namespace detail
 	}
 */
 	template<length_t L, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<L, T, Q> normalize(vec<L, T, Q> const& x)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, T, Q> normalize(vec<L, T, Q> const& x)
 	{
 		static_assert(std::numeric_limits<T>::is_iec559, "'normalize' accepts only floating-point inputs");
 
@@ -212,42 +215,42 @@ namespace detail
 
 	// faceforward
 	template<typename genType>
-	GLM_FUNC_QUALIFIER genType faceforward(genType const& N, genType const& I, genType const& Nref)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType faceforward(genType const& N, genType const& I, genType const& Nref)
 	{
 		return dot(Nref, I) < static_cast<genType>(0) ? N : -N;
 	}
 
 	template<length_t L, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<L, T, Q> faceforward(vec<L, T, Q> const& N, vec<L, T, Q> const& I, vec<L, T, Q> const& Nref)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, T, Q> faceforward(vec<L, T, Q> const& N, vec<L, T, Q> const& I, vec<L, T, Q> const& Nref)
 	{
 		return detail::compute_faceforward<L, T, Q, detail::is_aligned<Q>::value>::call(N, I, Nref);
 	}
 
 	// reflect
 	template<typename genType>
-	GLM_FUNC_QUALIFIER genType reflect(genType const& I, genType const& N)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType reflect(genType const& I, genType const& N)
 	{
 		return I - N * dot(N, I) * genType(2);
 	}
 
 	template<length_t L, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<L, T, Q> reflect(vec<L, T, Q> const& I, vec<L, T, Q> const& N)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, T, Q> reflect(vec<L, T, Q> const& I, vec<L, T, Q> const& N)
 	{
 		return detail::compute_reflect<L, T, Q, detail::is_aligned<Q>::value>::call(I, N);
 	}
 
 	// refract
 	template<typename genType>
-	GLM_FUNC_QUALIFIER genType refract(genType const& I, genType const& N, genType eta)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType refract(genType const& I, genType const& N, genType eta)
 	{
 		static_assert(std::numeric_limits<genType>::is_iec559, "'refract' accepts only floating-point inputs");
 		genType const dotValue(dot(N, I));
 		genType const k(static_cast<genType>(1) - eta * eta * (static_cast<genType>(1) - dotValue * dotValue));
-		return (eta * I - (eta * dotValue + sqrt(k)) * N) * static_cast<genType>(k >= static_cast<genType>(0));
+		return (eta * I - (eta * dotValue + detail::evaluate_sqrt(k)) * N) * static_cast<genType>(k >= static_cast<genType>(0));
 	}
 
 	template<length_t L, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<L, T, Q> refract(vec<L, T, Q> const& I, vec<L, T, Q> const& N, T eta)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, T, Q> refract(vec<L, T, Q> const& I, vec<L, T, Q> const& N, T eta)
 	{
 		static_assert(std::numeric_limits<T>::is_iec559, "'refract' accepts only floating-point inputs");
 		return detail::compute_refract<L, T, Q, detail::is_aligned<Q>::value>::call(I, N, eta);
@@ -161,6 +161,87 @@ namespace detail
 		};
 #		endif
 #	endif//GLM_HAS_BITSCAN_WINDOWS
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_findMSB
+	{
+		GLM_FUNC_QUALIFIER static vec<L, int, Q> call(vec<L, T, Q> const& v)
+		{
+			return compute_findMSB_vec<L, T, Q, static_cast<int>(sizeof(T) * 8)>::call(v);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_findLSB_vec
+	{
+		GLM_FUNC_QUALIFIER static vec<L, int, Q> call(vec<L, T, Q> const& v)
+		{
+			return detail::functor1<vec, L, int, T, Q>::call(compute_findLSB<T, sizeof(T) * 8>::call, v);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_bitCount
+	{
+		GLM_FUNC_QUALIFIER static vec<L, int, Q> call(vec<L, T, Q> const& v)
+		{
+#			if GLM_COMPILER & GLM_COMPILER_VC
+#				pragma warning(push)
+#				pragma warning(disable : 4310) //cast truncates constant value
+#			endif
+
+			typedef typename std::make_unsigned<T>::type U;
+			vec<L, U, Q> x(v);
+			x = compute_bitfieldBitCountStep<L, U, Q, Aligned, sizeof(T) * 8>=  2>::call(x, U(0x5555555555555555ull), U( 1));
+			x = compute_bitfieldBitCountStep<L, U, Q, Aligned, sizeof(T) * 8>=  4>::call(x, U(0x3333333333333333ull), U( 2));
+			x = compute_bitfieldBitCountStep<L, U, Q, Aligned, sizeof(T) * 8>=  8>::call(x, U(0x0F0F0F0F0F0F0F0Full), U( 4));
+			x = compute_bitfieldBitCountStep<L, U, Q, Aligned, sizeof(T) * 8>= 16>::call(x, U(0x00FF00FF00FF00FFull), U( 8));
+			x = compute_bitfieldBitCountStep<L, U, Q, Aligned, sizeof(T) * 8>= 32>::call(x, U(0x0000FFFF0000FFFFull), U(16));
+			x = compute_bitfieldBitCountStep<L, U, Q, Aligned, sizeof(T) * 8>= 64>::call(x, U(0x00000000FFFFFFFFull), U(32));
+			return vec<L, int, Q>(x);
+
+#			if GLM_COMPILER & GLM_COMPILER_VC
+#				pragma warning(pop)
+#			endif
+		}
+	};
+
+	template<length_t L, qualifier Q, bool Aligned>
+	struct compute_uaddCarry
+	{
+		GLM_FUNC_QUALIFIER static vec<L, uint, Q> call(vec<L, uint, Q> const& x, vec<L, uint, Q> const& y, vec<L, uint, Q>& Carry)
+		{
+			vec<L, detail::uint64, Q> Value64(vec<L, detail::uint64, Q>(x) + vec<L, detail::uint64, Q>(y));
+			vec<L, detail::uint64, Q> Max32((static_cast<detail::uint64>(1) << static_cast<detail::uint64>(32)) - static_cast<detail::uint64>(1));
+			Carry = mix(vec<L, uint, Q>(0), vec<L, uint, Q>(1), greaterThan(Value64, Max32));
+			return vec<L, uint, Q>(Value64 % (Max32 + static_cast<detail::uint64>(1)));
+		}
+	};
+
+	template<length_t L, qualifier Q, bool Aligned>
+	struct compute_usubBorrow
+	{
+		GLM_FUNC_QUALIFIER static vec<L, uint, Q> call(vec<L, uint, Q> const& x, vec<L, uint, Q> const& y, vec<L, uint, Q>& Borrow)
+		{
+			Borrow = mix(vec<L, uint, Q>(1), vec<L, uint, Q>(0), greaterThanEqual(x, y));
+			vec<L, uint, Q> const XgeY(x - y);
+			vec<L, uint, Q> const YgX(vec<L, uint, Q>((static_cast<detail::int64>(1) << static_cast<detail::int64>(32)) + (vec<L, detail::int64, Q>(x) - vec<L, detail::int64, Q>(y))));
+			return mix(YgX, XgeY, greaterThanEqual(x, y));
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_mulExtended
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, T, Q> const& x, vec<L, T, Q> const& y, vec<L, T, Q>& msb, vec<L, T, Q>& lsb)
+		{
+			typedef typename std::conditional<std::numeric_limits<T>::is_signed, detail::int64, detail::uint64>::type T64;
+
+			vec<L, T64, Q> Value64(vec<L, T64, Q>(x) * vec<L, T64, Q>(y));
+			lsb = vec<L, T, Q>(Value64 & static_cast<T64>(0xFFFFFFFF));
+			msb = vec<L, T, Q>((Value64 >> static_cast<T64>(32)) & static_cast<T64>(0xFFFFFFFF));
+		}
+	};
 }//namespace detail
 
 	// uaddCarry
@@ -175,10 +256,7 @@ namespace detail
 	template<length_t L, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, uint, Q> uaddCarry(vec<L, uint, Q> const& x, vec<L, uint, Q> const& y, vec<L, uint, Q>& Carry)
 	{
-		vec<L, detail::uint64, Q> Value64(vec<L, detail::uint64, Q>(x) + vec<L, detail::uint64, Q>(y));
-		vec<L, detail::uint64, Q> Max32((static_cast<detail::uint64>(1) << static_cast<detail::uint64>(32)) - static_cast<detail::uint64>(1));
-		Carry = mix(vec<L, uint, Q>(0), vec<L, uint, Q>(1), greaterThan(Value64, Max32));
-		return vec<L, uint, Q>(Value64 % (Max32 + static_cast<detail::uint64>(1)));
+		return detail::compute_uaddCarry<L, Q, detail::is_aligned<Q>::value>::call(x, y, Carry);
 	}
 
 	// usubBorrow
@@ -194,10 +272,7 @@ namespace detail
 	template<length_t L, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, uint, Q> usubBorrow(vec<L, uint, Q> const& x, vec<L, uint, Q> const& y, vec<L, uint, Q>& Borrow)
 	{
-		Borrow = mix(vec<L, uint, Q>(1), vec<L, uint, Q>(0), greaterThanEqual(x, y));
-		vec<L, uint, Q> const XgeY(x - y);
-		vec<L, uint, Q> const YgX(vec<L, uint, Q>((static_cast<detail::int64>(1) << static_cast<detail::int64>(32)) + (vec<L, detail::int64, Q>(x) - vec<L, detail::int64, Q>(y))));
-		return mix(YgX, XgeY, greaterThanEqual(x, y));
+		return detail::compute_usubBorrow<L, Q, detail::is_aligned<Q>::value>::call(x, y, Borrow);
 	}
 
 	// umulExtended
@@ -211,9 +286,7 @@ namespace detail
 	template<length_t L, qualifier Q>
 	GLM_FUNC_QUALIFIER void umulExtended(vec<L, uint, Q> const& x, vec<L, uint, Q> const& y, vec<L, uint, Q>& msb, vec<L, uint, Q>& lsb)
 	{
-		vec<L, detail::uint64, Q> Value64(vec<L, detail::uint64, Q>(x) * vec<L, detail::uint64, Q>(y));
-		msb = vec<L, uint, Q>(Value64 >> static_cast<detail::uint64>(32));
-		lsb = vec<L, uint, Q>(Value64);
+		detail::compute_mulExtended<L, uint, Q, detail::is_aligned<Q>::value>::call(x, y, msb, lsb);
 	}
 
 	// imulExtended
@@ -227,9 +300,7 @@ namespace detail
 	template<length_t L, qualifier Q>
 	GLM_FUNC_QUALIFIER void imulExtended(vec<L, int, Q> const& x, vec<L, int, Q> const& y, vec<L, int, Q>& msb, vec<L, int, Q>& lsb)
 	{
-		vec<L, detail::int64, Q> Value64(vec<L, detail::int64, Q>(x) * vec<L, detail::int64, Q>(y));
-		lsb = vec<L, int, Q>(Value64 & static_cast<detail::int64>(0xFFFFFFFF));
-		msb = vec<L, int, Q>((Value64 >> static_cast<detail::int64>(32)) & static_cast<detail::int64>(0xFFFFFFFF));
+		detail::compute_mulExtended<L, int, Q, detail::is_aligned<Q>::value>::call(x, y, msb, lsb);
 	}
 
 	// bitfieldExtract
@@ -312,23 +383,7 @@ namespace detail
 	{
 		static_assert(std::numeric_limits<T>::is_integer, "'bitCount' only accept integer values");
 
-#		if GLM_COMPILER & GLM_COMPILER_VC
-#			pragma warning(push)
-#			pragma warning(disable : 4310) //cast truncates constant value
-#		endif
-
-		vec<L, typename std::make_unsigned<T>::type, Q> x(v);
-		x = detail::compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>=  2>::call(x, typename std::make_unsigned<T>::type(0x5555555555555555ull), typename std::make_unsigned<T>::type( 1));
-		x = detail::compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>=  4>::call(x, typename std::make_unsigned<T>::type(0x3333333333333333ull), typename std::make_unsigned<T>::type( 2));
-		x = detail::compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>=  8>::call(x, typename std::make_unsigned<T>::type(0x0F0F0F0F0F0F0F0Full), typename std::make_unsigned<T>::type( 4));
-		x = detail::compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>= 16>::call(x, typename std::make_unsigned<T>::type(0x00FF00FF00FF00FFull), typename std::make_unsigned<T>::type( 8));
-		x = detail::compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>= 32>::call(x, typename std::make_unsigned<T>::type(0x0000FFFF0000FFFFull), typename std::make_unsigned<T>::type(16));
-		x = detail::compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>= 64>::call(x, typename std::make_unsigned<T>::type(0x00000000FFFFFFFFull), typename std::make_unsigned<T>::type(32));
-		return vec<L, int, Q>(x);
-
-#		if GLM_COMPILER & GLM_COMPILER_VC
-#			pragma warning(pop)
-#		endif
+		return detail::compute_bitCount<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 
 	// findLSB
@@ -345,7 +400,7 @@ namespace detail
 	{
 		static_assert(std::numeric_limits<T>::is_integer, "'findLSB' only accept integer values");
 
-		return detail::functor1<vec, L, int, T, Q>::call(findLSB, x);
+		return detail::compute_findLSB_vec<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
 	// findMSB
@@ -362,7 +417,7 @@ namespace detail
 	{
 		static_assert(std::numeric_limits<T>::is_integer, "'findMSB' only accept integer values");
 
-		return detail::compute_findMSB_vec<L, T, Q, static_cast<int>(sizeof(T) * 8)>::call(v);
+		return detail::compute_findMSB<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 }//namespace glm
 
@@ -11,18 +11,18 @@ namespace detail
 		GLM_FUNC_QUALIFIER static vec<4, uint, Q> call(vec<4, uint, Q> const& v, uint Mask, uint Shift)
 		{
 			__m128i const set0 = v.data;
+			__m128i const cnt0 = _mm_cvtsi32_si128(static_cast<int>(Shift));
 
 			__m128i const set1 = _mm_set1_epi32(static_cast<int>(Mask));
 			__m128i const and1 = _mm_and_si128(set0, set1);
-			__m128i const sft1 = _mm_slli_epi32(and1, static_cast<int>(Shift));
+			__m128i const sft1 = _mm_sll_epi32(and1, cnt0);
 
-			__m128i const set2 = _mm_andnot_si128(set0, _mm_set1_epi32(-1));
-			__m128i const and2 = _mm_and_si128(set0, set2);
-			__m128i const sft2 = _mm_srai_epi32(and2, static_cast<int>(Shift));
+			__m128i const and2 = _mm_andnot_si128(set1, set0);
+			__m128i const sft2 = _mm_srl_epi32(and2, cnt0);
 
-			__m128i const or0 = _mm_or_si128(sft1, sft2);
-
-			return or0;
+			vec<4, uint, Q> Result;
+			Result.data = _mm_or_si128(sft1, sft2);
+			return Result;
 		}
 	};
 
@@ -35,11 +35,114 @@ namespace detail
 
 			__m128i const set1 = _mm_set1_epi32(static_cast<int>(Mask));
 			__m128i const and0 = _mm_and_si128(set0, set1);
-			__m128i const sft0 = _mm_slli_epi32(set0, static_cast<int>(Shift));
+			__m128i const sft0 = _mm_srl_epi32(set0, _mm_cvtsi32_si128(static_cast<int>(Shift)));
 			__m128i const and1 = _mm_and_si128(sft0, set1);
-			__m128i const add0 = _mm_add_epi32(and0, and1);
 
-			return add0;
+			vec<4, uint, Q> Result;
+			Result.data = _mm_add_epi32(and0, and1);
+			return Result;
+		}
+	};
+
+	// findMSB, findLSB and bitCount only depend on the bit pattern, signed and unsigned lanes share the same code
+	template<typename T, qualifier Q>
+	struct compute_findMSB_simd
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, T, Q> const& v)
+		{
+			vec<4, int, Q> Result;
+			Result.data = glm_i128_findMSB(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_findMSB<4, uint, Q, true> : public compute_findMSB_simd<uint, Q>
+	{};
+
+	template<qualifier Q>
+	struct compute_findMSB<4, int, Q, true> : public compute_findMSB_simd<int, Q>
+	{};
+
+	template<typename T, qualifier Q>
+	struct compute_findLSB_simd
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, T, Q> const& v)
+		{
+			vec<4, int, Q> Result;
+			Result.data = glm_i128_findLSB(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_findLSB_vec<4, uint, Q, true> : public compute_findLSB_simd<uint, Q>
+	{};
+
+	template<qualifier Q>
+	struct compute_findLSB_vec<4, int, Q, true> : public compute_findLSB_simd<int, Q>
+	{};
+
+#	if GLM_ARCH & GLM_ARCH_SSSE3_BIT
+	template<typename T, qualifier Q>
+	struct compute_bitCount_simd
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, T, Q> const& v)
+		{
+			vec<4, int, Q> Result;
+			Result.data = glm_i128_bitCount(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_bitCount<4, uint, Q, true> : public compute_bitCount_simd<uint, Q>
+	{};
+
+	template<qualifier Q>
+	struct compute_bitCount<4, int, Q, true> : public compute_bitCount_simd<int, Q>
+	{};
+#	endif//GLM_ARCH & GLM_ARCH_SSSE3_BIT
+
+	template<qualifier Q>
+	struct compute_uaddCarry<4, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, uint, Q> call(vec<4, uint, Q> const& x, vec<4, uint, Q> const& y, vec<4, uint, Q>& Carry)
+		{
+			vec<4, uint, Q> Result;
+			Result.data = _mm_add_epi32(x.data, y.data);
+			Carry.data = _mm_srli_epi32(glm_i128_lessThan_u32(Result.data, x.data), 31);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_usubBorrow<4, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, uint, Q> call(vec<4, uint, Q> const& x, vec<4, uint, Q> const& y, vec<4, uint, Q>& Borrow)
+		{
+			vec<4, uint, Q> Result;
+			Result.data = _mm_sub_epi32(x.data, y.data);
+			Borrow.data = _mm_srli_epi32(glm_i128_lessThan_u32(x.data, y.data), 31);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mulExtended<4, uint, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, uint, Q> const& x, vec<4, uint, Q> const& y, vec<4, uint, Q>& msb, vec<4, uint, Q>& lsb)
+		{
+			lsb.data = glm_i128_umulExtended(x.data, y.data, &msb.data);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mulExtended<4, int, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, int, Q> const& x, vec<4, int, Q> const& y, vec<4, int, Q>& msb, vec<4, int, Q>& lsb)
+		{
+			lsb.data = glm_i128_imulExtended(x.data, y.data, &msb.data);
 		}
 	};
 }//namespace detail
@@ -63,3 +166,96 @@ namespace detail
 }//namespace glm
 
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_NEON_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_findMSB<4, uint, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, uint, Q> const& v)
+		{
+			// Leading zero count of 32 for zero gives -1
+			vec<4, int, Q> Result;
+			Result.data = vsubq_s32(vdupq_n_s32(31), vreinterpretq_s32_u32(vclzq_u32(v.data)));
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_findLSB_vec<4, uint, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, uint, Q> const& v)
+		{
+			uint32x4_t const Low = vandq_u32(v.data, vreinterpretq_u32_s32(vnegq_s32(vreinterpretq_s32_u32(v.data))));
+			vec<4, int, Q> Result;
+			Result.data = vsubq_s32(vdupq_n_s32(31), vreinterpretq_s32_u32(vclzq_u32(Low)));
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_bitCount<4, uint, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, uint, Q> const& v)
+		{
+			uint8x16_t const Bytes = vcntq_u8(vreinterpretq_u8_u32(v.data));
+			vec<4, int, Q> Result;
+			Result.data = vreinterpretq_s32_u32(vpaddlq_u16(vpaddlq_u8(Bytes)));
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_uaddCarry<4, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, uint, Q> call(vec<4, uint, Q> const& x, vec<4, uint, Q> const& y, vec<4, uint, Q>& Carry)
+		{
+			vec<4, uint, Q> Result;
+			Result.data = vaddq_u32(x.data, y.data);
+			Carry.data = vshrq_n_u32(vcltq_u32(Result.data, x.data), 31);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_usubBorrow<4, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, uint, Q> call(vec<4, uint, Q> const& x, vec<4, uint, Q> const& y, vec<4, uint, Q>& Borrow)
+		{
+			vec<4, uint, Q> Result;
+			Result.data = vsubq_u32(x.data, y.data);
+			Borrow.data = vshrq_n_u32(vcltq_u32(x.data, y.data), 31);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mulExtended<4, uint, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, uint, Q> const& x, vec<4, uint, Q> const& y, vec<4, uint, Q>& msb, vec<4, uint, Q>& lsb)
+		{
+			uint64x2_t const Low = vmull_u32(vget_low_u32(x.data), vget_low_u32(y.data));
+			uint64x2_t const High = vmull_u32(vget_high_u32(x.data), vget_high_u32(y.data));
+			lsb.data = vcombine_u32(vmovn_u64(Low), vmovn_u64(High));
+			msb.data = vcombine_u32(vshrn_n_u64(Low, 32), vshrn_n_u64(High, 32));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mulExtended<4, int, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, int, Q> const& x, vec<4, int, Q> const& y, vec<4, int, Q>& msb, vec<4, int, Q>& lsb)
+		{
+			int64x2_t const Low = vmull_s32(vget_low_s32(x.data), vget_low_s32(y.data));
+			int64x2_t const High = vmull_s32(vget_high_s32(x.data), vget_high_s32(y.data));
+			lsb.data = vcombine_s32(vmovn_s64(Low), vmovn_s64(High));
+			msb.data = vcombine_s32(vshrn_n_s64(Low, 32), vshrn_n_s64(High, 32));
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_NEON_BIT
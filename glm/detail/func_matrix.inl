@@ -7,7 +7,7 @@ namespace detail
 	template<length_t C, length_t R, typename T, qualifier Q, bool Aligned>
 	struct compute_matrixCompMult
 	{
-		GLM_FUNC_QUALIFIER static mat<C, R, T, Q> call(mat<C, R, T, Q> const& x, mat<C, R, T, Q> const& y)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<C, R, T, Q> call(mat<C, R, T, Q> const& x, mat<C, R, T, Q> const& y)
 		{
 			mat<C, R, T, Q> Result(1);
 			for(length_t i = 0; i < Result.length(); ++i)
@@ -18,7 +18,7 @@ namespace detail
 
 	template<length_t C, length_t R, typename T, qualifier Q, bool IsFloat, bool Aligned>
 	struct compute_matrixCompMult_type {
-		GLM_FUNC_QUALIFIER static mat<C, R, T, Q> call(mat<C, R, T, Q> const& x, mat<C, R, T, Q> const& y)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<C, R, T, Q> call(mat<C, R, T, Q> const& x, mat<C, R, T, Q> const& y)
 		{
 			static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, 
 				"'matrixCompMult' only accept floating-point inputs, include <glm/ext/matrix_integer.hpp> to discard this restriction.");
@@ -28,7 +28,7 @@ namespace detail
 
 	template<length_t DA, length_t DB, typename T, qualifier Q>
 	struct compute_outerProduct {
-		GLM_FUNC_QUALIFIER static typename detail::outerProduct_trait<DA, DB, T, Q>::type call(vec<DA, T, Q> const& c, vec<DB, T, Q> const& r)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static typename detail::outerProduct_trait<DA, DB, T, Q>::type call(vec<DA, T, Q> const& c, vec<DB, T, Q> const& r)
 		{
 			typename detail::outerProduct_trait<DA, DB, T, Q>::type m(0);
 			for(length_t i = 0; i < m.length(); ++i)
@@ -39,7 +39,7 @@ namespace detail
 
 	template<length_t DA, length_t DB, typename T, qualifier Q, bool IsFloat>
 	struct compute_outerProduct_type {
-		GLM_FUNC_QUALIFIER static typename detail::outerProduct_trait<DA, DB, T, Q>::type call(vec<DA, T, Q> const& c, vec<DB, T, Q> const& r)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static typename detail::outerProduct_trait<DA, DB, T, Q>::type call(vec<DA, T, Q> const& c, vec<DB, T, Q> const& r)
 		{
 			static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE,
 				"'outerProduct' only accept floating-point inputs, include <glm/ext/matrix_integer.hpp> to discard this restriction.");
@@ -54,7 +54,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<2, 2, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<2, 2, T, Q> call(mat<2, 2, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<2, 2, T, Q> call(mat<2, 2, T, Q> const& m)
 		{
 			mat<2, 2, T, Q> Result(1);
 			Result[0][0] = m[0][0];
@@ -68,7 +68,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<2, 3, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<3, 2, T, Q> call(mat<2, 3, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<3, 2, T, Q> call(mat<2, 3, T, Q> const& m)
 		{
 			mat<3,2, T, Q> Result(1);
 			Result[0][0] = m[0][0];
@@ -84,7 +84,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<2, 4, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<4, 2, T, Q> call(mat<2, 4, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<4, 2, T, Q> call(mat<2, 4, T, Q> const& m)
 		{
 			mat<4, 2, T, Q> Result(1);
 			Result[0][0] = m[0][0];
@@ -102,7 +102,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<3, 2, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<2, 3, T, Q> call(mat<3, 2, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<2, 3, T, Q> call(mat<3, 2, T, Q> const& m)
 		{
 			mat<2, 3, T, Q> Result(1);
 			Result[0][0] = m[0][0];
@@ -118,7 +118,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<3, 3, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<3, 3, T, Q> call(mat<3, 3, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<3, 3, T, Q> call(mat<3, 3, T, Q> const& m)
 		{
 			mat<3, 3, T, Q> Result(1);
 			Result[0][0] = m[0][0];
@@ -139,7 +139,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<3, 4, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<4, 3, T, Q> call(mat<3, 4, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<4, 3, T, Q> call(mat<3, 4, T, Q> const& m)
 		{
 			mat<4, 3, T, Q> Result(1);
 			Result[0][0] = m[0][0];
@@ -161,7 +161,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<4, 2, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<2, 4, T, Q> call(mat<4, 2, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<2, 4, T, Q> call(mat<4, 2, T, Q> const& m)
 		{
 			mat<2, 4, T, Q> Result(1);
 			Result[0][0] = m[0][0];
@@ -179,7 +179,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<4, 3, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<3, 4, T, Q> call(mat<4, 3, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<3, 4, T, Q> call(mat<4, 3, T, Q> const& m)
 		{
 			mat<3, 4, T, Q> Result(1);
 			Result[0][0] = m[0][0];
@@ -201,7 +201,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<4, 4, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<4, 4, T, Q> call(mat<4, 4, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<4, 4, T, Q> call(mat<4, 4, T, Q> const& m)
 		{
 			mat<4, 4, T, Q> Result(1);
 			Result[0][0] = m[0][0];
@@ -229,7 +229,7 @@ namespace detail
 
 	template<length_t C, length_t R, typename T, qualifier Q, bool IsFloat, bool Aligned>
 	struct compute_transpose_type {
-		GLM_FUNC_QUALIFIER static mat<R, C, T, Q> call(mat<C, R, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<R, C, T, Q> call(mat<C, R, T, Q> const& m)
 		{
 			static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, 
 				"'transpose' only accept floating-point inputs, include <glm/ext/matrix_integer.hpp> to discard this restriction.");
@@ -243,7 +243,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_determinant<2, 2, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static T call(mat<2, 2, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static T call(mat<2, 2, T, Q> const& m)
 		{
 			return m[0][0] * m[1][1] - m[1][0] * m[0][1];
 		}
@@ -252,7 +252,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_determinant<3, 3, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static T call(mat<3, 3, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static T call(mat<3, 3, T, Q> const& m)
 		{
 			return
 				+ m[0][0] * (m[1][1] * m[2][2] - m[2][1] * m[1][2])
@@ -264,7 +264,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_determinant<4, 4, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static T call(mat<4, 4, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static T call(mat<4, 4, T, Q> const& m)
 		{
 			T SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
 			T SubFactor01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
@@ -288,7 +288,7 @@ namespace detail
 	template<length_t C, length_t R, typename T, qualifier Q, bool IsFloat, bool Aligned>
 	struct compute_determinant_type{
 	
-		GLM_FUNC_QUALIFIER static T call(mat<C, R, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static T call(mat<C, R, T, Q> const& m)
 		{
 			static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, 
 				"'determinant' only accept floating-point inputs, include <glm/ext/matrix_integer.hpp> to discard this restriction.");
@@ -302,7 +302,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_inverse<2, 2, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<2, 2, T, Q> call(mat<2, 2, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<2, 2, T, Q> call(mat<2, 2, T, Q> const& m)
 		{
 			T OneOverDeterminant = static_cast<T>(1) / (
 				+ m[0][0] * m[1][1]
@@ -324,7 +324,7 @@ namespace detail
 	template<typename T, qualifier Q>
 	struct inv3x3<T, Q, true>
 	{
-		GLM_FUNC_QUALIFIER static mat<3, 3, T, Q> call(mat<3, 3, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<3, 3, T, Q> call(mat<3, 3, T, Q> const& m)
 		{
 			// see: https://www.onlinemathstutor.org/post/3x3_inverses
 
@@ -352,14 +352,14 @@ namespace detail
 	template<typename T, qualifier Q>
 	struct inv3x3<T, Q, false>
 	{
-		GLM_FUNC_QUALIFIER static mat<3, 3, T, Q> call(mat<3, 3, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<3, 3, T, Q> call(mat<3, 3, T, Q> const& m)
 		{
 			T OneOverDeterminant = static_cast<T>(1) / (
 				+m[0][0] * (m[1][1] * m[2][2] - m[2][1] * m[1][2])
 				- m[1][0] * (m[0][1] * m[2][2] - m[2][1] * m[0][2])
 				+ m[2][0] * (m[0][1] * m[1][2] - m[1][1] * m[0][2]));
 
-			mat<3, 3, T, Q> Inverse;
+			mat<3, 3, T, Q> Inverse(static_cast<T>(0));
 			Inverse[0][0] = +(m[1][1] * m[2][2] - m[2][1] * m[1][2]);
 			Inverse[1][0] = -(m[1][0] * m[2][2] - m[2][0] * m[1][2]);
 			Inverse[2][0] = +(m[1][0] * m[2][1] - m[2][0] * m[1][1]);
@@ -378,7 +378,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_inverse<3, 3, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<3, 3, T, Q> call(mat<3, 3, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<3, 3, T, Q> call(mat<3, 3, T, Q> const& m)
 		{
 			return detail::inv3x3<T, Q, detail::is_aligned<Q>::value>::call(m);
 		}
@@ -387,7 +387,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_inverse<4, 4, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<4, 4, T, Q> call(mat<4, 4, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<4, 4, T, Q> call(mat<4, 4, T, Q> const& m)
 		{
 			T Coef00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
 			T Coef02 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
@@ -447,31 +447,31 @@ namespace detail
 }//namespace detail
 
 	template<length_t C, length_t R, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER mat<C, R, T, Q> matrixCompMult(mat<C, R, T, Q> const& x, mat<C, R, T, Q> const& y)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<C, R, T, Q> matrixCompMult(mat<C, R, T, Q> const& x, mat<C, R, T, Q> const& y)
 	{
 		return detail::compute_matrixCompMult_type<C, R, T, Q, std::numeric_limits<T>::is_iec559, detail::is_aligned<Q>::value>::call(x, y);
 	}
 
 	template<length_t DA, length_t DB, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER typename detail::outerProduct_trait<DA, DB, T, Q>::type outerProduct(vec<DA, T, Q> const& c, vec<DB, T, Q> const& r)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR typename detail::outerProduct_trait<DA, DB, T, Q>::type outerProduct(vec<DA, T, Q> const& c, vec<DB, T, Q> const& r)
 	{
 		return detail::compute_outerProduct_type<DA, DB, T, Q, std::numeric_limits<T>::is_iec559>::call(c, r);
 	}
 
 	template<length_t C, length_t R, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER typename mat<C, R, T, Q>::transpose_type transpose(mat<C, R, T, Q> const& m)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR typename mat<C, R, T, Q>::transpose_type transpose(mat<C, R, T, Q> const& m)
 	{
 		return detail::compute_transpose_type<C, R, T, Q, std::numeric_limits<T>::is_iec559, detail::is_aligned<Q>::value>::call(m);
 	}
 
 	template<length_t C, length_t R, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER T determinant(mat<C, R, T, Q> const& m)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T determinant(mat<C, R, T, Q> const& m)
 	{
 		return detail::compute_determinant_type<C, R, T, Q, std::numeric_limits<T>::is_iec559, detail::is_aligned<Q>::value>::call(m);
 	}
 
 	template<length_t C, length_t R, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER mat<C, R, T, Q> inverse(mat<C, R, T, Q> const& m)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<C, R, T, Q> inverse(mat<C, R, T, Q> const& m)
 	{
 		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'inverse' only accept floating-point inputs");
 		return detail::compute_inverse<C, R, T, Q, detail::is_aligned<Q>::value>::call(m);
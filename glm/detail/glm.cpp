@@ -1,6 +1,9 @@
 /// @ref core
 /// @file glm/glm.cpp
 
+// Defines the instantiations declared by GLM_FORCE_EXTERN_TEMPLATE, GCC doesn't emit members used before an explicit instantiation definition
+#undef GLM_FORCE_EXTERN_TEMPLATE
+
 #ifndef GLM_ENABLE_EXPERIMENTAL
 #define GLM_ENABLE_EXPERIMENTAL
 #endif
@@ -260,5 +263,48 @@ template struct tdualquat<float64, mediump>;
 template struct tdualquat<float32, highp>;
 template struct tdualquat<float64, highp>;
 
+// Default aligned types declared by GLM_FORCE_EXTERN_TEMPLATE
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE && defined(GLM_FORCE_DEFAULT_ALIGNED_GENTYPES)
+template struct vec<2, float32, defaultp>;
+template struct vec<3, float32, defaultp>;
+template struct vec<4, float32, defaultp>;
+template struct vec<2, float64, defaultp>;
+template struct vec<3, float64, defaultp>;
+template struct vec<4, float64, defaultp>;
+template struct vec<2, int32, defaultp>;
+template struct vec<3, int32, defaultp>;
+template struct vec<4, int32, defaultp>;
+template struct vec<2, uint32, defaultp>;
+template struct vec<3, uint32, defaultp>;
+template struct vec<4, uint32, defaultp>;
+
+template struct mat<2, 2, float32, defaultp>;
+template struct mat<2, 3, float32, defaultp>;
+template struct mat<2, 4, float32, defaultp>;
+template struct mat<3, 2, float32, defaultp>;
+template struct mat<3, 3, float32, defaultp>;
+template struct mat<3, 4, float32, defaultp>;
+template struct mat<4, 2, float32, defaultp>;
+template struct mat<4, 3, float32, defaultp>;
+template struct mat<4, 4, float32, defaultp>;
+template struct mat<2, 2, float64, defaultp>;
+template struct mat<2, 3, float64, defaultp>;
+template struct mat<2, 4, float64, defaultp>;
+template struct mat<3, 2, float64, defaultp>;
+template struct mat<3, 3, float64, defaultp>;
+template struct mat<3, 4, float64, defaultp>;
+template struct mat<4, 2, float64, defaultp>;
+template struct mat<4, 3, float64, defaultp>;
+template struct mat<4, 4, float64, defaultp>;
+
+template struct qua<float32, defaultp>;
+template struct qua<float64, defaultp>;
+#endif
+
 }//namespace glm
 
+// Core functions declared by GLM_FORCE_EXTERN_TEMPLATE
+#define GLM_EXTERN_TEMPLATE template
+#include "glm_extern.inl"
+#undef GLM_EXTERN_TEMPLATE
+
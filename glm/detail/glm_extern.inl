@@ -0,0 +1,111 @@
+/// @ref core
+/// @file glm/detail/glm_extern.inl
+///
+/// Explicit instantiations of the core functions for the common float, double, int and uint types.
+/// Included by glm.hpp with GLM_EXTERN_TEMPLATE defined to 'extern template' when GLM_FORCE_EXTERN_TEMPLATE is defined
+/// and by glm.cpp with GLM_EXTERN_TEMPLATE defined to 'template' to build the definitions in the glm library.
+
+#define GLM_EXTERN_TEMPLATE_VEC_ARITHMETIC(L, T) \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> operator-(vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> operator+(vec<L, T, defaultp> const&, vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> operator+(vec<L, T, defaultp> const&, T); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> operator-(vec<L, T, defaultp> const&, vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> operator-(vec<L, T, defaultp> const&, T); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> operator*(vec<L, T, defaultp> const&, vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> operator*(vec<L, T, defaultp> const&, T); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> operator*(T, vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> operator/(vec<L, T, defaultp> const&, vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> operator/(vec<L, T, defaultp> const&, T); \
+	GLM_EXTERN_TEMPLATE bool operator==(vec<L, T, defaultp> const&, vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE bool operator!=(vec<L, T, defaultp> const&, vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> abs(vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> min(vec<L, T, defaultp> const&, vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> min(vec<L, T, defaultp> const&, T); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> max(vec<L, T, defaultp> const&, vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> max(vec<L, T, defaultp> const&, T); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> clamp(vec<L, T, defaultp> const&, vec<L, T, defaultp> const&, vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> clamp(vec<L, T, defaultp> const&, T, T);
+
+#define GLM_EXTERN_TEMPLATE_VEC_FLOAT(L, T) \
+	GLM_EXTERN_TEMPLATE_VEC_ARITHMETIC(L, T) \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> floor(vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> ceil(vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> fract(vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> mix(vec<L, T, defaultp> const&, vec<L, T, defaultp> const&, T); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> sqrt(vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> inversesqrt(vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> pow(vec<L, T, defaultp> const&, vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> exp(vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> log(vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> radians(vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> degrees(vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> sin(vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> cos(vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE T length(vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE T distance(vec<L, T, defaultp> const&, vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE T dot(vec<L, T, defaultp> const&, vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> normalize(vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> faceforward(vec<L, T, defaultp> const&, vec<L, T, defaultp> const&, vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> reflect(vec<L, T, defaultp> const&, vec<L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<L, T, defaultp> refract(vec<L, T, defaultp> const&, vec<L, T, defaultp> const&, T);
+
+#define GLM_EXTERN_TEMPLATE_MAT(C, R, T) \
+	GLM_EXTERN_TEMPLATE mat<C, R, T, defaultp> operator-(mat<C, R, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE mat<C, R, T, defaultp> operator+(mat<C, R, T, defaultp> const&, mat<C, R, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE mat<C, R, T, defaultp> operator-(mat<C, R, T, defaultp> const&, mat<C, R, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE mat<C, R, T, defaultp> operator*(mat<C, R, T, defaultp> const&, T); \
+	GLM_EXTERN_TEMPLATE vec<R, T, defaultp> operator*(mat<C, R, T, defaultp> const&, vec<C, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE vec<C, T, defaultp> operator*(vec<R, T, defaultp> const&, mat<C, R, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE bool operator==(mat<C, R, T, defaultp> const&, mat<C, R, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE bool operator!=(mat<C, R, T, defaultp> const&, mat<C, R, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE mat<C, R, T, defaultp> matrixCompMult(mat<C, R, T, defaultp> const&, mat<C, R, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE mat<R, C, T, defaultp> transpose(mat<C, R, T, defaultp> const&);
+
+#define GLM_EXTERN_TEMPLATE_MAT_SQUARE(L, T) \
+	GLM_EXTERN_TEMPLATE_MAT(L, L, T) \
+	GLM_EXTERN_TEMPLATE mat<L, L, T, defaultp> operator*(mat<L, L, T, defaultp> const&, mat<L, L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE T determinant(mat<L, L, T, defaultp> const&); \
+	GLM_EXTERN_TEMPLATE mat<L, L, T, defaultp> inverse(mat<L, L, T, defaultp> const&);
+
+namespace glm
+{
+	GLM_EXTERN_TEMPLATE_VEC_FLOAT(2, float)
+	GLM_EXTERN_TEMPLATE_VEC_FLOAT(3, float)
+	GLM_EXTERN_TEMPLATE_VEC_FLOAT(4, float)
+	GLM_EXTERN_TEMPLATE_VEC_FLOAT(2, double)
+	GLM_EXTERN_TEMPLATE_VEC_FLOAT(3, double)
+	GLM_EXTERN_TEMPLATE_VEC_FLOAT(4, double)
+	GLM_EXTERN_TEMPLATE_VEC_ARITHMETIC(2, int)
+	GLM_EXTERN_TEMPLATE_VEC_ARITHMETIC(3, int)
+	GLM_EXTERN_TEMPLATE_VEC_ARITHMETIC(4, int)
+	GLM_EXTERN_TEMPLATE_VEC_ARITHMETIC(2, uint)
+	GLM_EXTERN_TEMPLATE_VEC_ARITHMETIC(3, uint)
+	GLM_EXTERN_TEMPLATE_VEC_ARITHMETIC(4, uint)
+
+	GLM_EXTERN_TEMPLATE vec<3, float, defaultp> cross(vec<3, float, defaultp> const&, vec<3, float, defaultp> const&);
+	GLM_EXTERN_TEMPLATE vec<3, double, defaultp> cross(vec<3, double, defaultp> const&, vec<3, double, defaultp> const&);
+
+	GLM_EXTERN_TEMPLATE_MAT_SQUARE(2, float)
+	GLM_EXTERN_TEMPLATE_MAT_SQUARE(3, float)
+	GLM_EXTERN_TEMPLATE_MAT_SQUARE(4, float)
+	GLM_EXTERN_TEMPLATE_MAT(2, 3, float)
+	GLM_EXTERN_TEMPLATE_MAT(2, 4, float)
+	GLM_EXTERN_TEMPLATE_MAT(3, 2, float)
+	GLM_EXTERN_TEMPLATE_MAT(3, 4, float)
+	GLM_EXTERN_TEMPLATE_MAT(4, 2, float)
+	GLM_EXTERN_TEMPLATE_MAT(4, 3, float)
+	GLM_EXTERN_TEMPLATE_MAT_SQUARE(2, double)
+	GLM_EXTERN_TEMPLATE_MAT_SQUARE(3, double)
+	GLM_EXTERN_TEMPLATE_MAT_SQUARE(4, double)
+	GLM_EXTERN_TEMPLATE_MAT(2, 3, double)
+	GLM_EXTERN_TEMPLATE_MAT(2, 4, double)
+	GLM_EXTERN_TEMPLATE_MAT(3, 2, double)
+	GLM_EXTERN_TEMPLATE_MAT(3, 4, double)
+	GLM_EXTERN_TEMPLATE_MAT(4, 2, double)
+	GLM_EXTERN_TEMPLATE_MAT(4, 3, double)
+}//namespace glm
+
+#undef GLM_EXTERN_TEMPLATE_VEC_ARITHMETIC
+#undef GLM_EXTERN_TEMPLATE_VEC_FLOAT
+#undef GLM_EXTERN_TEMPLATE_MAT
+#undef GLM_EXTERN_TEMPLATE_MAT_SQUARE
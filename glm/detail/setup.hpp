@@ -131,9 +131,17 @@
 ///////////////////////////////////////////////////////////////////////////////////
 // Has of C++ features
 
+// P0595 std::is_constant_evaluated http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2018/p0595r2.html
+#if (GLM_LANG & GLM_LANG_CXX20_FLAG) && defined(__cpp_lib_is_constant_evaluated)
+#	define GLM_HAS_CONSTANT_EVALUATED 1
+#else
+#	define GLM_HAS_CONSTANT_EVALUATED 0
+#endif
+
 // N2235 Generalized Constant Expressions http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2007/n2235.pdf
 // N3652 Extended Constant Expressions http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2013/n3652.html
-#if (GLM_ARCH & GLM_ARCH_SIMD_BIT) // Compiler SIMD intrinsics don't support constexpr...
+// Compiler SIMD intrinsics don't support constexpr, the constant evaluations use the scalar code when it can be detected
+#if (GLM_ARCH & GLM_ARCH_SIMD_BIT) && !GLM_HAS_CONSTANT_EVALUATED
 #	define GLM_HAS_CONSTEXPR 0
 #else
 #	define GLM_HAS_CONSTEXPR 1
@@ -154,6 +162,13 @@
 #	define GLM_HAS_BITSCAN_WINDOWS 0
 #endif
 
+// CPUID and the per function target instruction sets used by the runtime dispatch of GLM_EXT_cpu_dispatch
+#if (GLM_ARCH & GLM_ARCH_X86_BIT) && (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG | GLM_COMPILER_VC))
+#	define GLM_HAS_CPUID 1
+#else
+#	define GLM_HAS_CPUID 0
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////////
 // OpenMP
 #ifdef _OPENMP
@@ -453,6 +468,24 @@ namespace detail
 #	define GLM_CONFIG_XYZW_ONLY GLM_DISABLE
 #endif
 
+///////////////////////////////////////////////////////////////////////////////////
+// Declare the common types and functions as explicitly instantiated in the glm library
+
+#ifdef GLM_FORCE_EXTERN_TEMPLATE
+#	define GLM_CONFIG_EXTERN_TEMPLATE GLM_ENABLE
+#else
+#	define GLM_CONFIG_EXTERN_TEMPLATE GLM_DISABLE
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////
+// Select the batch kernels at runtime from the instruction sets of the host CPU
+
+#if defined(GLM_FORCE_CPU_DISPATCH) && GLM_HAS_CPUID
+#	define GLM_CONFIG_CPU_DISPATCH GLM_ENABLE
+#else
+#	define GLM_CONFIG_CPU_DISPATCH GLM_DISABLE
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////////
 // Use SIMD instruction sets
 
@@ -718,6 +751,16 @@ namespace detail
 	// Report whether only xyzw component are used
 #	if defined GLM_FORCE_XYZW_ONLY
 #		pragma message("GLM: GLM_FORCE_XYZW_ONLY is defined. Only x, y, z and w component are available in vector type. This define disables swizzle operators and SIMD instruction sets.")
+#	endif
+
+	// Report explicit instantiation declarations
+#	if GLM_CONFIG_EXTERN_TEMPLATE == GLM_ENABLE
+#		pragma message("GLM: GLM_FORCE_EXTERN_TEMPLATE is defined. Common types and functions are instantiated by the glm library.")
+#	endif
+
+	// Report runtime dispatch of the batch kernels
+#	if GLM_CONFIG_CPU_DISPATCH == GLM_ENABLE
+#		pragma message("GLM: GLM_FORCE_CPU_DISPATCH is defined. Batch functions select their kernels from the instruction sets of the host CPU.")
 #	endif
 
 	// Report swizzle operator support
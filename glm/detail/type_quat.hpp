@@ -188,3 +188,11 @@ namespace glm
 #ifndef GLM_EXTERNAL_TEMPLATE
 #include "type_quat.inl"
 #endif//GLM_EXTERNAL_TEMPLATE
+
+#if GLM_CONFIG_EXTERN_TEMPLATE == GLM_ENABLE
+namespace glm
+{
+	extern template struct qua<float, defaultp>;
+	extern template struct qua<double, defaultp>;
+}//namespace glm
+#endif//GLM_CONFIG_EXTERN_TEMPLATE == GLM_ENABLE
@@ -1033,14 +1033,14 @@ namespace glm {
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_highp>::vec(const vec<4, float, packed_highp>& v)
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_highp>::vec(const vec<4, float, packed_highp>& v)
 	{
 		data = _mm_loadu_ps(reinterpret_cast<const float*>(&v));
 	}
 		
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, packed_highp>::vec(const vec<4, float, aligned_highp>& v)
+	GLM_FUNC_QUALIFIER vec<4, float, packed_highp>::vec(const vec<4, float, aligned_highp>& v)
 	{
 		_mm_storeu_ps(reinterpret_cast<float*>(this), v.data);
 	}
@@ -1054,21 +1054,21 @@ namespace glm {
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, int, aligned_highp>::vec(const vec<4, int, packed_highp>& v)
+	GLM_FUNC_QUALIFIER vec<4, int, aligned_highp>::vec(const vec<4, int, packed_highp>& v)
 	{
 		data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&v));
 	}
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, int, packed_highp>::vec(const vec<4, int, aligned_highp>& v)
+	GLM_FUNC_QUALIFIER vec<4, int, packed_highp>::vec(const vec<4, int, aligned_highp>& v)
 	{
 		_mm_storeu_si128(reinterpret_cast<__m128i*>(this), v.data);
 	}
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, double, aligned_highp>::vec(const vec<4, double, aligned_highp>& v)
+	GLM_FUNC_QUALIFIER vec<4, double, aligned_highp>::vec(const vec<4, double, aligned_highp>& v)
 	{
 #	if (GLM_ARCH & GLM_ARCH_AVX_BIT)
 		data = v.data;
@@ -1080,7 +1080,7 @@ namespace glm {
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, double, aligned_highp>::vec(const vec<4, double, packed_highp>& v)
+	GLM_FUNC_QUALIFIER vec<4, double, aligned_highp>::vec(const vec<4, double, packed_highp>& v)
 	{
 #	if (GLM_ARCH & GLM_ARCH_AVX_BIT)
 		data = _mm256_loadu_pd(reinterpret_cast<const double*>(&v));
@@ -1092,7 +1092,7 @@ namespace glm {
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, double, packed_highp>::vec(const vec<4, double, aligned_highp>& v)
+	GLM_FUNC_QUALIFIER vec<4, double, packed_highp>::vec(const vec<4, double, aligned_highp>& v)
 	{
 #	if (GLM_ARCH & GLM_ARCH_AVX_BIT)
 		_mm256_storeu_pd(reinterpret_cast<double*>(this), v.data);
@@ -62,59 +62,327 @@ template< length_t L, typename T, qualifier Q>
 struct compute_vec_div<L, T, Q, true> : public compute_vec_div<L, T, Q, false>
 {};
 
-#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#if GLM_CONFIG_SWIZZLE == GLM_SWIZZLE_OPERATOR && (GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_NEON_BIT))
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// A swizzle is a single shuffle of the vector, loaded with 8 bytes when it may belong to a vec2
+	template<bool Wide>
+	GLM_FUNC_QUALIFIER glm_f32vec4 _swizzle_load(float const* p)
+	{
+		return Wide ? _mm_load_ps(p) : _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const*>(p)));
+	}
 
-#	if GLM_CONFIG_SWIZZLE == GLM_SWIZZLE_OPERATOR
-	template<length_t L, qualifier Q, int E0, int E1, int E2, int E3>
-	struct _swizzle_base1<L, float, Q, E0,E1,E2,E3, true> : public _swizzle_base0<float, L>
+	template<bool Wide, typename T>
+	GLM_FUNC_QUALIFIER glm_i32vec4 _swizzle_load(T const* p)
+	{
+		return Wide ? _mm_load_si128(reinterpret_cast<glm_i32vec4 const*>(p)) : _mm_loadl_epi64(reinterpret_cast<glm_i32vec4 const*>(p));
+	}
+
+	template<int Shuffle>
+	GLM_FUNC_QUALIFIER glm_f32vec4 _swizzle_shuffle(glm_f32vec4 v)
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			return _mm_permute_ps(v, Shuffle);
+#		else
+			return _mm_shuffle_ps(v, v, Shuffle);
+#		endif
+	}
+
+	template<int Shuffle>
+	GLM_FUNC_QUALIFIER glm_i32vec4 _swizzle_shuffle(glm_i32vec4 v)
 	{
-		GLM_FUNC_QUALIFIER vec<L, float, Q> operator ()()  const
+		return _mm_shuffle_epi32(v, Shuffle);
+	}
+
+	// Lane Kept of b, the other lanes of a
+	template<int Kept>
+	GLM_FUNC_QUALIFIER glm_f32vec4 _swizzle_blend(glm_f32vec4 a, glm_f32vec4 b)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE41_BIT
+			return _mm_blend_ps(a, b, 1 << Kept);
+#		else
+			glm_f32vec4 const Mask = _mm_castsi128_ps(_mm_set_epi32(Kept == 3 ? -1 : 0, Kept == 2 ? -1 : 0, Kept == 1 ? -1 : 0, Kept == 0 ? -1 : 0));
+			return _mm_or_ps(_mm_and_ps(Mask, b), _mm_andnot_ps(Mask, a));
+#		endif
+	}
+
+	template<int Kept>
+	GLM_FUNC_QUALIFIER glm_i32vec4 _swizzle_blend(glm_i32vec4 a, glm_i32vec4 b)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE41_BIT
+			return _mm_blend_epi16(a, b, 3 << (Kept * 2));
+#		else
+			glm_i32vec4 const Mask = _mm_set_epi32(Kept == 3 ? -1 : 0, Kept == 2 ? -1 : 0, Kept == 1 ? -1 : 0, Kept == 0 ? -1 : 0);
+			return _mm_or_si128(_mm_and_si128(Mask, b), _mm_andnot_si128(Mask, a));
+#		endif
+	}
+#	else
+	// A swizzle is a single permutation of the vector, loaded with 8 bytes when it may belong to a vec2
+	template<bool Wide>
+	GLM_FUNC_QUALIFIER glm_f32vec4 _swizzle_load(float const* p)
+	{
+		return Wide ? vld1q_f32(p) : vcombine_f32(vld1_f32(p), vdup_n_f32(0.0f));
+	}
+
+	template<bool Wide>
+	GLM_FUNC_QUALIFIER glm_i32vec4 _swizzle_load(int const* p)
+	{
+		return Wide ? vld1q_s32(p) : vcombine_s32(vld1_s32(p), vdup_n_s32(0));
+	}
+
+	template<bool Wide>
+	GLM_FUNC_QUALIFIER glm_u32vec4 _swizzle_load(uint const* p)
+	{
+		return Wide ? vld1q_u32(p) : vcombine_u32(vld1_u32(p), vdup_n_u32(0));
+	}
+
+	// Instruction of the permutation Shuffle: 1 for a broadcast (vdup), 2 for a rotation (vext), 3 for yxwz (vrev64),
+	// 4 for wzyx (vrev64 and vext), 5 for xxyy and 6 for zzww (vzip), 7 for xzxz and 8 for ywyw (vuzp), 0 for a table lookup
+	template<int Shuffle>
+	struct _swizzle_permutation
+	{
+		enum
 		{
-			__m128 data = *reinterpret_cast<__m128 const*>(&this->_buffer);
+			E0 = Shuffle & 3,
+			E1 = (Shuffle >> 2) & 3,
+			E2 = (Shuffle >> 4) & 3,
+			E3 = (Shuffle >> 6) & 3,
+			Kind =
+				E0 == E1 && E1 == E2 && E2 == E3 ? 1 :
+				E1 == ((E0 + 1) & 3) && E2 == ((E0 + 2) & 3) && E3 == ((E0 + 3) & 3) ? 2 :
+				Shuffle == 0xB1 ? 3 :
+				Shuffle == 0x1B ? 4 :
+				Shuffle == 0x50 ? 5 :
+				Shuffle == 0xFA ? 6 :
+				Shuffle == 0x88 ? 7 :
+				Shuffle == 0xDD ? 8 : 0
+		};
+	};
 
-			vec<L, float, Q> Result;
-#			if GLM_ARCH & GLM_ARCH_AVX_BIT
-				Result.data = _mm_permute_ps(data, _MM_SHUFFLE(E3, E2, E1, E0));
+	// Indices of the four bytes of Lane
+	GLM_FUNC_QUALIFIER uint64 _swizzle_bytes(int Lane)
+	{
+		return static_cast<uint64>(0x03020100u + 0x04040404u * static_cast<unsigned int>(Lane));
+	}
+
+	template<int Shuffle, int Kind = _swizzle_permutation<Shuffle>::Kind>
+	struct _swizzle_permute
+	{
+		GLM_FUNC_QUALIFIER static uint32x4_t call(uint32x4_t v)
+		{
+			uint8x8_t const Low = vcreate_u8(_swizzle_bytes(Shuffle & 3) | (_swizzle_bytes((Shuffle >> 2) & 3) << 32));
+			uint8x8_t const High = vcreate_u8(_swizzle_bytes((Shuffle >> 4) & 3) | (_swizzle_bytes((Shuffle >> 6) & 3) << 32));
+#			if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+				return vreinterpretq_u32_u8(vqtbl1q_u8(vreinterpretq_u8_u32(v), vcombine_u8(Low, High)));
 #			else
-				Result.data = _mm_shuffle_ps(data, data, _MM_SHUFFLE(E3, E2, E1, E0));
+				uint8x8x2_t const Table = {{vget_low_u8(vreinterpretq_u8_u32(v)), vget_high_u8(vreinterpretq_u8_u32(v))}};
+				return vreinterpretq_u32_u8(vcombine_u8(vtbl2_u8(Table, Low), vtbl2_u8(Table, High)));
 #			endif
-			return Result;
 		}
 	};
 
-	template<qualifier Q, int E0, int E1, int E2, int E3>
-	struct _swizzle_base1<2, float, Q, E0, E1, E2, E3, true> : public _swizzle_base1<2, float, Q, E0, E1, E2, E3, false> {};
+	template<int Shuffle>
+	struct _swizzle_permute<Shuffle, 1>
+	{
+		GLM_FUNC_QUALIFIER static uint32x4_t call(uint32x4_t v)
+		{
+#			if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+				return vdupq_laneq_u32(v, Shuffle & 3);
+#			else
+				return vdupq_n_u32(vgetq_lane_u32(v, Shuffle & 3));
+#			endif
+		}
+	};
 
-	template<qualifier Q, int E0, int E1, int E2, int E3>
-	struct _swizzle_base1<2, int, Q, E0, E1, E2, E3, true> : public _swizzle_base1<2, int, Q, E0, E1, E2, E3, false> {};
+	template<int Shuffle>
+	struct _swizzle_permute<Shuffle, 2>
+	{
+		GLM_FUNC_QUALIFIER static uint32x4_t call(uint32x4_t v)
+		{
+			return vextq_u32(v, v, Shuffle & 3);
+		}
+	};
 
-	template<length_t L, qualifier Q, int E0, int E1, int E2, int E3>
-	struct _swizzle_base1<L, int, Q, E0,E1,E2,E3, true> : public _swizzle_base0<int, L>
+	template<int Shuffle>
+	struct _swizzle_permute<Shuffle, 3>
 	{
-		GLM_FUNC_QUALIFIER vec<L, int, Q> operator ()()  const
+		GLM_FUNC_QUALIFIER static uint32x4_t call(uint32x4_t v)
 		{
-			__m128i data = *reinterpret_cast<__m128i const*>(&this->_buffer);
+			return vrev64q_u32(v);
+		}
+	};
 
-			vec<L, int, Q> Result;
-			Result.data = _mm_shuffle_epi32(data, _MM_SHUFFLE(E3, E2, E1, E0));
-			return Result;
+	template<int Shuffle>
+	struct _swizzle_permute<Shuffle, 4>
+	{
+		GLM_FUNC_QUALIFIER static uint32x4_t call(uint32x4_t v)
+		{
+			uint32x4_t const Reversed = vrev64q_u32(v);
+			return vextq_u32(Reversed, Reversed, 2);
 		}
 	};
 
-	template<length_t L, qualifier Q, int E0, int E1, int E2, int E3>
-	struct _swizzle_base1<L, uint, Q, E0,E1,E2,E3, true> : public _swizzle_base0<uint, L>
+	template<int Shuffle>
+	struct _swizzle_permute<Shuffle, 5>
 	{
-		GLM_FUNC_QUALIFIER vec<L, uint, Q> operator ()()  const
+		GLM_FUNC_QUALIFIER static uint32x4_t call(uint32x4_t v)
 		{
-			__m128i data = *reinterpret_cast<__m128i const*>(&this->_buffer);
+#			if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+				return vzip1q_u32(v, v);
+#			else
+				return vzipq_u32(v, v).val[0];
+#			endif
+		}
+	};
 
-			vec<L, uint, Q> Result;
-			Result.data = _mm_shuffle_epi32(data, _MM_SHUFFLE(E3, E2, E1, E0));
+	template<int Shuffle>
+	struct _swizzle_permute<Shuffle, 6>
+	{
+		GLM_FUNC_QUALIFIER static uint32x4_t call(uint32x4_t v)
+		{
+#			if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+				return vzip2q_u32(v, v);
+#			else
+				return vzipq_u32(v, v).val[1];
+#			endif
+		}
+	};
+
+	template<int Shuffle>
+	struct _swizzle_permute<Shuffle, 7>
+	{
+		GLM_FUNC_QUALIFIER static uint32x4_t call(uint32x4_t v)
+		{
+#			if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+				return vuzp1q_u32(v, v);
+#			else
+				return vuzpq_u32(v, v).val[0];
+#			endif
+		}
+	};
+
+	template<int Shuffle>
+	struct _swizzle_permute<Shuffle, 8>
+	{
+		GLM_FUNC_QUALIFIER static uint32x4_t call(uint32x4_t v)
+		{
+#			if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+				return vuzp2q_u32(v, v);
+#			else
+				return vuzpq_u32(v, v).val[1];
+#			endif
+		}
+	};
+
+	template<int Shuffle>
+	GLM_FUNC_QUALIFIER glm_f32vec4 _swizzle_shuffle(glm_f32vec4 v)
+	{
+		return vreinterpretq_f32_u32(_swizzle_permute<Shuffle>::call(vreinterpretq_u32_f32(v)));
+	}
+
+	template<int Shuffle>
+	GLM_FUNC_QUALIFIER glm_i32vec4 _swizzle_shuffle(glm_i32vec4 v)
+	{
+		return vreinterpretq_s32_u32(_swizzle_permute<Shuffle>::call(vreinterpretq_u32_s32(v)));
+	}
+
+	template<int Shuffle>
+	GLM_FUNC_QUALIFIER glm_u32vec4 _swizzle_shuffle(glm_u32vec4 v)
+	{
+		return _swizzle_permute<Shuffle>::call(v);
+	}
+
+	// Lane Kept of b, the other lanes of a
+	template<int Kept>
+	GLM_FUNC_QUALIFIER glm_f32vec4 _swizzle_blend(glm_f32vec4 a, glm_f32vec4 b)
+	{
+		return vsetq_lane_f32(vgetq_lane_f32(b, Kept), a, Kept);
+	}
+
+	template<int Kept>
+	GLM_FUNC_QUALIFIER glm_i32vec4 _swizzle_blend(glm_i32vec4 a, glm_i32vec4 b)
+	{
+		return vsetq_lane_s32(vgetq_lane_s32(b, Kept), a, Kept);
+	}
+
+	template<int Kept>
+	GLM_FUNC_QUALIFIER glm_u32vec4 _swizzle_blend(glm_u32vec4 a, glm_u32vec4 b)
+	{
+		return vsetq_lane_u32(vgetq_lane_u32(b, Kept), a, Kept);
+	}
+#	endif
+
+	template<length_t L, typename T, qualifier Q, int E0, int E1, int E2, int E3>
+	struct _swizzle_base1_simd : public _swizzle_base0<T, L>
+	{
+		GLM_FUNC_QUALIFIER vec<L, T, Q> operator ()()  const
+		{
+			typedef _swizzle_lanes<L, E0, E1, E2, E3> lanes;
+
+			vec<L, T, Q> Result;
+			Result.data = _swizzle_shuffle<lanes::Shuffle>(_swizzle_load<lanes::Wide>(reinterpret_cast<T const*>(this->_buffer)));
 			return Result;
 		}
 	};
-#	endif// GLM_CONFIG_SWIZZLE == GLM_SWIZZLE_OPERATOR
 
+	template<length_t L, qualifier Q, int E0, int E1, int E2, int E3>
+	struct _swizzle_base1<L, float, Q, E0,E1,E2,E3, true> : public _swizzle_base1_simd<L, float, Q, E0,E1,E2,E3> {};
+
+	template<length_t L, qualifier Q, int E0, int E1, int E2, int E3>
+	struct _swizzle_base1<L, int, Q, E0,E1,E2,E3, true> : public _swizzle_base1_simd<L, int, Q, E0,E1,E2,E3> {};
+
+	template<length_t L, qualifier Q, int E0, int E1, int E2, int E3>
+	struct _swizzle_base1<L, uint, Q, E0,E1,E2,E3, true> : public _swizzle_base1_simd<L, uint, Q, E0,E1,E2,E3> {};
+
+	// An aligned vec2 is not stored in a SIMD register
+	template<qualifier Q, int E0, int E1, int E2, int E3>
+	struct _swizzle_base1<2, float, Q, E0, E1, E2, E3, true> : public _swizzle_base1<2, float, Q, E0, E1, E2, E3, false> {};
+
+	template<qualifier Q, int E0, int E1, int E2, int E3>
+	struct _swizzle_base1<2, int, Q, E0, E1, E2, E3, true> : public _swizzle_base1<2, int, Q, E0, E1, E2, E3, false> {};
+
+	template<qualifier Q, int E0, int E1, int E2, int E3>
+	struct _swizzle_base1<2, uint, Q, E0, E1, E2, E3, true> : public _swizzle_base1<2, uint, Q, E0, E1, E2, E3, false> {};
+
+	// The assigned vector is shuffled into the lanes of the destination, then the operator is applied to whole vectors.
+	// An assignment to three components restores the lane it doesn't write.
+	template<length_t N, typename T, qualifier Q, int E0, int E1, int E2, int E3>
+	struct _swizzle_apply_simd
+	{
+		template<typename S, typename U>
+		GLM_FUNC_QUALIFIER static void call(S& Swizzle, vec<N, T, Q> const& that, U const& op)
+		{
+			typedef _swizzle_assign_lanes<N, E0, E1, E2, E3> lanes;
+
+			vec<4, T, Q>& Dst = *reinterpret_cast<vec<4, T, Q>*>(&Swizzle);
+			vec<4, T, Q> Src;
+			Src.data = _swizzle_shuffle<lanes::Shuffle>(that.data);
+
+			if(N > 3)
+				op(Dst, Src);
+			else
+			{
+				vec<4, T, Q> Result(Dst);
+				op(Result, Src);
+				Dst.data = _swizzle_blend<lanes::Kept>(Result.data, Dst.data);
+			}
+		}
+	};
+
+	template<qualifier Q, int E0, int E1, int E2, int E3>
+	struct _swizzle_apply<4, float, Q, E0,E1,E2,E3, true> : public _swizzle_apply_simd<4, float, Q, E0,E1,E2,E3> {};
+
+	template<qualifier Q, int E0, int E1, int E2, int E3>
+	struct _swizzle_apply<4, int, Q, E0,E1,E2,E3, true> : public _swizzle_apply_simd<4, int, Q, E0,E1,E2,E3> {};
+
+	template<qualifier Q, int E0, int E1, int E2, int E3>
+	struct _swizzle_apply<4, uint, Q, E0,E1,E2,E3, true> : public _swizzle_apply_simd<4, uint, Q, E0,E1,E2,E3> {};
+
+	// A division of the unwritten lane would trap with integers, only the float assignments to three components are vectorized
+	template<qualifier Q, int E0, int E1, int E2>
+	struct _swizzle_apply<3, float, Q, E0,E1,E2,3, true> : public _swizzle_apply_simd<3, float, Q, E0,E1,E2,3> {};
+#endif// GLM_CONFIG_SWIZZLE == GLM_SWIZZLE_OPERATOR
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
 	template<length_t L, qualifier Q>
 	struct compute_vec_add<L, float, Q, true>
@@ -576,44 +844,45 @@ struct compute_vec_div<L, T, Q, true> : public compute_vec_div<L, T, Q, false>
 
 }//namespace detail
 
+// The constructors of the aligned types calling intrinsics aren't constexpr, only the packed types are used in constant expressions
 
 #define CTOR_FLOAT(L, Q)\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, float, Q>::vec(float _s) :\
+	GLM_FUNC_QUALIFIER vec<L, float, Q>::vec(float _s) :\
 	data(_mm_set1_ps(_s))\
 	{}
 
 #if GLM_ARCH & GLM_ARCH_AVX_BIT
 #	define CTOR_DOUBLE(L, Q)\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, double, Q>::vec(double _s) :\
+	GLM_FUNC_QUALIFIER vec<L, double, Q>::vec(double _s) :\
 		data(_mm256_set1_pd(_s)){}
 
 #define CTOR_DOUBLE4(L, Q)\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, double, Q>::vec(double _x, double _y, double _z, double _w):\
+	GLM_FUNC_QUALIFIER vec<L, double, Q>::vec(double _x, double _y, double _z, double _w):\
 		data(_mm256_set_pd(_w, _z, _y, _x)) {}
 
 #define CTOR_DOUBLE3(L, Q)\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, double, Q>::vec(double _x, double _y, double _z):\
+	GLM_FUNC_QUALIFIER vec<L, double, Q>::vec(double _x, double _y, double _z):\
 		data(_mm256_set_pd(_z, _z, _y, _x)) {}
 
 #	define CTOR_INT64(L, Q)\
 	template<>\
-		GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, detail::int64, Q>::vec(detail::int64 _s) :\
+		GLM_FUNC_QUALIFIER vec<L, detail::int64, Q>::vec(detail::int64 _s) :\
 		data(_mm256_set1_epi64x(_s)){}
 
 #define CTOR_DOUBLE_COPY3(L, Q)\
 	template<>\
 	template<qualifier P>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, double, Q>::vec(vec<3, double, P> const& v) :\
+	GLM_FUNC_QUALIFIER vec<3, double, Q>::vec(vec<3, double, P> const& v) :\
 		data(_mm256_setr_pd(v.x, v.y, v.z, v.z)){}
 
 #else
 #	define CTOR_DOUBLE(L, Q)\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, double, Q>::vec(double _v) \
+	GLM_FUNC_QUALIFIER vec<L, double, Q>::vec(double _v) \
 	{\
 		data.setv(0, _mm_set1_pd(_v)); \
 		data.setv(1, _mm_set1_pd(_v)); \
@@ -621,7 +890,7 @@ struct compute_vec_div<L, T, Q, true> : public compute_vec_div<L, T, Q, false>
 
 #define CTOR_DOUBLE4(L, Q)\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, double, Q>::vec(double _x, double _y, double _z, double _w)\
+	GLM_FUNC_QUALIFIER vec<L, double, Q>::vec(double _x, double _y, double _z, double _w)\
 	{\
 		data.setv(0, _mm_setr_pd(_x, _y)); \
 		data.setv(1, _mm_setr_pd(_z, _w)); \
@@ -629,7 +898,7 @@ struct compute_vec_div<L, T, Q, true> : public compute_vec_div<L, T, Q, false>
 
 #define CTOR_DOUBLE3(L, Q)\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, double, Q>::vec(double _x, double _y, double _z)\
+	GLM_FUNC_QUALIFIER vec<L, double, Q>::vec(double _x, double _y, double _z)\
 	{\
 		data.setv(0, _mm_setr_pd(_x, _y)); \
 		data.setv(1, _mm_setr_pd(_z, _z)); \
@@ -637,13 +906,13 @@ struct compute_vec_div<L, T, Q, true> : public compute_vec_div<L, T, Q, false>
 
 #	define CTOR_INT64(L, Q)\
 	template<>\
-		GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, detail::int64, Q>::vec(detail::int64 _s) :\
+		GLM_FUNC_QUALIFIER vec<L, detail::int64, Q>::vec(detail::int64 _s) :\
 		data(_mm256_set1_epi64x(_s)){}
 
 #define CTOR_DOUBLE_COPY3(L, Q)\
 	template<>\
 	template<qualifier P>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, double, Q>::vec(vec<3, double, P> const& v)\
+	GLM_FUNC_QUALIFIER vec<3, double, Q>::vec(vec<3, double, P> const& v)\
 	{\
 		data.setv(0, _mm_setr_pd(v.x, v.y));\
 		data.setv(1, _mm_setr_pd(v.z, 1.0));\
@@ -653,57 +922,57 @@ struct compute_vec_div<L, T, Q, true> : public compute_vec_div<L, T, Q, false>
 
 #define CTOR_INT(L, Q)\
 	template<>\
-		GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, int, Q>::vec(int _s) :\
+		GLM_FUNC_QUALIFIER vec<L, int, Q>::vec(int _s) :\
 		data(_mm_set1_epi32(_s))\
 		{}
 
 #define CTOR_FLOAT4(L, Q)\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, float, Q>::vec(float _x, float _y, float _z, float _w) :\
+	GLM_FUNC_QUALIFIER vec<L, float, Q>::vec(float _x, float _y, float _z, float _w) :\
 		data(_mm_set_ps(_w, _z, _y, _x))\
 		{}
 
 #define CTOR_FLOAT3(L, Q)\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, float, Q>::vec(float _x, float _y, float _z) :\
+	GLM_FUNC_QUALIFIER vec<L, float, Q>::vec(float _x, float _y, float _z) :\
 	data(_mm_set_ps(_z, _z, _y, _x)){}
 
 
 #define CTOR_INT4(L, Q)\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, int, Q>::vec(int _x, int _y, int _z, int _w) :\
+	GLM_FUNC_QUALIFIER vec<L, int, Q>::vec(int _x, int _y, int _z, int _w) :\
 	data(_mm_set_epi32(_w, _z, _y, _x)){}
 
 #define CTOR_INT3(L, Q)\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, int, Q>::vec(int _x, int _y, int _z) :\
+	GLM_FUNC_QUALIFIER vec<L, int, Q>::vec(int _x, int _y, int _z) :\
 	data(_mm_set_epi32(_z, _z, _y, _x)){}
 
 #define CTOR_VECF_INT4(L, Q)\
 	template<>\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, float, Q>::vec(int _x, int _y, int _z, int _w) :\
+	GLM_FUNC_QUALIFIER vec<L, float, Q>::vec(int _x, int _y, int _z, int _w) :\
 	data(_mm_cvtepi32_ps(_mm_set_epi32(_w, _z, _y, _x)))\
 	{}
 
 #define CTOR_VECF_INT3(L, Q)\
 	template<>\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, float, Q>::vec(int _x, int _y, int _z) :\
+	GLM_FUNC_QUALIFIER vec<L, float, Q>::vec(int _x, int _y, int _z) :\
 	data(_mm_cvtepi32_ps(_mm_set_epi32(_z, _z, _y, _x)))\
 	{}
 
 #define CTOR_DEFAULT(L, Q)\
 	template<>\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, float, Q>::vec() :\
+	GLM_FUNC_QUALIFIER vec<L, float, Q>::vec() :\
 	data(_mm_setzero_ps())\
 	{}
 
 #define CTOR_FLOAT_COPY3(L, Q)\
 	template<>\
 	template<qualifier P>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, float, Q>::vec(vec<3, float, P> const& v)\
+	GLM_FUNC_QUALIFIER vec<3, float, Q>::vec(vec<3, float, P> const& v)\
 		:data(_mm_set_ps(v.z, v.z, v.y, v.x))\
 	{}
 
@@ -715,21 +984,6 @@ struct compute_vec_div<L, T, Q, true> : public compute_vec_div<L, T, Q, false>
 
 #if GLM_ARCH & GLM_ARCH_NEON_BIT
 
-#if GLM_CONFIG_SWIZZLE == GLM_SWIZZLE_OPERATOR
-// the functions below needs to be properly implemented, use unoptimized function fro now.
-
-template<length_t L, qualifier Q, int E0, int E1, int E2, int E3>
-struct _swizzle_base1<L, float, Q, E0, E1, E2, E3, true> : public _swizzle_base1<L, float, Q, E0, E1, E2, E3, false>{}; 
-
-template<length_t L, qualifier Q, int E0, int E1, int E2, int E3>
-struct _swizzle_base1<L, int, Q, E0, E1, E2, E3, true> : public _swizzle_base1<L, int, Q, E0, E1, E2, E3, false> {};
-
-template<length_t L, qualifier Q, int E0, int E1, int E2, int E3>
-struct _swizzle_base1<L, uint, Q, E0, E1, E2, E3, true> : public _swizzle_base1<L, uint, Q, E0, E1, E2, E3, false> {};
-
-#	endif// GLM_CONFIG_SWIZZLE == GLM_SWIZZLE_OPERATOR
-
-
 	template<length_t L, qualifier Q>
 	struct compute_vec_add<L, float, Q, true>
 	{
@@ -948,54 +1202,54 @@ struct _swizzle_base1<L, uint, Q, E0, E1, E2, E3, true> : public _swizzle_base1<
 
 #define CTOR_FLOAT(L, Q)\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, float, Q>::vec(float _s) :\
+	GLM_FUNC_QUALIFIER vec<L, float, Q>::vec(float _s) :\
 		data(vdupq_n_f32(_s))\
 	{}
 
 #define CTOR_INT(L, Q)\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, int, Q>::vec(int _s) :\
+	GLM_FUNC_QUALIFIER vec<L, int, Q>::vec(int _s) :\
 		data(vdupq_n_s32(_s))\
 	{}
 
 #define CTOR_UINT(L, Q)\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, uint, Q>::vec(uint _s) :\
+	GLM_FUNC_QUALIFIER vec<L, uint, Q>::vec(uint _s) :\
 		data(vdupq_n_u32(_s))\
 	{}
 
 #define CTOR_VECF_INT4(L, Q)\
 	template<>\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, float, Q>::vec(int _x, int _y, int _z, int _w) :\
+	GLM_FUNC_QUALIFIER vec<L, float, Q>::vec(int _x, int _y, int _z, int _w) :\
 		data(vcvtq_f32_s32(vec<L, int, Q>(_x, _y, _z, _w).data))\
 	{}
 
 #define CTOR_VECF_UINT4(L, Q)\
 	template<>\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, float, Q>::vec(uint _x, uint _y, uint _z, uint _w) :\
+	GLM_FUNC_QUALIFIER vec<L, float, Q>::vec(uint _x, uint _y, uint _z, uint _w) :\
 		data(vcvtq_f32_u32(vec<L, uint, Q>(_x, _y, _z, _w).data))\
 	{}
 
 #define CTOR_VECF_INT3(L, Q)\
 	template<>\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, float, Q>::vec(int _x, int _y, int _z) :\
+	GLM_FUNC_QUALIFIER vec<L, float, Q>::vec(int _x, int _y, int _z) :\
 		data(vcvtq_f32_s32(vec<L, int, Q>(_x, _y, _z).data))\
 	{}
 
 #define CTOR_VECF_UINT4(L, Q)\
 	template<>\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, float, Q>::vec(uint _x, uint _y, uint _z, uint _w) :\
+	GLM_FUNC_QUALIFIER vec<L, float, Q>::vec(uint _x, uint _y, uint _z, uint _w) :\
 		data(vcvtq_f32_u32(vec<L, uint, Q>(_x, _y, _z, _w).data))\
 	{}
 
 #define CTOR_VECF_UINT3(L, Q)\
 	template<>\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, float, Q>::vec(uint _x, uint _y, uint _z) :\
+	GLM_FUNC_QUALIFIER vec<L, float, Q>::vec(uint _x, uint _y, uint _z) :\
 		data(vcvtq_f32_u32(vec<L, uint, Q>(_x, _y, _z).data))\
 	{}
 
@@ -1010,14 +1264,14 @@ struct _swizzle_base1<L, uint, Q, E0, E1, E2, E3, true> : public _swizzle_base1<
 #define CTOR_VECF_VECI(L, Q)\
 	template<>\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, float, Q>::vec(const vec<L, int, Q>& rhs) :\
+	GLM_FUNC_QUALIFIER vec<L, float, Q>::vec(const vec<L, int, Q>& rhs) :\
 		data(vcvtq_f32_s32(rhs.data))\
 	{}
 
 #define CTOR_VECF_VECU(L, Q)\
 	template<>\
 	template<>\
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, float, Q>::vec(const vec<L, uint, Q>& rhs) :\
+	GLM_FUNC_QUALIFIER vec<L, float, Q>::vec(const vec<L, uint, Q>& rhs) :\
 		data(vcvtq_f32_u32(rhs.data))\
 	{}
 
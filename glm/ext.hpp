@@ -13,6 +13,8 @@
 #	pragma message("GLM: All extensions included (not recommended)")
 #endif//GLM_MESSAGES
 
+#include "./ext/cpu_dispatch.hpp"
+
 #include "./ext/matrix_clip_space.hpp"
 #include "./ext/matrix_common.hpp"
 
@@ -241,6 +243,7 @@
 #include "./gtx/raw_data.hpp"
 #include "./gtx/rotate_normalized_axis.hpp"
 #include "./gtx/rotate_vector.hpp"
+#include "./gtx/serialize.hpp"
 #include "./gtx/spline.hpp"
 #include "./gtx/std_based_type.hpp"
 #if !((GLM_COMPILER & GLM_COMPILER_CUDA) || (GLM_COMPILER & GLM_COMPILER_HIP))
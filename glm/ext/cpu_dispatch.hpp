@@ -0,0 +1,81 @@
+/// @ref ext_cpu_dispatch
+/// @file glm/ext/cpu_dispatch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup ext_cpu_dispatch GLM_EXT_cpu_dispatch
+/// @ingroup ext
+///
+/// Include <glm/ext/cpu_dispatch.hpp> to use the features of this extension.
+///
+/// Runtime selection of the batch kernels from the instruction sets of the host CPU.
+/// GLM_ARCH selects the SIMD code at compile time, an application built for SSE2 doesn't use the AVX2 or AVX-512 units of the machines it runs on.
+/// When GLM_FORCE_CPU_DISPATCH is defined, the batch functions of GLM_GTC_bitfield and GLM_GTX_serialize
+/// are compiled for each tier and call the kernel of the tier detected with CPUID, through a cached function pointer.
+///
+/// The tiers follow the x86-64 microarchitecture levels, each tier includes the instruction sets of the previous ones.
+/// Runtime dispatch requires an x86 target and GCC, Clang or Visual C++, the host is cpu_generic otherwise.
+
+#pragma once
+
+// Dependencies
+#include "../detail/setup.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_cpu_dispatch extension included")
+#endif
+
+// Only the kernels use the intrinsics, <immintrin.h> costs more to parse than all of GLM
+#if GLM_HAS_CPUID && GLM_CONFIG_CPU_DISPATCH == GLM_ENABLE
+#	include <immintrin.h>
+#endif
+
+// Instruction sets of the kernels of each tier, the kernels are compiled for their tier whatever the compiler options
+#if GLM_HAS_CPUID && (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG))
+#	define GLM_DISPATCH_SSE2 __attribute__((target("sse2")))
+#	define GLM_DISPATCH_SSE4_1 __attribute__((target("sse2,ssse3,sse4.1")))
+#	define GLM_DISPATCH_AVX2 __attribute__((target("sse2,ssse3,sse4.1,avx,avx2,fma,bmi,bmi2")))
+#	define GLM_DISPATCH_AVX512 __attribute__((target("sse2,ssse3,sse4.1,avx,avx2,fma,bmi,bmi2,avx512f,avx512bw,avx512cd,avx512dq,avx512vl")))
+#else
+#	define GLM_DISPATCH_SSE2
+#	define GLM_DISPATCH_SSE4_1
+#	define GLM_DISPATCH_AVX2
+#	define GLM_DISPATCH_AVX512
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_cpu_dispatch
+	/// @{
+
+	/// Instruction sets used by the batch kernels
+	enum cpu_tier
+	{
+		cpu_generic = 0,	///< No SIMD instruction
+		cpu_sse2 = 1,		///< SSE2, x86-64 baseline
+		cpu_sse4_1 = 2,		///< SSSE3 and SSE4.1
+		cpu_avx2 = 3,		///< AVX2, FMA, BMI1 and BMI2, x86-64-v3
+		cpu_avx512 = 4		///< AVX-512 F, BW, CD, DQ and VL, x86-64-v4
+	};
+
+	/// Returns the highest tier supported by the host CPU and operating system.
+	/// CPUID is executed the first time the function is called.
+	///
+	/// @see ext_cpu_dispatch
+	GLM_FUNC_DECL cpu_tier cpuTier();
+
+	/// Returns the tier of the kernels called by the batch functions, cpuTier() unless setDispatchTier was called.
+	///
+	/// @see ext_cpu_dispatch
+	GLM_FUNC_DECL cpu_tier dispatchTier();
+
+	/// Forces the tier of the kernels called by the batch functions, e.g. to test or compare each tier.
+	/// Returns false and keeps the current tier if Tier isn't supported by the host.
+	///
+	/// @see ext_cpu_dispatch
+	GLM_FUNC_DECL bool setDispatchTier(cpu_tier Tier);
+
+	/// @}
+}//namespace glm
+
+#include "cpu_dispatch.inl"
@@ -0,0 +1,139 @@
+/// @ref ext_cpu_dispatch
+
+#include <atomic>
+
+#if GLM_HAS_CPUID && (GLM_COMPILER & GLM_COMPILER_VC)
+#	include <intrin.h>
+#elif GLM_HAS_CPUID
+#	include <cpuid.h>
+#endif
+
+namespace glm{
+namespace detail
+{
+#	if GLM_HAS_CPUID
+		GLM_FUNC_QUALIFIER void cpuid(unsigned int Leaf, unsigned int Subleaf, unsigned int Registers[4])
+		{
+#			if GLM_COMPILER & GLM_COMPILER_VC
+				int Info[4];
+				__cpuidex(Info, static_cast<int>(Leaf), static_cast<int>(Subleaf));
+				for(int i = 0; i < 4; ++i)
+					Registers[i] = static_cast<unsigned int>(Info[i]);
+#			else
+				__cpuid_count(Leaf, Subleaf, Registers[0], Registers[1], Registers[2], Registers[3]);
+#			endif
+		}
+
+		// Register states saved by the operating system, only valid when CPUID reports OSXSAVE
+		GLM_FUNC_QUALIFIER unsigned long long xgetbv()
+		{
+#			if GLM_COMPILER & GLM_COMPILER_VC
+				return _xgetbv(0);
+#			else
+				unsigned int Low = 0, High = 0;
+				__asm__ __volatile__("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+				return (static_cast<unsigned long long>(High) << 32) | Low;
+#			endif
+		}
+#	endif//GLM_HAS_CPUID
+
+	GLM_FUNC_QUALIFIER cpu_tier cpu_detect()
+	{
+#		if GLM_HAS_CPUID
+			unsigned int Leaf0[4];
+			cpuid(0, 0, Leaf0);
+			if(Leaf0[0] < 1)
+				return cpu_generic;
+
+			unsigned int Leaf1[4];
+			cpuid(1, 0, Leaf1);
+			unsigned int const Ecx1 = Leaf1[2];
+			unsigned int const Edx1 = Leaf1[3];
+
+			if(!(Edx1 & (1u << 26)))
+				return cpu_generic;
+			if(!(Ecx1 & (1u << 9)) || !(Ecx1 & (1u << 19)))
+				return cpu_sse2;
+
+			// The YMM registers must be saved by the operating system: OSXSAVE, AVX and XCR0 SSE and AVX states
+			if(Leaf0[0] < 7 || !(Ecx1 & (1u << 27)) || !(Ecx1 & (1u << 28)))
+				return cpu_sse4_1;
+			unsigned long long const Xcr0 = xgetbv();
+			if((Xcr0 & 0x06) != 0x06)
+				return cpu_sse4_1;
+
+			unsigned int Leaf7[4];
+			cpuid(7, 0, Leaf7);
+			unsigned int const Ebx7 = Leaf7[1];
+
+			// FMA, BMI1, AVX2 and BMI2
+			if(!(Ecx1 & (1u << 12)) || (Ebx7 & 0x00000128u) != 0x00000128u)
+				return cpu_sse4_1;
+
+			// AVX-512 F, DQ, CD, BW and VL with the opmask and ZMM states
+			if((Ebx7 & 0xD0030000u) != 0xD0030000u || (Xcr0 & 0xE6) != 0xE6)
+				return cpu_avx2;
+
+			return cpu_avx512;
+#		else
+			return cpu_generic;
+#		endif
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER cpu_tier cpuTier()
+	{
+		static cpu_tier const Tier = detail::cpu_detect();
+		return Tier;
+	}
+
+namespace detail
+{
+	GLM_FUNC_QUALIFIER std::atomic<int>& dispatch_tier()
+	{
+		static std::atomic<int> Tier(static_cast<int>(cpuTier()));
+		return Tier;
+	}
+
+	// Incremented when the dispatch tier changes, to select the cached kernels again
+	GLM_FUNC_QUALIFIER std::atomic<unsigned int>& dispatch_generation()
+	{
+		static std::atomic<unsigned int> Generation(0);
+		return Generation;
+	}
+
+	// kernel provides the 'function' pointer type and 'select', returning the kernel of the highest tier up to a given tier.
+	// All kernels compute the same result, a kernel selected for a previous tier by a concurrent call remains valid.
+	template<typename kernel>
+	GLM_FUNC_QUALIFIER typename kernel::function dispatch()
+	{
+		static std::atomic<typename kernel::function> Function(nullptr);
+		static std::atomic<unsigned int> Generation(0);
+
+		unsigned int const Current = dispatch_generation().load(std::memory_order_acquire);
+		typename kernel::function Result = Function.load(std::memory_order_acquire);
+		if(Result == nullptr || Generation.load(std::memory_order_relaxed) != Current)
+		{
+			Result = kernel::select(static_cast<cpu_tier>(dispatch_tier().load(std::memory_order_relaxed)));
+			Generation.store(Current, std::memory_order_relaxed);
+			Function.store(Result, std::memory_order_release);
+		}
+		return Result;
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER cpu_tier dispatchTier()
+	{
+		return static_cast<cpu_tier>(detail::dispatch_tier().load(std::memory_order_relaxed));
+	}
+
+	GLM_FUNC_QUALIFIER bool setDispatchTier(cpu_tier Tier)
+	{
+		if(Tier < cpu_generic || Tier > cpuTier())
+			return false;
+
+		detail::dispatch_tier().store(static_cast<int>(Tier), std::memory_order_relaxed);
+		detail::dispatch_generation().fetch_add(1, std::memory_order_release);
+		return true;
+	}
+}//namespace glm
@@ -2,7 +2,7 @@
 /// @file glm/ext/matrix_float2x2_precision.hpp
 
 #pragma once
-#include "../detail/type_mat2x2.hpp"
+#include "../detail/type_mat4x2.hpp"
 
 namespace glm
 {
@@ -35,7 +35,7 @@ namespace glm
 	///
 	/// @see ext_quaternion_geometric
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL T length(qua<T, Q> const& q);
+	GLM_FUNC_DECL GLM_CONSTEXPR T length(qua<T, Q> const& q);
 
 	/// Returns the normalized quaternion.
 	///
@@ -8,9 +8,9 @@ namespace glm
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER T length(qua<T, Q> const& q)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T length(qua<T, Q> const& q)
 	{
-		return glm::sqrt(dot(q, q));
+		return detail::evaluate_sqrt(dot(q, q));
 	}
 
 	template<typename T, qualifier Q>
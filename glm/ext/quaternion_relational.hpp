@@ -33,28 +33,28 @@ namespace glm
 	/// @tparam T Floating-point scalar types
 	/// @tparam Q Value from qualifier enum
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL vec<4, bool, Q> equal(qua<T, Q> const& x, qua<T, Q> const& y);
+	GLM_FUNC_DECL GLM_CONSTEXPR vec<4, bool, Q> equal(qua<T, Q> const& x, qua<T, Q> const& y);
 
 	/// Returns the component-wise comparison of |x - y| < epsilon.
 	///
 	/// @tparam T Floating-point scalar types
 	/// @tparam Q Value from qualifier enum
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL vec<4, bool, Q> equal(qua<T, Q> const& x, qua<T, Q> const& y, T epsilon);
+	GLM_FUNC_DECL GLM_CONSTEXPR vec<4, bool, Q> equal(qua<T, Q> const& x, qua<T, Q> const& y, T epsilon);
 
 	/// Returns the component-wise comparison of result x != y.
 	///
 	/// @tparam T Floating-point scalar types
 	/// @tparam Q Value from qualifier enum
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL vec<4, bool, Q> notEqual(qua<T, Q> const& x, qua<T, Q> const& y);
+	GLM_FUNC_DECL GLM_CONSTEXPR vec<4, bool, Q> notEqual(qua<T, Q> const& x, qua<T, Q> const& y);
 
 	/// Returns the component-wise comparison of |x - y| >= epsilon.
 	///
 	/// @tparam T Floating-point scalar types
 	/// @tparam Q Value from qualifier enum
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL vec<4, bool, Q> notEqual(qua<T, Q> const& x, qua<T, Q> const& y, T epsilon);
+	GLM_FUNC_DECL GLM_CONSTEXPR vec<4, bool, Q> notEqual(qua<T, Q> const& x, qua<T, Q> const& y, T epsilon);
 
 	/// @}
 } //namespace glm
@@ -20,6 +20,7 @@
 // Dependency:
 #include "../trigonometric.hpp"
 #include "../exponential.hpp"
+#include "../detail/compute_constexpr.hpp"
 #include "scalar_constants.hpp"
 #include "vector_relational.hpp"
 #include <limits>
@@ -57,7 +58,7 @@ namespace glm
 	/// @tparam T A floating-point scalar type
 	/// @tparam Q A value from qualifier enum
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL qua<T, Q> angleAxis(T const& angle, vec<3, T, Q> const& axis);
+	GLM_FUNC_DECL GLM_CONSTEXPR qua<T, Q> angleAxis(T const& angle, vec<3, T, Q> const& axis);
 
 	/// @}
 } //namespace glm
@@ -27,11 +27,11 @@ namespace glm
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER qua<T, Q> angleAxis(T const& angle, vec<3, T, Q> const& v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR qua<T, Q> angleAxis(T const& angle, vec<3, T, Q> const& v)
 	{
 		T const a(angle);
-		T const s = glm::sin(a * static_cast<T>(0.5));
+		T const s = detail::evaluate_sin(a * static_cast<T>(0.5));
 
-		return qua<T, Q>(glm::cos(a * static_cast<T>(0.5)), v * s);
+		return qua<T, Q>(detail::evaluate_cos(a * static_cast<T>(0.5)), v * s);
 	}
 }//namespace glm
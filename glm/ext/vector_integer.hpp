@@ -143,6 +143,83 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL vec<L, int, Q> findNSB(vec<L, T, Q> const& Source, vec<L, int, Q> SignificantBitCount);
 
+	/// Precomputed division by a runtime-invariant divisor.
+	///
+	/// @see ext_vector_integer
+	template<typename genType>
+	struct divider;
+
+	/// Division of 32 bits integer vectors by a runtime-invariant divisor vector, replacing each division by a multiplication and shifts.
+	/// Building a divider costs more than a division, it pays off when the same divisor is used many times,
+	/// for example to convert linear indices to grid coordinates.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T int or uint
+	/// @tparam Q Value from qualifier enum
+	///
+	/// Example:
+	/// ```
+	/// glm::divider<glm::uvec2> const Size(glm::uvec2(Width, Height));
+	/// glm::uvec2 const Tile = Pixel / Size;
+	/// glm::uvec2 const Texel = Pixel % Size;
+	/// ```
+	///
+	/// @see ext_vector_integer
+	template<length_t L, typename T, qualifier Q>
+	struct divider<vec<L, T, Q> >
+	{
+		static_assert(std::numeric_limits<T>::is_integer && sizeof(T) == 4, "'divider' only accept 32 bits integer inputs");
+
+		/// @param Divisor No component may be zero
+		GLM_CTOR_DECL explicit divider(vec<L, T, Q> const& Divisor);
+
+		/// @param Divisor Must not be zero
+		GLM_CTOR_DECL explicit divider(T Divisor);
+
+		/// Divisor of each component
+		vec<L, T, Q> Divisor;
+
+		/// Multiplier of the absolute value of each component
+		vec<L, uint, Q> Magic;
+
+		/// Final right shift of each component
+		vec<L, uint, Q> Shift;
+	};
+
+	/// Returns the quotient of v by the divisor of Divider, rounded toward zero like the / operator.
+	///
+	/// @see ext_vector_integer
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> operator/(vec<L, T, Q> const& v, divider<vec<L, T, Q> > const& Divider);
+
+	/// Returns the remainder of v by the divisor of Divider, with the sign of v like the % operator.
+	///
+	/// @see ext_vector_integer
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> operator%(vec<L, T, Q> const& v, divider<vec<L, T, Q> > const& Divider);
+
+	/// Returns x / y rounded toward zero, computed with a single precision floating point division.
+	/// The result is exact when the absolute values of x and y are lower than 2^24.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T Signed or unsigned integer scalar types.
+	/// @tparam Q Value from qualifier enum
+	///
+	/// @see ext_vector_integer
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> fastDivide(vec<L, T, Q> const& x, vec<L, T, Q> const& y);
+
+	/// Returns x % y computed with fastDivide.
+	/// The result is exact when the absolute values of x and y are lower than 2^24.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T Signed or unsigned integer scalar types.
+	/// @tparam Q Value from qualifier enum
+	///
+	/// @see ext_vector_integer
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> fastMod(vec<L, T, Q> const& x, vec<L, T, Q> const& y);
+
 	/// @}
 } //namespace glm
 
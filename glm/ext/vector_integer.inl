@@ -2,6 +2,75 @@
 
 namespace glm
 {
+namespace detail
+{
+	// Granlund-Montgomery round-up method: for 1 < d < 2^32, l = ceil(log2(d)) and m = 2^32 * (2^l - d) / d + 1,
+	// n / d = (t + ((n - t) >> 1)) >> (l - 1) where t = (m * n) >> 32, without overflow.
+	GLM_FUNC_QUALIFIER void divider_magic(uint d, uint& Magic, uint& Shift)
+	{
+		uint l = 0;
+		while((static_cast<uint64>(1) << l) < d)
+			++l;
+
+		Magic = static_cast<uint>((static_cast<uint64>(1) << 32) * ((static_cast<uint64>(1) << l) - d) / d + 1);
+		Shift = l > 0 ? l - 1 : 0;
+	}
+
+	GLM_FUNC_QUALIFIER uint divider_abs(int x)
+	{
+		return x < 0 ? 0u - static_cast<uint>(x) : static_cast<uint>(x);
+	}
+
+	GLM_FUNC_QUALIFIER uint divider_abs(uint x)
+	{
+		return x;
+	}
+
+	GLM_FUNC_QUALIFIER uint divider_divide(uint n, uint d, uint Magic, uint Shift)
+	{
+		uint const t = static_cast<uint>((static_cast<uint64>(Magic) * n) >> 32);
+		return d == 1 ? n : (t + ((n - t) >> 1)) >> Shift;
+	}
+
+	// Divides the absolute values then restores the sign of the quotient
+	GLM_FUNC_QUALIFIER int divider_divide(int n, int d, uint Magic, uint Shift)
+	{
+		uint const Sign = (n < 0) != (d < 0) ? ~0u : 0u;
+		uint const q = divider_divide(divider_abs(n), divider_abs(d), Magic, Shift);
+		return static_cast<int>((q ^ Sign) - Sign);
+	}
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_divider
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> div(vec<L, T, Q> const& v, divider<vec<L, T, Q> > const& Divider)
+		{
+			vec<L, T, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = divider_divide(v[i], Divider.Divisor[i], Divider.Magic[i], Divider.Shift[i]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> mod(vec<L, T, Q> const& v, divider<vec<L, T, Q> > const& Divider)
+		{
+			vec<L, T, Q> const q = div(v, Divider);
+			vec<L, T, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = static_cast<T>(static_cast<uint>(v[i]) - static_cast<uint>(q[i]) * static_cast<uint>(Divider.Divisor[i]));
+			return Result;
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fastDivide
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+		{
+			return vec<L, T, Q>(vec<L, float, Q>(x) / vec<L, float, Q>(y));
+		}
+	};
+}//namespace detail
+
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, bool, Q> isPowerOfTwo(vec<L, T, Q> const& Value)
 	{
@@ -82,4 +151,52 @@ namespace glm
 
 		return detail::functor2_vec_int<L, T, Q>::call(findNSB, Source, SignificantBitCount);
 	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR divider<vec<L, T, Q> >::divider(vec<L, T, Q> const& d)
+		: Divisor(d)
+	{
+		for(length_t i = 0; i < L; ++i)
+		{
+			assert(d[i] != static_cast<T>(0));
+			detail::divider_magic(detail::divider_abs(d[i]), Magic[i], Shift[i]);
+		}
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR divider<vec<L, T, Q> >::divider(T d)
+		: divider(vec<L, T, Q>(d))
+	{}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> operator/(vec<L, T, Q> const& v, divider<vec<L, T, Q> > const& Divider)
+	{
+		return detail::compute_divider<L, T, Q, detail::is_aligned<Q>::value>::div(v, Divider);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> operator%(vec<L, T, Q> const& v, divider<vec<L, T, Q> > const& Divider)
+	{
+		return detail::compute_divider<L, T, Q, detail::is_aligned<Q>::value>::mod(v, Divider);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> fastDivide(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+	{
+		static_assert(std::numeric_limits<T>::is_integer, "'fastDivide' only accept integer inputs");
+
+		return detail::compute_fastDivide<L, T, Q, detail::is_aligned<Q>::value>::call(x, y);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> fastMod(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+	{
+		static_assert(std::numeric_limits<T>::is_integer, "'fastMod' only accept integer inputs");
+
+		return x - fastDivide(x, y) * y;
+	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "vector_integer_simd.inl"
+#endif
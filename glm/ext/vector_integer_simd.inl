@@ -0,0 +1,85 @@
+/// @ref ext_vector_integer
+
+#include "../simd/integer.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_divider<4, uint, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, uint, Q> div(vec<4, uint, Q> const& v, divider<vec<4, uint, Q> > const& Divider)
+		{
+			vec<4, uint, Q> Result;
+			Result.data = glm_i128_udivMagic(v.data, Divider.Divisor.data, Divider.Magic.data, Divider.Shift.data);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, uint, Q> mod(vec<4, uint, Q> const& v, divider<vec<4, uint, Q> > const& Divider)
+		{
+			glm_uvec4 High;
+			glm_uvec4 const q = glm_i128_udivMagic(v.data, Divider.Divisor.data, Divider.Magic.data, Divider.Shift.data);
+
+			vec<4, uint, Q> Result;
+			Result.data = _mm_sub_epi32(v.data, glm_i128_umulExtended(q, Divider.Divisor.data, &High));
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_divider<4, int, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> div(vec<4, int, Q> const& v, divider<vec<4, int, Q> > const& Divider)
+		{
+			// Divides the absolute values then restores the sign of the quotient
+			glm_ivec4 const SignN = _mm_srai_epi32(v.data, 31);
+			glm_ivec4 const SignD = _mm_srai_epi32(Divider.Divisor.data, 31);
+			glm_uvec4 const AbsN = _mm_sub_epi32(_mm_xor_si128(v.data, SignN), SignN);
+			glm_uvec4 const AbsD = _mm_sub_epi32(_mm_xor_si128(Divider.Divisor.data, SignD), SignD);
+
+			glm_uvec4 const q = glm_i128_udivMagic(AbsN, AbsD, Divider.Magic.data, Divider.Shift.data);
+			glm_ivec4 const Sign = _mm_xor_si128(SignN, SignD);
+
+			vec<4, int, Q> Result;
+			Result.data = _mm_sub_epi32(_mm_xor_si128(q, Sign), Sign);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> mod(vec<4, int, Q> const& v, divider<vec<4, int, Q> > const& Divider)
+		{
+			// The low half of the product doesn't depend on the signedness
+			glm_uvec4 High;
+			vec<4, int, Q> Result;
+			Result.data = _mm_sub_epi32(v.data, glm_i128_umulExtended(div(v, Divider).data, Divider.Divisor.data, &High));
+			return Result;
+		}
+	};
+
+	// Operands lower than 2^24 are exactly converted, both signed and unsigned
+	template<qualifier Q>
+	struct compute_fastDivide<4, int, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, int, Q> const& x, vec<4, int, Q> const& y)
+		{
+			vec<4, int, Q> Result;
+			Result.data = _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(x.data), _mm_cvtepi32_ps(y.data)));
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_fastDivide<4, uint, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, uint, Q> call(vec<4, uint, Q> const& x, vec<4, uint, Q> const& y)
+		{
+			vec<4, uint, Q> Result;
+			Result.data = _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(x.data), _mm_cvtepi32_ps(y.data)));
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -7,12 +7,40 @@ module;
 #include "./glm.hpp"
 #include "./ext.hpp"
 
+// Experimental extensions not included by ext.hpp
+#ifdef GLM_ENABLE_EXPERIMENTAL
+#	include "./gtx/exterior_product.hpp"
+#	include "./gtx/iteration.hpp"
+#	include "./gtx/matrix_transform_2d.hpp"
+#	include "./gtx/mipmap.hpp"
+#	include "./gtx/scalar_relational.hpp"
+#	include "./gtx/spatial_sort.hpp"
+#	include "./gtx/structured_bindings.hpp"
+#	include "./gtx/texture.hpp"
+#	include "./gtx/vertex_weld.hpp"
+#endif
+
 export module glm;
 
 export namespace glm {
 	// Base types
 	using glm::qualifier;
 	using glm::precision;
+	using glm::length_t;
+	using glm::packed_highp;
+	using glm::packed_mediump;
+	using glm::packed_lowp;
+#   if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	using glm::aligned_highp;
+	using glm::aligned_mediump;
+	using glm::aligned_lowp;
+	using glm::aligned;
+#   endif
+	using glm::highp;
+	using glm::mediump;
+	using glm::lowp;
+	using glm::packed;
+	using glm::defaultp;
 	using glm::vec;
 	using glm::mat;
 	using glm::qua;
@@ -650,6 +678,30 @@ export namespace glm {
 	using glm::f64mat4x2;
 	using glm::f64mat4x3;
 	using glm::f64mat4x4;
+	using glm::lowp_imat2;
+	using glm::lowp_imat3;
+	using glm::lowp_imat4;
+	using glm::mediump_imat2;
+	using glm::mediump_imat3;
+	using glm::mediump_imat4;
+	using glm::highp_imat2;
+	using glm::highp_imat3;
+	using glm::highp_imat4;
+	using glm::imat2;
+	using glm::imat3;
+	using glm::imat4;
+	using glm::i8mat2;
+	using glm::i8mat3;
+	using glm::i8mat4;
+	using glm::i16mat2;
+	using glm::i16mat3;
+	using glm::i16mat4;
+	using glm::i32mat2;
+	using glm::i32mat3;
+	using glm::i32mat4;
+	using glm::i64mat2;
+	using glm::i64mat3;
+	using glm::i64mat4;
 	using glm::lowp_imat2x2;
 	using glm::lowp_imat2x3;
 	using glm::lowp_imat2x4;
@@ -830,6 +882,30 @@ export namespace glm {
 	using glm::i64mat4x2;
 	using glm::i64mat4x3;
 	using glm::i64mat4x4;
+	using glm::lowp_umat2;
+	using glm::lowp_umat3;
+	using glm::lowp_umat4;
+	using glm::mediump_umat2;
+	using glm::mediump_umat3;
+	using glm::mediump_umat4;
+	using glm::highp_umat2;
+	using glm::highp_umat3;
+	using glm::highp_umat4;
+	using glm::umat2;
+	using glm::umat3;
+	using glm::umat4;
+	using glm::u8mat2;
+	using glm::u8mat3;
+	using glm::u8mat4;
+	using glm::u16mat2;
+	using glm::u16mat3;
+	using glm::u16mat4;
+	using glm::u32mat2;
+	using glm::u32mat3;
+	using glm::u32mat4;
+	using glm::u64mat2;
+	using glm::u64mat3;
+	using glm::u64mat4;
 	using glm::lowp_umat2x2;
 	using glm::lowp_umat2x3;
 	using glm::lowp_umat2x4;
@@ -1409,6 +1485,22 @@ export namespace glm {
 		using glm::packed_highp_dmat4x4;
 		using glm::packed_mediump_dmat4x4;
 		using glm::packed_lowp_dmat4x4;
+		using glm::aligned_lowp_quat;
+		using glm::aligned_mediump_quat;
+		using glm::aligned_highp_quat;
+		using glm::aligned_quat;
+		using glm::packed_lowp_quat;
+		using glm::packed_mediump_quat;
+		using glm::packed_highp_quat;
+		using glm::packed_quat;
+		using glm::aligned_lowp_dquat;
+		using glm::aligned_mediump_dquat;
+		using glm::aligned_highp_dquat;
+		using glm::aligned_dquat;
+		using glm::packed_lowp_dquat;
+		using glm::packed_mediump_dquat;
+		using glm::packed_highp_dquat;
+		using glm::packed_dquat;
 #       if(defined(GLM_PRECISION_LOWP_FLOAT))
 		using glm::aligned_vec1;
 		using glm::aligned_vec2;
@@ -1694,6 +1786,7 @@ export namespace glm {
 		using glm::ballRand;
 		using glm::bitCount;
 		using glm::bitfieldDeinterleave;
+		using glm::bitfieldDeinterleave3;
 		using glm::bitfieldExtract;
 		using glm::bitfieldFillOne;
 		using glm::bitfieldFillZero;
@@ -1763,6 +1856,9 @@ export namespace glm {
 		using glm::greaterThan;
 		using glm::greaterThanEqual;
 		using glm::half_pi;
+		using glm::hilbertDecode2;
+		using glm::hilbertDecode3;
+		using glm::hilbertEncode;
 		using glm::identity;
 		using glm::imulExtended;
 		using glm::infinitePerspective;
@@ -1817,6 +1913,7 @@ export namespace glm {
 		using glm::mix;
 		using glm::mod;
 		using glm::modf;
+		using glm::mortonEncode;
 		using glm::next_float;
 		using glm::normalize;
 		using glm::notEqual;
@@ -1934,6 +2031,7 @@ export namespace glm {
 		using glm::step;
 		using glm::tan;
 		using glm::tanh;
+		using glm::tau;
 		using glm::third;
 		using glm::three_over_two_pi;
 		using glm::translate;
@@ -1996,6 +2094,14 @@ export namespace glm {
 	inline
 #   endif
 	namespace ext {
+		using glm::cpu_tier;
+		using glm::cpu_generic;
+		using glm::cpu_sse2;
+		using glm::cpu_sse4_1;
+		using glm::cpu_avx2;
+		using glm::cpu_avx512;
+		using glm::divider;
+
 		using glm::abs;
 		using glm::acos;
 		using glm::acosh;
@@ -2022,11 +2128,13 @@ export namespace glm {
 		using glm::cosh;
 		using glm::cot;
 		using glm::coth;
+		using glm::cpuTier;
 		using glm::cross;
 		using glm::csc;
 		using glm::csch;
 		using glm::degrees;
 		using glm::determinant;
+		using glm::dispatchTier;
 		using glm::distance;
 		using glm::dot;
 		using glm::e;
@@ -2036,6 +2144,8 @@ export namespace glm {
 		using glm::exp;
 		using glm::exp2;
 		using glm::faceforward;
+		using glm::fastDivide;
+		using glm::fastMod;
 		using glm::fclamp;
 		using glm::findNSB;
 		using glm::floatBitsToInt;
@@ -2064,7 +2174,11 @@ export namespace glm {
 		using glm::identity;
 		using glm::infinitePerspective;
 		using glm::infinitePerspectiveLH;
+		using glm::infinitePerspectiveLH_NO;
+		using glm::infinitePerspectiveLH_ZO;
 		using glm::infinitePerspectiveRH;
+		using glm::infinitePerspectiveRH_NO;
+		using glm::infinitePerspectiveRH_ZO;
 		using glm::intBitsToFloat;
 		using glm::inverse;
 		using glm::inversesqrt;
@@ -2159,6 +2273,8 @@ export namespace glm {
 		using glm::scale;
 		using glm::sec;
 		using glm::sech;
+		using glm::setDispatchTier;
+		using glm::shear;
 		using glm::sign;
 		using glm::sin;
 		using glm::sinh;
@@ -2192,9 +2308,15 @@ export namespace glm {
 #   endif
 	namespace gtx {
 		using glm::io::order_type;
+		using glm::io::column_major;
+		using glm::io::row_major;
 		using glm::io::format_punct;
 		using glm::io::basic_state_saver;
 		using glm::io::basic_format_saver;
+		using glm::io::state_saver;
+		using glm::io::wstate_saver;
+		using glm::io::format_saver;
+		using glm::io::wformat_saver;
 		using glm::io::precision;
 		using glm::io::width;
 		using glm::io::delimeter;
@@ -2205,15 +2327,175 @@ export namespace glm {
 		using glm::io::operator<<;
 		using glm::operator<<;
 		using glm::tdualquat;
+		using glm::lowp_fdualquat;
+		using glm::mediump_fdualquat;
+		using glm::highp_fdualquat;
+		using glm::lowp_dualquat;
+		using glm::mediump_dualquat;
+		using glm::highp_dualquat;
+		using glm::lowp_ddualquat;
+		using glm::mediump_ddualquat;
+		using glm::highp_ddualquat;
+		using glm::dualquat;
+		using glm::fdualquat;
+		using glm::ddualquat;
+
+		using glm::bool1;
+		using glm::bool2;
+		using glm::bool3;
+		using glm::bool4;
+		using glm::bool1x1;
+		using glm::bool2x2;
+		using glm::bool2x3;
+		using glm::bool2x4;
+		using glm::bool3x2;
+		using glm::bool3x3;
+		using glm::bool3x4;
+		using glm::bool4x2;
+		using glm::bool4x3;
+		using glm::bool4x4;
+		using glm::int1;
+		using glm::int2;
+		using glm::int3;
+		using glm::int4;
+		using glm::int1x1;
+		using glm::int2x2;
+		using glm::int2x3;
+		using glm::int2x4;
+		using glm::int3x2;
+		using glm::int3x3;
+		using glm::int3x4;
+		using glm::int4x2;
+		using glm::int4x3;
+		using glm::int4x4;
+		using glm::float1;
+		using glm::float2;
+		using glm::float3;
+		using glm::float4;
+		using glm::float1x1;
+		using glm::float2x2;
+		using glm::float2x3;
+		using glm::float2x4;
+		using glm::float3x2;
+		using glm::float3x3;
+		using glm::float3x4;
+		using glm::float4x2;
+		using glm::float4x3;
+		using glm::float4x4;
+		using glm::double1;
+		using glm::double2;
+		using glm::double3;
+		using glm::double4;
+		using glm::double1x1;
+		using glm::double2x2;
+		using glm::double2x3;
+		using glm::double2x4;
+		using glm::double3x2;
+		using glm::double3x3;
+		using glm::double3x4;
+		using glm::double4x2;
+		using glm::double4x3;
+		using glm::double4x4;
+
+		using glm::f32mat1;
+		using glm::f32mat1x1;
+		using glm::f64mat1;
+		using glm::f64mat1x1;
+		using glm::sint;
+		using glm::byte;
+		using glm::word;
+		using glm::dword;
+		using glm::qword;
+		using glm::size1;
+		using glm::size2;
+		using glm::size3;
+		using glm::size4;
+		using glm::size1_t;
+		using glm::size2_t;
+		using glm::size3_t;
+		using glm::size4_t;
+		using glm::covariance_accumulator;
+		using glm::catmull_rom_spline;
+
+		using glm::serial_endianness;
+		using glm::serial_little_endian;
+		using glm::serial_big_endian;
+		using glm::serial_encoding;
+		using glm::serial_raw;
+		using glm::serial_half;
+		using glm::serial_unorm8;
+		using glm::serial_snorm8;
+		using glm::serial_unorm16;
+		using glm::serial_snorm16;
+		using glm::serial_kind;
+		using glm::serial_scalar;
+		using glm::serial_vector;
+		using glm::serial_matrix;
+		using glm::serial_quaternion;
+		using glm::serial_int8;
+		using glm::serial_int16;
+		using glm::serial_int32;
+		using glm::serial_int64;
+		using glm::serial_uint8;
+		using glm::serial_uint16;
+		using glm::serial_uint32;
+		using glm::serial_uint64;
+		using glm::serial_float32;
+		using glm::serial_float64;
+		using glm::serial_header;
+		using glm::serial_layout;
+		using glm::serial_header_size;
+
+		using glm::easing_curve;
+		using glm::easing_linear;
+		using glm::easing_quadratic_in;
+		using glm::easing_quadratic_out;
+		using glm::easing_quadratic_in_out;
+		using glm::easing_cubic_in;
+		using glm::easing_cubic_out;
+		using glm::easing_cubic_in_out;
+		using glm::easing_quartic_in;
+		using glm::easing_quartic_out;
+		using glm::easing_quartic_in_out;
+		using glm::easing_quintic_in;
+		using glm::easing_quintic_out;
+		using glm::easing_quintic_in_out;
+		using glm::easing_sine_in;
+		using glm::easing_sine_out;
+		using glm::easing_sine_in_out;
+		using glm::easing_circular_in;
+		using glm::easing_circular_out;
+		using glm::easing_circular_in_out;
+		using glm::easing_exponential_in;
+		using glm::easing_exponential_out;
+		using glm::easing_exponential_in_out;
+		using glm::easing_elastic_in;
+		using glm::easing_elastic_out;
+		using glm::easing_elastic_in_out;
+		using glm::easing_back_in;
+		using glm::easing_back_out;
+		using glm::easing_back_in_out;
+		using glm::easing_bounce_in;
+		using glm::easing_bounce_out;
+		using glm::easing_bounce_in_out;
 
 #       if !((GLM_COMPILER & GLM_COMPILER_CUDA) || (GLM_COMPILER & GLM_COMPILER_HIP))
 		using glm::to_string;
+#       endif
+#       if GLM_LANG & GLM_LANG_CXX17_FLAG
+		using glm::to_chars;
+		using glm::from_chars;
+#       endif
+#       if defined(__cpp_structured_bindings) && __cpp_structured_bindings >= 201606L
+		using glm::get;
 #       endif
 		using glm::operator*;
 		using glm::operator/;
 		using glm::components;
 		using glm::begin;
 		using glm::end;
+		using glm::rbegin;
+		using glm::rend;
 
 		using glm::abs;
 		using glm::acos;
@@ -2223,6 +2505,7 @@ export namespace glm {
 		using glm::angle;
 		using glm::angleAxis;
 		using glm::any;
+		using glm::applyPermutation;
 		using glm::areCollinear;
 		using glm::areOrthogonal;
 		using glm::areOrthonormal;
@@ -2231,6 +2514,7 @@ export namespace glm {
 		using glm::associatedMax;
 		using glm::associatedMin;
 		using glm::atan;
+		using glm::atan2;
 		using glm::atanh;
 		using glm::axis;
 		using glm::axisAngle;
@@ -2283,10 +2567,12 @@ export namespace glm {
 		using glm::cubicEaseInOut;
 		using glm::cubicEaseOut;
 		using glm::decompose;
+		using glm::decomposeTRS;
 		using glm::degrees;
 		using glm::derivedEulerAngleX;
 		using glm::derivedEulerAngleY;
 		using glm::derivedEulerAngleZ;
+		using glm::deserialize;
 		using glm::determinant;
 		using glm::diagonal2x2;
 		using glm::diagonal2x3;
@@ -2300,9 +2586,16 @@ export namespace glm {
 		using glm::distance;
 		using glm::distance2;
 		using glm::dot;
+		using glm::downsample;
+		using glm::downsampleKaiser;
+		using glm::downsampleKaiserSRGB;
+		using glm::downsampleSRGB;
 		using glm::dual_quat_identity;
+		using glm::dualquat_blend;
 		using glm::dualquat_cast;
+		using glm::dualquat_skin;
 		using glm::e;
+		using glm::ease;
 		using glm::elasticEaseIn;
 		using glm::elasticEaseInOut;
 		using glm::elasticEaseOut;
@@ -2354,6 +2647,7 @@ export namespace glm {
 		using glm::extractEulerAngleZYZ;
 		using glm::extractMatrixRotation;
 		using glm::extractRealComponent;
+		using glm::extractRotation;
 		using glm::faceforward;
 		using glm::factorial;
 		using glm::fastAcos;
@@ -2375,6 +2669,10 @@ export namespace glm {
 		using glm::fastSqrt;
 		using glm::fastTan;
 		using glm::fclamp;
+		using glm::fcompMax;
+		using glm::fcompMin;
+		using glm::findEigenvaluesSymReal;
+		using glm::findEigenvaluesSymRealJacobi;
 		using glm::findLSB;
 		using glm::findMSB;
 		using glm::fliplr;
@@ -2404,8 +2702,11 @@ export namespace glm {
 		using glm::greaterThan;
 		using glm::greaterThanEqual;
 		using glm::half_pi;
+		using glm::hashValue;
 		using glm::hermite;
 		using glm::highestBitValue;
+		using glm::hilbertOrder;
+		using glm::hostEndianness;
 		using glm::hsvColor;
 		using glm::identity;
 		using glm::imulExtended;
@@ -2442,6 +2743,7 @@ export namespace glm {
 		using glm::lerp;
 		using glm::lessThan;
 		using glm::lessThanEqual;
+		using glm::levels;
 		using glm::linearGradient;
 		using glm::linearInterpolation;
 		using glm::ln_ln_two;
@@ -2482,12 +2784,18 @@ export namespace glm {
 		using glm::matrixCross4;
 		using glm::max;
 		using glm::min;
+		using glm::mipChain;
+		using glm::mipChainSize;
+		using glm::mipExtent;
+		using glm::mipOffset;
+		using glm::mipSize;
 		using glm::mirrorClamp;
 		using glm::mirrorRepeat;
 		using glm::mix;
 		using glm::mixedProduct;
 		using glm::mod;
 		using glm::modf;
+		using glm::mortonOrder;
 		using glm::nlz;
 		using glm::normalize;
 		using glm::normalizeDot;
@@ -2545,6 +2853,7 @@ export namespace glm {
 		using glm::pickMatrix;
 		using glm::pitch;
 		using glm::polar;
+		using glm::polarDecompose;
 		using glm::pow;
 		using glm::pow2;
 		using glm::pow3;
@@ -2576,9 +2885,13 @@ export namespace glm {
 		using glm::quinticEaseOut;
 		using glm::radialGradient;
 		using glm::radians;
+		using glm::readSerialHeader;
 		using glm::recompose;
 		using glm::reflect;
+		using glm::reflect2D;
+		using glm::reflect3D;
 		using glm::refract;
+		using glm::remapVertices;
 		using glm::repeat;
 		using glm::rgb2YCoCg;
 		using glm::rgb2YCoCgR;
@@ -2604,11 +2917,17 @@ export namespace glm {
 		using glm::rowMajor3;
 		using glm::rowMajor4;
 		using glm::rq_decompose;
+		using glm::saturate;
 		using glm::saturation;
 		using glm::scale;
 		using glm::scaleBias;
+		using glm::serialize;
+		using glm::serializedData;
+		using glm::serializedSize;
+		using glm::shearX;
 		using glm::shearX2D;
 		using glm::shearX3D;
+		using glm::shearY;
 		using glm::shearY2D;
 		using glm::shearY3D;
 		using glm::shearZ3D;
@@ -2622,6 +2941,10 @@ export namespace glm {
 		using glm::slerp;
 		using glm::smoothstep;
 		using glm::sortEigenvalues;
+		using glm::sortPermutation;
+		using glm::spatialCell;
+		using glm::spatialHash;
+		using glm::spatialSort;
 		using glm::sqrt;
 		using glm::squad;
 		using glm::step;
@@ -2656,11 +2979,346 @@ export namespace glm {
 		using glm::uround;
 		using glm::usubBorrow;
 		using glm::value_ptr;
+		using glm::weldVertices;
 		using glm::wrapAngle;
+		using glm::ww;
+		using glm::www;
+		using glm::wwww;
+		using glm::wwwx;
+		using glm::wwwy;
+		using glm::wwwz;
+		using glm::wwx;
+		using glm::wwxw;
+		using glm::wwxx;
+		using glm::wwxy;
+		using glm::wwxz;
+		using glm::wwy;
+		using glm::wwyw;
+		using glm::wwyx;
+		using glm::wwyy;
+		using glm::wwyz;
+		using glm::wwz;
+		using glm::wwzw;
+		using glm::wwzx;
+		using glm::wwzy;
+		using glm::wwzz;
+		using glm::wx;
+		using glm::wxw;
+		using glm::wxww;
+		using glm::wxwx;
+		using glm::wxwy;
+		using glm::wxwz;
+		using glm::wxx;
+		using glm::wxxw;
+		using glm::wxxx;
+		using glm::wxxy;
+		using glm::wxxz;
+		using glm::wxy;
+		using glm::wxyw;
+		using glm::wxyx;
+		using glm::wxyy;
 		using glm::wxyz;
+		using glm::wxz;
+		using glm::wxzw;
+		using glm::wxzx;
+		using glm::wxzy;
+		using glm::wxzz;
+		using glm::wy;
+		using glm::wyw;
+		using glm::wyww;
+		using glm::wywx;
+		using glm::wywy;
+		using glm::wywz;
+		using glm::wyx;
+		using glm::wyxw;
+		using glm::wyxx;
+		using glm::wyxy;
+		using glm::wyxz;
+		using glm::wyy;
+		using glm::wyyw;
+		using glm::wyyx;
+		using glm::wyyy;
+		using glm::wyyz;
+		using glm::wyz;
+		using glm::wyzw;
+		using glm::wyzx;
+		using glm::wyzy;
+		using glm::wyzz;
+		using glm::wz;
+		using glm::wzw;
+		using glm::wzww;
+		using glm::wzwx;
+		using glm::wzwy;
+		using glm::wzwz;
+		using glm::wzx;
+		using glm::wzxw;
+		using glm::wzxx;
+		using glm::wzxy;
+		using glm::wzxz;
+		using glm::wzy;
+		using glm::wzyw;
+		using glm::wzyx;
+		using glm::wzyy;
+		using glm::wzyz;
+		using glm::wzz;
+		using glm::wzzw;
+		using glm::wzzx;
+		using glm::wzzy;
+		using glm::wzzz;
+		using glm::xw;
+		using glm::xww;
+		using glm::xwww;
+		using glm::xwwx;
+		using glm::xwwy;
+		using glm::xwwz;
+		using glm::xwx;
+		using glm::xwxw;
+		using glm::xwxx;
+		using glm::xwxy;
+		using glm::xwxz;
+		using glm::xwy;
+		using glm::xwyw;
+		using glm::xwyx;
+		using glm::xwyy;
+		using glm::xwyz;
+		using glm::xwz;
+		using glm::xwzw;
+		using glm::xwzx;
+		using glm::xwzy;
+		using glm::xwzz;
+		using glm::xx;
+		using glm::xxw;
+		using glm::xxww;
+		using glm::xxwx;
+		using glm::xxwy;
+		using glm::xxwz;
+		using glm::xxx;
+		using glm::xxxw;
+		using glm::xxxx;
+		using glm::xxxy;
+		using glm::xxxz;
+		using glm::xxy;
+		using glm::xxyw;
+		using glm::xxyx;
+		using glm::xxyy;
+		using glm::xxyz;
+		using glm::xxz;
+		using glm::xxzw;
+		using glm::xxzx;
+		using glm::xxzy;
+		using glm::xxzz;
+		using glm::xy;
+		using glm::xyw;
+		using glm::xyww;
+		using glm::xywx;
+		using glm::xywy;
+		using glm::xywz;
+		using glm::xyx;
+		using glm::xyxw;
+		using glm::xyxx;
+		using glm::xyxy;
+		using glm::xyxz;
+		using glm::xyy;
+		using glm::xyyw;
+		using glm::xyyx;
+		using glm::xyyy;
+		using glm::xyyz;
+		using glm::xyz;
+		using glm::xyzw;
+		using glm::xyzx;
+		using glm::xyzy;
+		using glm::xz;
+		using glm::xzw;
+		using glm::xzww;
+		using glm::xzwx;
+		using glm::xzwy;
+		using glm::xzwz;
+		using glm::xzx;
+		using glm::xzxw;
+		using glm::xzxx;
+		using glm::xzxy;
+		using glm::xzxz;
+		using glm::xzy;
+		using glm::xzyw;
+		using glm::xzyx;
+		using glm::xzyy;
+		using glm::xzyz;
+		using glm::xzz;
+		using glm::xzzw;
+		using glm::xzzx;
+		using glm::xzzy;
+		using glm::xzzz;
 		using glm::yaw;
 		using glm::yawPitchRoll;
+		using glm::yw;
+		using glm::yww;
+		using glm::ywww;
+		using glm::ywwx;
+		using glm::ywwy;
+		using glm::ywwz;
+		using glm::ywx;
+		using glm::ywxw;
+		using glm::ywxx;
+		using glm::ywxy;
+		using glm::ywxz;
+		using glm::ywy;
+		using glm::ywyw;
+		using glm::ywyx;
+		using glm::ywyy;
+		using glm::ywyz;
+		using glm::ywz;
+		using glm::ywzw;
+		using glm::ywzx;
+		using glm::ywzy;
+		using glm::ywzz;
+		using glm::yx;
+		using glm::yxw;
+		using glm::yxww;
+		using glm::yxwx;
+		using glm::yxwy;
+		using glm::yxwz;
+		using glm::yxx;
+		using glm::yxxw;
+		using glm::yxxx;
+		using glm::yxxy;
+		using glm::yxxz;
+		using glm::yxy;
+		using glm::yxyw;
+		using glm::yxyx;
+		using glm::yxyy;
+		using glm::yxyz;
+		using glm::yxz;
+		using glm::yxzw;
+		using glm::yxzx;
+		using glm::yxzy;
+		using glm::yxzz;
+		using glm::yy;
+		using glm::yyw;
+		using glm::yyww;
+		using glm::yywx;
+		using glm::yywy;
+		using glm::yywz;
+		using glm::yyx;
+		using glm::yyxw;
+		using glm::yyxx;
+		using glm::yyxy;
+		using glm::yyxz;
+		using glm::yyy;
+		using glm::yyyw;
+		using glm::yyyx;
+		using glm::yyyy;
+		using glm::yyyz;
+		using glm::yyz;
+		using glm::yyzw;
+		using glm::yyzx;
+		using glm::yyzy;
+		using glm::yyzz;
+		using glm::yz;
+		using glm::yzw;
+		using glm::yzww;
+		using glm::yzwx;
+		using glm::yzwy;
+		using glm::yzwz;
+		using glm::yzx;
+		using glm::yzxw;
+		using glm::yzxx;
+		using glm::yzxy;
+		using glm::yzxz;
+		using glm::yzy;
+		using glm::yzyw;
+		using glm::yzyx;
+		using glm::yzyy;
+		using glm::yzyz;
+		using glm::yzz;
+		using glm::yzzw;
+		using glm::yzzx;
+		using glm::yzzy;
+		using glm::yzzz;
 		using glm::zero;
+		using glm::zw;
+		using glm::zww;
+		using glm::zwww;
+		using glm::zwwx;
+		using glm::zwwy;
+		using glm::zwwz;
+		using glm::zwx;
+		using glm::zwxw;
+		using glm::zwxx;
+		using glm::zwxy;
+		using glm::zwxz;
+		using glm::zwy;
+		using glm::zwyw;
+		using glm::zwyx;
+		using glm::zwyy;
+		using glm::zwyz;
+		using glm::zwz;
+		using glm::zwzw;
+		using glm::zwzx;
+		using glm::zwzy;
+		using glm::zwzz;
+		using glm::zx;
+		using glm::zxw;
+		using glm::zxww;
+		using glm::zxwx;
+		using glm::zxwy;
+		using glm::zxwz;
+		using glm::zxx;
+		using glm::zxxw;
+		using glm::zxxx;
+		using glm::zxxy;
+		using glm::zxxz;
+		using glm::zxy;
+		using glm::zxyw;
+		using glm::zxyx;
+		using glm::zxyy;
+		using glm::zxyz;
+		using glm::zxz;
+		using glm::zxzw;
+		using glm::zxzx;
+		using glm::zxzy;
+		using glm::zxzz;
+		using glm::zy;
+		using glm::zyw;
+		using glm::zyww;
+		using glm::zywx;
+		using glm::zywy;
+		using glm::zywz;
+		using glm::zyx;
+		using glm::zyxw;
+		using glm::zyxx;
+		using glm::zyxy;
+		using glm::zyxz;
+		using glm::zyy;
+		using glm::zyyw;
+		using glm::zyyx;
+		using glm::zyyy;
+		using glm::zyyz;
+		using glm::zyz;
+		using glm::zyzw;
+		using glm::zyzx;
+		using glm::zyzy;
+		using glm::zyzz;
+		using glm::zz;
+		using glm::zzw;
+		using glm::zzww;
+		using glm::zzwx;
+		using glm::zzwy;
+		using glm::zzwz;
+		using glm::zzx;
+		using glm::zzxw;
+		using glm::zzxx;
+		using glm::zzxy;
+		using glm::zzxz;
+		using glm::zzy;
+		using glm::zzyw;
+		using glm::zzyx;
+		using glm::zzyy;
+		using glm::zzyz;
+		using glm::zzz;
+		using glm::zzzw;
+		using glm::zzzx;
+		using glm::zzzy;
+		using glm::zzzz;
 	}
 #   endif
 }
@@ -135,3 +135,44 @@
 #include "matrix.hpp"
 #include "vector_relational.hpp"
 #include "integer.hpp"
+
+#if GLM_CONFIG_EXTERN_TEMPLATE == GLM_ENABLE
+namespace glm
+{
+	extern template struct vec<2, float, defaultp>;
+	extern template struct vec<3, float, defaultp>;
+	extern template struct vec<4, float, defaultp>;
+	extern template struct vec<2, double, defaultp>;
+	extern template struct vec<3, double, defaultp>;
+	extern template struct vec<4, double, defaultp>;
+	extern template struct vec<2, int, defaultp>;
+	extern template struct vec<3, int, defaultp>;
+	extern template struct vec<4, int, defaultp>;
+	extern template struct vec<2, uint, defaultp>;
+	extern template struct vec<3, uint, defaultp>;
+	extern template struct vec<4, uint, defaultp>;
+
+	extern template struct mat<2, 2, float, defaultp>;
+	extern template struct mat<2, 3, float, defaultp>;
+	extern template struct mat<2, 4, float, defaultp>;
+	extern template struct mat<3, 2, float, defaultp>;
+	extern template struct mat<3, 3, float, defaultp>;
+	extern template struct mat<3, 4, float, defaultp>;
+	extern template struct mat<4, 2, float, defaultp>;
+	extern template struct mat<4, 3, float, defaultp>;
+	extern template struct mat<4, 4, float, defaultp>;
+	extern template struct mat<2, 2, double, defaultp>;
+	extern template struct mat<2, 3, double, defaultp>;
+	extern template struct mat<2, 4, double, defaultp>;
+	extern template struct mat<3, 2, double, defaultp>;
+	extern template struct mat<3, 3, double, defaultp>;
+	extern template struct mat<3, 4, double, defaultp>;
+	extern template struct mat<4, 2, double, defaultp>;
+	extern template struct mat<4, 3, double, defaultp>;
+	extern template struct mat<4, 4, double, defaultp>;
+}//namespace glm
+
+#	define GLM_EXTERN_TEMPLATE extern template
+#	include "detail/glm_extern.inl"
+#	undef GLM_EXTERN_TEMPLATE
+#endif//GLM_CONFIG_EXTERN_TEMPLATE == GLM_ENABLE
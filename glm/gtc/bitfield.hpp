@@ -22,6 +22,10 @@
 #include "../detail/_vectorize.hpp"
 #include "type_precision.hpp"
 #include <limits>
+#include <cstddef>
+#if GLM_CONFIG_CPU_DISPATCH == GLM_ENABLE
+#	include "../ext/cpu_dispatch.hpp"
+#endif
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_bitfield extension included")
@@ -260,6 +264,74 @@ namespace glm
 	/// @see gtc_bitfield
 	GLM_FUNC_DECL uint64 bitfieldInterleave(uint16 x, uint16 y, uint16 z, uint16 w);
 
+	/// Deinterleaves the bits of x into three components, reverses bitfieldInterleave(uint8, uint8, uint8).
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL glm::u8vec3 bitfieldDeinterleave3(glm::uint32 x);
+
+	/// Deinterleaves the bits of x into three components of 21 bits, reverses bitfieldInterleave(uint32, uint32, uint32).
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL glm::u32vec3 bitfieldDeinterleave3(glm::uint64 x);
+
+	/// Interleaves the bits of Count vectors, equivalent to calling bitfieldInterleave(u32vec2) on each of them.
+	/// With GLM_FORCE_CPU_DISPATCH, uses the kernel of the host tier, see GLM_EXT_cpu_dispatch.
+	///
+	/// @see gtc_bitfield
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldInterleave(vec<2, uint32, Q> const* In, std::size_t Count, uint64* Out);
+
+	/// Interleaves the 21 low bits of each component of Count vectors, equivalent to calling bitfieldInterleave(u32vec3) on each of them.
+	/// Uses SIMD instructions for several vectors at once when BMI2 is not available.
+	/// With GLM_FORCE_CPU_DISPATCH, uses the kernel of the host tier, see GLM_EXT_cpu_dispatch.
+	///
+	/// @see gtc_bitfield
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldInterleave(vec<3, uint32, Q> const* In, std::size_t Count, uint64* Out);
+
+	/// Returns the index of v along a 2D Hilbert curve of 32 bits per axis.
+	/// Unlike the Morton order of bitfieldInterleave, consecutive indices are always neighbour cells.
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL glm::uint64 hilbertEncode(u32vec2 const& v);
+
+	/// Returns the index of v along a 3D Hilbert curve of 21 bits per axis, higher bits of v are ignored.
+	/// Unlike the Morton order of bitfieldInterleave, consecutive indices are always neighbour cells.
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL glm::uint64 hilbertEncode(u32vec3 const& v);
+
+	/// Returns the coordinates of the 2D Hilbert curve index x, reverses hilbertEncode(u32vec2).
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL glm::u32vec2 hilbertDecode2(glm::uint64 x);
+
+	/// Returns the coordinates of the 3D Hilbert curve index x, reverses hilbertEncode(u32vec3).
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL glm::u32vec3 hilbertDecode3(glm::uint64 x);
+
+	/// Computes the Morton codes of Count 2D or 3D floating-point positions.
+	/// Positions are quantized on a grid spanning the [Min, Max] box, with 32 bits per axis in 2D and 21 bits per axis in 3D.
+	/// Positions outside of the box are clamped.
+	///
+	/// @tparam L 2 or 3
+	/// @tparam T Floating-point scalar types
+	///
+	/// @see gtc_bitfield
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void mortonEncode(vec<L, T, Q> const* Positions, std::size_t Count, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, uint64* Out);
+
+	/// Computes the Hilbert curve indices of Count 2D or 3D floating-point positions, quantized like mortonEncode.
+	///
+	/// @tparam L 2 or 3
+	/// @tparam T Floating-point scalar types
+	///
+	/// @see gtc_bitfield
+	/// @see mortonEncode
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void hilbertEncode(vec<L, T, Q> const* Positions, std::size_t Count, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, uint64* Out);
+
 	/// @}
 } //namespace glm
 
@@ -17,207 +17,441 @@ namespace detail
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint16 bitfieldInterleave(glm::uint8 x, glm::uint8 y)
 	{
-		glm::uint16 REG1(x);
-		glm::uint16 REG2(y);
+#		if GLM_HAS_BMI2
+			return static_cast<glm::uint16>(_pdep_u32(x, 0x5555u) | _pdep_u32(y, 0xAAAAu));
+#		else
+			glm::uint16 REG1(x);
+			glm::uint16 REG2(y);
 
-		REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint16>(0x0F0F);
-		REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint16>(0x0F0F);
+			REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint16>(0x0F0F);
+			REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint16>(0x0F0F);
 
-		REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint16>(0x3333);
-		REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint16>(0x3333);
+			REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint16>(0x3333);
+			REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint16>(0x3333);
 
-		REG1 = ((REG1 <<  1) | REG1) & static_cast<glm::uint16>(0x5555);
-		REG2 = ((REG2 <<  1) | REG2) & static_cast<glm::uint16>(0x5555);
+			REG1 = ((REG1 <<  1) | REG1) & static_cast<glm::uint16>(0x5555);
+			REG2 = ((REG2 <<  1) | REG2) & static_cast<glm::uint16>(0x5555);
 
-		return REG1 | static_cast<glm::uint16>(REG2 << 1);
+			return REG1 | static_cast<glm::uint16>(REG2 << 1);
+#		endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint16 x, glm::uint16 y)
 	{
-		glm::uint32 REG1(x);
-		glm::uint32 REG2(y);
+#		if GLM_HAS_BMI2
+			return _pdep_u32(x, 0x55555555u) | _pdep_u32(y, 0xAAAAAAAAu);
+#		else
+			glm::uint32 REG1(x);
+			glm::uint32 REG2(y);
 
-		REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint32>(0x00FF00FF);
-		REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint32>(0x00FF00FF);
+			REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint32>(0x00FF00FF);
+			REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint32>(0x00FF00FF);
 
-		REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint32>(0x0F0F0F0F);
-		REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint32>(0x0F0F0F0F);
+			REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint32>(0x0F0F0F0F);
+			REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint32>(0x0F0F0F0F);
 
-		REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint32>(0x33333333);
-		REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint32>(0x33333333);
+			REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint32>(0x33333333);
+			REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint32>(0x33333333);
 
-		REG1 = ((REG1 <<  1) | REG1) & static_cast<glm::uint32>(0x55555555);
-		REG2 = ((REG2 <<  1) | REG2) & static_cast<glm::uint32>(0x55555555);
+			REG1 = ((REG1 <<  1) | REG1) & static_cast<glm::uint32>(0x55555555);
+			REG2 = ((REG2 <<  1) | REG2) & static_cast<glm::uint32>(0x55555555);
 
-		return REG1 | (REG2 << 1);
+			return REG1 | (REG2 << 1);
+#		endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint32 x, glm::uint32 y)
 	{
-		glm::uint64 REG1(x);
-		glm::uint64 REG2(y);
+#		if GLM_HAS_BMI2
+			return _pdep_u64(x, 0x5555555555555555ull) | _pdep_u64(y, 0xAAAAAAAAAAAAAAAAull);
+#		else
+			glm::uint64 REG1(x);
+			glm::uint64 REG2(y);
 
-		REG1 = ((REG1 << 16) | REG1) & static_cast<glm::uint64>(0x0000FFFF0000FFFFull);
-		REG2 = ((REG2 << 16) | REG2) & static_cast<glm::uint64>(0x0000FFFF0000FFFFull);
+			REG1 = ((REG1 << 16) | REG1) & static_cast<glm::uint64>(0x0000FFFF0000FFFFull);
+			REG2 = ((REG2 << 16) | REG2) & static_cast<glm::uint64>(0x0000FFFF0000FFFFull);
 
-		REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint64>(0x00FF00FF00FF00FFull);
-		REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint64>(0x00FF00FF00FF00FFull);
+			REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint64>(0x00FF00FF00FF00FFull);
+			REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint64>(0x00FF00FF00FF00FFull);
 
-		REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint64>(0x0F0F0F0F0F0F0F0Full);
-		REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint64>(0x0F0F0F0F0F0F0F0Full);
+			REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint64>(0x0F0F0F0F0F0F0F0Full);
+			REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint64>(0x0F0F0F0F0F0F0F0Full);
 
-		REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint64>(0x3333333333333333ull);
-		REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint64>(0x3333333333333333ull);
+			REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint64>(0x3333333333333333ull);
+			REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint64>(0x3333333333333333ull);
 
-		REG1 = ((REG1 <<  1) | REG1) & static_cast<glm::uint64>(0x5555555555555555ull);
-		REG2 = ((REG2 <<  1) | REG2) & static_cast<glm::uint64>(0x5555555555555555ull);
+			REG1 = ((REG1 <<  1) | REG1) & static_cast<glm::uint64>(0x5555555555555555ull);
+			REG2 = ((REG2 <<  1) | REG2) & static_cast<glm::uint64>(0x5555555555555555ull);
 
-		return REG1 | (REG2 << 1);
+			return REG1 | (REG2 << 1);
+#		endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint8 x, glm::uint8 y, glm::uint8 z)
 	{
-		glm::uint32 REG1(x);
-		glm::uint32 REG2(y);
-		glm::uint32 REG3(z);
+#		if GLM_HAS_BMI2
+			return _pdep_u32(x, 0x00249249u) | _pdep_u32(y, 0x00492492u) | _pdep_u32(z, 0x00924924u);
+#		else
+			glm::uint32 REG1(x);
+			glm::uint32 REG2(y);
+			glm::uint32 REG3(z);
 
-		REG1 = ((REG1 << 16) | REG1) & static_cast<glm::uint32>(0xFF0000FFu);
-		REG2 = ((REG2 << 16) | REG2) & static_cast<glm::uint32>(0xFF0000FFu);
-		REG3 = ((REG3 << 16) | REG3) & static_cast<glm::uint32>(0xFF0000FFu);
+			REG1 = ((REG1 << 16) | REG1) & static_cast<glm::uint32>(0xFF0000FFu);
+			REG2 = ((REG2 << 16) | REG2) & static_cast<glm::uint32>(0xFF0000FFu);
+			REG3 = ((REG3 << 16) | REG3) & static_cast<glm::uint32>(0xFF0000FFu);
 
-		REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint32>(0x0F00F00Fu);
-		REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint32>(0x0F00F00Fu);
-		REG3 = ((REG3 <<  8) | REG3) & static_cast<glm::uint32>(0x0F00F00Fu);
+			REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint32>(0x0F00F00Fu);
+			REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint32>(0x0F00F00Fu);
+			REG3 = ((REG3 <<  8) | REG3) & static_cast<glm::uint32>(0x0F00F00Fu);
 
-		REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint32>(0xC30C30C3u);
-		REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint32>(0xC30C30C3u);
-		REG3 = ((REG3 <<  4) | REG3) & static_cast<glm::uint32>(0xC30C30C3u);
+			REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint32>(0xC30C30C3u);
+			REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint32>(0xC30C30C3u);
+			REG3 = ((REG3 <<  4) | REG3) & static_cast<glm::uint32>(0xC30C30C3u);
 
-		REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint32>(0x49249249u);
-		REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint32>(0x49249249u);
-		REG3 = ((REG3 <<  2) | REG3) & static_cast<glm::uint32>(0x49249249u);
+			REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint32>(0x49249249u);
+			REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint32>(0x49249249u);
+			REG3 = ((REG3 <<  2) | REG3) & static_cast<glm::uint32>(0x49249249u);
 
-		return REG1 | (REG2 << 1) | (REG3 << 2);
+			return REG1 | (REG2 << 1) | (REG3 << 2);
+#		endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint16 x, glm::uint16 y, glm::uint16 z)
 	{
-		glm::uint64 REG1(x);
-		glm::uint64 REG2(y);
-		glm::uint64 REG3(z);
+#		if GLM_HAS_BMI2
+			return _pdep_u64(x, 0x1249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull) | _pdep_u64(z, 0x4924924924924924ull);
+#		else
+			glm::uint64 REG1(x);
+			glm::uint64 REG2(y);
+			glm::uint64 REG3(z);
 
-		REG1 = ((REG1 << 32) | REG1) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
-		REG2 = ((REG2 << 32) | REG2) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
-		REG3 = ((REG3 << 32) | REG3) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
+			REG1 = ((REG1 << 32) | REG1) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
+			REG2 = ((REG2 << 32) | REG2) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
+			REG3 = ((REG3 << 32) | REG3) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
 
-		REG1 = ((REG1 << 16) | REG1) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
-		REG2 = ((REG2 << 16) | REG2) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
-		REG3 = ((REG3 << 16) | REG3) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
+			REG1 = ((REG1 << 16) | REG1) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
+			REG2 = ((REG2 << 16) | REG2) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
+			REG3 = ((REG3 << 16) | REG3) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
 
-		REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
-		REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
-		REG3 = ((REG3 <<  8) | REG3) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
+			REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
+			REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
+			REG3 = ((REG3 <<  8) | REG3) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
 
-		REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
-		REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
-		REG3 = ((REG3 <<  4) | REG3) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
+			REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
+			REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
+			REG3 = ((REG3 <<  4) | REG3) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
 
-		REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint64>(0x9249249249249249ull);
-		REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint64>(0x9249249249249249ull);
-		REG3 = ((REG3 <<  2) | REG3) & static_cast<glm::uint64>(0x9249249249249249ull);
+			REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint64>(0x9249249249249249ull);
+			REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint64>(0x9249249249249249ull);
+			REG3 = ((REG3 <<  2) | REG3) & static_cast<glm::uint64>(0x9249249249249249ull);
 
-		return REG1 | (REG2 << 1) | (REG3 << 2);
+			return REG1 | (REG2 << 1) | (REG3 << 2);
+#		endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint32 x, glm::uint32 y, glm::uint32 z)
 	{
-		glm::uint64 REG1(x);
-		glm::uint64 REG2(y);
-		glm::uint64 REG3(z);
+#		if GLM_HAS_BMI2
+			return _pdep_u64(x, 0x1249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull) | _pdep_u64(z, 0x4924924924924924ull);
+#		else
+			glm::uint64 REG1(x & 0x001FFFFFu);
+			glm::uint64 REG2(y & 0x001FFFFFu);
+			glm::uint64 REG3(z & 0x001FFFFFu);
 
-		REG1 = ((REG1 << 32) | REG1) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
-		REG2 = ((REG2 << 32) | REG2) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
-		REG3 = ((REG3 << 32) | REG3) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
+			REG1 = ((REG1 << 32) | REG1) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
+			REG2 = ((REG2 << 32) | REG2) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
+			REG3 = ((REG3 << 32) | REG3) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
 
-		REG1 = ((REG1 << 16) | REG1) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
-		REG2 = ((REG2 << 16) | REG2) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
-		REG3 = ((REG3 << 16) | REG3) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
+			REG1 = ((REG1 << 16) | REG1) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
+			REG2 = ((REG2 << 16) | REG2) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
+			REG3 = ((REG3 << 16) | REG3) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
 
-		REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
-		REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
-		REG3 = ((REG3 <<  8) | REG3) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
+			REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
+			REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
+			REG3 = ((REG3 <<  8) | REG3) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
 
-		REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
-		REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
-		REG3 = ((REG3 <<  4) | REG3) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
+			REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
+			REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
+			REG3 = ((REG3 <<  4) | REG3) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
 
-		REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint64>(0x9249249249249249ull);
-		REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint64>(0x9249249249249249ull);
-		REG3 = ((REG3 <<  2) | REG3) & static_cast<glm::uint64>(0x9249249249249249ull);
+			REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint64>(0x9249249249249249ull);
+			REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint64>(0x9249249249249249ull);
+			REG3 = ((REG3 <<  2) | REG3) & static_cast<glm::uint64>(0x9249249249249249ull);
 
-		return REG1 | (REG2 << 1) | (REG3 << 2);
+			return REG1 | (REG2 << 1) | (REG3 << 2);
+#		endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint8 x, glm::uint8 y, glm::uint8 z, glm::uint8 w)
 	{
-		glm::uint32 REG1(x);
-		glm::uint32 REG2(y);
-		glm::uint32 REG3(z);
-		glm::uint32 REG4(w);
+#		if GLM_HAS_BMI2
+			return _pdep_u32(x, 0x11111111u) | _pdep_u32(y, 0x22222222u) | _pdep_u32(z, 0x44444444u) | _pdep_u32(w, 0x88888888u);
+#		else
+			glm::uint32 REG1(x);
+			glm::uint32 REG2(y);
+			glm::uint32 REG3(z);
+			glm::uint32 REG4(w);
 
-		REG1 = ((REG1 << 12) | REG1) & static_cast<glm::uint32>(0x000F000Fu);
-		REG2 = ((REG2 << 12) | REG2) & static_cast<glm::uint32>(0x000F000Fu);
-		REG3 = ((REG3 << 12) | REG3) & static_cast<glm::uint32>(0x000F000Fu);
-		REG4 = ((REG4 << 12) | REG4) & static_cast<glm::uint32>(0x000F000Fu);
+			REG1 = ((REG1 << 12) | REG1) & static_cast<glm::uint32>(0x000F000Fu);
+			REG2 = ((REG2 << 12) | REG2) & static_cast<glm::uint32>(0x000F000Fu);
+			REG3 = ((REG3 << 12) | REG3) & static_cast<glm::uint32>(0x000F000Fu);
+			REG4 = ((REG4 << 12) | REG4) & static_cast<glm::uint32>(0x000F000Fu);
 
-		REG1 = ((REG1 <<  6) | REG1) & static_cast<glm::uint32>(0x03030303u);
-		REG2 = ((REG2 <<  6) | REG2) & static_cast<glm::uint32>(0x03030303u);
-		REG3 = ((REG3 <<  6) | REG3) & static_cast<glm::uint32>(0x03030303u);
-		REG4 = ((REG4 <<  6) | REG4) & static_cast<glm::uint32>(0x03030303u);
+			REG1 = ((REG1 <<  6) | REG1) & static_cast<glm::uint32>(0x03030303u);
+			REG2 = ((REG2 <<  6) | REG2) & static_cast<glm::uint32>(0x03030303u);
+			REG3 = ((REG3 <<  6) | REG3) & static_cast<glm::uint32>(0x03030303u);
+			REG4 = ((REG4 <<  6) | REG4) & static_cast<glm::uint32>(0x03030303u);
 
-		REG1 = ((REG1 <<  3) | REG1) & static_cast<glm::uint32>(0x11111111u);
-		REG2 = ((REG2 <<  3) | REG2) & static_cast<glm::uint32>(0x11111111u);
-		REG3 = ((REG3 <<  3) | REG3) & static_cast<glm::uint32>(0x11111111u);
-		REG4 = ((REG4 <<  3) | REG4) & static_cast<glm::uint32>(0x11111111u);
+			REG1 = ((REG1 <<  3) | REG1) & static_cast<glm::uint32>(0x11111111u);
+			REG2 = ((REG2 <<  3) | REG2) & static_cast<glm::uint32>(0x11111111u);
+			REG3 = ((REG3 <<  3) | REG3) & static_cast<glm::uint32>(0x11111111u);
+			REG4 = ((REG4 <<  3) | REG4) & static_cast<glm::uint32>(0x11111111u);
 
-		return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
+			return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
+#		endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint16 x, glm::uint16 y, glm::uint16 z, glm::uint16 w)
 	{
-		glm::uint64 REG1(x);
-		glm::uint64 REG2(y);
-		glm::uint64 REG3(z);
-		glm::uint64 REG4(w);
+#		if GLM_HAS_BMI2
+			return _pdep_u64(x, 0x1111111111111111ull) | _pdep_u64(y, 0x2222222222222222ull) | _pdep_u64(z, 0x4444444444444444ull) | _pdep_u64(w, 0x8888888888888888ull);
+#		else
+			glm::uint64 REG1(x);
+			glm::uint64 REG2(y);
+			glm::uint64 REG3(z);
+			glm::uint64 REG4(w);
 
-		REG1 = ((REG1 << 24) | REG1) & static_cast<glm::uint64>(0x000000FF000000FFull);
-		REG2 = ((REG2 << 24) | REG2) & static_cast<glm::uint64>(0x000000FF000000FFull);
-		REG3 = ((REG3 << 24) | REG3) & static_cast<glm::uint64>(0x000000FF000000FFull);
-		REG4 = ((REG4 << 24) | REG4) & static_cast<glm::uint64>(0x000000FF000000FFull);
+			REG1 = ((REG1 << 24) | REG1) & static_cast<glm::uint64>(0x000000FF000000FFull);
+			REG2 = ((REG2 << 24) | REG2) & static_cast<glm::uint64>(0x000000FF000000FFull);
+			REG3 = ((REG3 << 24) | REG3) & static_cast<glm::uint64>(0x000000FF000000FFull);
+			REG4 = ((REG4 << 24) | REG4) & static_cast<glm::uint64>(0x000000FF000000FFull);
 
-		REG1 = ((REG1 << 12) | REG1) & static_cast<glm::uint64>(0x000F000F000F000Full);
-		REG2 = ((REG2 << 12) | REG2) & static_cast<glm::uint64>(0x000F000F000F000Full);
-		REG3 = ((REG3 << 12) | REG3) & static_cast<glm::uint64>(0x000F000F000F000Full);
-		REG4 = ((REG4 << 12) | REG4) & static_cast<glm::uint64>(0x000F000F000F000Full);
+			REG1 = ((REG1 << 12) | REG1) & static_cast<glm::uint64>(0x000F000F000F000Full);
+			REG2 = ((REG2 << 12) | REG2) & static_cast<glm::uint64>(0x000F000F000F000Full);
+			REG3 = ((REG3 << 12) | REG3) & static_cast<glm::uint64>(0x000F000F000F000Full);
+			REG4 = ((REG4 << 12) | REG4) & static_cast<glm::uint64>(0x000F000F000F000Full);
 
-		REG1 = ((REG1 <<  6) | REG1) & static_cast<glm::uint64>(0x0303030303030303ull);
-		REG2 = ((REG2 <<  6) | REG2) & static_cast<glm::uint64>(0x0303030303030303ull);
-		REG3 = ((REG3 <<  6) | REG3) & static_cast<glm::uint64>(0x0303030303030303ull);
-		REG4 = ((REG4 <<  6) | REG4) & static_cast<glm::uint64>(0x0303030303030303ull);
+			REG1 = ((REG1 <<  6) | REG1) & static_cast<glm::uint64>(0x0303030303030303ull);
+			REG2 = ((REG2 <<  6) | REG2) & static_cast<glm::uint64>(0x0303030303030303ull);
+			REG3 = ((REG3 <<  6) | REG3) & static_cast<glm::uint64>(0x0303030303030303ull);
+			REG4 = ((REG4 <<  6) | REG4) & static_cast<glm::uint64>(0x0303030303030303ull);
 
-		REG1 = ((REG1 <<  3) | REG1) & static_cast<glm::uint64>(0x1111111111111111ull);
-		REG2 = ((REG2 <<  3) | REG2) & static_cast<glm::uint64>(0x1111111111111111ull);
-		REG3 = ((REG3 <<  3) | REG3) & static_cast<glm::uint64>(0x1111111111111111ull);
-		REG4 = ((REG4 <<  3) | REG4) & static_cast<glm::uint64>(0x1111111111111111ull);
+			REG1 = ((REG1 <<  3) | REG1) & static_cast<glm::uint64>(0x1111111111111111ull);
+			REG2 = ((REG2 <<  3) | REG2) & static_cast<glm::uint64>(0x1111111111111111ull);
+			REG3 = ((REG3 <<  3) | REG3) & static_cast<glm::uint64>(0x1111111111111111ull);
+			REG4 = ((REG4 <<  3) | REG4) & static_cast<glm::uint64>(0x1111111111111111ull);
 
-		return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
+			return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER glm::uint64 bitfieldCompact3(glm::uint64 x)
+	{
+		x &= static_cast<glm::uint64>(0x1249249249249249ull);
+		x = (x ^ (x >>  2)) & static_cast<glm::uint64>(0x10C30C30C30C30C3ull);
+		x = (x ^ (x >>  4)) & static_cast<glm::uint64>(0x100F00F00F00F00Full);
+		x = (x ^ (x >>  8)) & static_cast<glm::uint64>(0x001F0000FF0000FFull);
+		x = (x ^ (x >> 16)) & static_cast<glm::uint64>(0x001F00000000FFFFull);
+		x = (x ^ (x >> 32)) & static_cast<glm::uint64>(0x00000000001FFFFFull);
+		return x;
+	}
+
+	// Skilling's algorithm, "Programming the Hilbert curve", 2004.
+	// Converts coordinates of Bits bits in place into the transposed Hilbert index, whose bits interleaved with
+	// X[0] as the most significant bit of each group give the index along the curve.
+	template<length_t L>
+	GLM_FUNC_QUALIFIER void hilbertAxesToTranspose(glm::uint32* X, glm::uint32 Bits)
+	{
+		glm::uint32 const M = 1u << (Bits - 1);
+
+		// Inverse undo
+		for(glm::uint32 Q = M; Q > 1; Q >>= 1)
+		{
+			glm::uint32 const P = Q - 1;
+			for(length_t i = 0; i < L; ++i)
+			{
+				if(X[i] & Q)
+					X[0] ^= P;
+				else
+				{
+					glm::uint32 const t = (X[0] ^ X[i]) & P;
+					X[0] ^= t;
+					X[i] ^= t;
+				}
+			}
+		}
+
+		// Gray encode
+		for(length_t i = 1; i < L; ++i)
+			X[i] ^= X[i - 1];
+		glm::uint32 t = 0;
+		for(glm::uint32 Q = M; Q > 1; Q >>= 1)
+			if(X[L - 1] & Q)
+				t ^= Q - 1;
+		for(length_t i = 0; i < L; ++i)
+			X[i] ^= t;
+	}
+
+	template<length_t L>
+	GLM_FUNC_QUALIFIER void hilbertTransposeToAxes(glm::uint32* X, glm::uint32 Bits)
+	{
+		// Wraps to zero for 32 bits
+		glm::uint32 const N = 2u << (Bits - 1);
+
+		// Gray decode
+		glm::uint32 t = X[L - 1] >> 1;
+		for(length_t i = L - 1; i > 0; --i)
+			X[i] ^= X[i - 1];
+		X[0] ^= t;
+
+		// Undo excess work
+		for(glm::uint32 Q = 2; Q != N; Q <<= 1)
+		{
+			glm::uint32 const P = Q - 1;
+			for(length_t i = L; i-- > 0;)
+			{
+				if(X[i] & Q)
+					X[0] ^= P;
+				else
+				{
+					t = (X[0] ^ X[i]) & P;
+					X[0] ^= t;
+					X[i] ^= t;
+				}
+			}
+		}
+	}
+
+	// 2D codes use 32 bits per axis, more than the mantissa of float, so positions are quantized in double
+	template<length_t L, typename T>
+	struct morton_quantize_type
+	{
+		typedef T type;
+	};
+
+	template<typename T>
+	struct morton_quantize_type<2, T>
+	{
+		typedef double type;
+	};
+
+	template<length_t L>
+	struct morton_bits
+	{
+		static glm::uint32 const value = L == 2 ? 32 : 21;
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_morton_quantize
+	{
+		typedef typename morton_quantize_type<L, T>::type U;
+
+		GLM_FUNC_QUALIFIER static vec<L, glm::uint32, Q> call(vec<L, T, Q> const& p, vec<L, T, Q> const& Min, vec<L, U, Q> const& Scale)
+		{
+			U const Bound = static_cast<U>(~glm::uint64(0) >> (64 - morton_bits<L>::value));
+
+			vec<L, glm::uint32, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+			{
+				U const v = (static_cast<U>(p[i]) - static_cast<U>(Min[i])) * Scale[i];
+				Result[i] = static_cast<glm::uint32>(v > static_cast<U>(0) ? (v < Bound ? v : Bound) : static_cast<U>(0));
+			}
+			return Result;
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, typename morton_quantize_type<L, T>::type, Q> mortonQuantizeScale(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max)
+	{
+		typedef typename morton_quantize_type<L, T>::type U;
+		U const Bound = static_cast<U>(~glm::uint64(0) >> (64 - morton_bits<L>::value));
+
+		vec<L, U, Q> Result;
+		for(length_t i = 0; i < L; ++i)
+		{
+			U const Extent = static_cast<U>(Max[i]) - static_cast<U>(Min[i]);
+			Result[i] = Extent > static_cast<U>(0) ? Bound / Extent : static_cast<U>(0);
+		}
+		return Result;
+	}
+
+	template<length_t L>
+	struct compute_hilbert_encode
+	{};
+
+	template<>
+	struct compute_hilbert_encode<2>
+	{
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static glm::uint64 call(vec<2, glm::uint32, Q> const& v)
+		{
+			glm::uint32 X[2] = {v.x, v.y};
+			hilbertAxesToTranspose<2>(X, 32);
+			return bitfieldInterleave<glm::uint32, glm::uint64>(X[1], X[0]);
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void call(vec<2, glm::uint32, Q> const* In, std::size_t Count, glm::uint64* Out)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = call(In[i]);
+		}
+	};
+
+	template<>
+	struct compute_hilbert_encode<3>
+	{
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static glm::uint64 call(vec<3, glm::uint32, Q> const& v)
+		{
+			glm::uint32 X[3] = {v.x & 0x001FFFFFu, v.y & 0x001FFFFFu, v.z & 0x001FFFFFu};
+			hilbertAxesToTranspose<3>(X, 21);
+			return bitfieldInterleave<glm::uint32, glm::uint64>(X[2], X[1], X[0]);
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void call(vec<3, glm::uint32, Q> const* In, std::size_t Count, glm::uint64* Out)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = call(In[i]);
+		}
+	};
+
+	template<length_t L>
+	struct compute_morton_encode
+	{
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void call(vec<L, glm::uint32, Q> const* In, std::size_t Count, glm::uint64* Out)
+		{
+			glm::bitfieldInterleave(In, Count, Out);
+		}
+	};
+
+	template<template<length_t> class encode, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void quantizeEncode(vec<L, T, Q> const* Positions, std::size_t Count, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, glm::uint64* Out)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'mortonEncode' and 'hilbertEncode' only accept floating-point inputs");
+		static_assert(L == 2 || L == 3, "'mortonEncode' and 'hilbertEncode' only accept 2D and 3D positions");
+
+		vec<L, typename morton_quantize_type<L, T>::type, Q> const Scale = mortonQuantizeScale(Min, Max);
+
+		// Quantize in blocks small enough to stay in cache before encoding them
+		std::size_t const BlockSize = 64;
+		vec<L, glm::uint32, Q> Block[BlockSize];
+		for(std::size_t i = 0; i < Count; i += BlockSize)
+		{
+			std::size_t const Size = Count - i < BlockSize ? Count - i : BlockSize;
+			for(std::size_t j = 0; j < Size; ++j)
+				Block[j] = compute_morton_quantize<L, T, Q, detail::is_aligned<Q>::value>::call(Positions[i + j], Min, Scale);
+			encode<L>::call(Block, Size, Out + i);
+		}
 	}
 }//namespace detail
 
@@ -339,25 +573,29 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER u8vec2 bitfieldDeinterleave(glm::uint16 x)
 	{
-		uint16 REG1(x);
-		uint16 REG2(x >>= 1);
+#		if GLM_HAS_BMI2
+			return u8vec2(_pext_u32(x, 0x5555u), _pext_u32(x, 0xAAAAu));
+#		else
+			uint16 REG1(x);
+			uint16 REG2(x >>= 1);
 
-		REG1 = REG1 & static_cast<uint16>(0x5555);
-		REG2 = REG2 & static_cast<uint16>(0x5555);
+			REG1 = REG1 & static_cast<uint16>(0x5555);
+			REG2 = REG2 & static_cast<uint16>(0x5555);
 
-		REG1 = ((REG1 >> 1) | REG1) & static_cast<uint16>(0x3333);
-		REG2 = ((REG2 >> 1) | REG2) & static_cast<uint16>(0x3333);
+			REG1 = ((REG1 >> 1) | REG1) & static_cast<uint16>(0x3333);
+			REG2 = ((REG2 >> 1) | REG2) & static_cast<uint16>(0x3333);
 
-		REG1 = ((REG1 >> 2) | REG1) & static_cast<uint16>(0x0F0F);
-		REG2 = ((REG2 >> 2) | REG2) & static_cast<uint16>(0x0F0F);
+			REG1 = ((REG1 >> 2) | REG1) & static_cast<uint16>(0x0F0F);
+			REG2 = ((REG2 >> 2) | REG2) & static_cast<uint16>(0x0F0F);
 
-		REG1 = ((REG1 >> 4) | REG1) & static_cast<uint16>(0x00FF);
-		REG2 = ((REG2 >> 4) | REG2) & static_cast<uint16>(0x00FF);
+			REG1 = ((REG1 >> 4) | REG1) & static_cast<uint16>(0x00FF);
+			REG2 = ((REG2 >> 4) | REG2) & static_cast<uint16>(0x00FF);
 
-		REG1 = ((REG1 >> 8) | REG1) & static_cast<uint16>(0xFFFF);
-		REG2 = ((REG2 >> 8) | REG2) & static_cast<uint16>(0xFFFF);
+			REG1 = ((REG1 >> 8) | REG1) & static_cast<uint16>(0xFFFF);
+			REG2 = ((REG2 >> 8) | REG2) & static_cast<uint16>(0xFFFF);
 
-		return glm::u8vec2(REG1, REG2);
+			return glm::u8vec2(REG1, REG2);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER int32 bitfieldInterleave(int16 x, int16 y)
@@ -393,25 +631,29 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER glm::u16vec2 bitfieldDeinterleave(glm::uint32 x)
 	{
-		glm::uint32 REG1(x);
-		glm::uint32 REG2(x >>= 1);
+#		if GLM_HAS_BMI2
+			return glm::u16vec2(_pext_u32(x, 0x55555555u), _pext_u32(x, 0xAAAAAAAAu));
+#		else
+			glm::uint32 REG1(x);
+			glm::uint32 REG2(x >>= 1);
 
-		REG1 = REG1 & static_cast<glm::uint32>(0x55555555);
-		REG2 = REG2 & static_cast<glm::uint32>(0x55555555);
+			REG1 = REG1 & static_cast<glm::uint32>(0x55555555);
+			REG2 = REG2 & static_cast<glm::uint32>(0x55555555);
 
-		REG1 = ((REG1 >> 1) | REG1) & static_cast<glm::uint32>(0x33333333);
-		REG2 = ((REG2 >> 1) | REG2) & static_cast<glm::uint32>(0x33333333);
+			REG1 = ((REG1 >> 1) | REG1) & static_cast<glm::uint32>(0x33333333);
+			REG2 = ((REG2 >> 1) | REG2) & static_cast<glm::uint32>(0x33333333);
 
-		REG1 = ((REG1 >> 2) | REG1) & static_cast<glm::uint32>(0x0F0F0F0F);
-		REG2 = ((REG2 >> 2) | REG2) & static_cast<glm::uint32>(0x0F0F0F0F);
+			REG1 = ((REG1 >> 2) | REG1) & static_cast<glm::uint32>(0x0F0F0F0F);
+			REG2 = ((REG2 >> 2) | REG2) & static_cast<glm::uint32>(0x0F0F0F0F);
 
-		REG1 = ((REG1 >> 4) | REG1) & static_cast<glm::uint32>(0x00FF00FF);
-		REG2 = ((REG2 >> 4) | REG2) & static_cast<glm::uint32>(0x00FF00FF);
+			REG1 = ((REG1 >> 4) | REG1) & static_cast<glm::uint32>(0x00FF00FF);
+			REG2 = ((REG2 >> 4) | REG2) & static_cast<glm::uint32>(0x00FF00FF);
 
-		REG1 = ((REG1 >> 8) | REG1) & static_cast<glm::uint32>(0x0000FFFF);
-		REG2 = ((REG2 >> 8) | REG2) & static_cast<glm::uint32>(0x0000FFFF);
+			REG1 = ((REG1 >> 8) | REG1) & static_cast<glm::uint32>(0x0000FFFF);
+			REG2 = ((REG2 >> 8) | REG2) & static_cast<glm::uint32>(0x0000FFFF);
 
-		return glm::u16vec2(REG1, REG2);
+			return glm::u16vec2(REG1, REG2);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER int64 bitfieldInterleave(int32 x, int32 y)
@@ -447,28 +689,32 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER glm::u32vec2 bitfieldDeinterleave(glm::uint64 x)
 	{
-		glm::uint64 REG1(x);
-		glm::uint64 REG2(x >>= 1);
+#		if GLM_HAS_BMI2
+			return glm::u32vec2(_pext_u64(x, 0x5555555555555555ull), _pext_u64(x, 0xAAAAAAAAAAAAAAAAull));
+#		else
+			glm::uint64 REG1(x);
+			glm::uint64 REG2(x >>= 1);
 
-		REG1 = REG1 & static_cast<glm::uint64>(0x5555555555555555ull);
-		REG2 = REG2 & static_cast<glm::uint64>(0x5555555555555555ull);
+			REG1 = REG1 & static_cast<glm::uint64>(0x5555555555555555ull);
+			REG2 = REG2 & static_cast<glm::uint64>(0x5555555555555555ull);
 
-		REG1 = ((REG1 >> 1) | REG1) & static_cast<glm::uint64>(0x3333333333333333ull);
-		REG2 = ((REG2 >> 1) | REG2) & static_cast<glm::uint64>(0x3333333333333333ull);
+			REG1 = ((REG1 >> 1) | REG1) & static_cast<glm::uint64>(0x3333333333333333ull);
+			REG2 = ((REG2 >> 1) | REG2) & static_cast<glm::uint64>(0x3333333333333333ull);
 
-		REG1 = ((REG1 >> 2) | REG1) & static_cast<glm::uint64>(0x0F0F0F0F0F0F0F0Full);
-		REG2 = ((REG2 >> 2) | REG2) & static_cast<glm::uint64>(0x0F0F0F0F0F0F0F0Full);
+			REG1 = ((REG1 >> 2) | REG1) & static_cast<glm::uint64>(0x0F0F0F0F0F0F0F0Full);
+			REG2 = ((REG2 >> 2) | REG2) & static_cast<glm::uint64>(0x0F0F0F0F0F0F0F0Full);
 
-		REG1 = ((REG1 >> 4) | REG1) & static_cast<glm::uint64>(0x00FF00FF00FF00FFull);
-		REG2 = ((REG2 >> 4) | REG2) & static_cast<glm::uint64>(0x00FF00FF00FF00FFull);
+			REG1 = ((REG1 >> 4) | REG1) & static_cast<glm::uint64>(0x00FF00FF00FF00FFull);
+			REG2 = ((REG2 >> 4) | REG2) & static_cast<glm::uint64>(0x00FF00FF00FF00FFull);
 
-		REG1 = ((REG1 >> 8) | REG1) & static_cast<glm::uint64>(0x0000FFFF0000FFFFull);
-		REG2 = ((REG2 >> 8) | REG2) & static_cast<glm::uint64>(0x0000FFFF0000FFFFull);
+			REG1 = ((REG1 >> 8) | REG1) & static_cast<glm::uint64>(0x0000FFFF0000FFFFull);
+			REG2 = ((REG2 >> 8) | REG2) & static_cast<glm::uint64>(0x0000FFFF0000FFFFull);
 
-		REG1 = ((REG1 >> 16) | REG1) & static_cast<glm::uint64>(0x00000000FFFFFFFFull);
-		REG2 = ((REG2 >> 16) | REG2) & static_cast<glm::uint64>(0x00000000FFFFFFFFull);
+			REG1 = ((REG1 >> 16) | REG1) & static_cast<glm::uint64>(0x00000000FFFFFFFFull);
+			REG2 = ((REG2 >> 16) | REG2) & static_cast<glm::uint64>(0x00000000FFFFFFFFull);
 
-		return glm::u32vec2(REG1, REG2);
+			return glm::u32vec2(REG1, REG2);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER int32 bitfieldInterleave(int8 x, int8 y, int8 z)
@@ -632,4 +878,128 @@ namespace detail
 	{
 		return detail::bitfieldInterleave<uint16, uint64>(v.x, v.y, v.z, v.w);
 	}
+
+	GLM_FUNC_QUALIFIER glm::u8vec3 bitfieldDeinterleave3(glm::uint32 x)
+	{
+#		if GLM_HAS_BMI2
+			return glm::u8vec3(_pext_u32(x, 0x00249249u), _pext_u32(x, 0x00492492u), _pext_u32(x, 0x00924924u));
+#		else
+			return glm::u8vec3(
+				detail::bitfieldCompact3(x),
+				detail::bitfieldCompact3(x >> 1),
+				detail::bitfieldCompact3(x >> 2));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER glm::u32vec3 bitfieldDeinterleave3(glm::uint64 x)
+	{
+#		if GLM_HAS_BMI2
+			return glm::u32vec3(
+				_pext_u64(x, 0x1249249249249249ull),
+				_pext_u64(x, 0x2492492492492492ull),
+				_pext_u64(x, 0x4924924924924924ull));
+#		else
+			return glm::u32vec3(
+				detail::bitfieldCompact3(x),
+				detail::bitfieldCompact3(x >> 1),
+				detail::bitfieldCompact3(x >> 2));
+#		endif
+	}
+
+#	if GLM_CONFIG_CPU_DISPATCH == GLM_ENABLE
+	namespace detail
+	{
+		template<length_t L, qualifier Q>
+		struct dispatch_interleave;
+	}//namespace detail
+#	endif
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldInterleave(vec<2, uint32, Q> const* In, std::size_t Count, uint64* Out)
+	{
+#		if GLM_CONFIG_CPU_DISPATCH == GLM_ENABLE
+			detail::dispatch<detail::dispatch_interleave<2, Q> >()(In, Count, Out);
+#		else
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = detail::bitfieldInterleave<uint32, uint64>(In[i].x, In[i].y);
+#		endif
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldInterleave(vec<3, uint32, Q> const* In, std::size_t Count, uint64* Out)
+	{
+#		if GLM_CONFIG_CPU_DISPATCH == GLM_ENABLE
+			detail::dispatch<detail::dispatch_interleave<3, Q> >()(In, Count, Out);
+#		else
+			std::size_t i = 0;
+
+			// Three PDEP per code are faster than spreading the bits with SIMD shifts
+#			if !GLM_HAS_BMI2 && (GLM_ARCH & GLM_ARCH_AVX2_BIT)
+				for(; i + 4 <= Count; i += 4)
+				{
+					glm_u64vec4 const x = _mm256_cvtepu32_epi64(_mm_set_epi32(static_cast<int>(In[i + 3].x), static_cast<int>(In[i + 2].x), static_cast<int>(In[i + 1].x), static_cast<int>(In[i].x)));
+					glm_u64vec4 const y = _mm256_cvtepu32_epi64(_mm_set_epi32(static_cast<int>(In[i + 3].y), static_cast<int>(In[i + 2].y), static_cast<int>(In[i + 1].y), static_cast<int>(In[i].y)));
+					glm_u64vec4 const z = _mm256_cvtepu32_epi64(_mm_set_epi32(static_cast<int>(In[i + 3].z), static_cast<int>(In[i + 2].z), static_cast<int>(In[i + 1].z), static_cast<int>(In[i].z)));
+					_mm256_storeu_si256(reinterpret_cast<glm_u64vec4*>(Out + i), glm_i256_interleave3(x, y, z));
+				}
+#			elif !GLM_HAS_BMI2 && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+				for(; i + 2 <= Count; i += 2)
+				{
+					glm_u64vec2 const x = _mm_set_epi64x(In[i + 1].x, In[i].x);
+					glm_u64vec2 const y = _mm_set_epi64x(In[i + 1].y, In[i].y);
+					glm_u64vec2 const z = _mm_set_epi64x(In[i + 1].z, In[i].z);
+					_mm_storeu_si128(reinterpret_cast<glm_u64vec2*>(Out + i), glm_i128_interleave3(x, y, z));
+				}
+#			endif
+
+			for(; i < Count; ++i)
+				Out[i] = detail::bitfieldInterleave<uint32, uint64>(In[i].x, In[i].y, In[i].z);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER glm::uint64 hilbertEncode(u32vec2 const& v)
+	{
+		return detail::compute_hilbert_encode<2>::call(v);
+	}
+
+	GLM_FUNC_QUALIFIER glm::uint64 hilbertEncode(u32vec3 const& v)
+	{
+		return detail::compute_hilbert_encode<3>::call(v);
+	}
+
+	GLM_FUNC_QUALIFIER glm::u32vec2 hilbertDecode2(glm::uint64 x)
+	{
+		glm::u32vec2 const v = bitfieldDeinterleave(x);
+		glm::uint32 X[2] = {v.y, v.x};
+		detail::hilbertTransposeToAxes<2>(X, 32);
+		return glm::u32vec2(X[0], X[1]);
+	}
+
+	GLM_FUNC_QUALIFIER glm::u32vec3 hilbertDecode3(glm::uint64 x)
+	{
+		glm::u32vec3 const v = bitfieldDeinterleave3(x);
+		glm::uint32 X[3] = {v.z, v.y, v.x};
+		detail::hilbertTransposeToAxes<3>(X, 21);
+		return glm::u32vec3(X[0], X[1], X[2]);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mortonEncode(vec<L, T, Q> const* Positions, std::size_t Count, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, uint64* Out)
+	{
+		detail::quantizeEncode<detail::compute_morton_encode>(Positions, Count, Min, Max, Out);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void hilbertEncode(vec<L, T, Q> const* Positions, std::size_t Count, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, uint64* Out)
+	{
+		detail::quantizeEncode<detail::compute_hilbert_encode>(Positions, Count, Min, Max, Out);
+	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "bitfield_simd.inl"
+#endif
+
+#if GLM_CONFIG_CPU_DISPATCH == GLM_ENABLE
+#	include "bitfield_dispatch.inl"
+#endif
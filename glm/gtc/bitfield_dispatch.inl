@@ -0,0 +1,93 @@
+/// @ref gtc_bitfield
+
+namespace glm{
+namespace detail
+{
+	// Each SIMD kernel interleaves 2, 4 or 8 vectors at once, the remaining vectors use the generic kernel
+	template<length_t L, qualifier Q>
+	struct dispatch_interleave
+	{
+		typedef void (*function)(vec<L, uint32, Q> const* In, std::size_t Count, uint64* Out);
+
+		GLM_FUNC_QUALIFIER static uint64 interleave(vec<L, uint32, Q> const& v)
+		{
+			return L == 2 ? detail::bitfieldInterleave<uint32, uint64>(v[0], v[1]) : detail::bitfieldInterleave<uint32, uint64>(v[0], v[1], v[L - 1]);
+		}
+
+		GLM_FUNC_QUALIFIER static void generic(vec<L, uint32, Q> const* In, std::size_t Count, uint64* Out)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = interleave(In[i]);
+		}
+
+		GLM_DISPATCH_SSE2 GLM_FUNC_QUALIFIER static void sse2(vec<L, uint32, Q> const* In, std::size_t Count, uint64* Out)
+		{
+			std::size_t i = 0;
+			for(; i + 2 <= Count; i += 2)
+			{
+				__m128i Code = _mm_setzero_si128();
+				for(length_t c = 0; c < L; ++c)
+				{
+					__m128i const Component = _mm_set_epi64x(In[i + 1][c], In[i][c]);
+					Code = _mm_or_si128(Code, _mm_slli_epi64(L == 2 ? glm_i128_spread2(Component) : glm_i128_spread3(Component), c));
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), Code);
+			}
+
+			generic(In + i, Count - i, Out + i);
+		}
+
+		GLM_DISPATCH_AVX2 GLM_FUNC_QUALIFIER static void avx2(vec<L, uint32, Q> const* In, std::size_t Count, uint64* Out)
+		{
+			std::size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+			{
+				__m256i Code = _mm256_setzero_si256();
+				for(length_t c = 0; c < L; ++c)
+				{
+					__m256i const Component = _mm256_cvtepu32_epi64(_mm_set_epi32(static_cast<int>(In[i + 3][c]), static_cast<int>(In[i + 2][c]), static_cast<int>(In[i + 1][c]), static_cast<int>(In[i][c])));
+					Code = _mm256_or_si256(Code, _mm256_slli_epi64(L == 2 ? glm_i256_spread2(Component) : glm_i256_spread3(Component), c));
+				}
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), Code);
+			}
+
+			generic(In + i, Count - i, Out + i);
+		}
+
+		// Zero masking forms of the AVX-512 intrinsics, the unmasked ones pass an undefined source reported as uninitialized by GCC 12
+		GLM_DISPATCH_AVX512 GLM_FUNC_QUALIFIER static void avx512(vec<L, uint32, Q> const* In, std::size_t Count, uint64* Out)
+		{
+			std::size_t i = 0;
+			for(; i + 8 <= Count; i += 8)
+			{
+				__m512i Code = _mm512_setzero_si512();
+				for(length_t c = 0; c < L; ++c)
+				{
+					uint32 const Lanes[8] = {In[i][c], In[i + 1][c], In[i + 2][c], In[i + 3][c], In[i + 4][c], In[i + 5][c], In[i + 6][c], In[i + 7][c]};
+					__m512i const Component = _mm512_maskz_cvtepu32_epi64(0xFF, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Lanes)));
+					Code = _mm512_or_si512(Code, _mm512_maskz_slli_epi64(0xFF, L == 2 ? glm_i512_spread2(Component) : glm_i512_spread3(Component), static_cast<unsigned int>(c)));
+				}
+				_mm512_storeu_si512(Out + i, Code);
+			}
+
+			generic(In + i, Count - i, Out + i);
+		}
+
+		GLM_FUNC_QUALIFIER static function select(cpu_tier Tier)
+		{
+			switch(Tier)
+			{
+			case cpu_avx512:
+				return avx512;
+			case cpu_avx2:
+				return avx2;
+			case cpu_sse4_1:
+			case cpu_sse2:
+				return sse2;
+			default:
+				return generic;
+			}
+		}
+	};
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,24 @@
+/// @ref gtc_bitfield
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_morton_quantize<3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<3, glm::uint32, Q> call(vec<3, float, Q> const& p, vec<3, float, Q> const& Min, vec<3, float, Q> const& Scale)
+		{
+			glm_vec4 const v = _mm_mul_ps(_mm_sub_ps(p.data, Min.data), Scale.data);
+			glm_vec4 const Clamped = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(2097151.0f));
+
+			vec<3, glm::uint32, Q> Result;
+			Result.data = _mm_cvttps_epi32(Clamped);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
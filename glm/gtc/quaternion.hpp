@@ -27,9 +27,11 @@
 #include "../ext/quaternion_trigonometric.hpp"
 #include "../ext/quaternion_transform.hpp"
 #include "../detail/type_mat3x3.hpp"
+#include "../detail/type_mat3x4.hpp"
 #include "../detail/type_mat4x4.hpp"
 #include "../detail/type_vec3.hpp"
 #include "../detail/type_vec4.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_quaternion extension included")
@@ -79,7 +81,7 @@ namespace glm
 	///
 	/// @see gtc_quaternion
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL mat<3, 3, T, Q> mat3_cast(qua<T, Q> const& x);
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<3, 3, T, Q> mat3_cast(qua<T, Q> const& x);
 
 	/// Converts a quaternion to a 4 * 4 matrix.
 	///
@@ -87,7 +89,7 @@ namespace glm
 	///
 	/// @see gtc_quaternion
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL mat<4, 4, T, Q> mat4_cast(qua<T, Q> const& x);
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, Q> mat4_cast(qua<T, Q> const& x);
 
 	/// Converts a pure rotation 3 * 3 matrix to a quaternion.
 	///
@@ -95,7 +97,7 @@ namespace glm
 	///
 	/// @see gtc_quaternion
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL qua<T, Q> quat_cast(mat<3, 3, T, Q> const& x);
+	GLM_FUNC_DECL GLM_CONSTEXPR qua<T, Q> quat_cast(mat<3, 3, T, Q> const& x);
 
 	/// Converts a pure rotation 4 * 4 matrix to a quaternion.
 	///
@@ -103,7 +105,72 @@ namespace glm
 	///
 	/// @see gtc_quaternion
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL qua<T, Q> quat_cast(mat<4, 4, T, Q> const& x);
+	GLM_FUNC_DECL GLM_CONSTEXPR qua<T, Q> quat_cast(mat<4, 4, T, Q> const& x);
+
+	/// Builds an affine 4 * 4 matrix equivalent to translate(translation) * mat4_cast(orientation) * scale(scale).
+	///
+	/// @tparam T Floating-point scalar types.
+	///
+	/// @see gtc_quaternion
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, Q> mat4_cast(vec<3, T, Q> const& translation, qua<T, Q> const& orientation, vec<3, T, Q> const& scale);
+
+	/// Builds the transposed 3 rows of the affine matrix returned by mat4_cast(translation, orientation, scale),
+	/// the layout commonly uploaded as skinning palette.
+	///
+	/// @tparam T Floating-point scalar types.
+	///
+	/// @see gtc_quaternion
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<3, 4, T, Q> mat3x4_cast(vec<3, T, Q> const& translation, qua<T, Q> const& orientation, vec<3, T, Q> const& scale);
+
+	/// Converts count quaternions to 3 * 3 matrices.
+	///
+	/// @tparam T Floating-point scalar types.
+	///
+	/// @see gtc_quaternion
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void mat3_cast(qua<T, Q> const* q, std::size_t count, mat<3, 3, T, Q>* m);
+
+	/// Converts count quaternions to 4 * 4 matrices.
+	///
+	/// @tparam T Floating-point scalar types.
+	///
+	/// @see gtc_quaternion
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void mat4_cast(qua<T, Q> const* q, std::size_t count, mat<4, 4, T, Q>* m);
+
+	/// Converts count pure rotation 3 * 3 matrices to quaternions.
+	///
+	/// @tparam T Floating-point scalar types.
+	///
+	/// @see gtc_quaternion
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void quat_cast(mat<3, 3, T, Q> const* m, std::size_t count, qua<T, Q>* q);
+
+	/// Converts count pure rotation 4 * 4 matrices to quaternions.
+	///
+	/// @tparam T Floating-point scalar types.
+	///
+	/// @see gtc_quaternion
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void quat_cast(mat<4, 4, T, Q> const* m, std::size_t count, qua<T, Q>* q);
+
+	/// Builds count affine 4 * 4 matrices from translation, orientation and scale arrays in a single pass.
+	///
+	/// @tparam T Floating-point scalar types.
+	///
+	/// @see gtc_quaternion
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void mat4_cast(vec<3, T, Q> const* translation, qua<T, Q> const* orientation, vec<3, T, Q> const* scale, std::size_t count, mat<4, 4, T, Q>* m);
+
+	/// Builds count transposed affine 3 * 4 matrices from translation, orientation and scale arrays in a single pass.
+	///
+	/// @tparam T Floating-point scalar types.
+	///
+	/// @see gtc_quaternion
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void mat3x4_cast(vec<3, T, Q> const* translation, qua<T, Q> const* orientation, vec<3, T, Q> const* scale, std::size_t count, mat<3, 4, T, Q>* m);
 
 	/// Returns the component-wise comparison result of x < y.
 	///
@@ -1,11 +1,94 @@
 #include "../trigonometric.hpp"
 #include "../geometric.hpp"
 #include "../exponential.hpp"
+#include "../detail/compute_constexpr.hpp"
 #include "epsilon.hpp"
 #include <limits>
 
 namespace glm
 {
+namespace detail
+{
+	template<length_t C, typename T, qualifier Q, bool Aligned>
+	struct compute_mat_cast
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<C, C, T, Q> call(qua<T, Q> const& q)
+		{
+			mat<C, C, T, Q> Result(T(1));
+			T qxx(q.x * q.x);
+			T qyy(q.y * q.y);
+			T qzz(q.z * q.z);
+			T qxz(q.x * q.z);
+			T qxy(q.x * q.y);
+			T qyz(q.y * q.z);
+			T qwx(q.w * q.x);
+			T qwy(q.w * q.y);
+			T qwz(q.w * q.z);
+
+			Result[0][0] = T(1) - T(2) * (qyy +  qzz);
+			Result[0][1] = T(2) * (qxy + qwz);
+			Result[0][2] = T(2) * (qxz - qwy);
+
+			Result[1][0] = T(2) * (qxy - qwz);
+			Result[1][1] = T(1) - T(2) * (qxx +  qzz);
+			Result[1][2] = T(2) * (qyz + qwx);
+
+			Result[2][0] = T(2) * (qxz + qwy);
+			Result[2][1] = T(2) * (qyz - qwx);
+			Result[2][2] = T(1) - T(2) * (qxx +  qyy);
+			return Result;
+		}
+	};
+
+	template<length_t C, typename T, qualifier Q, bool Aligned>
+	struct compute_quat_cast
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static qua<T, Q> call(mat<C, C, T, Q> const& m)
+		{
+			T fourXSquaredMinus1 = m[0][0] - m[1][1] - m[2][2];
+			T fourYSquaredMinus1 = m[1][1] - m[0][0] - m[2][2];
+			T fourZSquaredMinus1 = m[2][2] - m[0][0] - m[1][1];
+			T fourWSquaredMinus1 = m[0][0] + m[1][1] + m[2][2];
+
+			int biggestIndex = 0;
+			T fourBiggestSquaredMinus1 = fourWSquaredMinus1;
+			if(fourXSquaredMinus1 > fourBiggestSquaredMinus1)
+			{
+				fourBiggestSquaredMinus1 = fourXSquaredMinus1;
+				biggestIndex = 1;
+			}
+			if(fourYSquaredMinus1 > fourBiggestSquaredMinus1)
+			{
+				fourBiggestSquaredMinus1 = fourYSquaredMinus1;
+				biggestIndex = 2;
+			}
+			if(fourZSquaredMinus1 > fourBiggestSquaredMinus1)
+			{
+				fourBiggestSquaredMinus1 = fourZSquaredMinus1;
+				biggestIndex = 3;
+			}
+
+			T biggestVal = evaluate_sqrt(fourBiggestSquaredMinus1 + static_cast<T>(1)) * static_cast<T>(0.5);
+			T mult = static_cast<T>(0.25) / biggestVal;
+
+			switch(biggestIndex)
+			{
+			case 0:
+				return qua<T, Q>::wxyz(biggestVal, (m[1][2] - m[2][1]) * mult, (m[2][0] - m[0][2]) * mult, (m[0][1] - m[1][0]) * mult);
+			case 1:
+				return qua<T, Q>::wxyz((m[1][2] - m[2][1]) * mult, biggestVal, (m[0][1] + m[1][0]) * mult, (m[2][0] + m[0][2]) * mult);
+			case 2:
+				return qua<T, Q>::wxyz((m[2][0] - m[0][2]) * mult, (m[0][1] + m[1][0]) * mult, biggestVal, (m[1][2] + m[2][1]) * mult);
+			case 3:
+				return qua<T, Q>::wxyz((m[0][1] - m[1][0]) * mult, (m[2][0] + m[0][2]) * mult, (m[1][2] + m[2][1]) * mult, biggestVal);
+			default: // Silence a -Wswitch-default warning in GCC. Should never actually get here. Assert is just for sanity.
+				assert(false);
+				return qua<T, Q>::wxyz(1, 0, 0, 0);
+			}
+		}
+	};
+}//namespace detail
+
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<3, T, Q> eulerAngles(qua<T, Q> const& x)
 	{
@@ -44,88 +127,90 @@ namespace glm
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER mat<3, 3, T, Q> mat3_cast(qua<T, Q> const& q)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<3, 3, T, Q> mat3_cast(qua<T, Q> const& q)
+	{
+		return detail::compute_mat_cast<3, T, Q, detail::is_aligned<Q>::value>::call(q);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<4, 4, T, Q> mat4_cast(qua<T, Q> const& q)
 	{
-		mat<3, 3, T, Q> Result(T(1));
-		T qxx(q.x * q.x);
-		T qyy(q.y * q.y);
-		T qzz(q.z * q.z);
-		T qxz(q.x * q.z);
-		T qxy(q.x * q.y);
-		T qyz(q.y * q.z);
-		T qwx(q.w * q.x);
-		T qwy(q.w * q.y);
-		T qwz(q.w * q.z);
+		return detail::compute_mat_cast<4, T, Q, detail::is_aligned<Q>::value>::call(q);
+	}
 
-		Result[0][0] = T(1) - T(2) * (qyy +  qzz);
-		Result[0][1] = T(2) * (qxy + qwz);
-		Result[0][2] = T(2) * (qxz - qwy);
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR qua<T, Q> quat_cast(mat<3, 3, T, Q> const& m)
+	{
+		return detail::compute_quat_cast<3, T, Q, detail::is_aligned<Q>::value>::call(m);
+	}
 
-		Result[1][0] = T(2) * (qxy - qwz);
-		Result[1][1] = T(1) - T(2) * (qxx +  qzz);
-		Result[1][2] = T(2) * (qyz + qwx);
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR qua<T, Q> quat_cast(mat<4, 4, T, Q> const& m4)
+	{
+		return detail::compute_quat_cast<4, T, Q, detail::is_aligned<Q>::value>::call(m4);
+	}
 
-		Result[2][0] = T(2) * (qxz + qwy);
-		Result[2][1] = T(2) * (qyz - qwx);
-		Result[2][2] = T(1) - T(2) * (qxx +  qyy);
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<4, 4, T, Q> mat4_cast(vec<3, T, Q> const& translation, qua<T, Q> const& orientation, vec<3, T, Q> const& scale)
+	{
+		mat<4, 4, T, Q> Result(mat4_cast(orientation));
+		Result[0] *= scale.x;
+		Result[1] *= scale.y;
+		Result[2] *= scale.z;
+		Result[3] = vec<4, T, Q>(translation, static_cast<T>(1));
 		return Result;
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> mat4_cast(qua<T, Q> const& q)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<3, 4, T, Q> mat3x4_cast(vec<3, T, Q> const& translation, qua<T, Q> const& orientation, vec<3, T, Q> const& scale)
 	{
-		return mat<4, 4, T, Q>(mat3_cast(q));
+		mat<4, 4, T, Q> const Affine(mat4_cast(translation, orientation, scale));
+		return mat<3, 4, T, Q>(
+			Affine[0][0], Affine[1][0], Affine[2][0], Affine[3][0],
+			Affine[0][1], Affine[1][1], Affine[2][1], Affine[3][1],
+			Affine[0][2], Affine[1][2], Affine[2][2], Affine[3][2]);
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER qua<T, Q> quat_cast(mat<3, 3, T, Q> const& m)
+	GLM_FUNC_QUALIFIER void mat3_cast(qua<T, Q> const* q, std::size_t count, mat<3, 3, T, Q>* m)
 	{
-		T fourXSquaredMinus1 = m[0][0] - m[1][1] - m[2][2];
-		T fourYSquaredMinus1 = m[1][1] - m[0][0] - m[2][2];
-		T fourZSquaredMinus1 = m[2][2] - m[0][0] - m[1][1];
-		T fourWSquaredMinus1 = m[0][0] + m[1][1] + m[2][2];
+		for(std::size_t i = 0; i < count; ++i)
+			m[i] = mat3_cast(q[i]);
+	}
 
-		int biggestIndex = 0;
-		T fourBiggestSquaredMinus1 = fourWSquaredMinus1;
-		if(fourXSquaredMinus1 > fourBiggestSquaredMinus1)
-		{
-			fourBiggestSquaredMinus1 = fourXSquaredMinus1;
-			biggestIndex = 1;
-		}
-		if(fourYSquaredMinus1 > fourBiggestSquaredMinus1)
-		{
-			fourBiggestSquaredMinus1 = fourYSquaredMinus1;
-			biggestIndex = 2;
-		}
-		if(fourZSquaredMinus1 > fourBiggestSquaredMinus1)
-		{
-			fourBiggestSquaredMinus1 = fourZSquaredMinus1;
-			biggestIndex = 3;
-		}
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mat4_cast(qua<T, Q> const* q, std::size_t count, mat<4, 4, T, Q>* m)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			m[i] = mat4_cast(q[i]);
+	}
 
-		T biggestVal = sqrt(fourBiggestSquaredMinus1 + static_cast<T>(1)) * static_cast<T>(0.5);
-		T mult = static_cast<T>(0.25) / biggestVal;
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void quat_cast(mat<3, 3, T, Q> const* m, std::size_t count, qua<T, Q>* q)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			q[i] = quat_cast(m[i]);
+	}
 
-		switch(biggestIndex)
-		{
-		case 0:
-			return qua<T, Q>::wxyz(biggestVal, (m[1][2] - m[2][1]) * mult, (m[2][0] - m[0][2]) * mult, (m[0][1] - m[1][0]) * mult);
-		case 1:
-			return qua<T, Q>::wxyz((m[1][2] - m[2][1]) * mult, biggestVal, (m[0][1] + m[1][0]) * mult, (m[2][0] + m[0][2]) * mult);
-		case 2:
-			return qua<T, Q>::wxyz((m[2][0] - m[0][2]) * mult, (m[0][1] + m[1][0]) * mult, biggestVal, (m[1][2] + m[2][1]) * mult);
-		case 3:
-			return qua<T, Q>::wxyz((m[0][1] - m[1][0]) * mult, (m[2][0] + m[0][2]) * mult, (m[1][2] + m[2][1]) * mult, biggestVal);
-		default: // Silence a -Wswitch-default warning in GCC. Should never actually get here. Assert is just for sanity.
-			assert(false);
-			return qua<T, Q>::wxyz(1, 0, 0, 0);
-		}
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void quat_cast(mat<4, 4, T, Q> const* m, std::size_t count, qua<T, Q>* q)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			q[i] = quat_cast(m[i]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mat4_cast(vec<3, T, Q> const* translation, qua<T, Q> const* orientation, vec<3, T, Q> const* scale, std::size_t count, mat<4, 4, T, Q>* m)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			m[i] = mat4_cast(translation[i], orientation[i], scale[i]);
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER qua<T, Q> quat_cast(mat<4, 4, T, Q> const& m4)
+	GLM_FUNC_QUALIFIER void mat3x4_cast(vec<3, T, Q> const* translation, qua<T, Q> const* orientation, vec<3, T, Q> const* scale, std::size_t count, mat<3, 4, T, Q>* m)
 	{
-		return quat_cast(mat<3, 3, T, Q>(m4));
+		for(std::size_t i = 0; i < count; ++i)
+			m[i] = mat3x4_cast(translation[i], orientation[i], scale[i]);
 	}
 
 	template<typename T, qualifier Q>
@@ -0,0 +1,58 @@
+/// @ref gtc_quaternion
+
+#include "../simd/quaternion.h"
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && !defined(GLM_FORCE_QUAT_DATA_WXYZ)
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_mat_cast<3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(qua<float, Q> const& q)
+		{
+			glm_vec4 Columns[3];
+			glm_quat_mat3_cast(q.data, Columns);
+
+			mat<3, 3, float, Q> Result;
+			Result[0].data = Columns[0];
+			Result[1].data = Columns[1];
+			Result[2].data = Columns[2];
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat_cast<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(qua<float, Q> const& q)
+		{
+			glm_vec4 Columns[3];
+			glm_quat_mat3_cast(q.data, Columns);
+
+			mat<4, 4, float, Q> Result;
+			Result[0].data = Columns[0];
+			Result[1].data = Columns[1];
+			Result[2].data = Columns[2];
+			Result[3].data = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+			return Result;
+		}
+	};
+
+	template<length_t C, qualifier Q>
+	struct compute_quat_cast<C, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static qua<float, Q> call(mat<C, C, float, Q> const& m)
+		{
+			glm_vec4 const Columns[3] = {m[0].data, m[1].data, m[2].data};
+
+			qua<float, Q> Result;
+			Result.data = glm_mat3_quat_cast(Columns);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//(GLM_ARCH & GLM_ARCH_SSE2_BIT) && !defined(GLM_FORCE_QUAT_DATA_WXYZ)
@@ -19,6 +19,7 @@
 #include "../glm.hpp"
 #include "../gtc/constants.hpp"
 #include "../gtc/quaternion.hpp"
+#include <cstddef>
 
 #ifndef GLM_ENABLE_EXPERIMENTAL
 #	error "GLM: GLM_GTX_dual_quaternion is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
@@ -178,6 +179,37 @@ namespace glm
 	template<typename T, qualifier Q>
 	GLM_FUNC_DECL tdualquat<T, Q> dualquat_cast(mat<3, 4, T, Q> const& x);
 
+	/// Blends count weighted dual quaternions of a palette and returns the normalized result (dual quaternion linear blending).
+	/// Influences lying in the opposite hemisphere of the first one are negated so that blending takes the shortest path.
+	///
+	/// @param palette Bone transforms, each a unit dual quaternion.
+	/// @param indices count indices into palette.
+	/// @param weights count weights, expected to sum to one.
+	/// @param count Number of influences, typically 4 or 8.
+	///
+	/// @see gtx_dual_quaternion
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_DECL tdualquat<T, Q> dualquat_blend(tdualquat<T, Q> const* palette, I const* indices, T const* weights, length_t count);
+
+	/// Skins count vertices in a single pass with dual quaternion linear blending.
+	///
+	/// @param palette Bone transforms, each a unit dual quaternion.
+	/// @param indices count * influences indices into palette, stored per vertex.
+	/// @param weights count * influences weights, stored per vertex.
+	/// @param influences Number of influences per vertex, typically 4 or 8.
+	/// @param positions count positions to transform.
+	/// @param normals count normals to rotate, or nullptr.
+	/// @param count Number of vertices.
+	/// @param outPositions count transformed positions.
+	/// @param outNormals count rotated normals, ignored when normals is nullptr.
+	///
+	/// @see gtx_dual_quaternion
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_DISCARD_DECL void dualquat_skin(
+		tdualquat<T, Q> const* palette, I const* indices, T const* weights, length_t influences,
+		vec<3, T, Q> const* positions, vec<3, T, Q> const* normals, std::size_t count,
+		vec<3, T, Q>* outPositions, vec<3, T, Q>* outNormals);
+
 
 	/// Dual-quaternion of low single-qualifier floating-point numbers.
 	///
@@ -3,8 +3,33 @@
 #include "../geometric.hpp"
 #include <limits>
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_dualquat_blend
+	{
+		template<typename I>
+		GLM_FUNC_QUALIFIER static tdualquat<T, Q> call(tdualquat<T, Q> const* palette, I const* indices, T const* weights, length_t count)
+		{
+			qua<T, Q> const& Pivot = palette[indices[0]].real;
+
+			qua<T, Q> Real(palette[indices[0]].real * weights[0]);
+			qua<T, Q> Dual(palette[indices[0]].dual * weights[0]);
+			for(length_t i = 1; i < count; ++i)
+			{
+				tdualquat<T, Q> const& Bone = palette[indices[i]];
+				T const Weight = dot(Pivot, Bone.real) < static_cast<T>(0) ? -weights[i] : weights[i];
+				Real += Bone.real * Weight;
+				Dual += Bone.dual * Weight;
+			}
+
+			T const InvLength = static_cast<T>(1) / length(Real);
+			return tdualquat<T, Q>(Real * InvLength, Dual * InvLength);
+		}
+	};
+}//namespace detail
+
 	// -- Component accesses --
 
 	template<typename T, qualifier Q>
@@ -240,7 +265,7 @@ namespace glm
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> mat3x4_cast(tdualquat<T, Q> const& x)
 	{
-		qua<T, Q> r = x.real / length2(x.real);
+		qua<T, Q> r = x.real / dot(x.real, x.real);
 
 		qua<T, Q> const rr(r.w * x.real.w, r.x * x.real.x, r.y * x.real.y, r.z * x.real.z);
 		r *= static_cast<T>(2);
@@ -331,4 +356,31 @@ namespace glm
 		dual.w = -static_cast<T>(0.5) * ( x[0].w * real.x + x[1].w * real.y + x[2].w * real.z);
 		return tdualquat<T, Q>(real, dual);
 	}
+
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER tdualquat<T, Q> dualquat_blend(tdualquat<T, Q> const* palette, I const* indices, T const* weights, length_t count)
+	{
+		assert(count > 0);
+		return detail::compute_dualquat_blend<T, Q, detail::is_aligned<Q>::value>::call(palette, indices, weights, count);
+	}
+
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER void dualquat_skin(
+		tdualquat<T, Q> const* palette, I const* indices, T const* weights, length_t influences,
+		vec<3, T, Q> const* positions, vec<3, T, Q> const* normals, std::size_t count,
+		vec<3, T, Q>* outPositions, vec<3, T, Q>* outNormals)
+	{
+		std::size_t const Stride = static_cast<std::size_t>(influences);
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			tdualquat<T, Q> const Blend = dualquat_blend(palette, indices + i * Stride, weights + i * Stride, influences);
+			outPositions[i] = Blend * positions[i];
+			if(normals)
+				outNormals[i] = Blend.real * normals[i];
+		}
+	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "dual_quaternion_simd.inl"
+#endif
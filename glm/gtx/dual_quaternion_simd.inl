@@ -0,0 +1,44 @@
+/// @ref gtx_dual_quaternion
+
+#include "../simd/geometric.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_dualquat_blend<float, Q, true>
+	{
+		template<typename I>
+		GLM_FUNC_QUALIFIER static tdualquat<float, Q> call(tdualquat<float, Q> const* palette, I const* indices, float const* weights, length_t count)
+		{
+			glm_vec4 const SignMask = _mm_set1_ps(-0.0f);
+			glm_vec4 const Pivot = palette[indices[0]].real.data;
+			glm_vec4 const Weight0 = _mm_set1_ps(weights[0]);
+
+			glm_vec4 Real = _mm_mul_ps(Pivot, Weight0);
+			glm_vec4 Dual = _mm_mul_ps(palette[indices[0]].dual.data, Weight0);
+			for(length_t i = 1; i < count; ++i)
+			{
+				tdualquat<float, Q> const& Bone = palette[indices[i]];
+
+				// Antipodality correction: the sign bit of the dot product flips the weight
+				glm_vec4 const Sign = _mm_and_ps(glm_vec4_dot(Pivot, Bone.real.data), SignMask);
+				glm_vec4 const Weight = _mm_xor_ps(_mm_set1_ps(weights[i]), Sign);
+				Real = _mm_add_ps(Real, _mm_mul_ps(Bone.real.data, Weight));
+				Dual = _mm_add_ps(Dual, _mm_mul_ps(Bone.dual.data, Weight));
+			}
+
+			glm_vec4 const InvLength = _mm_div_ps(_mm_set1_ps(1.0f), glm_vec4_length(Real));
+
+			tdualquat<float, Q> Result;
+			Result.real.data = _mm_mul_ps(Real, InvLength);
+			Result.dual.data = _mm_mul_ps(Dual, InvLength);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -13,6 +13,9 @@
 /// All functions take a parameter x in the range [0.0,1.0]
 ///
 /// Based on the AHEasing project of Warren Moore (https://github.com/warrenm/AHEasing)
+///
+/// The vector overloads evaluate each component without branches: the pieces of the piecewise functions are computed
+/// for all the components and selected with mix. ease evaluates an easing function on an array of parameters.
 
 #pragma once
 
@@ -27,6 +30,8 @@
 #	pragma message("GLM: GLM_GTX_easing extension included")
 #endif
 
+#include <cstddef>
+
 namespace glm{
 	/// @addtogroup gtx_easing
 	/// @{
@@ -211,6 +216,173 @@ namespace glm{
 	template <typename genType>
 	GLM_FUNC_DECL genType bounceEaseInOut(genType const& a);
 
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> linearInterpolation(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quadraticEaseIn(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quadraticEaseOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quadraticEaseInOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> cubicEaseIn(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> cubicEaseOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> cubicEaseInOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quarticEaseIn(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quarticEaseOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quarticEaseInOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quinticEaseIn(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quinticEaseOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quinticEaseInOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> sineEaseIn(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> sineEaseOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> sineEaseInOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> circularEaseIn(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> circularEaseOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> circularEaseInOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> exponentialEaseIn(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> exponentialEaseOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> exponentialEaseInOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> elasticEaseIn(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> elasticEaseOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> elasticEaseInOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> backEaseIn(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> backEaseOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> backEaseInOut(vec<L, T, Q> const& a);
+
+	/// @param a parameter
+	/// @param o Optional overshoot modifier
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> backEaseIn(vec<L, T, Q> const& a, vec<L, T, Q> const& o);
+
+	/// @param a parameter
+	/// @param o Optional overshoot modifier
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> backEaseOut(vec<L, T, Q> const& a, vec<L, T, Q> const& o);
+
+	/// @param a parameter
+	/// @param o Optional overshoot modifier
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> backEaseInOut(vec<L, T, Q> const& a, vec<L, T, Q> const& o);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> bounceEaseIn(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> bounceEaseOut(vec<L, T, Q> const& a);
+
+	/// @see gtx_easing
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> bounceEaseInOut(vec<L, T, Q> const& a);
+
+	/// Easing functions evaluated by ease
+	enum easing_curve
+	{
+		easing_linear,
+		easing_quadratic_in, easing_quadratic_out, easing_quadratic_in_out,
+		easing_cubic_in, easing_cubic_out, easing_cubic_in_out,
+		easing_quartic_in, easing_quartic_out, easing_quartic_in_out,
+		easing_quintic_in, easing_quintic_out, easing_quintic_in_out,
+		easing_sine_in, easing_sine_out, easing_sine_in_out,
+		easing_circular_in, easing_circular_out, easing_circular_in_out,
+		easing_exponential_in, easing_exponential_out, easing_exponential_in_out,
+		easing_elastic_in, easing_elastic_out, easing_elastic_in_out,
+		easing_back_in, easing_back_out, easing_back_in_out,
+		easing_bounce_in, easing_bounce_out, easing_bounce_in_out
+	};
+
+	/// Evaluates the easing function Curve at Count parameters in [0, 1].
+	/// With SIMD instruction sets, the parameters are evaluated 4 at a time with the vector overloads on aligned vec4 types.
+	/// The function is selected once per call, not per parameter.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @see gtx_easing
+	template<typename T>
+	GLM_FUNC_DISCARD_DECL void ease(easing_curve Curve, T const* In, std::size_t Count, T* Out);
+
 	/// @}
 }//namespace glm
 
@@ -433,4 +433,474 @@ namespace glm{
 		}
 	}
 
+namespace detail
+{
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool easing_domain(vec<L, T, Q> const& a)
+	{
+		return all(greaterThanEqual(a, vec<L, T, Q>(static_cast<T>(0)))) && all(lessThanEqual(a, vec<L, T, Q>(static_cast<T>(1))));
+	}
+
+	// Components of a lower than 0.5
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, bool, Q> easing_first_half(vec<L, T, Q> const& a)
+	{
+		return lessThan(a, vec<L, T, Q>(static_cast<T>(0.5)));
+	}
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> linearInterpolation(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		return a;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quadraticEaseIn(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		return a * a;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quadraticEaseOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		return -(a * (a - static_cast<T>(2)));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quadraticEaseInOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const First = static_cast<T>(2) * a * a;
+		vec<L, T, Q> const Second = (-static_cast<T>(2) * a * a) + (static_cast<T>(4) * a) - static_cast<T>(1);
+		return mix(Second, First, detail::easing_first_half(a));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> cubicEaseIn(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		return a * a * a;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> cubicEaseOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const f = a - static_cast<T>(1);
+		return f * f * f + static_cast<T>(1);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> cubicEaseInOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const f = ((static_cast<T>(2) * a) - static_cast<T>(2));
+		vec<L, T, Q> const First = static_cast<T>(4) * a * a * a;
+		vec<L, T, Q> const Second = static_cast<T>(0.5) * f * f * f + static_cast<T>(1);
+		return mix(Second, First, detail::easing_first_half(a));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quarticEaseIn(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		return a * a * a * a;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quarticEaseOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const f = (a - static_cast<T>(1));
+		return f * f * f * (static_cast<T>(1) - a) + static_cast<T>(1);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quarticEaseInOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const f = (a - static_cast<T>(1));
+		vec<L, T, Q> const First = static_cast<T>(8) * a * a * a * a;
+		vec<L, T, Q> const Second = -static_cast<T>(8) * f * f * f * f + static_cast<T>(1);
+		return mix(Second, First, detail::easing_first_half(a));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quinticEaseIn(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		return a * a * a * a * a;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quinticEaseOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const f = (a - static_cast<T>(1));
+		return f * f * f * f * f + static_cast<T>(1);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quinticEaseInOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const f = ((static_cast<T>(2) * a) - static_cast<T>(2));
+		vec<L, T, Q> const First = static_cast<T>(16) * a * a * a * a * a;
+		vec<L, T, Q> const Second = static_cast<T>(0.5) * f * f * f * f * f + static_cast<T>(1);
+		return mix(Second, First, detail::easing_first_half(a));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> sineEaseIn(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		return sin((a - static_cast<T>(1)) * half_pi<T>()) + static_cast<T>(1);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> sineEaseOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		return sin(a * half_pi<T>());
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> sineEaseInOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		return static_cast<T>(0.5) * (static_cast<T>(1) - cos(a * pi<T>()));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> circularEaseIn(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		return static_cast<T>(1) - sqrt(static_cast<T>(1) - (a * a));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> circularEaseOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		return sqrt((static_cast<T>(2) - a) * a);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> circularEaseInOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		// The square roots of the unused pieces are clamped to avoid NaNs
+		vec<L, T, Q> const Zero(static_cast<T>(0));
+		vec<L, T, Q> const First = static_cast<T>(0.5) * (static_cast<T>(1) - sqrt(max(static_cast<T>(1) - static_cast<T>(4) * (a * a), Zero)));
+		vec<L, T, Q> const Second = static_cast<T>(0.5) * (sqrt(max(-((static_cast<T>(2) * a) - static_cast<T>(3)) * ((static_cast<T>(2) * a) - static_cast<T>(1)), Zero)) + static_cast<T>(1));
+		return mix(Second, First, detail::easing_first_half(a));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> exponentialEaseIn(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const Two(static_cast<T>(2));
+		return mix(pow(Two, (a - static_cast<T>(1)) * static_cast<T>(10)), a, lessThanEqual(a, vec<L, T, Q>(static_cast<T>(0))));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> exponentialEaseOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const Two(static_cast<T>(2));
+		return mix(static_cast<T>(1) - pow(Two, -static_cast<T>(10) * a), a, greaterThanEqual(a, vec<L, T, Q>(static_cast<T>(1))));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> exponentialEaseInOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const Two(static_cast<T>(2));
+		vec<L, T, Q> const First = static_cast<T>(0.5) * pow(Two, (static_cast<T>(20) * a) - static_cast<T>(10));
+		vec<L, T, Q> const Second = -static_cast<T>(0.5) * pow(Two, (-static_cast<T>(20) * a) + static_cast<T>(10)) + static_cast<T>(1);
+		return mix(Second, First, detail::easing_first_half(a));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> elasticEaseIn(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const Two(static_cast<T>(2));
+		return sin(static_cast<T>(13) * half_pi<T>() * a) * pow(Two, static_cast<T>(10) * (a - static_cast<T>(1)));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> elasticEaseOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const Two(static_cast<T>(2));
+		return sin(-static_cast<T>(13) * half_pi<T>() * (a + static_cast<T>(1))) * pow(Two, -static_cast<T>(10) * a) + static_cast<T>(1);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> elasticEaseInOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const Two(static_cast<T>(2));
+		vec<L, T, Q> const b = static_cast<T>(2) * a - static_cast<T>(1);
+		vec<L, T, Q> const First = static_cast<T>(0.5) * sin(static_cast<T>(13) * half_pi<T>() * (static_cast<T>(2) * a)) * pow(Two, static_cast<T>(10) * b);
+		vec<L, T, Q> const Second = static_cast<T>(0.5) * (sin(-static_cast<T>(13) * half_pi<T>() * (b + static_cast<T>(1))) * pow(Two, -static_cast<T>(10) * b) + static_cast<T>(2));
+		return mix(Second, First, detail::easing_first_half(a));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> backEaseIn(vec<L, T, Q> const& a, vec<L, T, Q> const& o)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const z = ((o + static_cast<T>(1)) * a) - o;
+		return (a * a * z);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> backEaseOut(vec<L, T, Q> const& a, vec<L, T, Q> const& o)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const n = a - static_cast<T>(1);
+		vec<L, T, Q> const z = ((o + static_cast<T>(1)) * n) + o;
+		return (n * n * z) + static_cast<T>(1);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> backEaseInOut(vec<L, T, Q> const& a, vec<L, T, Q> const& o)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const s = o * static_cast<T>(1.525);
+		vec<L, T, Q> const n = a / static_cast<T>(0.5);
+		vec<L, T, Q> const m = n - static_cast<T>(2);
+		vec<L, T, Q> const First = static_cast<T>(0.5) * (n * n * (((s + static_cast<T>(1)) * n) - s));
+		vec<L, T, Q> const Second = static_cast<T>(0.5) * ((m * m * (((s + static_cast<T>(1)) * m) + s)) + static_cast<T>(2));
+		return mix(Second, First, lessThan(n, vec<L, T, Q>(static_cast<T>(1))));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> backEaseIn(vec<L, T, Q> const& a)
+	{
+		return backEaseIn(a, vec<L, T, Q>(static_cast<T>(1.70158)));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> backEaseOut(vec<L, T, Q> const& a)
+	{
+		return backEaseOut(a, vec<L, T, Q>(static_cast<T>(1.70158)));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> backEaseInOut(vec<L, T, Q> const& a)
+	{
+		return backEaseInOut(a, vec<L, T, Q>(static_cast<T>(1.70158)));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> bounceEaseOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		vec<L, T, Q> const Piece0 = (static_cast<T>(121) * a * a) / static_cast<T>(16);
+		vec<L, T, Q> const Piece1 = (static_cast<T>(363.0 / 40.0) * a * a) - (static_cast<T>(99.0 / 10.0) * a) + static_cast<T>(17.0 / 5.0);
+		vec<L, T, Q> const Piece2 = (static_cast<T>(4356.0 / 361.0) * a * a) - (static_cast<T>(35442.0 / 1805.0) * a) + static_cast<T>(16061.0 / 1805.0);
+		vec<L, T, Q> const Piece3 = (static_cast<T>(54.0 / 5.0) * a * a) - (static_cast<T>(513.0 / 25.0) * a) + static_cast<T>(268.0 / 25.0);
+
+		vec<L, T, Q> Result = mix(Piece3, Piece2, lessThan(a, vec<L, T, Q>(static_cast<T>(9.0 / 10.0))));
+		Result = mix(Result, Piece1, lessThan(a, vec<L, T, Q>(static_cast<T>(8.0 / 11.0))));
+		return mix(Result, Piece0, lessThan(a, vec<L, T, Q>(static_cast<T>(4.0 / 11.0))));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> bounceEaseIn(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		return static_cast<T>(1) - bounceEaseOut(static_cast<T>(1) - a);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> bounceEaseInOut(vec<L, T, Q> const& a)
+	{
+		// Only defined in [0, 1]
+		assert(detail::easing_domain(a));
+
+		// The parameters of the unused pieces are clamped to [0, 1]
+		vec<L, T, Q> const Zero(static_cast<T>(0));
+		vec<L, T, Q> const First = static_cast<T>(0.5) * (static_cast<T>(1) - bounceEaseOut(max(static_cast<T>(1) - a * static_cast<T>(2), Zero)));
+		vec<L, T, Q> const Second = static_cast<T>(0.5) * bounceEaseOut(max(a * static_cast<T>(2) - static_cast<T>(1), Zero)) + static_cast<T>(0.5);
+		return mix(Second, First, detail::easing_first_half(a));
+	}
+
+namespace detail
+{
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		typedef std::integral_constant<qualifier, aligned_highp> easing_qualifier;
+#	else
+		typedef std::integral_constant<qualifier, defaultp> easing_qualifier;
+#	endif
+
+	// With SIMD instruction sets, evaluates the vector overload of the function 4 parameters at a time and the last parameters with the scalar one.
+	// Otherwise the scalar function is faster than the branch-free vector overload, which evaluates all the pieces.
+	template<typename T, vec<4, T, easing_qualifier::value> (*Function)(vec<4, T, easing_qualifier::value> const&), T (*Scalar)(T const&)>
+	GLM_FUNC_QUALIFIER void ease_batch(T const* In, std::size_t Count, T* Out)
+	{
+		std::size_t i = 0;
+
+#		if GLM_CONFIG_SIMD == GLM_ENABLE
+			typedef vec<4, T, easing_qualifier::value> batch_type;
+
+			std::size_t const Batches = Count - Count % 4;
+			for(; i < Batches; i += 4)
+			{
+				batch_type const Result = Function(batch_type(In[i + 0], In[i + 1], In[i + 2], In[i + 3]));
+				Out[i + 0] = Result.x;
+				Out[i + 1] = Result.y;
+				Out[i + 2] = Result.z;
+				Out[i + 3] = Result.w;
+			}
+#		endif
+
+		for(; i < Count; ++i)
+			Out[i] = Scalar(In[i]);
+	}
+}//namespace detail
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER void ease(easing_curve Curve, T const* In, std::size_t Count, T* Out)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559, "'ease' only accept floating-point inputs");
+
+		length_t const L = 4;
+		qualifier const Q = detail::easing_qualifier::value;
+
+		switch(Curve)
+		{
+		case easing_linear:
+			detail::ease_batch<T, linearInterpolation<L, T, Q>, linearInterpolation<T> >(In, Count, Out); break;
+		case easing_quadratic_in:
+			detail::ease_batch<T, quadraticEaseIn<L, T, Q>, quadraticEaseIn<T> >(In, Count, Out); break;
+		case easing_quadratic_out:
+			detail::ease_batch<T, quadraticEaseOut<L, T, Q>, quadraticEaseOut<T> >(In, Count, Out); break;
+		case easing_quadratic_in_out:
+			detail::ease_batch<T, quadraticEaseInOut<L, T, Q>, quadraticEaseInOut<T> >(In, Count, Out); break;
+		case easing_cubic_in:
+			detail::ease_batch<T, cubicEaseIn<L, T, Q>, cubicEaseIn<T> >(In, Count, Out); break;
+		case easing_cubic_out:
+			detail::ease_batch<T, cubicEaseOut<L, T, Q>, cubicEaseOut<T> >(In, Count, Out); break;
+		case easing_cubic_in_out:
+			detail::ease_batch<T, cubicEaseInOut<L, T, Q>, cubicEaseInOut<T> >(In, Count, Out); break;
+		case easing_quartic_in:
+			detail::ease_batch<T, quarticEaseIn<L, T, Q>, quarticEaseIn<T> >(In, Count, Out); break;
+		case easing_quartic_out:
+			detail::ease_batch<T, quarticEaseOut<L, T, Q>, quarticEaseOut<T> >(In, Count, Out); break;
+		case easing_quartic_in_out:
+			detail::ease_batch<T, quarticEaseInOut<L, T, Q>, quarticEaseInOut<T> >(In, Count, Out); break;
+		case easing_quintic_in:
+			detail::ease_batch<T, quinticEaseIn<L, T, Q>, quinticEaseIn<T> >(In, Count, Out); break;
+		case easing_quintic_out:
+			detail::ease_batch<T, quinticEaseOut<L, T, Q>, quinticEaseOut<T> >(In, Count, Out); break;
+		case easing_quintic_in_out:
+			detail::ease_batch<T, quinticEaseInOut<L, T, Q>, quinticEaseInOut<T> >(In, Count, Out); break;
+		case easing_sine_in:
+			detail::ease_batch<T, sineEaseIn<L, T, Q>, sineEaseIn<T> >(In, Count, Out); break;
+		case easing_sine_out:
+			detail::ease_batch<T, sineEaseOut<L, T, Q>, sineEaseOut<T> >(In, Count, Out); break;
+		case easing_sine_in_out:
+			detail::ease_batch<T, sineEaseInOut<L, T, Q>, sineEaseInOut<T> >(In, Count, Out); break;
+		case easing_circular_in:
+			detail::ease_batch<T, circularEaseIn<L, T, Q>, circularEaseIn<T> >(In, Count, Out); break;
+		case easing_circular_out:
+			detail::ease_batch<T, circularEaseOut<L, T, Q>, circularEaseOut<T> >(In, Count, Out); break;
+		case easing_circular_in_out:
+			detail::ease_batch<T, circularEaseInOut<L, T, Q>, circularEaseInOut<T> >(In, Count, Out); break;
+		case easing_exponential_in:
+			detail::ease_batch<T, exponentialEaseIn<L, T, Q>, exponentialEaseIn<T> >(In, Count, Out); break;
+		case easing_exponential_out:
+			detail::ease_batch<T, exponentialEaseOut<L, T, Q>, exponentialEaseOut<T> >(In, Count, Out); break;
+		case easing_exponential_in_out:
+			detail::ease_batch<T, exponentialEaseInOut<L, T, Q>, exponentialEaseInOut<T> >(In, Count, Out); break;
+		case easing_elastic_in:
+			detail::ease_batch<T, elasticEaseIn<L, T, Q>, elasticEaseIn<T> >(In, Count, Out); break;
+		case easing_elastic_out:
+			detail::ease_batch<T, elasticEaseOut<L, T, Q>, elasticEaseOut<T> >(In, Count, Out); break;
+		case easing_elastic_in_out:
+			detail::ease_batch<T, elasticEaseInOut<L, T, Q>, elasticEaseInOut<T> >(In, Count, Out); break;
+		case easing_back_in:
+			detail::ease_batch<T, backEaseIn<L, T, Q>, backEaseIn<T> >(In, Count, Out); break;
+		case easing_back_out:
+			detail::ease_batch<T, backEaseOut<L, T, Q>, backEaseOut<T> >(In, Count, Out); break;
+		case easing_back_in_out:
+			detail::ease_batch<T, backEaseInOut<L, T, Q>, backEaseInOut<T> >(In, Count, Out); break;
+		case easing_bounce_in:
+			detail::ease_batch<T, bounceEaseIn<L, T, Q>, bounceEaseIn<T> >(In, Count, Out); break;
+		case easing_bounce_out:
+			detail::ease_batch<T, bounceEaseOut<L, T, Q>, bounceEaseOut<T> >(In, Count, Out); break;
+		case easing_bounce_in_out:
+			detail::ease_batch<T, bounceEaseInOut<L, T, Q>, bounceEaseInOut<T> >(In, Count, Out); break;
+		}
+	}
+
 }//namespace glm
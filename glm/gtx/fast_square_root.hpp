@@ -11,6 +11,21 @@
 /// Fast but less accurate implementations of square root based functions.
 /// - Sqrt optimisation based on Newton's method,
 /// www.gamedev.net/community/forums/topic.asp?topic id=139956
+///
+/// The scalar functions, fastSqrt and the lowp vectors use the integer estimate 0x5f375a86 - (i >> 1) and a Newton-Raphson step,
+/// the other vectors of fastInverseSqrt use the precise inversesqrt.
+/// With SIMD instruction sets, the aligned vec4 and the batch functions on float arrays use the
+/// estimate of rsqrtps (SSE, AVX) or vrsqrteq_f32 (NEON) refined by Newton-Raphson steps.
+///
+/// Maximum relative error on [0.001, 1000], measured against the double precision functions.
+/// The vectors of the SIMD column are the aligned vec4, the NEON kernels use two Newton-Raphson steps to reach the same accuracy.
+///
+/// | Function        | Scalar | SSE2 and AVX |
+/// |-----------------|--------|--------------|
+/// | fastInverseSqrt | 1.8e-3 | 2.6e-7       |
+/// | fastSqrt        | 1.8e-3 | 2.9e-7       |
+///
+/// The SIMD fastSqrt returns 0 for 0, the results for negative, infinite and NaN values are undefined.
 
 #pragma once
 
@@ -18,6 +33,7 @@
 #include "../common.hpp"
 #include "../exponential.hpp"
 #include "../geometric.hpp"
+#include <cstddef>
 
 #ifndef GLM_ENABLE_EXPERIMENTAL
 #	error "GLM: GLM_GTX_fast_square_root is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
@@ -42,6 +58,14 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL vec<L, T, Q> fastSqrt(vec<L, T, Q> const& x);
 
+	/// Computes fastSqrt of Count values, Out[i] = fastSqrt(In[i]).
+	/// The float values are computed 8 at once with AVX, 4 at once with SSE2 and NEON. Vector arrays can be passed with value_ptr and Count * L.
+	/// In and Out may be the same array.
+	///
+	/// @see gtx_fast_square_root extension.
+	template<typename T>
+	GLM_FUNC_DISCARD_DECL void fastSqrt(T const* In, std::size_t Count, T* Out);
+
 	/// Faster than the common inversesqrt function but less accurate.
 	///
 	/// @see gtx_fast_square_root extension.
@@ -54,6 +78,14 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL vec<L, T, Q> fastInverseSqrt(vec<L, T, Q> const& x);
 
+	/// Computes fastInverseSqrt of Count values, Out[i] = fastInverseSqrt(In[i]).
+	/// The float values are computed 8 at once with AVX, 4 at once with SSE2 and NEON. Vector arrays can be passed with value_ptr and Count * L.
+	/// In and Out may be the same array.
+	///
+	/// @see gtx_fast_square_root extension.
+	template<typename T>
+	GLM_FUNC_DISCARD_DECL void fastInverseSqrt(T const* In, std::size_t Count, T* Out);
+
 	/// Faster than the common length function but less accurate.
 	///
 	/// @see gtx_fast_square_root extension.
@@ -1,7 +1,53 @@
 /// @ref gtx_fast_square_root
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fastSqrt
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(fastSqrt, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fastInverseSqrt
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::compute_inversesqrt<L, T, Q, Aligned>::call(x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fastNormalize
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return x * fastInverseSqrt(dot(x, x));
+		}
+	};
+
+	// Specialized for float with SIMD instruction sets
+	template<typename T, bool UseSimd>
+	struct compute_fastSqrt_batch
+	{
+		GLM_FUNC_QUALIFIER static void sqrt(T const* In, std::size_t Count, T* Out)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = fastSqrt(In[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void inversesqrt(T const* In, std::size_t Count, T* Out)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = fastInverseSqrt(In[i]);
+		}
+	};
+}//namespace detail
+
 	// fastSqrt
 	template<typename genType>
 	GLM_FUNC_QUALIFIER genType fastSqrt(genType x)
@@ -14,7 +60,13 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastSqrt(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(fastSqrt, x);
+		return detail::compute_fastSqrt<L, T, Q, detail::is_aligned<Q>::value>::call(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER void fastSqrt(T const* In, std::size_t Count, T* Out)
+	{
+		detail::compute_fastSqrt_batch<T, GLM_CONFIG_SIMD == GLM_ENABLE>::sqrt(In, Count, Out);
 	}
 
 	// fastInversesqrt
@@ -27,7 +79,13 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastInverseSqrt(vec<L, T, Q> const& x)
 	{
-		return detail::compute_inversesqrt<L, T, Q, detail::is_aligned<Q>::value>::call(x);
+		return detail::compute_fastInverseSqrt<L, T, Q, detail::is_aligned<Q>::value>::call(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER void fastInverseSqrt(T const* In, std::size_t Count, T* Out)
+	{
+		detail::compute_fastSqrt_batch<T, GLM_CONFIG_SIMD == GLM_ENABLE>::inversesqrt(In, Count, Out);
 	}
 
 	// fastLength
@@ -70,6 +128,10 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastNormalize(vec<L, T, Q> const& x)
 	{
-		return x * fastInverseSqrt(dot(x, x));
+		return detail::compute_fastNormalize<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "fast_square_root_simd.inl"
+#endif
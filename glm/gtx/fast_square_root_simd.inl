@@ -0,0 +1,102 @@
+/// @ref gtx_fast_square_root
+
+#include "../simd/exponential.h"
+#include "../simd/geometric.h"
+
+#if GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_NEON_BIT)
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_fastSqrt<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_fast_sqrt(x.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_fastInverseSqrt<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_fast_inversesqrt(x.data);
+			return Result;
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	struct compute_fastNormalize<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = _mm_mul_ps(x.data, glm_vec4_fast_inversesqrt(glm_vec4_dot(x.data, x.data)));
+			return Result;
+		}
+	};
+#	endif
+
+	template<bool Inverse>
+	GLM_FUNC_QUALIFIER void fast_sqrt4(float const* In, float* Out)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_f32vec4 const x = _mm_loadu_ps(In);
+			_mm_storeu_ps(Out, Inverse ? glm_vec4_fast_inversesqrt(x) : glm_vec4_fast_sqrt(x));
+#		else
+			glm_f32vec4 const x = vld1q_f32(In);
+			vst1q_f32(Out, Inverse ? glm_vec4_fast_inversesqrt(x) : glm_vec4_fast_sqrt(x));
+#		endif
+	}
+
+	// The remaining values are computed in a block padded with ones, each value has the same result whatever its index
+	template<bool Inverse>
+	GLM_FUNC_QUALIFIER void fast_sqrt_batch(float const* In, std::size_t Count, float* Out)
+	{
+		std::size_t i = 0;
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			for(; i + 8 <= Count; i += 8)
+			{
+				glm_f32vec8 const x = _mm256_loadu_ps(In + i);
+				_mm256_storeu_ps(Out + i, Inverse ? glm_vec8_fast_inversesqrt(x) : glm_vec8_fast_sqrt(x));
+			}
+#		endif
+
+		for(; i + 4 <= Count; i += 4)
+			fast_sqrt4<Inverse>(In + i, Out + i);
+
+		if(i < Count)
+		{
+			float Block[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+			for(std::size_t j = i; j < Count; ++j)
+				Block[j - i] = In[j];
+			fast_sqrt4<Inverse>(Block, Block);
+			for(std::size_t j = i; j < Count; ++j)
+				Out[j] = Block[j - i];
+		}
+	}
+
+	template<>
+	struct compute_fastSqrt_batch<float, true>
+	{
+		GLM_FUNC_QUALIFIER static void sqrt(float const* In, std::size_t Count, float* Out)
+		{
+			fast_sqrt_batch<false>(In, Count, Out);
+		}
+
+		GLM_FUNC_QUALIFIER static void inversesqrt(float const* In, std::size_t Count, float* Out)
+		{
+			fast_sqrt_batch<true>(In, Count, Out);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_NEON_BIT)
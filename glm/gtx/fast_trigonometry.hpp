@@ -9,11 +9,38 @@
 /// Include <glm/gtx/fast_trigonometry.hpp> to use the features of this extension.
 ///
 /// Fast but less accurate implementations of trigonometric functions.
+///
+/// fastCos and fastSin wrap the angle then evaluate a polynomial of degree 6 on [0, pi / 2].
+/// With SIMD instruction sets, the aligned vec4 and the batch functions on float arrays evaluate the same polynomial with SSE2, AVX or NEON,
+/// after a reduction to [-pi, pi] with 2 pi split in two constants, keeping the accuracy for large angles.
+/// fastTan, fastAsin and fastAtan are Taylor series around 0, evaluated on whole vectors.
+///
+/// Maximum absolute error of the float functions, measured against the double precision functions.
+/// The vectors of the SIMD column are the aligned vec4, the NEON kernels evaluate the same reduction and polynomial.
+///
+/// | Function | Domain          | Scalar and vectors | SSE2 and AVX       |
+/// |----------|-----------------|--------------------|--------------------|
+/// | fastCos  | [-pi, pi]       | 7.1e-6             | 6.9e-6             |
+/// | fastCos  | [-100, 100]     | 1.3e-5             | 7.0e-6             |
+/// | fastCos  | [-10^4, 10^4]   | 7.7e-4             | 7.0e-6             |
+/// | fastSin  | [-pi, pi]       | 7.0e-6             | 7.0e-6             |
+/// | fastSin  | [-100, 100]     | 1.6e-5             | 7.1e-6             |
+/// | fastSin  | [-10^4, 10^4]   | 1.3e-3             | 7.1e-6             |
+/// | fastTan  | [-0.5, 0.5]     | 4.8e-5             | 4.8e-5             |
+/// | fastTan  | [-pi/4, pi/4]   | 3.4e-3             | 3.4e-3             |
+/// | fastAsin | [-0.5, 0.5]     | 1.4e-5             | 1.4e-5             |
+/// | fastAcos | [-0.5, 0.5]     | 1.4e-5             | 1.4e-5             |
+/// | fastAtan | [-0.5, 0.5]     | 7.8e-6             | 7.8e-6             |
+/// | fastAtan | [-1, 1]         | 4.2e-2             | 4.2e-2             |
+///
+/// The Taylor series diverge quickly outside of these domains: fastAsin(1) is off by 0.25.
 
 #pragma once
 
 // Dependency:
+#include "../common.hpp"
 #include "../gtc/constants.hpp"
+#include <cstddef>
 
 #ifndef GLM_ENABLE_EXPERIMENTAL
 #	error "GLM: GLM_GTX_fast_trigonometry is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
@@ -36,11 +63,25 @@ namespace glm
 	template<typename T>
 	GLM_FUNC_DECL T fastSin(T angle);
 
+	/// Computes fastSin of Count angles, Out[i] = fastSin(In[i]).
+	/// The float values are computed 8 at once with AVX, 4 at once with SSE2 and NEON. Vector arrays can be passed with value_ptr and Count * L.
+	/// In and Out may be the same array.
+	/// From GLM_GTX_fast_trigonometry extension.
+	template<typename T>
+	GLM_FUNC_DISCARD_DECL void fastSin(T const* In, std::size_t Count, T* Out);
+
 	/// Faster than the common cos function but less accurate.
 	/// From GLM_GTX_fast_trigonometry extension.
 	template<typename T>
 	GLM_FUNC_DECL T fastCos(T angle);
 
+	/// Computes fastCos of Count angles, Out[i] = fastCos(In[i]).
+	/// The float values are computed 8 at once with AVX, 4 at once with SSE2 and NEON. Vector arrays can be passed with value_ptr and Count * L.
+	/// In and Out may be the same array.
+	/// From GLM_GTX_fast_trigonometry extension.
+	template<typename T>
+	GLM_FUNC_DISCARD_DECL void fastCos(T const* In, std::size_t Count, T* Out);
+
 	/// Faster than the common tan function but less accurate.
 	/// Defined between -2pi and 2pi.
 	/// From GLM_GTX_fast_trigonometry extension.
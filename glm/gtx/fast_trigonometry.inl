@@ -25,6 +25,41 @@ namespace detail
 	{
 		return detail::functor1<vec, L, T, T, Q>::call(cos_52s, x);
 	}
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fastCos
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(fastCos, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fastSin
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(fastSin, x);
+		}
+	};
+
+	// Specialized for float with SIMD instruction sets
+	template<typename T, bool UseSimd>
+	struct compute_fastSinCos_batch
+	{
+		GLM_FUNC_QUALIFIER static void sin(T const* In, std::size_t Count, T* Out)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = fastSin(In[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void cos(T const* In, std::size_t Count, T* Out)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = fastCos(In[i]);
+		}
+	};
 }//namespace detail
 
 	// wrapAngle
@@ -59,7 +94,13 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastCos(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(fastCos, x);
+		return detail::compute_fastCos<L, T, Q, detail::is_aligned<Q>::value>::call(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER void fastCos(T const* In, std::size_t Count, T* Out)
+	{
+		detail::compute_fastSinCos_batch<T, GLM_CONFIG_SIMD == GLM_ENABLE>::cos(In, Count, Out);
 	}
 
 	// sin
@@ -72,7 +113,13 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastSin(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(fastSin, x);
+		return detail::compute_fastSin<L, T, Q, detail::is_aligned<Q>::value>::call(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER void fastSin(T const* In, std::size_t Count, T* Out)
+	{
+		detail::compute_fastSinCos_batch<T, GLM_CONFIG_SIMD == GLM_ENABLE>::sin(In, Count, Out);
 	}
 
 	// tan
@@ -85,7 +132,8 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastTan(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(fastTan, x);
+		vec<L, T, Q> const xx(x * x);
+		return x + x * xx * (T(0.3333333333) + xx * (T(0.1333333333333) + xx * T(0.0539682539)));
 	}
 
 	// asin
@@ -98,7 +146,8 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastAsin(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(fastAsin, x);
+		vec<L, T, Q> const xx(x * x);
+		return x + x * xx * (T(0.166666667) + xx * (T(0.075) + xx * (T(0.0446428571) + xx * T(0.0303819444))));
 	}
 
 	// acos
@@ -111,7 +160,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastAcos(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(fastAcos, x);
+		return T(1.5707963267948966192313216916398) - fastAsin(x); //(PI / 2)
 	}
 
 	// atan
@@ -125,7 +174,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastAtan(vec<L, T, Q> const& y, vec<L, T, Q> const& x)
 	{
-		return detail::functor2<vec, L, T, Q>::call(fastAtan, y, x);
+		return abs(fastAtan(y / x)) * (sign(y) * sign(x));
 	}
 
 	template<typename T>
@@ -137,6 +186,11 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastAtan(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(fastAtan, x);
+		vec<L, T, Q> const xx(x * x);
+		return x + x * xx * (T(-0.333333333333) + xx * (T(0.2) + xx * (T(-0.1428571429) + xx * (T(0.111111111111) + xx * T(-0.0909090909)))));
 	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "fast_trigonometry_simd.inl"
+#endif
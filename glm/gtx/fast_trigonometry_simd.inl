@@ -0,0 +1,88 @@
+/// @ref gtx_fast_trigonometry
+
+#include "../simd/trigonometric.h"
+
+#if GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_NEON_BIT)
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_fastCos<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_fast_cos(x.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_fastSin<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_fast_sin(x.data);
+			return Result;
+		}
+	};
+
+	template<bool Sine>
+	GLM_FUNC_QUALIFIER void fast_sincos4(float const* In, float* Out)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_f32vec4 const x = _mm_loadu_ps(In);
+			_mm_storeu_ps(Out, Sine ? glm_vec4_fast_sin(x) : glm_vec4_fast_cos(x));
+#		else
+			glm_f32vec4 const x = vld1q_f32(In);
+			vst1q_f32(Out, Sine ? glm_vec4_fast_sin(x) : glm_vec4_fast_cos(x));
+#		endif
+	}
+
+	// The remaining angles are computed in a block padded with zeros, each angle has the same result whatever its index
+	template<bool Sine>
+	GLM_FUNC_QUALIFIER void fast_sincos_batch(float const* In, std::size_t Count, float* Out)
+	{
+		std::size_t i = 0;
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			for(; i + 8 <= Count; i += 8)
+			{
+				glm_f32vec8 const x = _mm256_loadu_ps(In + i);
+				_mm256_storeu_ps(Out + i, Sine ? glm_vec8_fast_sin(x) : glm_vec8_fast_cos(x));
+			}
+#		endif
+
+		for(; i + 4 <= Count; i += 4)
+			fast_sincos4<Sine>(In + i, Out + i);
+
+		if(i < Count)
+		{
+			float Block[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+			for(std::size_t j = i; j < Count; ++j)
+				Block[j - i] = In[j];
+			fast_sincos4<Sine>(Block, Block);
+			for(std::size_t j = i; j < Count; ++j)
+				Out[j] = Block[j - i];
+		}
+	}
+
+	template<>
+	struct compute_fastSinCos_batch<float, true>
+	{
+		GLM_FUNC_QUALIFIER static void sin(float const* In, std::size_t Count, float* Out)
+		{
+			fast_sincos_batch<true>(In, Count, Out);
+		}
+
+		GLM_FUNC_QUALIFIER static void cos(float const* In, std::size_t Count, float* Out)
+		{
+			fast_sincos_batch<false>(In, Count, Out);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_NEON_BIT)
@@ -10,6 +10,9 @@
 /// Include <glm/gtx/gradient_paint.hpp> to use the features of this extension.
 ///
 /// Functions that return the color of procedural gradient for specific coordinates.
+///
+/// The row overloads fill a row of pixels: they evaluate the gradient at Count positions spaced by Step from Position.
+/// With SIMD instruction sets, the float rows are computed 4 positions at a time with SSE2 or ARMv8 NEON.
 
 #pragma once
 
@@ -23,6 +26,8 @@
 #	pragma message("GLM: GLM_GTX_gradient_paint extension included")
 #endif
 
+#include <cstddef>
+
 namespace glm
 {
 	/// @addtogroup gtx_gradient_paint
@@ -45,6 +50,29 @@ namespace glm
 		vec<2, T, Q> const& Point1,
 		vec<2, T, Q> const& Position);
 
+	/// Fill Out with a radial gradient at Count positions: Position, Position + Step, Position + Step * 2...
+	/// @see - gtx_gradient_paint
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void radialGradient(
+		vec<2, T, Q> const& Center,
+		T const& Radius,
+		vec<2, T, Q> const& Focal,
+		vec<2, T, Q> const& Position,
+		vec<2, T, Q> const& Step,
+		std::size_t Count,
+		T* Out);
+
+	/// Fill Out with a linear gradient at Count positions: Position, Position + Step, Position + Step * 2...
+	/// @see - gtx_gradient_paint
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void linearGradient(
+		vec<2, T, Q> const& Point0,
+		vec<2, T, Q> const& Point1,
+		vec<2, T, Q> const& Position,
+		vec<2, T, Q> const& Step,
+		std::size_t Count,
+		T* Out);
+
 	/// @}
 }// namespace glm
 
@@ -2,6 +2,28 @@
 
 namespace glm
 {
+namespace detail
+{
+	// Computes the positions [Begin, Count) of a row, specialized for float with SIMD instruction sets
+	template<typename T, bool UseSimd>
+	struct compute_gradient_row
+	{
+		GLM_FUNC_QUALIFIER static void radial(vec<2, T, defaultp> const& Center, T Radius, vec<2, T, defaultp> const& Focal,
+			vec<2, T, defaultp> const& Position, vec<2, T, defaultp> const& Step, std::size_t Begin, std::size_t Count, T* Out)
+		{
+			for(std::size_t i = Begin; i < Count; ++i)
+				Out[i] = radialGradient(Center, Radius, Focal, Position + Step * static_cast<T>(i));
+		}
+
+		GLM_FUNC_QUALIFIER static void linear(vec<2, T, defaultp> const& Point0, vec<2, T, defaultp> const& Point1,
+			vec<2, T, defaultp> const& Position, vec<2, T, defaultp> const& Step, std::size_t Begin, std::size_t Count, T* Out)
+		{
+			for(std::size_t i = Begin; i < Count; ++i)
+				Out[i] = linearGradient(Point0, Point1, Position + Step * static_cast<T>(i));
+		}
+	};
+}//namespace detail
+
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER T radialGradient
 	(
@@ -33,4 +55,39 @@ namespace glm
 		vec<2, T, Q> Dist = Point1 - Point0;
 		return (Dist.x * (Position.x - Point0.x) + Dist.y * (Position.y - Point0.y)) / glm::dot(Dist, Dist);
 	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void radialGradient
+	(
+		vec<2, T, Q> const& Center,
+		T const& Radius,
+		vec<2, T, Q> const& Focal,
+		vec<2, T, Q> const& Position,
+		vec<2, T, Q> const& Step,
+		std::size_t Count,
+		T* Out
+	)
+	{
+		detail::compute_gradient_row<T, GLM_CONFIG_SIMD == GLM_ENABLE>::radial(
+			vec<2, T, defaultp>(Center), Radius, vec<2, T, defaultp>(Focal), vec<2, T, defaultp>(Position), vec<2, T, defaultp>(Step), 0, Count, Out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void linearGradient
+	(
+		vec<2, T, Q> const& Point0,
+		vec<2, T, Q> const& Point1,
+		vec<2, T, Q> const& Position,
+		vec<2, T, Q> const& Step,
+		std::size_t Count,
+		T* Out
+	)
+	{
+		detail::compute_gradient_row<T, GLM_CONFIG_SIMD == GLM_ENABLE>::linear(
+			vec<2, T, defaultp>(Point0), vec<2, T, defaultp>(Point1), vec<2, T, defaultp>(Position), vec<2, T, defaultp>(Step), 0, Count, Out);
+	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "gradient_paint_simd.inl"
+#endif
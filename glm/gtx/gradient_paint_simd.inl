@@ -0,0 +1,102 @@
+/// @ref gtx_gradient_paint
+
+#if GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_ARMV8_BIT)
+
+namespace glm{
+namespace detail
+{
+	// Four positions per iteration, computed from their index like the generic loop, the last positions by the generic loop
+	template<>
+	struct compute_gradient_row<float, true>
+	{
+		GLM_FUNC_QUALIFIER static void radial(vec<2, float, defaultp> const& Center, float Radius, vec<2, float, defaultp> const& Focal,
+			vec<2, float, defaultp> const& Position, vec<2, float, defaultp> const& Step, std::size_t Begin, std::size_t Count, float* Out)
+		{
+			vec<2, float, defaultp> const F = Focal - Center;
+			float const Radius2 = Radius * Radius;
+			float const Denominator = Radius2 - (F.x * F.x + F.y * F.y);
+			std::size_t const Batches = Begin + (Count - Begin) / 4 * 4;
+			std::size_t i = Begin;
+
+#			if GLM_ARCH & GLM_ARCH_SSE2_BIT
+				glm_f32vec4 const Lanes = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+				glm_f32vec4 const px0 = _mm_set1_ps(Position.x);
+				glm_f32vec4 const py0 = _mm_set1_ps(Position.y);
+				glm_f32vec4 const sx0 = _mm_set1_ps(Step.x);
+				glm_f32vec4 const sy0 = _mm_set1_ps(Step.y);
+				glm_f32vec4 const fx0 = _mm_set1_ps(F.x);
+				glm_f32vec4 const fy0 = _mm_set1_ps(F.y);
+				for(; i < Batches; i += 4)
+				{
+					glm_f32vec4 const idx0 = _mm_add_ps(_mm_set1_ps(static_cast<float>(i)), Lanes);
+					glm_f32vec4 const dx0 = _mm_sub_ps(_mm_add_ps(px0, _mm_mul_ps(sx0, idx0)), _mm_set1_ps(Focal.x));
+					glm_f32vec4 const dy0 = _mm_sub_ps(_mm_add_ps(py0, _mm_mul_ps(sy0, idx0)), _mm_set1_ps(Focal.y));
+					glm_f32vec4 const dot0 = _mm_add_ps(_mm_mul_ps(dx0, fx0), _mm_mul_ps(dy0, fy0));
+					glm_f32vec4 const len0 = _mm_add_ps(_mm_mul_ps(dx0, dx0), _mm_mul_ps(dy0, dy0));
+					glm_f32vec4 const crs0 = _mm_sub_ps(_mm_mul_ps(dx0, fy0), _mm_mul_ps(dy0, fx0));
+					glm_f32vec4 const num0 = _mm_add_ps(dot0, _mm_sqrt_ps(_mm_sub_ps(_mm_mul_ps(_mm_set1_ps(Radius2), len0), _mm_mul_ps(crs0, crs0))));
+					_mm_storeu_ps(Out + i, _mm_div_ps(num0, _mm_set1_ps(Denominator)));
+				}
+#			else
+				float const LaneValues[4] = {0.0f, 1.0f, 2.0f, 3.0f};
+				float32x4_t const Lanes = vld1q_f32(LaneValues);
+				float32x4_t const fx0 = vdupq_n_f32(F.x);
+				float32x4_t const fy0 = vdupq_n_f32(F.y);
+				for(; i < Batches; i += 4)
+				{
+					float32x4_t const idx0 = vaddq_f32(vdupq_n_f32(static_cast<float>(i)), Lanes);
+					float32x4_t const dx0 = vsubq_f32(vaddq_f32(vdupq_n_f32(Position.x), vmulq_n_f32(idx0, Step.x)), vdupq_n_f32(Focal.x));
+					float32x4_t const dy0 = vsubq_f32(vaddq_f32(vdupq_n_f32(Position.y), vmulq_n_f32(idx0, Step.y)), vdupq_n_f32(Focal.y));
+					float32x4_t const dot0 = vaddq_f32(vmulq_f32(dx0, fx0), vmulq_f32(dy0, fy0));
+					float32x4_t const len0 = vaddq_f32(vmulq_f32(dx0, dx0), vmulq_f32(dy0, dy0));
+					float32x4_t const crs0 = vsubq_f32(vmulq_f32(dx0, fy0), vmulq_f32(dy0, fx0));
+					float32x4_t const num0 = vaddq_f32(dot0, vsqrtq_f32(vsubq_f32(vmulq_n_f32(len0, Radius2), vmulq_f32(crs0, crs0))));
+					vst1q_f32(Out + i, vdivq_f32(num0, vdupq_n_f32(Denominator)));
+				}
+#			endif
+
+			compute_gradient_row<float, false>::radial(Center, Radius, Focal, Position, Step, i, Count, Out);
+		}
+
+		GLM_FUNC_QUALIFIER static void linear(vec<2, float, defaultp> const& Point0, vec<2, float, defaultp> const& Point1,
+			vec<2, float, defaultp> const& Position, vec<2, float, defaultp> const& Step, std::size_t Begin, std::size_t Count, float* Out)
+		{
+			vec<2, float, defaultp> const Dist = Point1 - Point0;
+			float const Length2 = dot(Dist, Dist);
+			std::size_t const Batches = Begin + (Count - Begin) / 4 * 4;
+			std::size_t i = Begin;
+
+#			if GLM_ARCH & GLM_ARCH_SSE2_BIT
+				glm_f32vec4 const Lanes = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+				glm_f32vec4 const px0 = _mm_set1_ps(Position.x);
+				glm_f32vec4 const py0 = _mm_set1_ps(Position.y);
+				glm_f32vec4 const sx0 = _mm_set1_ps(Step.x);
+				glm_f32vec4 const sy0 = _mm_set1_ps(Step.y);
+				for(; i < Batches; i += 4)
+				{
+					glm_f32vec4 const idx0 = _mm_add_ps(_mm_set1_ps(static_cast<float>(i)), Lanes);
+					glm_f32vec4 const dx0 = _mm_sub_ps(_mm_add_ps(px0, _mm_mul_ps(sx0, idx0)), _mm_set1_ps(Point0.x));
+					glm_f32vec4 const dy0 = _mm_sub_ps(_mm_add_ps(py0, _mm_mul_ps(sy0, idx0)), _mm_set1_ps(Point0.y));
+					glm_f32vec4 const num0 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Dist.x), dx0), _mm_mul_ps(_mm_set1_ps(Dist.y), dy0));
+					_mm_storeu_ps(Out + i, _mm_div_ps(num0, _mm_set1_ps(Length2)));
+				}
+#			else
+				float const LaneValues[4] = {0.0f, 1.0f, 2.0f, 3.0f};
+				float32x4_t const Lanes = vld1q_f32(LaneValues);
+				for(; i < Batches; i += 4)
+				{
+					float32x4_t const idx0 = vaddq_f32(vdupq_n_f32(static_cast<float>(i)), Lanes);
+					float32x4_t const dx0 = vsubq_f32(vaddq_f32(vdupq_n_f32(Position.x), vmulq_n_f32(idx0, Step.x)), vdupq_n_f32(Point0.x));
+					float32x4_t const dy0 = vsubq_f32(vaddq_f32(vdupq_n_f32(Position.y), vmulq_n_f32(idx0, Step.y)), vdupq_n_f32(Point0.y));
+					float32x4_t const num0 = vaddq_f32(vmulq_n_f32(dx0, Dist.x), vmulq_n_f32(dy0, Dist.y));
+					vst1q_f32(Out + i, vdivq_f32(num0, vdupq_n_f32(Length2)));
+				}
+#			endif
+
+			compute_gradient_row<float, false>::linear(Point0, Point1, Position, Step, i, Count, Out);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_ARMV8_BIT)
@@ -8,7 +8,8 @@
 ///
 /// Include <glm/gtx/hash.hpp> to use the features of this extension.
 ///
-/// Add std::hash support for glm types
+/// Add std::hash support for glm types, using a wyhash-style mixing of the whole value.
+/// Also provides spatial hashing helpers to bucket points into grid cells.
 
 #pragma once
 
@@ -57,6 +58,40 @@
 #if GLM_LANG & GLM_LANG_CXX11
 #define GLM_GTX_hash 1
 #include <functional>
+#include <cstddef>
+
+namespace glm
+{
+	/// @addtogroup gtx_hash
+	/// @{
+
+	/// Returns the same hash as std::hash for a vector.
+	/// Floating-point -0.0 and +0.0 hash equally.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL size_t hashValue(vec<L, T, Q> const& v);
+
+	/// Hashes Count vectors into Out.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void hashValue(vec<L, T, Q> const* v, std::size_t Count, std::size_t* Out);
+
+	/// Returns the integer coordinates of the grid cell of size CellSize containing p: floor(p / CellSize).
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, int, Q> spatialCell(vec<L, T, Q> const& p, T CellSize);
+
+	/// Hashes the coordinates of a grid cell.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL size_t spatialHash(vec<L, int, Q> const& Cell);
+
+	/// Hashes the grid cell of size CellSize containing p, equivalent to spatialHash(spatialCell(p, CellSize)).
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL size_t spatialHash(vec<L, T, Q> const& p, T CellSize);
+
+	/// Hashes the grid cells of size CellSize containing Count points into Out.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void spatialHash(vec<L, T, Q> const* p, std::size_t Count, T CellSize, std::size_t* Out);
+
+	/// @}
+}//namespace glm
 
 namespace std
 {
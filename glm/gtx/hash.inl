@@ -1,175 +1,246 @@
 /// @ref gtx_hash
 
+#include <cstring>
+#if defined(_MSC_VER) && defined(_M_X64)
+#	include <intrin.h>
+#endif
+
 namespace glm {
 namespace detail
 {
-	GLM_INLINE void hash_combine(size_t &seed, size_t hash)
+	// Full 64 x 64 -> 128 bits multiply, folded back to 64 bits (wyhash 'mum')
+	GLM_FUNC_QUALIFIER uint64 hash_mix(uint64 a, uint64 b)
+	{
+#		if defined(__SIZEOF_INT128__)
+			__extension__ typedef unsigned __int128 uint128;
+			uint128 const r = static_cast<uint128>(a) * b;
+			return static_cast<uint64>(r) ^ static_cast<uint64>(r >> 64);
+#		elif defined(_MSC_VER) && defined(_M_X64)
+			uint64 hi;
+			uint64 const lo = _umul128(a, b, &hi);
+			return lo ^ hi;
+#		else
+			uint64 const ha = a >> 32, hb = b >> 32, la = a & 0xffffffffull, lb = b & 0xffffffffull;
+			uint64 const rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+			uint64 const t = rl + (rm0 << 32);
+			uint64 c = t < rl ? 1 : 0;
+			uint64 const lo = t + (rm1 << 32);
+			c += lo < t ? 1 : 0;
+			uint64 const hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+			return lo ^ hi;
+#		endif
+	}
+
+	// wyhash default secrets, an accessor rather than namespace scope statics so headers define no per translation unit objects
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR uint64 hash_secret(int Index)
+	{
+		return
+			Index == 0 ? 0xa0761d6478bd642full :
+			Index == 1 ? 0xe7037ed1a0b428dbull :
+			Index == 2 ? 0x8ebc6af09c88c6e3ull :
+			0x589965cc75374cc3ull;
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER uint64 hash_bits(T v)
+	{
+		return static_cast<uint64>(v);
+	}
+
+	// -0.0 and +0.0 compare equal so they must hash equally
+	GLM_FUNC_QUALIFIER uint64 hash_bits(float v)
+	{
+		uint32 Bits;
+		std::memcpy(&Bits, &v, sizeof(Bits));
+		return Bits == 0x80000000u ? 0 : Bits;
+	}
+
+	GLM_FUNC_QUALIFIER uint64 hash_bits(double v)
+	{
+		uint64 Bits;
+		std::memcpy(&Bits, &v, sizeof(Bits));
+		return Bits == 0x8000000000000000ull ? 0 : Bits;
+	}
+
+	// Components are consumed in pairs, one multiply per pair
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER uint64 hash_accumulate(vec<L, T, Q> const& v, uint64 seed)
+	{
+		for(length_t i = 0; i < L; i += 2)
+		{
+			uint64 const a = hash_bits(v[i]);
+			uint64 const b = i + 1 < L ? hash_bits(v[i + 1]) : hash_secret(3);
+			seed = hash_mix(a ^ hash_secret(1), b ^ seed);
+		}
+		return seed;
+	}
+
+	GLM_FUNC_QUALIFIER size_t hash_finalize(uint64 seed, uint64 length)
+	{
+		return static_cast<size_t>(hash_mix(seed ^ hash_secret(2), length ^ hash_secret(1)));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER size_t hash_vec(vec<L, T, Q> const& v)
+	{
+		return hash_finalize(hash_accumulate(v, hash_secret(0)), static_cast<uint64>(L));
+	}
+
+	template<length_t C, length_t R, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER size_t hash_mat(mat<C, R, T, Q> const& m)
+	{
+		uint64 Seed = hash_secret(0);
+		for(length_t i = 0; i < C; ++i)
+			Seed = hash_accumulate(m[i], Seed);
+		return hash_finalize(Seed, static_cast<uint64>(C * R));
+	}
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_spatial_cell
+	{
+		GLM_FUNC_QUALIFIER static vec<L, int, Q> call(vec<L, T, Q> const& p, T cellSize)
+		{
+			return vec<L, int, Q>(floor(p / cellSize));
+		}
+	};
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER size_t hashValue(vec<L, T, Q> const& v)
 	{
-		hash += 0x9e3779b9 + (seed << 6) + (seed >> 2);
-		seed ^= hash;
+		return detail::hash_vec(v);
 	}
-}}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void hashValue(vec<L, T, Q> const* v, std::size_t count, std::size_t* out)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			out[i] = detail::hash_vec(v[i]);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, int, Q> spatialCell(vec<L, T, Q> const& p, T cellSize)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'spatialCell' only accept floating-point inputs");
+		return detail::compute_spatial_cell<L, T, Q, detail::is_aligned<Q>::value>::call(p, cellSize);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER size_t spatialHash(vec<L, int, Q> const& cell)
+	{
+		return detail::hash_vec(cell);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER size_t spatialHash(vec<L, T, Q> const& p, T cellSize)
+	{
+		return detail::hash_vec(spatialCell(p, cellSize));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void spatialHash(vec<L, T, Q> const* p, std::size_t count, T cellSize, std::size_t* out)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			out[i] = detail::hash_vec(spatialCell(p[i], cellSize));
+	}
+}//namespace glm
 
 namespace std
 {
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::vec<1, T, Q> >::operator()(glm::vec<1, T, Q> const& v) const noexcept
 	{
-		hash<T> hasher;
-		return hasher(v.x);
+		return glm::detail::hash_vec(v);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::vec<2, T, Q> >::operator()(glm::vec<2, T, Q> const& v) const noexcept
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		return seed;
+		return glm::detail::hash_vec(v);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::vec<3, T, Q> >::operator()(glm::vec<3, T, Q> const& v) const noexcept
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		glm::detail::hash_combine(seed, hasher(v.z));
-		return seed;
+		return glm::detail::hash_vec(v);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::vec<4, T, Q> >::operator()(glm::vec<4, T, Q> const& v) const noexcept
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		glm::detail::hash_combine(seed, hasher(v.z));
-		glm::detail::hash_combine(seed, hasher(v.w));
-		return seed;
+		return glm::detail::hash_vec(v);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::qua<T, Q> >::operator()(glm::qua<T,Q> const& q) const noexcept
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(q.x));
-		glm::detail::hash_combine(seed, hasher(q.y));
-		glm::detail::hash_combine(seed, hasher(q.z));
-		glm::detail::hash_combine(seed, hasher(q.w));
-		return seed;
+		return glm::detail::hash_vec(glm::vec<4, T, Q>(q.x, q.y, q.z, q.w));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tdualquat<T, Q> >::operator()(glm::tdualquat<T, Q> const& q) const noexcept
 	{
-		size_t seed = 0;
-		hash<glm::qua<T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(q.real));
-		glm::detail::hash_combine(seed, hasher(q.dual));
-		return seed;
+		glm::uint64 Seed = glm::detail::hash_secret(0);
+		Seed = glm::detail::hash_accumulate(glm::vec<4, T, Q>(q.real.x, q.real.y, q.real.z, q.real.w), Seed);
+		Seed = glm::detail::hash_accumulate(glm::vec<4, T, Q>(q.dual.x, q.dual.y, q.dual.z, q.dual.w), Seed);
+		return glm::detail::hash_finalize(Seed, 8);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<2, 2, T, Q> >::operator()(glm::mat<2, 2, T, Q> const& m) const noexcept
 	{
-		size_t seed = 0;
-		hash<glm::vec<2, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		return seed;
+		return glm::detail::hash_mat(m);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<2, 3, T, Q> >::operator()(glm::mat<2, 3, T, Q> const& m) const noexcept
 	{
-		size_t seed = 0;
-		hash<glm::vec<3, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		return seed;
+		return glm::detail::hash_mat(m);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<2, 4, T, Q> >::operator()(glm::mat<2, 4, T, Q> const& m) const noexcept
 	{
-		size_t seed = 0;
-		hash<glm::vec<4, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		return seed;
+		return glm::detail::hash_mat(m);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<3, 2, T, Q> >::operator()(glm::mat<3, 2, T, Q> const& m) const noexcept
 	{
-		size_t seed = 0;
-		hash<glm::vec<2, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		return seed;
+		return glm::detail::hash_mat(m);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<3, 3, T, Q> >::operator()(glm::mat<3, 3, T, Q> const& m) const noexcept
 	{
-		size_t seed = 0;
-		hash<glm::vec<3, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		return seed;
+		return glm::detail::hash_mat(m);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<3, 4, T, Q> >::operator()(glm::mat<3, 4, T, Q> const& m) const noexcept
 	{
-		size_t seed = 0;
-		hash<glm::vec<4, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		return seed;
+		return glm::detail::hash_mat(m);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<4, 2, T,Q> >::operator()(glm::mat<4, 2, T,Q> const& m) const noexcept
 	{
-		size_t seed = 0;
-		hash<glm::vec<2, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		glm::detail::hash_combine(seed, hasher(m[3]));
-		return seed;
+		return glm::detail::hash_mat(m);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<4, 3, T,Q> >::operator()(glm::mat<4, 3, T,Q> const& m) const noexcept
 	{
-		size_t seed = 0;
-		hash<glm::vec<3, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		glm::detail::hash_combine(seed, hasher(m[3]));
-		return seed;
+		return glm::detail::hash_mat(m);
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<4, 4, T,Q> >::operator()(glm::mat<4, 4, T, Q> const& m) const noexcept
 	{
-		size_t seed = 0;
-		hash<glm::vec<4, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		glm::detail::hash_combine(seed, hasher(m[3]));
-		return seed;
+		return glm::detail::hash_mat(m);
 	}
 }
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "hash_simd.inl"
+#endif
@@ -0,0 +1,32 @@
+/// @ref gtx_hash
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_spatial_cell<3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<3, int, Q> call(vec<3, float, Q> const& p, float cellSize)
+		{
+			vec<3, int, Q> Result;
+			Result.data = _mm_cvttps_epi32(glm_vec4_floor(_mm_div_ps(p.data, _mm_set1_ps(cellSize))));
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_spatial_cell<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, float, Q> const& p, float cellSize)
+		{
+			vec<4, int, Q> Result;
+			Result.data = _mm_cvttps_epi32(glm_vec4_floor(_mm_div_ps(p.data, _mm_set1_ps(cellSize))));
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -19,6 +19,7 @@
 #include "../geometric.hpp"
 #include "../gtc/quaternion.hpp"
 #include "../gtc/matrix_transform.hpp"
+#include <cstddef>
 
 #ifndef GLM_ENABLE_EXPERIMENTAL
 #	error "GLM: GLM_GTX_matrix_decompose is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
@@ -44,6 +45,37 @@ namespace glm
 		vec<3, T, Q> const& scale, qua<T, Q> const& orientation, vec<3, T, Q> const& translation,
 		vec<3, T, Q> const& skew, vec<4, T, Q> const& perspective);
 
+	/// Decomposes an affine model matrix without skew nor perspective to translation, rotation and scale components.
+	/// Much cheaper than decompose for the common translate * rotate * scale matrices.
+	/// A negative determinant is reported by negating the three scale factors.
+	/// Returns false and sets orientation to identity if a scale factor is zero.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL bool decomposeTRS(
+		mat<4, 4, T, Q> const& modelMatrix,
+		vec<3, T, Q> & scale, qua<T, Q> & orientation, vec<3, T, Q> & translation);
+
+	/// Decomposes count affine model matrices without skew nor perspective, see decomposeTRS.
+	/// Returns false if at least one of the matrices has a zero scale factor.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL bool decomposeTRS(
+		mat<4, 4, T, Q> const* modelMatrix, std::size_t count,
+		vec<3, T, Q>* scale, qua<T, Q>* orientation, vec<3, T, Q>* translation);
+
+	/// Recomposes a model matrix from components returned by decomposeTRS.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> recompose(
+		vec<3, T, Q> const& scale, qua<T, Q> const& orientation, vec<3, T, Q> const& translation);
+
+	/// Recomposes count model matrices from components returned by decomposeTRS.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void recompose(
+		vec<3, T, Q> const* scale, qua<T, Q> const* orientation, vec<3, T, Q> const* translation,
+		std::size_t count, mat<4, 4, T, Q>* modelMatrix);
+
 	/// @}
 }//namespace glm
 
@@ -23,6 +23,33 @@ namespace detail
 	{
 		return v * desiredLength / length(v);
 	}
+
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_decomposeTRS
+	{
+		GLM_FUNC_QUALIFIER static bool call(mat<4, 4, T, Q> const& m, vec<3, T, Q> & Scale, qua<T, Q> & Orientation, vec<3, T, Q> & Translation)
+		{
+			vec<3, T, Q> const X(m[0]);
+			vec<3, T, Q> const Y(m[1]);
+			vec<3, T, Q> const Z(m[2]);
+
+			Translation = vec<3, T, Q>(m[3]);
+			Scale = vec<3, T, Q>(length(X), length(Y), length(Z));
+
+			if(Scale.x <= epsilon<T>() || Scale.y <= epsilon<T>() || Scale.z <= epsilon<T>())
+			{
+				Orientation = qua<T, Q>::wxyz(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0));
+				return false;
+			}
+
+			// Check for a coordinate system flip, same convention as decompose
+			if(dot(cross(X, Y), Z) < static_cast<T>(0))
+				Scale = -Scale;
+
+			Orientation = quat_cast(mat<3, 3, T, Q>(X / Scale.x, Y / Scale.y, Z / Scale.z));
+			return true;
+		}
+	};
 }//namespace detail
 
 	// Matrix decompose
@@ -231,4 +258,35 @@ namespace detail
 
 		return m;
 	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool decomposeTRS(mat<4, 4, T, Q> const& ModelMatrix, vec<3, T, Q> & Scale, qua<T, Q> & Orientation, vec<3, T, Q> & Translation)
+	{
+		return detail::compute_decomposeTRS<T, Q, detail::is_aligned<Q>::value>::call(ModelMatrix, Scale, Orientation, Translation);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool decomposeTRS(mat<4, 4, T, Q> const* ModelMatrix, std::size_t Count, vec<3, T, Q>* Scale, qua<T, Q>* Orientation, vec<3, T, Q>* Translation)
+	{
+		bool Result = true;
+		for(std::size_t i = 0; i < Count; ++i)
+			Result = decomposeTRS(ModelMatrix[i], Scale[i], Orientation[i], Translation[i]) && Result;
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> recompose(vec<3, T, Q> const& Scale, qua<T, Q> const& Orientation, vec<3, T, Q> const& Translation)
+	{
+		return mat4_cast(Translation, Orientation, Scale);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void recompose(vec<3, T, Q> const* Scale, qua<T, Q> const* Orientation, vec<3, T, Q> const* Translation, std::size_t Count, mat<4, 4, T, Q>* ModelMatrix)
+	{
+		mat4_cast(Translation, Orientation, Scale, Count, ModelMatrix);
+	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_decompose_simd.inl"
+#endif
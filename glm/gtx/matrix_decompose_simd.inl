@@ -0,0 +1,55 @@
+/// @ref gtx_matrix_decompose
+
+#include "../simd/geometric.h"
+#include "../simd/quaternion.h"
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && !defined(GLM_FORCE_QUAT_DATA_WXYZ)
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_decomposeTRS<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static bool call(mat<4, 4, float, Q> const& m, vec<3, float, Q> & Scale, qua<float, Q> & Orientation, vec<3, float, Q> & Translation)
+		{
+			glm_vec4 const MaskXYZ = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+			glm_vec4 const X = _mm_and_ps(m[0].data, MaskXYZ);
+			glm_vec4 const Y = _mm_and_ps(m[1].data, MaskXYZ);
+			glm_vec4 const Z = _mm_and_ps(m[2].data, MaskXYZ);
+
+			Translation.data = _mm_and_ps(m[3].data, MaskXYZ);
+
+			// The three squared column lengths at once: (|X|^2, |Y|^2, |Z|^2, 0)
+			glm_vec4 Row0 = _mm_mul_ps(X, X);
+			glm_vec4 Row1 = _mm_mul_ps(Y, Y);
+			glm_vec4 Row2 = _mm_mul_ps(Z, Z);
+			glm_vec4 Row3 = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(Row0, Row1, Row2, Row3);
+			glm_vec4 const Length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(Row0, Row1), Row2));
+
+			if(_mm_movemask_ps(_mm_cmple_ps(Length, _mm_set1_ps(epsilon<float>()))) & 0x7)
+			{
+				Scale.data = Length;
+				Orientation = qua<float, Q>::wxyz(1.0f, 0.0f, 0.0f, 0.0f);
+				return false;
+			}
+
+			// Check for a coordinate system flip, same convention as decompose
+			glm_vec4 const Flip = _mm_and_ps(glm_vec4_dot(glm_vec4_cross(X, Y), Z), _mm_set1_ps(-0.0f));
+			glm_vec4 const Signed = _mm_xor_ps(Length, Flip);
+			Scale.data = Signed;
+
+			glm_vec4 const InvScale = _mm_div_ps(_mm_set1_ps(1.0f), Signed);
+			glm_vec4 const Rotation[3] = {
+				_mm_mul_ps(X, _mm_shuffle_ps(InvScale, InvScale, _MM_SHUFFLE(0, 0, 0, 0))),
+				_mm_mul_ps(Y, _mm_shuffle_ps(InvScale, InvScale, _MM_SHUFFLE(1, 1, 1, 1))),
+				_mm_mul_ps(Z, _mm_shuffle_ps(InvScale, InvScale, _MM_SHUFFLE(2, 2, 2, 2)))};
+			Orientation.data = glm_mat3_quat_cast(Rotation);
+			return true;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//(GLM_ARCH & GLM_ARCH_SSE2_BIT) && !defined(GLM_FORCE_QUAT_DATA_WXYZ)
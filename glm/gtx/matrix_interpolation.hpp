@@ -15,6 +15,8 @@
 
 // Dependency:
 #include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include <cstddef>
 
 #ifndef GLM_ENABLE_EXPERIMENTAL
 #	error "GLM: GLM_GTX_matrix_interpolation is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
@@ -48,10 +50,67 @@ namespace glm
 	/// Build a interpolation of 4 * 4 matrixes.
 	/// From GLM_GTX_matrix_interpolation extension.
 	/// Warning! works only with rotation and/or translation matrixes, scale will generate unexpected results.
+	/// Use extractRotation or polarDecompose first to remove scale or accumulated drift.
 	template<typename T, qualifier Q>
 	GLM_FUNC_DECL mat<4, 4, T, Q> interpolate(
 		mat<4, 4, T, Q> const& m1, mat<4, 4, T, Q> const& m2, T const Delta);
 
+	/// Polar decomposition of a 3 * 3 matrix: Mat = Rotation * Stretch, with Rotation orthogonal and Stretch symmetric.
+	/// Runs the scaled Newton iteration of Higham until convergence, at most 16 iterations.
+	/// Rotation is a reflection if the determinant of Mat is negative.
+	/// Returns false if Mat is singular relative to its scale, |determinant| <= epsilon * frobeniusNorm^3,
+	/// or if the iteration produced non-finite values.
+	/// From GLM_GTX_matrix_interpolation extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL bool polarDecompose(
+		mat<3, 3, T, Q> const& Mat, mat<3, 3, T, Q> & Rotation, mat<3, 3, T, Q> & Stretch);
+
+	/// Polar decomposition of a 3 * 3 matrix running exactly Iterations Newton steps, for a predictable cost.
+	/// Three to five iterations are enough for matrices close to a rotation.
+	/// From GLM_GTX_matrix_interpolation extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL bool polarDecompose(
+		mat<3, 3, T, Q> const& Mat, mat<3, 3, T, Q> & Rotation, mat<3, 3, T, Q> & Stretch, length_t Iterations);
+
+	/// Polar decomposition of the upper 3 * 3 part of a 4 * 4 matrix, translation is ignored.
+	/// Rotation and Stretch are returned as 4 * 4 matrices with an identity fourth row and column.
+	/// From GLM_GTX_matrix_interpolation extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL bool polarDecompose(
+		mat<4, 4, T, Q> const& Mat, mat<4, 4, T, Q> & Rotation, mat<4, 4, T, Q> & Stretch);
+
+	/// Polar decomposition of the upper 3 * 3 part of a 4 * 4 matrix running exactly Iterations Newton steps.
+	/// From GLM_GTX_matrix_interpolation extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL bool polarDecompose(
+		mat<4, 4, T, Q> const& Mat, mat<4, 4, T, Q> & Rotation, mat<4, 4, T, Q> & Stretch, length_t Iterations);
+
+	/// Extracts the rotation closest to a 3 * 3 matrix as a quaternion, refining Guess with Iterations steps.
+	/// Warm starting from the previous frame result usually converges in one or two iterations.
+	/// Robust to scale, shear, drift and degenerate matrices; the result is always a unit quaternion.
+	/// From GLM_GTX_matrix_interpolation extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL qua<T, Q> extractRotation(
+		mat<3, 3, T, Q> const& Mat, qua<T, Q> const& Guess, length_t Iterations);
+
+	/// Extracts the rotation closest to the upper 3 * 3 part of a 4 * 4 matrix as a quaternion, see extractRotation.
+	/// From GLM_GTX_matrix_interpolation extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL qua<T, Q> extractRotation(
+		mat<4, 4, T, Q> const& Mat, qua<T, Q> const& Guess, length_t Iterations);
+
+	/// Extracts the rotations of Count matrices. Rotations holds the initial guesses and receives the results.
+	/// From GLM_GTX_matrix_interpolation extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void extractRotation(
+		mat<3, 3, T, Q> const* Mat, std::size_t Count, qua<T, Q>* Rotations, length_t Iterations);
+
+	/// Extracts the rotations of the upper 3 * 3 part of Count matrices. Rotations holds the initial guesses and receives the results.
+	/// From GLM_GTX_matrix_interpolation extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void extractRotation(
+		mat<4, 4, T, Q> const* Mat, std::size_t Count, qua<T, Q>* Rotations, length_t Iterations);
+
 	/// @}
 }//namespace glm
 
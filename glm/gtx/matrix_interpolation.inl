@@ -143,4 +143,127 @@ namespace glm
 		out[3][2] = m1[3][2] + delta * (m2[3][2] - m1[3][2]);
 		return out;
 	}
+
+namespace detail
+{
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T frobeniusNorm2(mat<3, 3, T, Q> const& m)
+	{
+		return dot(m[0], m[0]) + dot(m[1], m[1]) + dot(m[2], m[2]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool polarDecompose(mat<3, 3, T, Q> const& m, mat<3, 3, T, Q>& r, mat<3, 3, T, Q>& s, length_t iterations, bool converge)
+	{
+		// Singular relative to the scale of the matrix, the determinant has the dimension of a cubed norm
+		T const Scale2 = frobeniusNorm2(m);
+		if(!(abs(determinant(m)) > std::numeric_limits<T>::epsilon() * Scale2 * sqrt(Scale2)))
+			return false;
+
+		mat<3, 3, T, Q> X(m);
+		for(length_t i = 0; i < iterations; ++i)
+		{
+			mat<3, 3, T, Q> const InverseTranspose = transpose(inverse(X));
+
+			// Frobenius norm scaling speeds up the first iterations when the matrix is far from orthogonal
+			T const Norm2 = frobeniusNorm2(X);
+			T const Gamma = sqrt(sqrt(frobeniusNorm2(InverseTranspose) / Norm2));
+			mat<3, 3, T, Q> const Next = (X * Gamma + InverseTranspose / Gamma) * static_cast<T>(0.5);
+
+			mat<3, 3, T, Q> const Delta = Next - X;
+			X = Next;
+			if(converge && frobeniusNorm2(Delta) <= std::numeric_limits<T>::epsilon() * std::numeric_limits<T>::epsilon() * Norm2)
+				break;
+		}
+
+		mat<3, 3, T, Q> const Stretch = transpose(X) * m;
+		mat<3, 3, T, Q> const Symmetric = (Stretch + transpose(Stretch)) * static_cast<T>(0.5);
+
+		// A NaN or an infinity anywhere propagates to the norms
+		T const Norm2 = frobeniusNorm2(X) + frobeniusNorm2(Symmetric);
+		if(isnan(Norm2) || isinf(Norm2))
+			return false;
+
+		r = X;
+		s = Symmetric;
+		return true;
+	}
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool polarDecompose(mat<3, 3, T, Q> const& m, mat<3, 3, T, Q>& r, mat<3, 3, T, Q>& s)
+	{
+		return detail::polarDecompose(m, r, s, 16, true);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool polarDecompose(mat<3, 3, T, Q> const& m, mat<3, 3, T, Q>& r, mat<3, 3, T, Q>& s, length_t iterations)
+	{
+		return detail::polarDecompose(m, r, s, iterations, false);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool polarDecompose(mat<4, 4, T, Q> const& m, mat<4, 4, T, Q>& r, mat<4, 4, T, Q>& s)
+	{
+		mat<3, 3, T, Q> Rotation, Stretch;
+		if(!detail::polarDecompose(mat<3, 3, T, Q>(m), Rotation, Stretch, 16, true))
+			return false;
+
+		r = mat<4, 4, T, Q>(Rotation);
+		s = mat<4, 4, T, Q>(Stretch);
+		return true;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool polarDecompose(mat<4, 4, T, Q> const& m, mat<4, 4, T, Q>& r, mat<4, 4, T, Q>& s, length_t iterations)
+	{
+		mat<3, 3, T, Q> Rotation, Stretch;
+		if(!detail::polarDecompose(mat<3, 3, T, Q>(m), Rotation, Stretch, iterations, false))
+			return false;
+
+		r = mat<4, 4, T, Q>(Rotation);
+		s = mat<4, 4, T, Q>(Stretch);
+		return true;
+	}
+
+	// A Robust Method to Extract the Rotational Part of Deformations, Muller et al. 2016
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER qua<T, Q> extractRotation(mat<3, 3, T, Q> const& m, qua<T, Q> const& guess, length_t iterations)
+	{
+		qua<T, Q> Result(guess);
+		for(length_t i = 0; i < iterations; ++i)
+		{
+			mat<3, 3, T, Q> const R = mat3_cast(Result);
+			vec<3, T, Q> const Omega =
+				(cross(R[0], m[0]) + cross(R[1], m[1]) + cross(R[2], m[2])) *
+				(static_cast<T>(1) / (abs(dot(R[0], m[0]) + dot(R[1], m[1]) + dot(R[2], m[2])) + std::numeric_limits<T>::epsilon()));
+
+			T const Angle = length(Omega);
+			if(Angle <= std::numeric_limits<T>::epsilon())
+				break;
+
+			Result = normalize(angleAxis(Angle, Omega / Angle) * Result);
+		}
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER qua<T, Q> extractRotation(mat<4, 4, T, Q> const& m, qua<T, Q> const& guess, length_t iterations)
+	{
+		return extractRotation(mat<3, 3, T, Q>(m), guess, iterations);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void extractRotation(mat<3, 3, T, Q> const* m, std::size_t count, qua<T, Q>* rotations, length_t iterations)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			rotations[i] = extractRotation(m[i], rotations[i], iterations);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void extractRotation(mat<4, 4, T, Q> const* m, std::size_t count, qua<T, Q>* rotations, length_t iterations)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			rotations[i] = extractRotation(mat<3, 3, T, Q>(m[i]), rotations[i], iterations);
+	}
 }//namespace glm
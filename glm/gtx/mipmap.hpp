@@ -0,0 +1,150 @@
+/// @ref gtx_mipmap
+/// @file glm/gtx/mipmap.hpp
+///
+/// @see core (dependence)
+/// @see gtc_color_space (dependence)
+/// @see gtx_texture (dependence)
+///
+/// @defgroup gtx_mipmap GLM_GTX_mipmap
+/// @ingroup gtx
+///
+/// Include <glm/gtx/mipmap.hpp> to use the features of this extension.
+///
+/// Extents and byte offsets of the levels of a mipmap chain and box or Kaiser downsampling of RGBA images.
+///
+/// The levels of a chain are packed from the base level, without padding between the levels.
+/// The formats are described by the extent of their blocks in texels and the size of a block in bytes:
+/// (1, 1) and 16 for RGBA32F, (1, 1) and 4 for RGBA8, (4, 4) and 8 for BC1, (4, 4) and 16 for BC7.
+///
+/// The downsampling functions average the 2x2 (2D) or 2x2x2 (3D) blocks of texels of the source.
+/// Along an odd dimension the extent of the destination is rounded down and the last texel of the source is folded into
+/// the last texel of the destination: its three source texels are weighted by 1/4, 1/2 and 1/4.
+/// With SIMD instruction sets, the rows of vec4 and u8vec4 texels are averaged with SSE2, AVX or NEON kernels.
+/// The Kaiser downsampling functions filter the rows, then the columns, then the slices with a Kaiser windowed sinc,
+/// sharper than the box filter, at the cost of a few more source texels per destination texel and of intermediate buffers.
+/// The rows of the destination are split between up to Threads threads.
+/// The downsampling functions use std::thread: link the program with the threads library, e.g. Threads::Threads with CMake.
+/// It is not included by <glm/ext.hpp> so that including all the extensions does not include <thread>.
+///
+/// Example:
+/// ```
+/// glm::ivec2 Extent(1024, 512);
+/// std::vector<glm::u8vec4> Chain(glm::mipChainSize(Extent, glm::ivec2(1), 4) / 4);
+/// for(int Level = 1; Level < glm::levels(Extent); ++Level)
+/// {
+///     std::size_t const Src = glm::mipOffset(Extent, Level - 1, glm::ivec2(1), 4) / 4;
+///     std::size_t const Dst = glm::mipOffset(Extent, Level, glm::ivec2(1), 4) / 4;
+///     glm::downsampleSRGB(&Chain[Src], glm::mipExtent(Extent, Level - 1), &Chain[Dst], 4u);
+/// }
+/// ```
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../ext/scalar_uint_sized.hpp"
+#include "../gtc/color_space.hpp"
+#include "../gtx/texture.hpp"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_mipmap is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_mipmap extension included")
+#endif
+
+#if GLM_LANG & GLM_LANG_CXX11
+
+#include <cstddef>
+
+namespace glm
+{
+	/// @addtogroup gtx_mipmap
+	/// @{
+
+	/// Extent of the mipmap Level of a texture whose base level has the extent Extent.
+	/// Each dimension is halved at each level and never falls below 1.
+	///
+	/// @tparam L Integer between 1 and 3 included that qualify the dimension of the texture
+	/// @tparam T Signed integer scalar types
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> mipExtent(vec<L, T, Q> const& Extent, T Level);
+
+	/// Size in bytes of an image of Extent texels stored in blocks of BlockExtent texels of BlockSize bytes.
+	/// The partial blocks at the end of each dimension are stored whole.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t mipSize(vec<L, T, Q> const& Extent, vec<L, T, Q> const& BlockExtent, std::size_t BlockSize);
+
+	/// Offset in bytes of the mipmap Level in the packed chain of a texture whose base level has the extent Extent.
+	///
+	/// @see mipSize
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t mipOffset(vec<L, T, Q> const& Extent, T Level, vec<L, T, Q> const& BlockExtent, std::size_t BlockSize);
+
+	/// Size in bytes of the packed chain of the levels(Extent) levels of a texture whose base level has the extent Extent.
+	///
+	/// @see levels
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t mipChainSize(vec<L, T, Q> const& Extent, vec<L, T, Q> const& BlockExtent, std::size_t BlockSize);
+
+	/// Computes the extent and the offset in bytes of each level of the packed chain of a texture whose base level has the extent Extent.
+	/// Extents and Offsets, which may be null, receive levels(Extent) values. Returns the size of the chain in bytes.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t mipChain(vec<L, T, Q> const& Extent, vec<L, T, Q> const& BlockExtent, std::size_t BlockSize,
+		vec<L, T, Q>* Extents, std::size_t* Offsets);
+
+	/// Downsamples the 2D or 3D image Src of Extent texels into Dst of mipExtent(Extent, 1) texels with a box filter,
+	/// using up to Threads threads.
+	///
+	/// @tparam L 2 or 3, the dimension of the image
+	template<length_t L, qualifier P, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void downsample(vec<4, float, Q> const* Src, vec<L, int, P> const& Extent, vec<4, float, Q>* Dst, unsigned int Threads);
+
+	/// Downsamples the 2D or 3D image Src of Extent texels into Dst of mipExtent(Extent, 1) texels with a box filter,
+	/// using up to Threads threads. The averages are rounded to the nearest integer.
+	///
+	/// @tparam L 2 or 3, the dimension of the image
+	template<length_t L, qualifier P, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void downsample(vec<4, uint8, Q> const* Src, vec<L, int, P> const& Extent, vec<4, uint8, Q>* Dst, unsigned int Threads);
+
+	/// Downsamples the 2D or 3D sRGB image Src of Extent texels into Dst of mipExtent(Extent, 1) texels with a box filter,
+	/// using up to Threads threads. The color components are averaged in linear space, the alpha component is linear.
+	/// The conversions are the ones of convertSRGBToLinear, the averages are rounded to the nearest sRGB value.
+	///
+	/// @tparam L 2 or 3, the dimension of the image
+	/// @see convertSRGBToLinear
+	template<length_t L, qualifier P, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void downsampleSRGB(vec<4, uint8, Q> const* Src, vec<L, int, P> const& Extent, vec<4, uint8, Q>* Dst, unsigned int Threads);
+
+	/// Downsamples the 2D or 3D image Src of Extent texels into Dst of mipExtent(Extent, 1) texels with a separable Kaiser filter,
+	/// using up to Threads threads. The filter is a sinc windowed by a Kaiser window of parameter Alpha
+	/// that spans Width destination texels on each side of each texel, e.g. Width 3 and Alpha 4.
+	/// The source is clamped to its edges.
+	///
+	/// @tparam L 2 or 3, the dimension of the image
+	template<length_t L, qualifier P, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void downsampleKaiser(vec<4, float, Q> const* Src, vec<L, int, P> const& Extent, vec<4, float, Q>* Dst, float Width, float Alpha, unsigned int Threads);
+
+	/// Downsamples the 2D or 3D image Src of Extent texels into Dst of mipExtent(Extent, 1) texels with a separable Kaiser filter,
+	/// using up to Threads threads. The results are clamped to [0, 255] and rounded to the nearest integer.
+	///
+	/// @tparam L 2 or 3, the dimension of the image
+	/// @see downsampleKaiser
+	template<length_t L, qualifier P, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void downsampleKaiser(vec<4, uint8, Q> const* Src, vec<L, int, P> const& Extent, vec<4, uint8, Q>* Dst, float Width, float Alpha, unsigned int Threads);
+
+	/// Downsamples the 2D or 3D sRGB image Src of Extent texels into Dst of mipExtent(Extent, 1) texels with a separable Kaiser filter,
+	/// using up to Threads threads. The color components are filtered in linear space, the alpha component is linear.
+	/// The results are clamped and rounded to the nearest sRGB value.
+	///
+	/// @tparam L 2 or 3, the dimension of the image
+	/// @see downsampleKaiser
+	/// @see convertSRGBToLinear
+	template<length_t L, qualifier P, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void downsampleKaiserSRGB(vec<4, uint8, Q> const* Src, vec<L, int, P> const& Extent, vec<4, uint8, Q>* Dst, float Width, float Alpha, unsigned int Threads);
+
+	/// @}
+}//namespace glm
+
+#include "mipmap.inl"
+
+#endif//GLM_LANG & GLM_LANG_CXX11
@@ -0,0 +1,558 @@
+/// @ref gtx_mipmap
+
+#include "../detail/_parallel.hpp"
+#include <cmath>
+#include <vector>
+
+namespace glm{
+namespace detail
+{
+	// Below this number of destination texels per thread, threads cost more than they save
+	GLM_FUNC_QUALIFIER unsigned int mipmap_threads(std::size_t Texels, unsigned int Threads)
+	{
+		return parallel_threads(Texels, 65536, Threads);
+	}
+
+	GLM_FUNC_QUALIFIER float downsample_average(float Sum, int Count)
+	{
+		return Sum / static_cast<float>(Count);
+	}
+
+	GLM_FUNC_QUALIFIER uint8 downsample_average(int Sum, int Count)
+	{
+		return static_cast<uint8>((Sum + Count / 2) / Count);
+	}
+
+	// Source texels of the destination texel Texel along a dimension of Extent texels and their weights.
+	// The last texel of an odd dimension is folded into the last destination texel with the weights 1, 2 and 1.
+	// The sums of the weights are powers of two: 1 along a dimension of one texel, 4 for a folded texel, 2 otherwise.
+	struct downsample_taps
+	{
+		int Index[3];
+		int Weight[3];
+		int Count;
+		int Total;
+
+		downsample_taps(int Texel, int Extent)
+		{
+			Index[0] = Texel * 2;
+			Index[1] = Texel * 2 + 1;
+			Index[2] = Texel * 2 + 2;
+			Weight[0] = 1;
+			Weight[1] = 1;
+			Weight[2] = 1;
+
+			if(Extent == 1)
+				Count = Total = 1;
+			else if((Extent & 1) && Texel == Extent / 2 - 1)
+			{
+				Weight[1] = 2;
+				Count = 3;
+				Total = 4;
+			}
+			else
+				Count = Total = 2;
+		}
+	};
+
+	// Number of destination texels along a dimension of Extent texels whose source texels are two texels of weight 1
+	GLM_FUNC_QUALIFIER int downsample_pairs(int Extent)
+	{
+		return Extent & 1 ? Extent / 2 - 1 : Extent / 2;
+	}
+
+	// Averages the weighted RowCount source rows of SrcWidth RGBA texels into the texels [Begin, End) of the destination row.
+	// RowTotal is the sum of the Weights of the rows. Specialized for float and uint8 with SIMD instruction sets.
+	template<typename T, bool UseSimd>
+	struct compute_downsample_row
+	{
+		GLM_FUNC_QUALIFIER static void call(T const* const* Rows, int const* Weights, int RowCount, int RowTotal, int SrcWidth, T* Dst, int Begin, int End)
+		{
+			typedef decltype(T() + T()) sum_type;
+
+			for(int x = Begin; x < End; ++x)
+			{
+				downsample_taps const Taps(x, SrcWidth);
+				for(int c = 0; c < 4; ++c)
+				{
+					sum_type Sum(0);
+					for(int r = 0; r < RowCount; ++r)
+					{
+						sum_type Row(0);
+						for(int t = 0; t < Taps.Count; ++t)
+							Row += Rows[r][Taps.Index[t] * 4 + c] * static_cast<sum_type>(Taps.Weight[t]);
+						Sum += Row * static_cast<sum_type>(Weights[r]);
+					}
+					Dst[x * 4 + c] = downsample_average(Sum, RowTotal * Taps.Total);
+				}
+			}
+		}
+	};
+
+	// Linear values of the 256 sRGB values and the linear values halfway between consecutive sRGB values
+	struct srgb_table
+	{
+		float Linear[256];
+		float Midpoints[255];
+
+		srgb_table()
+		{
+			for(int i = 0; i < 256; ++i)
+				Linear[i] = convertSRGBToLinear(vec<3, float, defaultp>(static_cast<float>(i) / 255.0f)).x;
+			for(int i = 0; i < 255; ++i)
+				Midpoints[i] = convertSRGBToLinear(vec<3, float, defaultp>((static_cast<float>(i) + 0.5f) / 255.0f)).x;
+		}
+
+		// Nearest sRGB value of a linear value
+		uint8 encode(float Value) const
+		{
+			return static_cast<uint8>(std::upper_bound(Midpoints, Midpoints + 255, Value) - Midpoints);
+		}
+	};
+
+	GLM_FUNC_QUALIFIER srgb_table const& srgb_lookup()
+	{
+		static srgb_table const Table;
+		return Table;
+	}
+
+	GLM_FUNC_QUALIFIER void downsample_srgb_row(uint8 const* const* Rows, int const* Weights, int RowCount, int RowTotal, int SrcWidth, uint8* Dst, int DstWidth)
+	{
+		srgb_table const& Table = srgb_lookup();
+
+		for(int x = 0; x < DstWidth; ++x)
+		{
+			downsample_taps const Taps(x, SrcWidth);
+			for(int c = 0; c < 3; ++c)
+			{
+				float Sum(0);
+				for(int r = 0; r < RowCount; ++r)
+				{
+					float Row(0);
+					for(int t = 0; t < Taps.Count; ++t)
+						Row += Table.Linear[Rows[r][Taps.Index[t] * 4 + c]] * static_cast<float>(Taps.Weight[t]);
+					Sum += Row * static_cast<float>(Weights[r]);
+				}
+				Dst[x * 4 + c] = Table.encode(Sum / static_cast<float>(RowTotal * Taps.Total));
+			}
+
+			int Alpha = 0;
+			for(int r = 0; r < RowCount; ++r)
+			{
+				int Row = 0;
+				for(int t = 0; t < Taps.Count; ++t)
+					Row += Rows[r][Taps.Index[t] * 4 + 3] * Taps.Weight[t];
+				Alpha += Row * Weights[r];
+			}
+			Dst[x * 4 + 3] = downsample_average(Alpha, RowTotal * Taps.Total);
+		}
+	}
+
+	template<typename T, bool SRGB>
+	struct downsample_kernel
+	{
+		GLM_FUNC_QUALIFIER static void call(T const* const* Rows, int const* Weights, int RowCount, int RowTotal, int SrcWidth, T* Dst, int DstWidth)
+		{
+			compute_downsample_row<T, GLM_CONFIG_SIMD == GLM_ENABLE>::call(Rows, Weights, RowCount, RowTotal, SrcWidth, Dst, 0, DstWidth);
+		}
+	};
+
+	template<>
+	struct downsample_kernel<uint8, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint8 const* const* Rows, int const* Weights, int RowCount, int RowTotal, int SrcWidth, uint8* Dst, int DstWidth)
+		{
+			downsample_srgb_row(Rows, Weights, RowCount, RowTotal, SrcWidth, Dst, DstWidth);
+		}
+	};
+
+	// Computes the rows [Begin, End) of the destination, the rows of all the slices are numbered consecutively
+	template<typename T, bool SRGB>
+	struct downsample_rows
+	{
+		T const* Src;
+		T* Dst;
+		int Width, Height, Depth;
+		int DstWidth, DstHeight;
+
+		void operator()(std::size_t Begin, std::size_t End, unsigned int) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				downsample_taps const TapsY(static_cast<int>(i % static_cast<std::size_t>(DstHeight)), Height);
+				downsample_taps const TapsZ(static_cast<int>(i / static_cast<std::size_t>(DstHeight)), Depth);
+
+				T const* Rows[9];
+				int Weights[9];
+				int RowCount = 0;
+				for(int k = 0; k < TapsZ.Count; ++k)
+				for(int j = 0; j < TapsY.Count; ++j)
+				{
+					Rows[RowCount] = row(TapsZ.Index[k], TapsY.Index[j]);
+					Weights[RowCount] = TapsZ.Weight[k] * TapsY.Weight[j];
+					++RowCount;
+				}
+
+				downsample_kernel<T, SRGB>::call(Rows, Weights, RowCount, TapsY.Total * TapsZ.Total, Width, Dst + i * static_cast<std::size_t>(DstWidth) * 4, DstWidth);
+			}
+		}
+
+		T const* row(int z, int y) const
+		{
+			return Src + (static_cast<std::size_t>(z) * static_cast<std::size_t>(Height) + static_cast<std::size_t>(y)) * static_cast<std::size_t>(Width) * 4;
+		}
+	};
+
+	template<typename T, bool SRGB, length_t L, qualifier P>
+	GLM_FUNC_QUALIFIER void downsample_image(T const* Src, vec<L, int, P> const& Extent, T* Dst, unsigned int Threads)
+	{
+		static_assert(L == 2 || L == 3, "'downsample' only accept 2D and 3D images");
+
+		vec<L, int, P> const DstExtent = mipExtent(Extent, 1);
+
+		downsample_rows<T, SRGB> Rows;
+		Rows.Src = Src;
+		Rows.Dst = Dst;
+		Rows.Width = Extent.x;
+		Rows.Height = Extent.y;
+		Rows.Depth = L > 2 ? Extent[L - 1] : 1;
+		Rows.DstWidth = DstExtent.x;
+		Rows.DstHeight = DstExtent.y;
+
+		std::size_t const Count = static_cast<std::size_t>(Rows.DstHeight) * static_cast<std::size_t>(L > 2 ? DstExtent[L - 1] : 1);
+		parallel_for(Count, mipmap_threads(Count * static_cast<std::size_t>(Rows.DstWidth), Threads), Rows);
+	}
+	// Modified Bessel function of the first kind of order 0, from its power series
+	GLM_FUNC_QUALIFIER double kaiser_bessel_i0(double x)
+	{
+		double Sum = 1.0;
+		double Term = 1.0;
+		for(int k = 1; Term > Sum * 1e-12; ++k)
+		{
+			double const Half = x / (2.0 * static_cast<double>(k));
+			Term *= Half * Half;
+			Sum += Term;
+		}
+		return Sum;
+	}
+
+	// Sinc windowed by a Kaiser window of Width texels on each side, x in destination texels
+	GLM_FUNC_QUALIFIER double kaiser_filter(double x, double Width, double Alpha)
+	{
+		if(std::abs(x) >= Width)
+			return 0.0;
+
+		double const t = x / Width;
+		double const Window = kaiser_bessel_i0(Alpha * std::sqrt(1.0 - t * t)) / kaiser_bessel_i0(Alpha);
+		double const Pi = 3.14159265358979323846;
+		double const Sinc = x == 0.0 ? 1.0 : std::sin(Pi * x) / (Pi * x);
+		return Sinc * Window;
+	}
+
+	// Source texels and normalized weights of the destination texels along a dimension of Extent texels.
+	// The taps of the destination texel i are [Offset[i], Offset[i + 1]), the source is clamped to its edges.
+	struct kaiser_taps
+	{
+		std::vector<std::size_t> Offset;
+		std::vector<int> Index;
+		std::vector<float> Weight;
+
+		kaiser_taps(int Extent, int DstExtent, float Width, float Alpha)
+		{
+			double const Scale = static_cast<double>(Extent) / static_cast<double>(DstExtent);
+			double const Radius = static_cast<double>(Width) * Scale;
+
+			Offset.push_back(0);
+			for(int i = 0; i < DstExtent; ++i)
+			{
+				double const Center = (static_cast<double>(i) + 0.5) * Scale - 0.5;
+				int const First = static_cast<int>(std::ceil(Center - Radius));
+				int const Last = static_cast<int>(std::floor(Center + Radius));
+
+				std::size_t const Begin = Weight.size();
+				double Total = 0.0;
+				for(int j = First; j <= Last; ++j)
+				{
+					double const Value = kaiser_filter((static_cast<double>(j) - Center) / Scale, static_cast<double>(Width), static_cast<double>(Alpha));
+					if(Value == 0.0)
+						continue;
+					Index.push_back(j < 0 ? 0 : j < Extent ? j : Extent - 1);
+					Weight.push_back(static_cast<float>(Value));
+					Total += Value;
+				}
+				for(std::size_t t = Begin; t < Weight.size(); ++t)
+					Weight[t] = static_cast<float>(static_cast<double>(Weight[t]) / Total);
+				Offset.push_back(Weight.size());
+			}
+		}
+	};
+
+	// Conversions of the RGBA texels to and from the linear float values the Kaiser filter is computed on
+	template<typename T, bool SRGB>
+	struct kaiser_texel
+	{
+		GLM_FUNC_QUALIFIER static void load(float const* Src, float* Dst)
+		{
+			for(int c = 0; c < 4; ++c)
+				Dst[c] = Src[c];
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float const* Src, float* Dst)
+		{
+			for(int c = 0; c < 4; ++c)
+				Dst[c] = Src[c];
+		}
+	};
+
+	// The negative lobes of the filter overshoot, the values are clamped to the range of uint8
+	template<>
+	struct kaiser_texel<uint8, false>
+	{
+		GLM_FUNC_QUALIFIER static void load(uint8 const* Src, float* Dst)
+		{
+			for(int c = 0; c < 4; ++c)
+				Dst[c] = static_cast<float>(Src[c]);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float const* Src, uint8* Dst)
+		{
+			for(int c = 0; c < 4; ++c)
+				Dst[c] = static_cast<uint8>(std::min(std::max(Src[c] + 0.5f, 0.0f), 255.0f));
+		}
+	};
+
+	template<>
+	struct kaiser_texel<uint8, true>
+	{
+		GLM_FUNC_QUALIFIER static void load(uint8 const* Src, float* Dst)
+		{
+			srgb_table const& Table = srgb_lookup();
+			for(int c = 0; c < 3; ++c)
+				Dst[c] = Table.Linear[Src[c]];
+			Dst[3] = static_cast<float>(Src[3]);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float const* Src, uint8* Dst)
+		{
+			srgb_table const& Table = srgb_lookup();
+			for(int c = 0; c < 3; ++c)
+				Dst[c] = Table.encode(Src[c]);
+			Dst[3] = static_cast<uint8>(std::min(std::max(Src[3] + 0.5f, 0.0f), 255.0f));
+		}
+	};
+
+	// Filters the rows [Begin, End) of Width source texels into rows of DstWidth linear texels
+	template<typename T, bool SRGB>
+	struct kaiser_rows
+	{
+		T const* Src;
+		float* Dst;
+		int Width, DstWidth;
+		kaiser_taps const* Taps;
+
+		void operator()(std::size_t Begin, std::size_t End, unsigned int) const
+		{
+			std::vector<float> Row(static_cast<std::size_t>(Width) * 4);
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				T const* SrcRow = Src + i * static_cast<std::size_t>(Width) * 4;
+				for(std::size_t x = 0; x < static_cast<std::size_t>(Width); ++x)
+					kaiser_texel<T, SRGB>::load(SrcRow + x * 4, &Row[x * 4]);
+
+				float* DstRow = Dst + i * static_cast<std::size_t>(DstWidth) * 4;
+				for(std::size_t x = 0; x < static_cast<std::size_t>(DstWidth); ++x)
+				{
+					float Sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+					for(std::size_t t = Taps->Offset[x]; t < Taps->Offset[x + 1]; ++t)
+					for(int c = 0; c < 4; ++c)
+						Sum[c] += Row[static_cast<std::size_t>(Taps->Index[t]) * 4 + c] * Taps->Weight[t];
+					for(int c = 0; c < 4; ++c)
+						DstRow[x * 4 + c] = Sum[c];
+				}
+			}
+		}
+	};
+
+	// Filters the planes of Size floats of Src, Extent planes per slice, into DstExtent planes per slice.
+	// Computes the planes [Begin, End) of the destination, the planes of all the slices are numbered consecutively.
+	// The planes are stored into Dst when it isn't null, into Out otherwise.
+	template<typename T, bool SRGB>
+	struct kaiser_planes
+	{
+		float const* Src;
+		float* Out;
+		T* Dst;
+		std::size_t Size;
+		int Extent, DstExtent;
+		kaiser_taps const* Taps;
+
+		void operator()(std::size_t Begin, std::size_t End, unsigned int) const
+		{
+			std::vector<float> Plane(Size);
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				std::size_t const Slice = i / static_cast<std::size_t>(DstExtent);
+				std::size_t const Texel = i % static_cast<std::size_t>(DstExtent);
+
+				std::fill(Plane.begin(), Plane.end(), 0.0f);
+				for(std::size_t t = Taps->Offset[Texel]; t < Taps->Offset[Texel + 1]; ++t)
+				{
+					float const* SrcPlane = Src + (Slice * static_cast<std::size_t>(Extent) + static_cast<std::size_t>(Taps->Index[t])) * Size;
+					for(std::size_t j = 0; j < Size; ++j)
+						Plane[j] += SrcPlane[j] * Taps->Weight[t];
+				}
+
+				if(Dst)
+				{
+					for(std::size_t j = 0; j < Size; j += 4)
+						kaiser_texel<T, SRGB>::store(&Plane[j], Dst + i * Size + j);
+				}
+				else
+					std::copy(Plane.begin(), Plane.end(), Out + i * Size);
+			}
+		}
+	};
+
+	template<typename T, bool SRGB, length_t L, qualifier P>
+	GLM_FUNC_QUALIFIER void downsample_kaiser_image(T const* Src, vec<L, int, P> const& Extent, T* Dst, float Width, float Alpha, unsigned int Threads)
+	{
+		static_assert(L == 2 || L == 3, "'downsampleKaiser' only accept 2D and 3D images");
+		assert(Width >= 1.0f && Alpha >= 0.0f);
+
+		vec<L, int, P> const DstExtent = mipExtent(Extent, 1);
+		std::size_t const Depth = static_cast<std::size_t>(L > 2 ? Extent[L - 1] : 1);
+		std::size_t const DstWidth = static_cast<std::size_t>(DstExtent.x);
+		std::size_t const DstHeight = static_cast<std::size_t>(DstExtent.y);
+
+		// Rows, then columns, then slices
+		kaiser_taps const TapsX(Extent.x, DstExtent.x, Width, Alpha);
+		std::vector<float> Rows(DstWidth * static_cast<std::size_t>(Extent.y) * Depth * 4);
+		kaiser_rows<T, SRGB> RowPass;
+		RowPass.Src = Src;
+		RowPass.Dst = &Rows[0];
+		RowPass.Width = Extent.x;
+		RowPass.DstWidth = DstExtent.x;
+		RowPass.Taps = &TapsX;
+		std::size_t const RowCount = static_cast<std::size_t>(Extent.y) * Depth;
+		parallel_for(RowCount, mipmap_threads(RowCount * DstWidth, Threads), RowPass);
+
+		kaiser_taps const TapsY(Extent.y, DstExtent.y, Width, Alpha);
+		std::vector<float> Columns(L > 2 ? DstWidth * DstHeight * Depth * 4 : 0);
+		kaiser_planes<T, SRGB> ColumnPass;
+		ColumnPass.Src = &Rows[0];
+		ColumnPass.Out = L > 2 ? &Columns[0] : nullptr;
+		ColumnPass.Dst = L > 2 ? nullptr : Dst;
+		ColumnPass.Size = DstWidth * 4;
+		ColumnPass.Extent = Extent.y;
+		ColumnPass.DstExtent = DstExtent.y;
+		ColumnPass.Taps = &TapsY;
+		std::size_t const ColumnCount = DstHeight * Depth;
+		parallel_for(ColumnCount, mipmap_threads(ColumnCount * DstWidth, Threads), ColumnPass);
+
+		if(L > 2)
+		{
+			kaiser_taps const TapsZ(Extent[L - 1], DstExtent[L - 1], Width, Alpha);
+			kaiser_planes<T, SRGB> SlicePass;
+			SlicePass.Src = &Columns[0];
+			SlicePass.Out = nullptr;
+			SlicePass.Dst = Dst;
+			SlicePass.Size = DstWidth * DstHeight * 4;
+			SlicePass.Extent = Extent[L - 1];
+			SlicePass.DstExtent = DstExtent[L - 1];
+			SlicePass.Taps = &TapsZ;
+			std::size_t const SliceCount = static_cast<std::size_t>(DstExtent[L - 1]);
+			parallel_for(SliceCount, mipmap_threads(SliceCount * DstWidth * DstHeight, Threads), SlicePass);
+		}
+	}
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> mipExtent(vec<L, T, Q> const& Extent, T Level)
+	{
+		static_assert(std::numeric_limits<T>::is_integer, "'mipExtent' only accept integer inputs");
+
+		return max(Extent >> Level, static_cast<T>(1));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t mipSize(vec<L, T, Q> const& Extent, vec<L, T, Q> const& BlockExtent, std::size_t BlockSize)
+	{
+		std::size_t Size = BlockSize;
+		for(length_t i = 0; i < L; ++i)
+			Size *= static_cast<std::size_t>((Extent[i] + BlockExtent[i] - 1) / BlockExtent[i]);
+		return Size;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t mipOffset(vec<L, T, Q> const& Extent, T Level, vec<L, T, Q> const& BlockExtent, std::size_t BlockSize)
+	{
+		std::size_t Offset = 0;
+		for(T i = 0; i < Level; ++i)
+			Offset += mipSize(mipExtent(Extent, i), BlockExtent, BlockSize);
+		return Offset;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t mipChainSize(vec<L, T, Q> const& Extent, vec<L, T, Q> const& BlockExtent, std::size_t BlockSize)
+	{
+		return mipChain(Extent, BlockExtent, BlockSize, static_cast<vec<L, T, Q>*>(nullptr), static_cast<std::size_t*>(nullptr));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t mipChain(vec<L, T, Q> const& Extent, vec<L, T, Q> const& BlockExtent, std::size_t BlockSize,
+		vec<L, T, Q>* Extents, std::size_t* Offsets)
+	{
+		T const Levels = levels(Extent);
+
+		std::size_t Offset = 0;
+		for(T i = 0; i < Levels; ++i)
+		{
+			vec<L, T, Q> const Level = mipExtent(Extent, i);
+			if(Extents)
+				Extents[i] = Level;
+			if(Offsets)
+				Offsets[i] = Offset;
+			Offset += mipSize(Level, BlockExtent, BlockSize);
+		}
+		return Offset;
+	}
+
+	template<length_t L, qualifier P, qualifier Q>
+	GLM_FUNC_QUALIFIER void downsample(vec<4, float, Q> const* Src, vec<L, int, P> const& Extent, vec<4, float, Q>* Dst, unsigned int Threads)
+	{
+		detail::downsample_image<float, false>(reinterpret_cast<float const*>(Src), Extent, reinterpret_cast<float*>(Dst), Threads);
+	}
+
+	template<length_t L, qualifier P, qualifier Q>
+	GLM_FUNC_QUALIFIER void downsample(vec<4, uint8, Q> const* Src, vec<L, int, P> const& Extent, vec<4, uint8, Q>* Dst, unsigned int Threads)
+	{
+		detail::downsample_image<uint8, false>(reinterpret_cast<uint8 const*>(Src), Extent, reinterpret_cast<uint8*>(Dst), Threads);
+	}
+
+	template<length_t L, qualifier P, qualifier Q>
+	GLM_FUNC_QUALIFIER void downsampleSRGB(vec<4, uint8, Q> const* Src, vec<L, int, P> const& Extent, vec<4, uint8, Q>* Dst, unsigned int Threads)
+	{
+		detail::downsample_image<uint8, true>(reinterpret_cast<uint8 const*>(Src), Extent, reinterpret_cast<uint8*>(Dst), Threads);
+	}
+	template<length_t L, qualifier P, qualifier Q>
+	GLM_FUNC_QUALIFIER void downsampleKaiser(vec<4, float, Q> const* Src, vec<L, int, P> const& Extent, vec<4, float, Q>* Dst, float Width, float Alpha, unsigned int Threads)
+	{
+		detail::downsample_kaiser_image<float, false>(reinterpret_cast<float const*>(Src), Extent, reinterpret_cast<float*>(Dst), Width, Alpha, Threads);
+	}
+
+	template<length_t L, qualifier P, qualifier Q>
+	GLM_FUNC_QUALIFIER void downsampleKaiser(vec<4, uint8, Q> const* Src, vec<L, int, P> const& Extent, vec<4, uint8, Q>* Dst, float Width, float Alpha, unsigned int Threads)
+	{
+		detail::downsample_kaiser_image<uint8, false>(reinterpret_cast<uint8 const*>(Src), Extent, reinterpret_cast<uint8*>(Dst), Width, Alpha, Threads);
+	}
+
+	template<length_t L, qualifier P, qualifier Q>
+	GLM_FUNC_QUALIFIER void downsampleKaiserSRGB(vec<4, uint8, Q> const* Src, vec<L, int, P> const& Extent, vec<4, uint8, Q>* Dst, float Width, float Alpha, unsigned int Threads)
+	{
+		detail::downsample_kaiser_image<uint8, true>(reinterpret_cast<uint8 const*>(Src), Extent, reinterpret_cast<uint8*>(Dst), Width, Alpha, Threads);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "mipmap_simd.inl"
+#endif
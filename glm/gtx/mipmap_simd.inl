@@ -0,0 +1,112 @@
+/// @ref gtx_mipmap
+
+#if GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_NEON_BIT)
+
+namespace glm{
+namespace detail
+{
+	// The texels of two source texels are averaged with vectors, the folded last texel of an odd row by the generic loop
+	template<>
+	struct compute_downsample_row<float, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const* const* Rows, int const* Weights, int RowCount, int RowTotal, int SrcWidth, float* Dst, int Begin, int End)
+		{
+			int const Pairs = std::min(End, downsample_pairs(SrcWidth));
+			float const Scale = 1.0f / static_cast<float>(RowTotal * 2);
+			int x = Begin;
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				// Two destination texels: the sums of the texels 0 and 2 and of the texels 1 and 3 of the rows
+				for(; x + 2 <= Pairs; x += 2)
+				{
+					glm_f32vec8 a = _mm256_setzero_ps();
+					glm_f32vec8 b = _mm256_setzero_ps();
+					for(int r = 0; r < RowCount; ++r)
+					{
+						glm_f32vec8 const w0 = _mm256_set1_ps(static_cast<float>(Weights[r]));
+						a = _mm256_add_ps(a, _mm256_mul_ps(_mm256_loadu_ps(Rows[r] + x * 8), w0));
+						b = _mm256_add_ps(b, _mm256_mul_ps(_mm256_loadu_ps(Rows[r] + x * 8 + 8), w0));
+					}
+					glm_f32vec8 const sum0 = _mm256_add_ps(_mm256_permute2f128_ps(a, b, 0x20), _mm256_permute2f128_ps(a, b, 0x31));
+					_mm256_storeu_ps(Dst + x * 4, _mm256_mul_ps(sum0, _mm256_set1_ps(Scale)));
+				}
+#			endif
+
+			for(; x < Pairs; ++x)
+			{
+#				if GLM_ARCH & GLM_ARCH_SSE2_BIT
+					glm_f32vec4 sum0 = _mm_setzero_ps();
+					for(int r = 0; r < RowCount; ++r)
+					{
+						glm_f32vec4 const row0 = _mm_add_ps(_mm_loadu_ps(Rows[r] + x * 8), _mm_loadu_ps(Rows[r] + x * 8 + 4));
+						sum0 = _mm_add_ps(sum0, _mm_mul_ps(row0, _mm_set1_ps(static_cast<float>(Weights[r]))));
+					}
+					_mm_storeu_ps(Dst + x * 4, _mm_mul_ps(sum0, _mm_set1_ps(Scale)));
+#				else
+					float32x4_t sum0 = vdupq_n_f32(0.0f);
+					for(int r = 0; r < RowCount; ++r)
+						sum0 = vmlaq_n_f32(sum0, vaddq_f32(vld1q_f32(Rows[r] + x * 8), vld1q_f32(Rows[r] + x * 8 + 4)), static_cast<float>(Weights[r]));
+					vst1q_f32(Dst + x * 4, vmulq_n_f32(sum0, Scale));
+#				endif
+			}
+
+			compute_downsample_row<float, false>::call(Rows, Weights, RowCount, RowTotal, SrcWidth, Dst, x, End);
+		}
+	};
+
+	// Two destination texels from four source texels of each row, weighted and summed with 16 bits components then rounded:
+	// (sum + RowTotal) >> log2(RowTotal * 2), RowTotal is a power of two
+	template<>
+	struct compute_downsample_row<uint8, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint8 const* const* Rows, int const* Weights, int RowCount, int RowTotal, int SrcWidth, uint8* Dst, int Begin, int End)
+		{
+			int const Pairs = std::min(End, downsample_pairs(SrcWidth));
+			int Shift = 1;
+			for(int Total = RowTotal; Total > 1; Total >>= 1)
+				++Shift;
+			int x = Begin;
+
+			for(; x + 2 <= Pairs; x += 2)
+			{
+#				if GLM_ARCH & GLM_ARCH_SSE2_BIT
+					glm_i32vec4 const zero = _mm_setzero_si128();
+					glm_i32vec4 lo0 = zero;
+					glm_i32vec4 hi0 = zero;
+					for(int r = 0; r < RowCount; ++r)
+					{
+						glm_i32vec4 const row0 = _mm_loadu_si128(reinterpret_cast<glm_i32vec4 const*>(Rows[r] + x * 8));
+						glm_i32vec4 const w0 = _mm_set1_epi16(static_cast<short>(Weights[r]));
+						lo0 = _mm_add_epi16(lo0, _mm_mullo_epi16(_mm_unpacklo_epi8(row0, zero), w0));
+						hi0 = _mm_add_epi16(hi0, _mm_mullo_epi16(_mm_unpackhi_epi8(row0, zero), w0));
+					}
+					glm_i32vec4 const lo1 = _mm_add_epi16(lo0, _mm_srli_si128(lo0, 8));
+					glm_i32vec4 const hi1 = _mm_add_epi16(hi0, _mm_srli_si128(hi0, 8));
+					glm_i32vec4 const sum0 = _mm_unpacklo_epi64(lo1, hi1);
+					glm_i32vec4 const avg0 = _mm_srl_epi16(_mm_add_epi16(sum0, _mm_set1_epi16(static_cast<short>(RowTotal))), _mm_cvtsi32_si128(Shift));
+					_mm_storel_epi64(reinterpret_cast<glm_i32vec4*>(Dst + x * 4), _mm_packus_epi16(avg0, avg0));
+#				else
+					uint16x8_t lo0 = vdupq_n_u16(0);
+					uint16x8_t hi0 = vdupq_n_u16(0);
+					for(int r = 0; r < RowCount; ++r)
+					{
+						uint8x16_t const row0 = vld1q_u8(Rows[r] + x * 8);
+						uint8x8_t const w0 = vdup_n_u8(static_cast<uint8_t>(Weights[r]));
+						lo0 = vmlal_u8(lo0, vget_low_u8(row0), w0);
+						hi0 = vmlal_u8(hi0, vget_high_u8(row0), w0);
+					}
+					uint16x4_t const lo1 = vadd_u16(vget_low_u16(lo0), vget_high_u16(lo0));
+					uint16x4_t const hi1 = vadd_u16(vget_low_u16(hi0), vget_high_u16(hi0));
+					uint16x8_t const sum0 = vaddq_u16(vcombine_u16(lo1, hi1), vdupq_n_u16(static_cast<uint16_t>(RowTotal)));
+					uint16x8_t const avg0 = vshlq_u16(sum0, vdupq_n_s16(static_cast<int16_t>(-Shift)));
+					vst1_u8(Dst + x * 4, vmovn_u16(avg0));
+#				endif
+			}
+
+			compute_downsample_row<uint8, false>::call(Rows, Weights, RowCount, RowTotal, SrcWidth, Dst, x, End);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_NEON_BIT)
@@ -91,6 +91,34 @@ namespace glm {
 		mat<D, D, T, Q>& outEigenvectors
 	);
 
+	/// Specialized eigensolver for symmetric, real-valued 3x3 matrices using cyclic Jacobi rotations.
+	/// Sweeps until the off-diagonal elements are negligible, at most 16 sweeps; usually 4 to 6 are needed.
+	/// Faster and more accurate than the generic `findEigenvaluesSymReal` for 3x3 matrices.
+	/// The eigenvectors are orthonormal column vectors, in the same order as `outEigenvalues`, unsorted.
+	///
+	/// @param[in] covarMat A symmetric, real-valued matrix, e.g. computed from computeCovarianceMatrix
+	/// @param[out] outEigenvalues Vector to receive the eigenvalues
+	/// @param[out] outEigenvectors Matrix to receive the eigenvectors corresponding to the eigenvalues, as column vectors
+	/// @return The number of eigenvalues found, always 3.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL unsigned int findEigenvaluesSymRealJacobi
+	(
+		mat<3, 3, T, Q> const& covarMat,
+		vec<3, T, Q>& outEigenvalues,
+		mat<3, 3, T, Q>& outEigenvectors
+	);
+
+	/// Specialized eigensolver for symmetric, real-valued 3x3 matrices running exactly `sweeps` Jacobi sweeps, for a predictable cost.
+	/// @see findEigenvaluesSymRealJacobi
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL unsigned int findEigenvaluesSymRealJacobi
+	(
+		mat<3, 3, T, Q> const& covarMat,
+		vec<3, T, Q>& outEigenvalues,
+		mat<3, 3, T, Q>& outEigenvectors,
+		length_t sweeps
+	);
+
 	/// Sorts a group of Eigenvalues&Eigenvectors, for largest Eigenvalue to smallest Eigenvalue.
 	/// The data in `outEigenvalues` and `outEigenvectors` are assumed to be matching order, i.e. `outEigenvector[i]` is the Eigenvector of the Eigenvalue `outEigenvalue[i]`.
 	template<typename T, qualifier Q>
@@ -106,6 +134,33 @@ namespace glm {
 	template<typename T, qualifier Q>
 	GLM_FUNC_DISCARD_DECL void sortEigenvalues(vec<4, T, Q>& eigenvalues, mat<4, 4, T, Q>& eigenvectors);
 
+	/// One-pass, numerically stable (Welford) accumulator of the mean and covariance of a stream of absolute coordinates.
+	/// Partial accumulators, e.g. computed by worker threads, can be combined with `merge`.
+	template<length_t D, typename T, qualifier Q = defaultp>
+	struct covariance_accumulator
+	{
+		/// Number of accumulated points
+		size_t count;
+		/// Running mean, the center of gravity of the accumulated points
+		vec<D, T, Q> mean;
+		/// Running sum of the outer products of the deviations from the mean
+		mat<D, D, T, Q> comoment;
+
+		GLM_CTOR_DECL covariance_accumulator();
+
+		/// Accumulates a single point
+		GLM_FUNC_DISCARD_DECL void add(vec<D, T, Q> const& v);
+
+		/// Accumulates `n` points
+		GLM_FUNC_DISCARD_DECL void add(vec<D, T, Q> const* v, size_t n);
+
+		/// Combines the points accumulated by `other` into this accumulator
+		GLM_FUNC_DISCARD_DECL void merge(covariance_accumulator const& other);
+
+		/// Returns the covariance matrix of the accumulated points, normalized like `computeCovarianceMatrix`
+		GLM_FUNC_DECL mat<D, D, T, Q> covariance() const;
+	};
+
 	/// @}
 }//namespace glm
 
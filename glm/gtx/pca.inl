@@ -277,6 +277,81 @@ namespace glm {
 		return D;
 	}
 
+	namespace _internal_
+	{
+
+		// Cyclic Jacobi eigenvalue algorithm for symmetric 3x3 matrices. The eigenvector columns are rotated
+		// as whole vectors, which maps to SIMD operations with aligned qualifiers.
+		template<typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER static void jacobiRotate(T a[3][3], mat<3, 3, T, Q>& v, length_t p, length_t q, length_t r)
+		{
+			T const apq = a[p][q];
+			if(glm::abs(apq) <= std::numeric_limits<T>::min())
+				return;
+
+			T const theta = (a[q][q] - a[p][p]) / (static_cast<T>(2) * apq);
+			T const t = transferSign(static_cast<T>(1), theta) / (glm::abs(theta) + glm::sqrt(theta * theta + static_cast<T>(1)));
+			T const c = static_cast<T>(1) / glm::sqrt(t * t + static_cast<T>(1));
+			T const s = t * c;
+
+			a[p][p] -= t * apq;
+			a[q][q] += t * apq;
+			a[p][q] = a[q][p] = static_cast<T>(0);
+
+			T const arp = a[r][p];
+			T const arq = a[r][q];
+			a[r][p] = a[p][r] = c * arp - s * arq;
+			a[r][q] = a[q][r] = s * arp + c * arq;
+
+			vec<3, T, Q> const vp = v[p];
+			vec<3, T, Q> const vq = v[q];
+			v[p] = vp * c - vq * s;
+			v[q] = vp * s + vq * c;
+		}
+
+		template<typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER static unsigned int findEigenvaluesSymRealJacobi(mat<3, 3, T, Q> const& covarMat, vec<3, T, Q>& outEigenvalues, mat<3, 3, T, Q>& outEigenvectors, length_t sweeps, bool converge)
+		{
+			T a[3][3];
+			for(length_t c = 0; c < 3; ++c)
+				for(length_t r = 0; r < 3; ++r)
+					a[c][r] = covarMat[c][r];
+
+			mat<3, 3, T, Q> v(static_cast<T>(1));
+			for(length_t i = 0; i < sweeps; ++i)
+			{
+				if(converge)
+				{
+					T const off = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+					T const diag = a[0][0] * a[0][0] + a[1][1] * a[1][1] + a[2][2] * a[2][2];
+					if(off <= std::numeric_limits<T>::epsilon() * std::numeric_limits<T>::epsilon() * diag)
+						break;
+				}
+
+				jacobiRotate(a, v, 0, 1, 2);
+				jacobiRotate(a, v, 0, 2, 1);
+				jacobiRotate(a, v, 1, 2, 0);
+			}
+
+			outEigenvalues = vec<3, T, Q>(a[0][0], a[1][1], a[2][2]);
+			outEigenvectors = v;
+			return 3;
+		}
+
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER unsigned int findEigenvaluesSymRealJacobi(mat<3, 3, T, Q> const& covarMat, vec<3, T, Q>& outEigenvalues, mat<3, 3, T, Q>& outEigenvectors)
+	{
+		return _internal_::findEigenvaluesSymRealJacobi(covarMat, outEigenvalues, outEigenvectors, 16, true);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER unsigned int findEigenvaluesSymRealJacobi(mat<3, 3, T, Q> const& covarMat, vec<3, T, Q>& outEigenvalues, mat<3, 3, T, Q>& outEigenvectors, length_t sweeps)
+	{
+		return _internal_::findEigenvaluesSymRealJacobi(covarMat, outEigenvalues, outEigenvectors, sweeps, false);
+	}
+
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER void sortEigenvalues(vec<2, T, Q>& eigenvalues, mat<2, 2, T, Q>& eigenvectors)
 	{
@@ -337,4 +412,55 @@ namespace glm {
 		}
 	}
 
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR covariance_accumulator<D, T, Q>::covariance_accumulator()
+		: count(0)
+		, mean(static_cast<T>(0))
+		, comoment(static_cast<T>(0))
+	{}
+
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void covariance_accumulator<D, T, Q>::add(vec<D, T, Q> const& v)
+	{
+		++count;
+		vec<D, T, Q> const delta = v - mean;
+		mean += delta / static_cast<T>(count);
+		comoment += outerProduct(delta, v - mean);
+	}
+
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void covariance_accumulator<D, T, Q>::add(vec<D, T, Q> const* v, size_t n)
+	{
+		for(size_t i = 0; i < n; ++i)
+			add(v[i]);
+	}
+
+	// Chan et al. pairwise update
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void covariance_accumulator<D, T, Q>::merge(covariance_accumulator const& other)
+	{
+		if(other.count == 0)
+			return;
+		if(count == 0)
+		{
+			*this = other;
+			return;
+		}
+
+		size_t const total = count + other.count;
+		T const weight = static_cast<T>(other.count) / static_cast<T>(total);
+		vec<D, T, Q> const delta = other.mean - mean;
+		mean += delta * weight;
+		comoment += other.comoment + outerProduct(delta, delta) * (static_cast<T>(count) * weight);
+		count = total;
+	}
+
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<D, D, T, Q> covariance_accumulator<D, T, Q>::covariance() const
+	{
+		if(count == 0)
+			return comoment;
+		return comoment / static_cast<T>(count);
+	}
+
 }//namespace glm
@@ -0,0 +1,165 @@
+/// @ref gtx_serialize
+/// @file glm/gtx/serialize.hpp
+///
+/// @see core (dependence)
+/// @see gtc_packing (dependence)
+/// @see gtc_quaternion (dependence)
+///
+/// @defgroup gtx_serialize GLM_GTX_serialize
+/// @ingroup gtx
+///
+/// Include <glm/gtx/serialize.hpp> to use the features of this extension.
+///
+/// Binary serialization of arrays of vectors, matrices and quaternions.
+/// A serialized buffer starts with a fixed 32 bytes header describing the values, followed by the tightly packed components.
+/// Values are copied in bulk when the requested endianness is the one of the host and byte swapped otherwise.
+/// Floating point components may be quantized with the functions of GLM_GTC_packing.
+/// With GLM_FORCE_CPU_DISPATCH, byte swaps use the kernel of the host tier, see GLM_EXT_cpu_dispatch.
+///
+/// Example:
+/// ```
+/// std::vector<unsigned char> Buffer(glm::serializedSize<glm::vec3>(Positions.size(), glm::serial_raw));
+/// glm::serialize(Positions.data(), Positions.size(), glm::serial_little_endian, glm::serial_raw, Buffer.data(), Buffer.size());
+///
+/// // Reading from a memory mapped file without copy when the layout matches the host
+/// std::size_t Count = 0;
+/// glm::vec3 const* Data = glm::serializedData<glm::vec3>(Mapped, MappedSize, Count);
+/// ```
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/packing.hpp"
+#include "../gtc/quaternion.hpp"
+#if GLM_CONFIG_CPU_DISPATCH == GLM_ENABLE
+#	include "../ext/cpu_dispatch.hpp"
+#endif
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_serialize is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_serialize extension included")
+#endif
+
+#include <cstddef>
+
+namespace glm
+{
+	/// @addtogroup gtx_serialize
+	/// @{
+
+	/// Byte order of serialized components
+	enum serial_endianness
+	{
+		serial_little_endian = 0,
+		serial_big_endian = 1
+	};
+
+	/// Storage of serialized floating point components
+	enum serial_encoding
+	{
+		serial_raw = 0,		///< Components stored with their type
+		serial_half = 1,	///< 16 bits floating point, see packHalf1x16
+		serial_snorm8 = 2,	///< 8 bits signed normalized, see packSnorm1x8
+		serial_unorm8 = 3,	///< 8 bits unsigned normalized, see packUnorm1x8
+		serial_snorm16 = 4,	///< 16 bits signed normalized, see packSnorm1x16
+		serial_unorm16 = 5	///< 16 bits unsigned normalized, see packUnorm1x16
+	};
+
+	/// Type of the serialized values
+	enum serial_kind
+	{
+		serial_vector = 1,
+		serial_matrix = 2,
+		serial_quaternion = 3
+	};
+
+	/// Scalar type of the serialized components, before encoding
+	enum serial_scalar
+	{
+		serial_int8 = 1,
+		serial_uint8 = 2,
+		serial_int16 = 3,
+		serial_uint16 = 4,
+		serial_int32 = 5,
+		serial_uint32 = 6,
+		serial_int64 = 7,
+		serial_uint64 = 8,
+		serial_float32 = 9,
+		serial_float64 = 10
+	};
+
+	/// Layout descriptor of a serialized buffer.
+	///
+	/// The header is stored in the first 32 bytes of the buffer in little endian whatever the endianness of the components:
+	/// Magic "GLMS" at offset 0, Version at 4, then one byte each for Endianness, Kind, Scalar, Encoding, Columns and Rows,
+	/// Count as a 64 bits integer at offset 16. The other bytes are zero.
+	/// Components follow, column after column for matrices and in x, y, z, w order for quaternions.
+	struct serial_header
+	{
+		uint32 Version;
+		serial_endianness Endianness;
+		serial_kind Kind;
+		serial_scalar Scalar;
+		serial_encoding Encoding;
+		length_t Columns;
+		length_t Rows;
+		uint64 Count;
+	};
+
+	/// Size in bytes of the header of a serialized buffer
+	enum serial_layout
+	{
+		serial_header_size = 32
+	};
+
+	/// Returns the byte order of the host.
+	GLM_FUNC_DECL serial_endianness hostEndianness();
+
+	/// Returns the number of bytes required to serialize Count values of genType with Encoding.
+	///
+	/// @tparam genType A vector, matrix or quaternion of integer or floating point scalars
+	template<typename genType>
+	GLM_FUNC_DECL std::size_t serializedSize(std::size_t Count, serial_encoding Encoding);
+
+	/// Writes a header and Count values to Buffer with the requested byte order and encoding.
+	/// Encodings other than serial_raw require float components.
+	///
+	/// @return The number of bytes written, 0 if Size is too small or the encoding isn't supported by genType
+	///
+	/// @see serializedSize
+	template<typename genType>
+	GLM_FUNC_DECL std::size_t serialize(
+		genType const* Values, std::size_t Count, serial_endianness Endianness, serial_encoding Encoding,
+		void* Buffer, std::size_t Size);
+
+	/// Writes a header and Count values to Buffer with the host byte order and no encoding.
+	///
+	/// @return The number of bytes written, 0 if Size is too small
+	template<typename genType>
+	GLM_FUNC_DECL std::size_t serialize(genType const* Values, std::size_t Count, void* Buffer, std::size_t Size);
+
+	/// Reads the header of a serialized buffer.
+	///
+	/// @return false if Buffer doesn't start with a header of a supported version
+	GLM_FUNC_DECL bool readSerialHeader(void const* Buffer, std::size_t Size, serial_header& Header);
+
+	/// Reads up to Capacity values from a serialized buffer, decoding and byte swapping the components as needed.
+	///
+	/// @return The number of values read, 0 if the buffer doesn't hold values of genType or is truncated
+	template<typename genType>
+	GLM_FUNC_DECL std::size_t deserialize(void const* Buffer, std::size_t Size, genType* Values, std::size_t Capacity);
+
+	/// Returns the values of a serialized buffer without copy, for example from a memory mapped file.
+	/// It requires values of genType without encoding nor padding, in the host byte order and suitably aligned in memory.
+	///
+	/// @param Count Receives the number of values
+	/// @return The values, null if they can't be used in place, then deserialize reads them
+	template<typename genType>
+	GLM_FUNC_DECL genType const* serializedData(void const* Buffer, std::size_t Size, std::size_t& Count);
+
+	/// @}
+}//namespace glm
+
+#include "serialize.inl"
@@ -0,0 +1,506 @@
+/// @ref gtx_serialize
+
+#include <cstring>
+#include <algorithm>
+
+namespace glm{
+namespace detail
+{
+	// "GLMS" read as a little endian 32 bits integer
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR uint32 serial_magic()
+	{
+		return 0x534D4C47u;
+	}
+
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR uint32 serial_version()
+	{
+		return 1;
+	}
+
+	template<typename T>
+	struct serial_scalar_of
+	{};
+
+	template<>
+	struct serial_scalar_of<int8>
+	{
+		static serial_scalar const value = serial_int8;
+	};
+
+	template<>
+	struct serial_scalar_of<uint8>
+	{
+		static serial_scalar const value = serial_uint8;
+	};
+
+	template<>
+	struct serial_scalar_of<int16>
+	{
+		static serial_scalar const value = serial_int16;
+	};
+
+	template<>
+	struct serial_scalar_of<uint16>
+	{
+		static serial_scalar const value = serial_uint16;
+	};
+
+	template<>
+	struct serial_scalar_of<int32>
+	{
+		static serial_scalar const value = serial_int32;
+	};
+
+	template<>
+	struct serial_scalar_of<uint32>
+	{
+		static serial_scalar const value = serial_uint32;
+	};
+
+	template<>
+	struct serial_scalar_of<int64>
+	{
+		static serial_scalar const value = serial_int64;
+	};
+
+	template<>
+	struct serial_scalar_of<uint64>
+	{
+		static serial_scalar const value = serial_uint64;
+	};
+
+	template<>
+	struct serial_scalar_of<float>
+	{
+		static serial_scalar const value = serial_float32;
+	};
+
+	template<>
+	struct serial_scalar_of<double>
+	{
+		static serial_scalar const value = serial_float64;
+	};
+
+	// Packed is true when the components are contiguous in memory in the serialized order, allowing bulk copies
+	template<typename genType>
+	struct serial_traits
+	{};
+
+	template<length_t L, typename T, qualifier Q>
+	struct serial_traits<vec<L, T, Q> >
+	{
+		typedef T value_type;
+		static serial_kind const Kind = serial_vector;
+		static length_t const Columns = 1;
+		static length_t const Rows = L;
+		static bool const Packed = sizeof(vec<L, T, Q>) == sizeof(T) * L;
+
+		GLM_FUNC_QUALIFIER static T get(vec<L, T, Q> const& v, length_t i)
+		{
+			return v[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void set(vec<L, T, Q>& v, length_t i, T x)
+		{
+			v[i] = x;
+		}
+	};
+
+	template<length_t C, length_t R, typename T, qualifier Q>
+	struct serial_traits<mat<C, R, T, Q> >
+	{
+		typedef T value_type;
+		static serial_kind const Kind = serial_matrix;
+		static length_t const Columns = C;
+		static length_t const Rows = R;
+		static bool const Packed = sizeof(mat<C, R, T, Q>) == sizeof(T) * C * R;
+
+		GLM_FUNC_QUALIFIER static T get(mat<C, R, T, Q> const& m, length_t i)
+		{
+			return m[i / R][i % R];
+		}
+
+		GLM_FUNC_QUALIFIER static void set(mat<C, R, T, Q>& m, length_t i, T x)
+		{
+			m[i / R][i % R] = x;
+		}
+	};
+
+	template<typename T, qualifier Q>
+	struct serial_traits<qua<T, Q> >
+	{
+		typedef T value_type;
+		static serial_kind const Kind = serial_quaternion;
+		static length_t const Columns = 1;
+		static length_t const Rows = 4;
+#		ifdef GLM_FORCE_QUAT_DATA_WXYZ
+			static bool const Packed = false;
+#		else
+			static bool const Packed = sizeof(qua<T, Q>) == sizeof(T) * 4;
+#		endif
+
+		GLM_FUNC_QUALIFIER static T get(qua<T, Q> const& q, length_t i)
+		{
+			return i == 0 ? q.x : i == 1 ? q.y : i == 2 ? q.z : q.w;
+		}
+
+		GLM_FUNC_QUALIFIER static void set(qua<T, Q>& q, length_t i, T x)
+		{
+			(i == 0 ? q.x : i == 1 ? q.y : i == 2 ? q.z : q.w) = x;
+		}
+	};
+
+	template<std::size_t Size>
+	struct serial_uint
+	{};
+
+	template<>
+	struct serial_uint<2>
+	{
+		typedef uint16 type;
+	};
+
+	template<>
+	struct serial_uint<4>
+	{
+		typedef uint32 type;
+	};
+
+	template<>
+	struct serial_uint<8>
+	{
+		typedef uint64 type;
+	};
+
+	template<std::size_t Size, bool Simd>
+	struct compute_byteswap
+	{
+		// Reverses the bytes of Count scalars of Size bytes, Dst may be Src
+		GLM_FUNC_QUALIFIER static void call(uint8* Dst, uint8 const* Src, std::size_t Count)
+		{
+			typedef typename serial_uint<Size>::type utype;
+
+			for(std::size_t i = 0; i < Count; ++i, Dst += Size, Src += Size)
+			{
+				utype Value;
+				std::memcpy(&Value, Src, Size);
+
+				utype Result = 0;
+				for(std::size_t b = 0; b < Size; ++b, Value >>= 8)
+					Result = static_cast<utype>((Result << 8) | (Value & 0xFF));
+
+				std::memcpy(Dst, &Result, Size);
+			}
+		}
+	};
+
+#	if GLM_CONFIG_CPU_DISPATCH == GLM_ENABLE
+		template<std::size_t Size>
+		struct dispatch_byteswap;
+#	endif
+
+	template<std::size_t Size, bool Simd>
+	GLM_FUNC_QUALIFIER void serial_byteswap(uint8* Dst, uint8 const* Src, std::size_t Count)
+	{
+#		if GLM_CONFIG_CPU_DISPATCH == GLM_ENABLE
+			dispatch<dispatch_byteswap<Size> >()(Dst, Src, Count);
+#		else
+			compute_byteswap<Size, Simd>::call(Dst, Src, Count);
+#		endif
+	}
+
+	template<bool Simd>
+	GLM_FUNC_QUALIFIER void serial_copy(uint8* Dst, uint8 const* Src, std::size_t Count, std::size_t Size, bool Swap)
+	{
+		if(!Swap || Size == 1)
+		{
+			if(Dst != Src)
+				std::memcpy(Dst, Src, Count * Size);
+			return;
+		}
+
+		switch(Size)
+		{
+		case 2:
+			serial_byteswap<2, Simd>(Dst, Src, Count);
+			break;
+		case 4:
+			serial_byteswap<4, Simd>(Dst, Src, Count);
+			break;
+		default:
+			serial_byteswap<8, Simd>(Dst, Src, Count);
+			break;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t serial_encoded_size(serial_encoding Encoding, std::size_t ScalarSize)
+	{
+		switch(Encoding)
+		{
+		case serial_raw:
+			return ScalarSize;
+		case serial_snorm8:
+		case serial_unorm8:
+			return 1;
+		default:
+			return 2;
+		}
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER bool serial_supported(serial_encoding Encoding)
+	{
+		return Encoding == serial_raw;
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER bool serial_supported<float>(serial_encoding Encoding)
+	{
+		return Encoding >= serial_raw && Encoding <= serial_unorm16;
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER uint8* serial_encode(uint8* Dst, T x, serial_encoding)
+	{
+		std::memcpy(Dst, &x, sizeof(T));
+		return Dst + sizeof(T);
+	}
+
+	GLM_FUNC_QUALIFIER uint8* serial_encode(uint8* Dst, float x, serial_encoding Encoding)
+	{
+		uint16 Packed = 0;
+		switch(Encoding)
+		{
+		default:
+			std::memcpy(Dst, &x, sizeof(x));
+			return Dst + sizeof(x);
+		case serial_snorm8:
+			*Dst = packSnorm1x8(x);
+			return Dst + 1;
+		case serial_unorm8:
+			*Dst = packUnorm1x8(x);
+			return Dst + 1;
+		case serial_half:
+			Packed = packHalf1x16(x);
+			break;
+		case serial_snorm16:
+			Packed = packSnorm1x16(x);
+			break;
+		case serial_unorm16:
+			Packed = packUnorm1x16(x);
+			break;
+		}
+		std::memcpy(Dst, &Packed, sizeof(Packed));
+		return Dst + sizeof(Packed);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T serial_decode(uint8 const* Src, serial_encoding)
+	{
+		T x;
+		std::memcpy(&x, Src, sizeof(T));
+		return x;
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER float serial_decode<float>(uint8 const* Src, serial_encoding Encoding)
+	{
+		uint16 Packed;
+		std::memcpy(&Packed, Src, sizeof(Packed));
+		switch(Encoding)
+		{
+		default:
+		{
+			float x;
+			std::memcpy(&x, Src, sizeof(x));
+			return x;
+		}
+		case serial_snorm8:
+			return unpackSnorm1x8(*Src);
+		case serial_unorm8:
+			return unpackUnorm1x8(*Src);
+		case serial_half:
+			return unpackHalf1x16(Packed);
+		case serial_snorm16:
+			return unpackSnorm1x16(Packed);
+		case serial_unorm16:
+			return unpackUnorm1x16(Packed);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void serial_store(uint8* Dst, uint64 Value, std::size_t Size)
+	{
+		for(std::size_t b = 0; b < Size; ++b)
+			Dst[b] = static_cast<uint8>(Value >> (b * 8));
+	}
+
+	GLM_FUNC_QUALIFIER uint64 serial_load(uint8 const* Src, std::size_t Size)
+	{
+		uint64 Value = 0;
+		for(std::size_t b = 0; b < Size; ++b)
+			Value |= static_cast<uint64>(Src[b]) << (b * 8);
+		return Value;
+	}
+
+	// Returns the components of genType in Buffer, null if the header doesn't match genType or the buffer is truncated
+	template<typename genType>
+	GLM_FUNC_QUALIFIER uint8 const* serial_values(void const* Buffer, std::size_t Size, serial_header& Header)
+	{
+		typedef serial_traits<genType> traits;
+		typedef typename traits::value_type T;
+
+		if(!readSerialHeader(Buffer, Size, Header))
+			return nullptr;
+		if(Header.Kind != traits::Kind || Header.Columns != traits::Columns || Header.Rows != traits::Rows)
+			return nullptr;
+		if(Header.Scalar != serial_scalar_of<T>::value || !serial_supported<T>(Header.Encoding))
+			return nullptr;
+
+		uint64 const Stride = static_cast<uint64>(serial_encoded_size(Header.Encoding, sizeof(T)) * traits::Columns * traits::Rows);
+		if(Header.Count > (Size - serial_header_size) / Stride)
+			return nullptr;
+
+		return static_cast<uint8 const*>(Buffer) + serial_header_size;
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER serial_endianness hostEndianness()
+	{
+		uint16 const Value = 1;
+		uint8 Byte = 0;
+		std::memcpy(&Byte, &Value, 1);
+		return Byte == 1 ? serial_little_endian : serial_big_endian;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER std::size_t serializedSize(std::size_t Count, serial_encoding Encoding)
+	{
+		typedef detail::serial_traits<genType> traits;
+
+		return serial_header_size + Count * traits::Columns * traits::Rows * detail::serial_encoded_size(Encoding, sizeof(typename traits::value_type));
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER std::size_t serialize(
+		genType const* Values, std::size_t Count, serial_endianness Endianness, serial_encoding Encoding,
+		void* Buffer, std::size_t Size)
+	{
+		typedef detail::serial_traits<genType> traits;
+		typedef typename traits::value_type T;
+
+		std::size_t const Bytes = serializedSize<genType>(Count, Encoding);
+		if(!detail::serial_supported<T>(Encoding) || Size < Bytes)
+			return 0;
+
+		uint8 Header[serial_header_size] = {0};
+		detail::serial_store(Header + 0, detail::serial_magic(), 4);
+		detail::serial_store(Header + 4, detail::serial_version(), 1);
+		detail::serial_store(Header + 5, static_cast<uint64>(Endianness), 1);
+		detail::serial_store(Header + 6, static_cast<uint64>(traits::Kind), 1);
+		detail::serial_store(Header + 7, static_cast<uint64>(detail::serial_scalar_of<T>::value), 1);
+		detail::serial_store(Header + 8, static_cast<uint64>(Encoding), 1);
+		detail::serial_store(Header + 9, static_cast<uint64>(traits::Columns), 1);
+		detail::serial_store(Header + 10, static_cast<uint64>(traits::Rows), 1);
+		detail::serial_store(Header + 16, static_cast<uint64>(Count), 8);
+		std::memcpy(Buffer, Header, serial_header_size);
+
+		std::size_t const Components = Count * traits::Columns * traits::Rows;
+		std::size_t const ScalarSize = detail::serial_encoded_size(Encoding, sizeof(T));
+		bool const Swap = Endianness != hostEndianness();
+		uint8* const Data = static_cast<uint8*>(Buffer) + serial_header_size;
+
+		if(Encoding == serial_raw && traits::Packed)
+		{
+			detail::serial_copy<GLM_CONFIG_SIMD == GLM_ENABLE>(Data, reinterpret_cast<uint8 const*>(Values), Components, ScalarSize, Swap);
+			return Bytes;
+		}
+
+		uint8* Dst = Data;
+		for(std::size_t i = 0; i < Count; ++i)
+		for(length_t c = 0; c < traits::Columns * traits::Rows; ++c)
+			Dst = detail::serial_encode(Dst, traits::get(Values[i], c), Encoding);
+
+		detail::serial_copy<GLM_CONFIG_SIMD == GLM_ENABLE>(Data, Data, Components, ScalarSize, Swap);
+		return Bytes;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER std::size_t serialize(genType const* Values, std::size_t Count, void* Buffer, std::size_t Size)
+	{
+		return serialize(Values, Count, hostEndianness(), serial_raw, Buffer, Size);
+	}
+
+	GLM_FUNC_QUALIFIER bool readSerialHeader(void const* Buffer, std::size_t Size, serial_header& Header)
+	{
+		if(Buffer == nullptr || Size < serial_header_size)
+			return false;
+
+		uint8 const* const Bytes = static_cast<uint8 const*>(Buffer);
+		if(detail::serial_load(Bytes + 0, 4) != detail::serial_magic())
+			return false;
+
+		Header.Version = static_cast<uint32>(detail::serial_load(Bytes + 4, 1));
+		Header.Endianness = static_cast<serial_endianness>(Bytes[5]);
+		Header.Kind = static_cast<serial_kind>(Bytes[6]);
+		Header.Scalar = static_cast<serial_scalar>(Bytes[7]);
+		Header.Encoding = static_cast<serial_encoding>(Bytes[8]);
+		Header.Columns = static_cast<length_t>(Bytes[9]);
+		Header.Rows = static_cast<length_t>(Bytes[10]);
+		Header.Count = detail::serial_load(Bytes + 16, 8);
+
+		return Header.Version == detail::serial_version() && Bytes[5] <= serial_big_endian;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER std::size_t deserialize(void const* Buffer, std::size_t Size, genType* Values, std::size_t Capacity)
+	{
+		typedef detail::serial_traits<genType> traits;
+		typedef typename traits::value_type T;
+
+		serial_header Header;
+		uint8 const* Src = detail::serial_values<genType>(Buffer, Size, Header);
+		if(Src == nullptr)
+			return 0;
+
+		std::size_t const Count = static_cast<std::size_t>(std::min<uint64>(Header.Count, Capacity));
+		std::size_t const ScalarSize = detail::serial_encoded_size(Header.Encoding, sizeof(T));
+		bool const Swap = Header.Endianness != hostEndianness();
+
+		if(Header.Encoding == serial_raw && traits::Packed)
+		{
+			detail::serial_copy<GLM_CONFIG_SIMD == GLM_ENABLE>(reinterpret_cast<uint8*>(Values), Src, Count * traits::Columns * traits::Rows, ScalarSize, Swap);
+			return Count;
+		}
+
+		for(std::size_t i = 0; i < Count; ++i)
+		for(length_t c = 0; c < traits::Columns * traits::Rows; ++c, Src += ScalarSize)
+		{
+			uint8 Scalar[sizeof(uint64)];
+			detail::serial_copy<GLM_CONFIG_SIMD == GLM_ENABLE>(Scalar, Src, 1, ScalarSize, Swap);
+			traits::set(Values[i], c, detail::serial_decode<T>(Scalar, Header.Encoding));
+		}
+		return Count;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER genType const* serializedData(void const* Buffer, std::size_t Size, std::size_t& Count)
+	{
+		serial_header Header;
+		uint8 const* const Src = detail::serial_values<genType>(Buffer, Size, Header);
+		if(Src == nullptr || !detail::serial_traits<genType>::Packed || Header.Encoding != serial_raw || Header.Endianness != hostEndianness())
+			return nullptr;
+		if(reinterpret_cast<std::size_t>(Src) % alignof(genType) != 0)
+			return nullptr;
+
+		Count = static_cast<std::size_t>(Header.Count);
+		return reinterpret_cast<genType const*>(Src);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "serialize_simd.inl"
+#endif
+
+#if GLM_CONFIG_CPU_DISPATCH == GLM_ENABLE
+#	include "serialize_dispatch.inl"
+#endif
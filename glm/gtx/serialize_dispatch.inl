@@ -0,0 +1,125 @@
+/// @ref gtx_serialize
+
+namespace glm{
+namespace detail
+{
+	template<std::size_t Size>
+	struct dispatch_byteswap
+	{
+		typedef void (*function)(uint8* Dst, uint8 const* Src, std::size_t Count);
+
+		// Shuffle indices reversing the bytes of each group of Size bytes of a 16 bytes register
+		GLM_FUNC_QUALIFIER static void indices(char Indices[16])
+		{
+			for(std::size_t i = 0; i < 16; ++i)
+				Indices[i] = static_cast<char>(i - i % Size + Size - 1 - i % Size);
+		}
+
+		// Reverses the 16 bits words of each scalar then swaps the bytes of each word
+		GLM_DISPATCH_SSE2 GLM_FUNC_QUALIFIER static void sse2(uint8* Dst, uint8 const* Src, std::size_t Count)
+		{
+			std::size_t const Bytes = Count * Size;
+			std::size_t i = 0;
+			for(; i + 16 <= Bytes; i += 16)
+			{
+				__m128i Value = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+				if(Size == 4)
+				{
+					Value = _mm_shufflelo_epi16(Value, _MM_SHUFFLE(2, 3, 0, 1));
+					Value = _mm_shufflehi_epi16(Value, _MM_SHUFFLE(2, 3, 0, 1));
+				}
+				else if(Size == 8)
+				{
+					Value = _mm_shufflelo_epi16(Value, _MM_SHUFFLE(0, 1, 2, 3));
+					Value = _mm_shufflehi_epi16(Value, _MM_SHUFFLE(0, 1, 2, 3));
+				}
+				Value = _mm_or_si128(_mm_slli_epi16(Value, 8), _mm_srli_epi16(Value, 8));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), Value);
+			}
+
+			compute_byteswap<Size, false>::call(Dst + i, Src + i, (Bytes - i) / Size);
+		}
+
+		GLM_DISPATCH_SSE4_1 GLM_FUNC_QUALIFIER static void sse4_1(uint8* Dst, uint8 const* Src, std::size_t Count)
+		{
+			char Indices[16];
+			indices(Indices);
+			__m128i const Mask = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Indices));
+
+			std::size_t const Bytes = Count * Size;
+			std::size_t i = 0;
+			for(; i + 16 <= Bytes; i += 16)
+			{
+				__m128i const Value = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), _mm_shuffle_epi8(Value, Mask));
+			}
+
+			compute_byteswap<Size, false>::call(Dst + i, Src + i, (Bytes - i) / Size);
+		}
+
+		GLM_DISPATCH_AVX2 GLM_FUNC_QUALIFIER static void avx2(uint8* Dst, uint8 const* Src, std::size_t Count)
+		{
+			char Indices[16];
+			indices(Indices);
+			__m128i const Mask = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Indices));
+			__m256i const Mask2 = _mm256_broadcastsi128_si256(Mask);
+
+			std::size_t const Bytes = Count * Size;
+			std::size_t i = 0;
+			for(; i + 32 <= Bytes; i += 32)
+			{
+				__m256i const Value = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Src + i));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Dst + i), _mm256_shuffle_epi8(Value, Mask2));
+			}
+			for(; i + 16 <= Bytes; i += 16)
+			{
+				__m128i const Value = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), _mm_shuffle_epi8(Value, Mask));
+			}
+
+			compute_byteswap<Size, false>::call(Dst + i, Src + i, (Bytes - i) / Size);
+		}
+
+		// The remaining bytes are swapped with masked loads and stores.
+		// The broadcast uses the zero masking form, the unmasked one passes an undefined source reported as uninitialized by GCC 12
+		GLM_DISPATCH_AVX512 GLM_FUNC_QUALIFIER static void avx512(uint8* Dst, uint8 const* Src, std::size_t Count)
+		{
+			char Indices[16];
+			indices(Indices);
+			__m512i const Mask = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<__m128i const*>(Indices)));
+
+			std::size_t const Bytes = Count * Size;
+			std::size_t i = 0;
+			for(; i + 64 <= Bytes; i += 64)
+			{
+				__m512i const Value = _mm512_loadu_si512(Src + i);
+				_mm512_storeu_si512(Dst + i, _mm512_shuffle_epi8(Value, Mask));
+			}
+
+			if(i < Bytes)
+			{
+				__mmask64 const Remain = static_cast<__mmask64>((1ull << (Bytes - i)) - 1ull);
+				__m512i const Value = _mm512_maskz_loadu_epi8(Remain, Src + i);
+				_mm512_mask_storeu_epi8(Dst + i, Remain, _mm512_shuffle_epi8(Value, Mask));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static function select(cpu_tier Tier)
+		{
+			switch(Tier)
+			{
+			case cpu_avx512:
+				return avx512;
+			case cpu_avx2:
+				return avx2;
+			case cpu_sse4_1:
+				return sse4_1;
+			case cpu_sse2:
+				return sse2;
+			default:
+				return compute_byteswap<Size, false>::call;
+			}
+		}
+	};
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,65 @@
+/// @ref gtx_serialize
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<std::size_t Size>
+	struct compute_byteswap<Size, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint8* Dst, uint8 const* Src, std::size_t Count)
+		{
+#		if GLM_ARCH & GLM_ARCH_SSSE3_BIT
+			// Reverses the bytes of each group of Size bytes of a 16 bytes register
+			char Indices[16];
+			for(std::size_t i = 0; i < 16; ++i)
+				Indices[i] = static_cast<char>(i - i % Size + Size - 1 - i % Size);
+			__m128i const Mask = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Indices));
+
+			std::size_t const Bytes = Count * Size;
+			std::size_t i = 0;
+
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				__m256i const Mask2 = _mm256_broadcastsi128_si256(Mask);
+				for(; i + 32 <= Bytes; i += 32)
+				{
+					__m256i const Value = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Src + i));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(Dst + i), _mm256_shuffle_epi8(Value, Mask2));
+				}
+#			endif
+
+			for(; i + 16 <= Bytes; i += 16)
+			{
+				__m128i const Value = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), _mm_shuffle_epi8(Value, Mask));
+			}
+#		else
+			// Reverses the 16 bits words of each scalar then swaps the bytes of each word
+			std::size_t const Bytes = Count * Size;
+			std::size_t i = 0;
+			for(; i + 16 <= Bytes; i += 16)
+			{
+				__m128i Value = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+				if(Size == 4)
+				{
+					Value = _mm_shufflelo_epi16(Value, _MM_SHUFFLE(2, 3, 0, 1));
+					Value = _mm_shufflehi_epi16(Value, _MM_SHUFFLE(2, 3, 0, 1));
+				}
+				else if(Size == 8)
+				{
+					Value = _mm_shufflelo_epi16(Value, _MM_SHUFFLE(0, 1, 2, 3));
+					Value = _mm_shufflehi_epi16(Value, _MM_SHUFFLE(0, 1, 2, 3));
+				}
+				Value = _mm_or_si128(_mm_slli_epi16(Value, 8), _mm_srli_epi16(Value, 8));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), Value);
+			}
+#		endif
+
+			compute_byteswap<Size, false>::call(Dst + i, Src + i, (Bytes - i) / Size);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,92 @@
+/// @ref gtx_spatial_sort
+/// @file glm/gtx/spatial_sort.hpp
+///
+/// @see core (dependence)
+/// @see gtc_bitfield (dependence)
+///
+/// @defgroup gtx_spatial_sort GLM_GTX_spatial_sort
+/// @ingroup gtx
+///
+/// Include <glm/gtx/spatial_sort.hpp> to use the features of this extension.
+///
+/// Reorders points along a Morton or Hilbert space-filling curve so that elements close in space are close in memory.
+/// Keys are computed with mortonEncode and hilbertEncode of GLM_GTC_bitfield and sorted with a parallel radix sort.
+/// The sort uses std::thread: link the program with the threads library, e.g. Threads::Threads with CMake.
+/// It is not included by <glm/ext.hpp> so that including all the extensions does not include <thread>.
+///
+/// Example:
+/// ```
+/// std::vector<glm::uint32> permutation(points.size());
+/// glm::spatialSort(points.data(), points.size(), permutation.data(), 4u);
+///
+/// // Move the attributes of the points along
+/// glm::applyPermutation(permutation.data(), colors.size(), colors.data());
+/// ```
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/bitfield.hpp"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_spatial_sort is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_spatial_sort extension included")
+#endif
+
+#if GLM_LANG & GLM_LANG_CXX11
+
+#include <cstddef>
+
+namespace glm
+{
+	/// @addtogroup gtx_spatial_sort
+	/// @{
+
+	/// Sorts Count 64 bits keys with a stable radix sort using up to Threads threads.
+	/// Permutation receives for each sorted position the index of its key, Keys is left unchanged.
+	///
+	/// @param Count Number of keys, lower than 2^32
+	GLM_FUNC_DISCARD_DECL void sortPermutation(uint64 const* Keys, std::size_t Count, uint32* Permutation, unsigned int Threads);
+
+	/// Computes the permutation sorting Count 2D or 3D positions along the Morton curve of the [Min, Max] box.
+	/// Permutation receives for each sorted position the index of the original position.
+	///
+	/// @see mortonEncode
+	/// @see applyPermutation
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void mortonOrder(
+		vec<L, T, Q> const* Positions, std::size_t Count, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max,
+		uint32* Permutation, unsigned int Threads);
+
+	/// Computes the permutation sorting Count 2D or 3D positions along the Hilbert curve of the [Min, Max] box.
+	/// The Hilbert order is more expensive to compute than the Morton order but never jumps between distant cells.
+	/// Permutation receives for each sorted position the index of the original position.
+	///
+	/// @see hilbertEncode
+	/// @see applyPermutation
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void hilbertOrder(
+		vec<L, T, Q> const* Positions, std::size_t Count, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max,
+		uint32* Permutation, unsigned int Threads);
+
+	/// Reorders Count elements of Data in place: the element at index i becomes the element previously at Permutation[i].
+	/// Requires Count / 8 bytes of temporary memory.
+	template<typename genType>
+	GLM_FUNC_DISCARD_DECL void applyPermutation(uint32 const* Permutation, std::size_t Count, genType* Data);
+
+	/// Reorders in place Count 2D or 3D positions along the Hilbert curve of their bounding box.
+	/// Permutation, which may be null, receives for each sorted position the index of the original position
+	/// to reorder other arrays with applyPermutation.
+	///
+	/// @see hilbertOrder
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void spatialSort(vec<L, T, Q>* Positions, std::size_t Count, uint32* Permutation, unsigned int Threads);
+
+	/// @}
+}//namespace glm
+
+#include "spatial_sort.inl"
+
+#endif//GLM_LANG & GLM_LANG_CXX11
@@ -0,0 +1,223 @@
+/// @ref gtx_spatial_sort
+
+#include "../detail/_parallel.hpp"
+#include <vector>
+
+namespace glm{
+namespace detail
+{
+	// Below this number of keys per thread, threads cost more than they save
+	GLM_FUNC_QUALIFIER unsigned int spatial_sort_threads(std::size_t Count, unsigned int Threads)
+	{
+		return parallel_threads(Count, 16384, Threads);
+	}
+
+	// Least significant digit radix sort of 8 bits digits, skipping the digits shared by all keys.
+	// Each pass counts the digits of each chunk of keys then scatters the chunks concurrently.
+	class radix_sort
+	{
+		static std::size_t const Buckets = 256;
+
+		struct histogram
+		{
+			radix_sort* Sort;
+
+			void operator()(std::size_t Begin, std::size_t End, unsigned int Chunk) const
+			{
+				std::size_t* Counts = &Sort->Counts[Chunk * Buckets];
+				std::fill(Counts, Counts + Buckets, std::size_t(0));
+				for(std::size_t i = Begin; i < End; ++i)
+					++Counts[Sort->digit(Sort->SrcKeys[i])];
+			}
+		};
+
+		struct scatter
+		{
+			radix_sort* Sort;
+
+			void operator()(std::size_t Begin, std::size_t End, unsigned int Chunk) const
+			{
+				std::size_t* Offsets = &Sort->Counts[Chunk * Buckets];
+				for(std::size_t i = Begin; i < End; ++i)
+				{
+					std::size_t const o = Offsets[Sort->digit(Sort->SrcKeys[i])]++;
+					Sort->DstKeys[o] = Sort->SrcKeys[i];
+					Sort->DstIndices[o] = Sort->SrcIndices ? Sort->SrcIndices[i] : static_cast<uint32>(i);
+				}
+			}
+		};
+
+	public:
+		radix_sort(uint64 const* keys, std::size_t count, uint32* permutation, unsigned int threads)
+			: Count(count)
+			, Threads(spatial_sort_threads(count, threads))
+			, Shift(0)
+			, Permutation(permutation)
+			, Counts(Threads * Buckets)
+			, SrcKeys(keys)
+			, SrcIndices(nullptr)
+			, DstKeys(nullptr)
+			, DstIndices(nullptr)
+		{}
+
+		void operator()()
+		{
+			if(Count == 0)
+				return;
+
+			// Digits equal for all keys don't change the order
+			uint64 Varying = 0;
+			for(std::size_t i = 1; i < Count; ++i)
+				Varying |= SrcKeys[i] ^ SrcKeys[0];
+
+			std::vector<uint64> Keys[2];
+			std::vector<uint32> Indices(Count);
+			uint32* IndexBuffers[2] = {Permutation, &Indices[0]};
+			int Buffer = 0;
+
+			for(Shift = 0; Shift < 64; Shift += 8)
+			{
+				if(((Varying >> Shift) & (Buckets - 1)) == 0)
+					continue;
+
+				Keys[Buffer].resize(Count);
+				DstKeys = &Keys[Buffer][0];
+				DstIndices = IndexBuffers[Buffer];
+
+				histogram const Histogram = {this};
+				parallel_for(Count, Threads, Histogram);
+
+				// Exclusive prefix sum in bucket then chunk order gives the first output position of each chunk digit
+				std::size_t Offset = 0;
+				for(std::size_t b = 0; b < Buckets; ++b)
+				for(unsigned int t = 0; t < Threads; ++t)
+				{
+					std::size_t const Size = Counts[t * Buckets + b];
+					Counts[t * Buckets + b] = Offset;
+					Offset += Size;
+				}
+
+				scatter const Scatter = {this};
+				parallel_for(Count, Threads, Scatter);
+
+				SrcKeys = DstKeys;
+				SrcIndices = DstIndices;
+				Buffer ^= 1;
+			}
+
+			if(SrcIndices == nullptr)
+			{
+				for(std::size_t i = 0; i < Count; ++i)
+					Permutation[i] = static_cast<uint32>(i);
+			}
+			else if(SrcIndices != Permutation)
+				std::copy(SrcIndices, SrcIndices + Count, Permutation);
+		}
+
+	private:
+		std::size_t digit(uint64 Key) const
+		{
+			return static_cast<std::size_t>((Key >> Shift) & (Buckets - 1));
+		}
+
+		std::size_t Count;
+		unsigned int Threads;
+		unsigned int Shift;
+		uint32* Permutation;
+		std::vector<std::size_t> Counts;
+		uint64 const* SrcKeys;
+		uint32 const* SrcIndices;
+		uint64* DstKeys;
+		uint32* DstIndices;
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Hilbert>
+	struct spatial_sort_keys
+	{
+		vec<L, T, Q> const* Positions;
+		vec<L, T, Q> Min;
+		vec<L, T, Q> Max;
+		uint64* Keys;
+
+		void operator()(std::size_t Begin, std::size_t End, unsigned int) const
+		{
+			if(Hilbert)
+				hilbertEncode(Positions + Begin, End - Begin, Min, Max, Keys + Begin);
+			else
+				mortonEncode(Positions + Begin, End - Begin, Min, Max, Keys + Begin);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Hilbert>
+	GLM_FUNC_QUALIFIER void spatialOrder(vec<L, T, Q> const* Positions, std::size_t Count, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, uint32* Permutation, unsigned int Threads)
+	{
+		std::vector<uint64> Keys(Count);
+		spatial_sort_keys<L, T, Q, Hilbert> const Encode = {Positions, Min, Max, Keys.empty() ? nullptr : &Keys[0]};
+		parallel_for(Count, spatial_sort_threads(Count, Threads), Encode);
+		sortPermutation(Encode.Keys, Count, Permutation, Threads);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void sortPermutation(uint64 const* Keys, std::size_t Count, uint32* Permutation, unsigned int Threads)
+	{
+		detail::radix_sort Sort(Keys, Count, Permutation, Threads);
+		Sort();
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mortonOrder(vec<L, T, Q> const* Positions, std::size_t Count, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, uint32* Permutation, unsigned int Threads)
+	{
+		detail::spatialOrder<L, T, Q, false>(Positions, Count, Min, Max, Permutation, Threads);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void hilbertOrder(vec<L, T, Q> const* Positions, std::size_t Count, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, uint32* Permutation, unsigned int Threads)
+	{
+		detail::spatialOrder<L, T, Q, true>(Positions, Count, Min, Max, Permutation, Threads);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER void applyPermutation(uint32 const* Permutation, std::size_t Count, genType* Data)
+	{
+		// Follow each cycle of the permutation, moving every element once
+		std::vector<bool> Done(Count, false);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			if(Done[i])
+				continue;
+
+			genType const First = Data[i];
+			std::size_t j = i;
+			for(;;)
+			{
+				Done[j] = true;
+				std::size_t const k = Permutation[j];
+				if(k == i)
+					break;
+				Data[j] = Data[k];
+				j = k;
+			}
+			Data[j] = First;
+		}
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void spatialSort(vec<L, T, Q>* Positions, std::size_t Count, uint32* Permutation, unsigned int Threads)
+	{
+		if(Count == 0)
+			return;
+
+		vec<L, T, Q> Min(Positions[0]);
+		vec<L, T, Q> Max(Positions[0]);
+		for(std::size_t i = 1; i < Count; ++i)
+		{
+			Min = min(Min, Positions[i]);
+			Max = max(Max, Positions[i]);
+		}
+
+		std::vector<uint32> Order(Permutation ? 0 : Count);
+		uint32* const Result = Permutation ? Permutation : &Order[0];
+		hilbertOrder(Positions, Count, Min, Max, Result, Threads);
+		applyPermutation(Result, Count, Positions);
+	}
+}//namespace glm
@@ -1,5 +1,7 @@
 /// @ref gtx_spline
 
+#include <algorithm>
+
 namespace glm
 {
 	template<typename genType>
@@ -57,4 +59,249 @@ namespace glm
 	{
 		return ((v1 * s + v2) * s + v3) * s + v4;
 	}
+
+namespace detail
+{
+	// Segment of the parameter clamped to the spline and parameter in the segment
+	template<typename T>
+	GLM_FUNC_QUALIFIER std::size_t spline_segment(T Parameter, std::size_t Segments, T& s)
+	{
+		T const t = clamp(Parameter, static_cast<T>(0), static_cast<T>(Segments));
+		std::size_t const k = std::min(static_cast<std::size_t>(t), Segments - 1);
+		s = t - static_cast<T>(k);
+		return k;
+	}
+
+	// Second derivative of the point with respect to the parameter
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> spline_curvature(vec<L, T, Q> const* c, T s)
+	{
+		return c[0] * (static_cast<T>(6) * s) + c[1] * static_cast<T>(2);
+	}
+
+	// Specialized for vec3 and vec4 float with SIMD instruction sets
+	template<length_t L, typename T, qualifier Q, bool UseSimd>
+	struct compute_spline_eval
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> position(vec<L, T, Q> const* c, T s)
+		{
+			return cubic(c[0], c[1], c[2], c[3], s);
+		}
+
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> tangent(vec<L, T, Q> const* c, T s)
+		{
+			return (c[0] * (static_cast<T>(3) * s) + c[1] * static_cast<T>(2)) * s + c[2];
+		}
+
+		GLM_FUNC_QUALIFIER static void positions(vec<L, T, Q> const* c, std::size_t Segments, T const* Parameters, std::size_t Count, vec<L, T, Q>* Out)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				T s;
+				std::size_t const k = spline_segment(Parameters[i], Segments, s);
+				Out[i] = position(c + k * 4, s);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void tangents(vec<L, T, Q> const* c, std::size_t Segments, T const* Parameters, std::size_t Count, vec<L, T, Q>* Out)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				T s;
+				std::size_t const k = spline_segment(Parameters[i], Segments, s);
+				Out[i] = tangent(c + k * 4, s);
+			}
+		}
+	};
+
+	// Linear interpolation of a table at the fractional index x in [0, Table.size() - 1]
+	template<typename T>
+	GLM_FUNC_QUALIFIER T spline_lookup(std::vector<T> const& Table, T x)
+	{
+		std::size_t const i = std::min(static_cast<std::size_t>(max(x, static_cast<T>(0))), Table.size() - 2);
+		return mix(Table[i], Table[i + 1], clamp(x - static_cast<T>(i), static_cast<T>(0), static_cast<T>(1)));
+	}
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR catmull_rom_spline<L, T, Q>::catmull_rom_spline(vec<L, T, Q> const* Points, std::size_t Count, int Subdivisions)
+		: subdivisions(Subdivisions)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559, "'catmull_rom_spline' only accept floating-point inputs");
+		assert(Count >= 2 && Subdivisions >= 1);
+
+		std::size_t const Segments = Count - 1;
+		T const Half = static_cast<T>(0.5);
+
+		coefficients.resize(Segments * 4 + 1);
+		for(std::size_t k = 0; k < Segments; ++k)
+		{
+			vec<L, T, Q> const p0 = k > 0 ? Points[k - 1] : Points[0] * static_cast<T>(2) - Points[1];
+			vec<L, T, Q> const p1 = Points[k];
+			vec<L, T, Q> const p2 = Points[k + 1];
+			vec<L, T, Q> const p3 = k + 2 < Count ? Points[k + 2] : Points[k + 1] * static_cast<T>(2) - Points[k];
+
+			// The polynomial of catmullRom(p0, p1, p2, p3, s)
+			coefficients[k * 4 + 0] = (p3 - p0 + (p1 - p2) * static_cast<T>(3)) * Half;
+			coefficients[k * 4 + 1] = p0 - p1 * static_cast<T>(2.5) + p2 * static_cast<T>(2) - p3 * Half;
+			coefficients[k * 4 + 2] = (p2 - p0) * Half;
+			coefficients[k * 4 + 3] = p1;
+		}
+
+		// 3 points Gauss-Legendre quadrature of the speed on each sample
+		T const Nodes[3] = {static_cast<T>(-0.774596669241483377), static_cast<T>(0), static_cast<T>(0.774596669241483377)};
+		T const Weights[3] = {static_cast<T>(5.0 / 9.0), static_cast<T>(8.0 / 9.0), static_cast<T>(5.0 / 9.0)};
+		T const Step = static_cast<T>(1) / static_cast<T>(Subdivisions);
+
+		std::size_t const Samples = Segments * static_cast<std::size_t>(Subdivisions) + 1;
+		lengthTable.resize(Samples);
+		lengthTable[0] = static_cast<T>(0);
+		for(std::size_t i = 1; i < Samples; ++i)
+		{
+			std::size_t const k = (i - 1) / static_cast<std::size_t>(Subdivisions);
+			T const s = (static_cast<T>((i - 1) % static_cast<std::size_t>(Subdivisions)) + Half) * Step;
+			T Length = static_cast<T>(0);
+			for(int n = 0; n < 3; ++n)
+				Length += Weights[n] * glm::length(detail::compute_spline_eval<L, T, Q, false>::tangent(&coefficients[k * 4], s + Nodes[n] * Half * Step));
+			lengthTable[i] = lengthTable[i - 1] + Length * Half * Step;
+		}
+
+		// Inverse of the length table, the lengths are increasing
+		T const Total = lengthTable[Samples - 1];
+		parameterTable.resize(Samples);
+		std::size_t j = 0;
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			T const Distance = Total * static_cast<T>(i) / static_cast<T>(Samples - 1);
+			while(j + 2 < Samples && lengthTable[j + 1] < Distance)
+				++j;
+			T const Interval = lengthTable[j + 1] - lengthTable[j];
+			T const Fraction = Interval > static_cast<T>(0) ? clamp((Distance - lengthTable[j]) / Interval, static_cast<T>(0), static_cast<T>(1)) : static_cast<T>(0);
+			parameterTable[i] = (static_cast<T>(j) + Fraction) * Step;
+		}
+		parameterTable[Samples - 1] = static_cast<T>(Segments);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t catmull_rom_spline<L, T, Q>::segments() const
+	{
+		return coefficients.size() / 4;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T catmull_rom_spline<L, T, Q>::length() const
+	{
+		return lengthTable.back();
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T catmull_rom_spline<L, T, Q>::distance(T Parameter) const
+	{
+		return detail::spline_lookup(lengthTable, Parameter * static_cast<T>(subdivisions));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T catmull_rom_spline<L, T, Q>::parameter(T Distance) const
+	{
+		T const Length = length();
+		if(Length <= static_cast<T>(0))
+			return static_cast<T>(0);
+		return detail::spline_lookup(parameterTable, Distance / Length * static_cast<T>(parameterTable.size() - 1));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void catmull_rom_spline<L, T, Q>::parameters(T const* Distances, std::size_t Count, T* Out) const
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = parameter(Distances[i]);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> catmull_rom_spline<L, T, Q>::position(T Parameter) const
+	{
+		T s;
+		std::size_t const k = detail::spline_segment(Parameter, segments(), s);
+		return detail::compute_spline_eval<L, T, Q, false>::position(&coefficients[k * 4], s);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> catmull_rom_spline<L, T, Q>::tangent(T Parameter) const
+	{
+		T s;
+		std::size_t const k = detail::spline_segment(Parameter, segments(), s);
+		return detail::compute_spline_eval<L, T, Q, false>::tangent(&coefficients[k * 4], s);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void catmull_rom_spline<L, T, Q>::positions(T const* Parameters, std::size_t Count, vec<L, T, Q>* Out) const
+	{
+		detail::compute_spline_eval<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::positions(&coefficients[0], segments(), Parameters, Count, Out);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void catmull_rom_spline<L, T, Q>::tangents(T const* Parameters, std::size_t Count, vec<L, T, Q>* Out) const
+	{
+		detail::compute_spline_eval<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::tangents(&coefficients[0], segments(), Parameters, Count, Out);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T catmull_rom_spline<L, T, Q>::closestParameter(vec<L, T, Q> const& Point) const
+	{
+		return closestParameter(Point, static_cast<T>(0), static_cast<T>(segments()));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T catmull_rom_spline<L, T, Q>::closestParameter(vec<L, T, Q> const& Point, T First, T Last) const
+	{
+		T const Begin = clamp(min(First, Last), static_cast<T>(0), static_cast<T>(segments()));
+		T const End = clamp(max(First, Last), static_cast<T>(0), static_cast<T>(segments()));
+		T const Step = static_cast<T>(1) / static_cast<T>(subdivisions);
+
+		// Closest sample, including the bounds of the range
+		T Closest = Begin;
+		T ClosestDistance = dot(position(Begin) - Point, position(Begin) - Point);
+		for(T t = (floor(Begin * static_cast<T>(subdivisions)) + static_cast<T>(1)) * Step; t <= End; t += Step)
+		{
+			vec<L, T, Q> const Delta = position(t) - Point;
+			T const Distance = dot(Delta, Delta);
+			if(Distance < ClosestDistance)
+			{
+				Closest = t;
+				ClosestDistance = Distance;
+			}
+		}
+		{
+			vec<L, T, Q> const Delta = position(End) - Point;
+			if(dot(Delta, Delta) < ClosestDistance)
+			{
+				Closest = End;
+				ClosestDistance = dot(Delta, Delta);
+			}
+		}
+
+		// Newton iterations on the derivative of the squared distance, within the samples around the closest one
+		T const Low = max(Closest - Step, Begin);
+		T const High = min(Closest + Step, End);
+		T t = Closest;
+		for(int i = 0; i < 8; ++i)
+		{
+			T s;
+			std::size_t const k = detail::spline_segment(t, segments(), s);
+			vec<L, T, Q> const* c = &coefficients[k * 4];
+			vec<L, T, Q> const Delta = detail::compute_spline_eval<L, T, Q, false>::position(c, s) - Point;
+			vec<L, T, Q> const Tangent = detail::compute_spline_eval<L, T, Q, false>::tangent(c, s);
+			T const Slope = dot(Delta, Tangent);
+			T const Curvature = dot(Tangent, Tangent) + dot(Delta, detail::spline_curvature(c, s));
+			if(Curvature <= static_cast<T>(0))
+				break;
+			t = clamp(t - Slope / Curvature, Low, High);
+		}
+
+		vec<L, T, Q> const Delta = position(t) - Point;
+		return dot(Delta, Delta) < ClosestDistance ? t : Closest;
+	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "spline_simd.inl"
+#endif
@@ -0,0 +1,118 @@
+/// @ref gtx_spline
+
+#if GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_NEON_BIT)
+
+namespace glm{
+namespace detail
+{
+	// One parameter per iteration, the four coefficients of its segment are loaded with 16 bytes loads.
+	// The loads of the vec3 coefficients read the first component of the next one, the padding element after the last segment.
+	template<length_t L, qualifier Q>
+	struct compute_spline_eval_simd
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			typedef glm_f32vec4 simd_type;
+
+			GLM_FUNC_QUALIFIER static simd_type load(vec<L, float, Q> const* c)
+			{
+				return _mm_loadu_ps(&c->x);
+			}
+
+			GLM_FUNC_QUALIFIER static void store(vec<L, float, Q>* Out, simd_type v)
+			{
+				if(L == 4)
+					_mm_storeu_ps(&Out->x, v);
+				else
+				{
+					_mm_storel_pi(reinterpret_cast<__m64*>(&Out->x), v);
+					_mm_store_ss(&Out->x + 2, _mm_movehl_ps(v, v));
+				}
+			}
+
+			// a * b + c
+			GLM_FUNC_QUALIFIER static simd_type fma(simd_type a, simd_type b, simd_type c)
+			{
+				return glm_vec4_fma(a, b, c);
+			}
+
+			GLM_FUNC_QUALIFIER static simd_type add(simd_type a, simd_type b)
+			{
+				return _mm_add_ps(a, b);
+			}
+
+			GLM_FUNC_QUALIFIER static simd_type set1(float s)
+			{
+				return _mm_set1_ps(s);
+			}
+#		else
+			typedef float32x4_t simd_type;
+
+			GLM_FUNC_QUALIFIER static simd_type load(vec<L, float, Q> const* c)
+			{
+				return vld1q_f32(&c->x);
+			}
+
+			GLM_FUNC_QUALIFIER static void store(vec<L, float, Q>* Out, simd_type v)
+			{
+				if(L == 4)
+					vst1q_f32(&Out->x, v);
+				else
+				{
+					vst1_f32(&Out->x, vget_low_f32(v));
+					vst1q_lane_f32(&Out->x + 2, v, 2);
+				}
+			}
+
+			GLM_FUNC_QUALIFIER static simd_type fma(simd_type a, simd_type b, simd_type c)
+			{
+				return vmlaq_f32(c, a, b);
+			}
+
+			GLM_FUNC_QUALIFIER static simd_type add(simd_type a, simd_type b)
+			{
+				return vaddq_f32(a, b);
+			}
+
+			GLM_FUNC_QUALIFIER static simd_type set1(float s)
+			{
+				return vdupq_n_f32(s);
+			}
+#		endif
+
+		GLM_FUNC_QUALIFIER static void positions(vec<L, float, Q> const* c, std::size_t Segments, float const* Parameters, std::size_t Count, vec<L, float, Q>* Out)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				float s;
+				vec<L, float, Q> const* Segment = c + spline_segment(Parameters[i], Segments, s) * 4;
+				simd_type const s0 = set1(s);
+				simd_type const r0 = fma(load(Segment + 0), s0, load(Segment + 1));
+				simd_type const r1 = fma(r0, s0, load(Segment + 2));
+				store(Out + i, fma(r1, s0, load(Segment + 3)));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void tangents(vec<L, float, Q> const* c, std::size_t Segments, float const* Parameters, std::size_t Count, vec<L, float, Q>* Out)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				float s;
+				vec<L, float, Q> const* Segment = c + spline_segment(Parameters[i], Segments, s) * 4;
+				simd_type const b = load(Segment + 1);
+				simd_type const r0 = fma(load(Segment + 0), set1(s * 3.0f), add(b, b));
+				store(Out + i, fma(r0, set1(s), load(Segment + 2)));
+			}
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_spline_eval<3, float, Q, true> : public compute_spline_eval_simd<3, Q>
+	{};
+
+	template<qualifier Q>
+	struct compute_spline_eval<4, float, Q, true> : public compute_spline_eval_simd<4, Q>
+	{};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_NEON_BIT)
@@ -22,6 +22,10 @@
 #include <string>
 #include <cmath>
 #include <cstring>
+#if GLM_LANG & GLM_LANG_CXX17_FLAG
+#	include <charconv>
+#	include <vector>
+#endif
 
 #ifndef GLM_ENABLE_EXPERIMENTAL
 #	error "GLM: GLM_GTX_string_cast is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
@@ -39,6 +43,44 @@ namespace glm
 	template<typename genType>
 	GLM_FUNC_DECL std::string to_string(genType const& x);
 
+#if GLM_LANG & GLM_LANG_CXX17_FLAG
+	/// Writes a GLM vector, matrix, quaternion or dual quaternion to the character range [First, Last)
+	/// with the layout of to_string, without memory allocation nor null terminator.
+	/// Floating point values are written with the shortest representation that reads back to the same value,
+	/// e.g. "vec3(1, 0.1, -2.5e-07)".
+	///
+	/// @return On success, ptr points one past the last character written and ec is value-initialized.
+	/// If the range is too small, ptr is Last and ec is std::errc::value_too_large.
+	///
+	/// @see gtx_string_cast extension.
+	template<typename genType>
+	GLM_FUNC_DECL std::to_chars_result to_chars(char* First, char* Last, genType const& x);
+
+	/// Reads a GLM vector, matrix, quaternion or dual quaternion from the character range [First, Last).
+	/// Accepts the output of to_string and to_chars, e.g. "mat2x2((1, 0), (0, 1))", and plain delimited numbers, e.g. "1 2 3", "1,2,3" or "[1, 2, 3]".
+	/// Spaces, commas, semicolons and brackets separate the numbers, the brackets opened before the last number must be closed after it.
+	/// The type name is optional. Its kind and dimensions must be the ones of genType, e.g. "vec3" or "dvec3" for a vec3 but not "vec2",
+	/// the scalar type isn't checked. Square matrices also accept "mat3" for "mat3x3".
+	/// Matrices are read column after column, quaternions as w, x, y, z like to_string.
+	///
+	/// @return On success, ptr points one past the value and its closing brackets and ec is value-initialized.
+	/// Otherwise ptr is First, ec is std::errc::invalid_argument and x is left unchanged.
+	///
+	/// @see gtx_string_cast extension.
+	template<typename genType>
+	GLM_FUNC_DECL std::from_chars_result from_chars(char const* First, char const* Last, genType& x);
+
+	/// Reads all the values of the character range [First, Last), for example a memory mapped file, and appends them to Values.
+	/// Values are separated like numbers, e.g. a line per value or a JSON array of arrays.
+	///
+	/// @return On success, ptr is Last and ec is value-initialized.
+	/// Otherwise ptr points to the first value that couldn't be read, ec is std::errc::invalid_argument and Values holds the values read before.
+	///
+	/// @see gtx_string_cast extension.
+	template<typename genType>
+	GLM_FUNC_DECL std::from_chars_result from_chars(char const* First, char const* Last, std::vector<genType>& Values);
+#endif//GLM_LANG & GLM_LANG_CXX17_FLAG
+
 	/// @}
 }//namespace glm
 
@@ -2,6 +2,8 @@
 
 #include <cstdarg>
 #include <cstdio>
+#include <cstdlib>
+#include <algorithm>
 
 namespace glm{
 namespace detail
@@ -494,4 +496,549 @@ GLM_FUNC_QUALIFIER std::string to_string(matType const& x)
 	return detail::compute_to_string<matType>::call(x);
 }
 
+#if GLM_LANG & GLM_LANG_CXX17_FLAG
+namespace detail
+{
+	// The to_chars helpers return one past the last character written, null if the range is too small or if First is null
+	GLM_FUNC_QUALIFIER char* to_chars_text(char* First, char* Last, char const* Text)
+	{
+		if(First == nullptr)
+			return nullptr;
+
+		std::size_t const Size = std::strlen(Text);
+		if(static_cast<std::size_t>(Last - First) < Size)
+			return nullptr;
+
+		std::memcpy(First, Text, Size);
+		return First + Size;
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER char* to_chars_value(char* First, char* Last, T Value)
+	{
+		if(First == nullptr)
+			return nullptr;
+
+		std::to_chars_result const Result = std::to_chars(First, Last, Value);
+		return Result.ec == std::errc() ? Result.ptr : nullptr;
+	}
+
+	GLM_FUNC_QUALIFIER char* to_chars_value(char* First, char* Last, bool Value)
+	{
+		return to_chars_text(First, Last, Value ? LabelTrue : LabelFalse);
+	}
+
+#	if !defined(__cpp_lib_to_chars)
+	// Standard libraries without floating point std::to_chars: the lowest precision reading back to the same value
+	template<typename T>
+	GLM_FUNC_QUALIFIER char* to_chars_float(char* First, char* Last, T Value)
+	{
+		char Buffer[32];
+		for(int Precision = 1; Precision <= std::numeric_limits<T>::max_digits10; ++Precision)
+		{
+			std::snprintf(Buffer, sizeof(Buffer), "%.*g", Precision, static_cast<double>(Value));
+			if(static_cast<T>(std::strtod(Buffer, nullptr)) == Value)
+				break;
+		}
+		return to_chars_text(First, Last, Buffer);
+	}
+
+	GLM_FUNC_QUALIFIER char* to_chars_value(char* First, char* Last, float Value)
+	{
+		return to_chars_float(First, Last, Value);
+	}
+
+	GLM_FUNC_QUALIFIER char* to_chars_value(char* First, char* Last, double Value)
+	{
+		return to_chars_float(First, Last, Value);
+	}
+#	endif//!defined(__cpp_lib_to_chars)
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER char* to_chars_components(char* First, char* Last, vec<L, T, Q> const& x)
+	{
+		for(length_t i = 0; i < L; ++i)
+		{
+			if(i > 0)
+				First = to_chars_text(First, Last, ", ");
+			First = to_chars_value(First, Last, x[i]);
+		}
+		return First;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER char* to_chars_components(char* First, char* Last, qua<T, Q> const& q)
+	{
+		First = to_chars_value(First, Last, q.w);
+		First = to_chars_text(First, Last, ", {");
+		First = to_chars_components(First, Last, vec<3, T, Q>(q.x, q.y, q.z));
+		return to_chars_text(First, Last, "}");
+	}
+
+	// Upper bound of the number of characters written by to_chars_value: the sign, the digits, the point and the exponent
+	template<typename T>
+	struct to_chars_size
+	{
+		static constexpr std::size_t value = std::numeric_limits<T>::is_integer
+			? static_cast<std::size_t>(std::numeric_limits<T>::digits10) + 2
+			: static_cast<std::size_t>(std::numeric_limits<T>::max_digits10) + 8;
+	};
+
+	template<>
+	struct to_chars_size<bool>
+	{
+		static constexpr std::size_t value = 5;
+	};
+
+	// The specializations declare capacity, an upper bound of the number of characters they write
+	template<typename genType>
+	struct compute_to_chars
+	{};
+
+	template<length_t L, typename T, qualifier Q>
+	struct compute_to_chars<vec<L, T, Q> >
+	{
+		// "i64vec4(" and ")", the components and their separators
+		static constexpr std::size_t capacity = 16 + L * (to_chars_size<T>::value + 2);
+
+		GLM_FUNC_QUALIFIER static char* call(char* First, char* Last, vec<L, T, Q> const& x)
+		{
+			char const Name[] = {'v', 'e', 'c', static_cast<char>('0' + L), '(', '\0'};
+
+			First = to_chars_text(First, Last, prefix<T>::value());
+			First = to_chars_text(First, Last, Name);
+			First = to_chars_components(First, Last, x);
+			return to_chars_text(First, Last, ")");
+		}
+	};
+
+	template<length_t C, length_t R, typename T, qualifier Q>
+	struct compute_to_chars<mat<C, R, T, Q> >
+	{
+		static constexpr std::size_t capacity = 16 + C * (4 + R * (to_chars_size<T>::value + 2));
+
+		GLM_FUNC_QUALIFIER static char* call(char* First, char* Last, mat<C, R, T, Q> const& x)
+		{
+			char const Name[] = {'m', 'a', 't', static_cast<char>('0' + C), 'x', static_cast<char>('0' + R), '(', '\0'};
+
+			First = to_chars_text(First, Last, prefix<T>::value());
+			First = to_chars_text(First, Last, Name);
+			for(length_t i = 0; i < C; ++i)
+			{
+				First = to_chars_text(First, Last, i > 0 ? ", (" : "(");
+				First = to_chars_components(First, Last, x[i]);
+				First = to_chars_text(First, Last, ")");
+			}
+			return to_chars_text(First, Last, ")");
+		}
+	};
+
+	template<typename T, qualifier Q>
+	struct compute_to_chars<qua<T, Q> >
+	{
+		static constexpr std::size_t capacity = 16 + 4 * (to_chars_size<T>::value + 2) + 4;
+
+		GLM_FUNC_QUALIFIER static char* call(char* First, char* Last, qua<T, Q> const& q)
+		{
+			First = to_chars_text(First, Last, prefix<T>::value());
+			First = to_chars_text(First, Last, "quat(");
+			First = to_chars_components(First, Last, q);
+			return to_chars_text(First, Last, ")");
+		}
+	};
+
+	template<typename T, qualifier Q>
+	struct compute_to_chars<tdualquat<T, Q> >
+	{
+		static constexpr std::size_t capacity = 24 + 8 * (to_chars_size<T>::value + 2) + 8;
+
+		GLM_FUNC_QUALIFIER static char* call(char* First, char* Last, tdualquat<T, Q> const& x)
+		{
+			First = to_chars_text(First, Last, prefix<T>::value());
+			First = to_chars_text(First, Last, "dualquat((");
+			First = to_chars_components(First, Last, x.real);
+			First = to_chars_text(First, Last, "), (");
+			First = to_chars_components(First, Last, x.dual);
+			return to_chars_text(First, Last, "))");
+		}
+	};
+
+	template<typename genType>
+	struct compute_from_chars;
+
+	GLM_FUNC_QUALIFIER bool from_chars_separator(char c)
+	{
+		switch(c)
+		{
+		case ' ': case '\t': case '\r': case '\n': case '\v': case '\f':
+		case ',': case ';': case '(': case ')': case '[': case ']': case '{': case '}':
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER char const* from_chars_skip(char const* First, char const* Last)
+	{
+		while(First != Last && from_chars_separator(*First))
+			++First;
+		return First;
+	}
+
+	// Skips the closing brackets of the brackets opened in [Begin, First), before the value and between its numbers, and the following spaces.
+	// Returns null if a closing bracket is missing, e.g. when the text has more numbers than the value
+	GLM_FUNC_QUALIFIER char const* from_chars_close(char const* Begin, char const* First, char const* Last)
+	{
+		int Depth = 0;
+		for(char const* It = Begin; It != First; ++It)
+		{
+			if(*It == '(' || *It == '[' || *It == '{')
+				++Depth;
+			else if(*It == ')' || *It == ']' || *It == '}')
+				--Depth;
+		}
+
+		while(First != Last && Depth > 0 && (*First == ' ' || *First == '\t' || *First == ')' || *First == ']' || *First == '}'))
+		{
+			if(*First != ' ' && *First != '\t')
+				--Depth;
+			++First;
+		}
+		while(First != Last && (*First == ' ' || *First == '\t'))
+			++First;
+		return Depth == 0 ? First : nullptr;
+	}
+
+	GLM_FUNC_QUALIFIER bool from_chars_letter(char c)
+	{
+		return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+	}
+
+	// Checks that the type name [First, Last) is Suffix after the prefix of a scalar type, e.g. "i8" in "i8vec2"
+	GLM_FUNC_QUALIFIER bool from_chars_type(char const* First, char const* Last, char const* Suffix)
+	{
+		std::size_t const Length = std::strlen(Suffix);
+		if(static_cast<std::size_t>(Last - First) < Length || std::memcmp(Last - Length, Suffix, Length) != 0)
+			return false;
+
+		char const* const End = Last - Length;
+		if(First == End)
+			return true;
+		if(*First != 'b' && *First != 'd' && *First != 'f' && *First != 'h' && *First != 'i' && *First != 'u')
+			return false;
+		for(++First; First != End; ++First)
+			if(*First < '0' || *First > '9')
+				return false;
+		return true;
+	}
+
+	// Skips a type name followed by a parenthesis like "dmat2x3(", but not "inf" or "true".
+	// Returns null if the name isn't the one of genType.
+	template<typename genType>
+	GLM_FUNC_QUALIFIER char const* from_chars_name(char const* First, char const* Last)
+	{
+		if(First == Last || !from_chars_letter(*First))
+			return First;
+
+		char const* It = First;
+		while(It != Last && (from_chars_letter(*It) || (*It >= '0' && *It <= '9') || *It == '_'))
+			++It;
+		char const* const NameEnd = It;
+		while(It != Last && (*It == ' ' || *It == '\t'))
+			++It;
+		if(It == Last || *It != '(')
+			return First;
+		return compute_from_chars<genType>::name(First, NameEnd) ? It : nullptr;
+	}
+
+	// The from_chars helpers return one past the last character read, null if the characters don't form a value or if First is null
+	template<typename T>
+	GLM_FUNC_QUALIFIER char const* from_chars_value(char const* First, char const* Last, T& Value)
+	{
+		if(First == nullptr)
+			return nullptr;
+
+		if(First != Last && *First == '+')
+			++First;
+		std::from_chars_result const Result = std::from_chars(First, Last, Value);
+		return Result.ec == std::errc() ? Result.ptr : nullptr;
+	}
+
+	GLM_FUNC_QUALIFIER char const* from_chars_value(char const* First, char const* Last, bool& Value)
+	{
+		if(First == nullptr)
+			return nullptr;
+
+		std::size_t const Size = static_cast<std::size_t>(Last - First);
+		std::size_t Length = 0;
+		if(Size >= 4 && std::memcmp(First, LabelTrue, 4) == 0)
+			Length = 4;
+		else if(Size >= 5 && std::memcmp(First, LabelFalse, 5) == 0)
+			Length = 5;
+		else if(Size >= 1 && (*First == '0' || *First == '1'))
+			Length = 1;
+		else
+			return nullptr;
+
+		Value = *First == 't' || *First == '1';
+		return First + Length;
+	}
+
+#	if !defined(__cpp_lib_to_chars)
+	// Standard libraries without floating point std::from_chars: strtod reads a null terminated copy of the number
+	template<typename T>
+	GLM_FUNC_QUALIFIER char const* from_chars_float(char const* First, char const* Last, T& Value)
+	{
+		if(First == nullptr)
+			return nullptr;
+
+		char Buffer[64];
+		std::size_t Size = 0;
+		while(First + Size != Last && Size < sizeof(Buffer) - 1 && !from_chars_separator(First[Size]))
+		{
+			Buffer[Size] = First[Size];
+			++Size;
+		}
+		Buffer[Size] = '\0';
+
+		char* End = nullptr;
+		double const Result = std::strtod(Buffer, &End);
+		if(End == Buffer)
+			return nullptr;
+
+		Value = static_cast<T>(Result);
+		return First + (End - Buffer);
+	}
+
+	GLM_FUNC_QUALIFIER char const* from_chars_value(char const* First, char const* Last, float& Value)
+	{
+		return from_chars_float(First, Last, Value);
+	}
+
+	GLM_FUNC_QUALIFIER char const* from_chars_value(char const* First, char const* Last, double& Value)
+	{
+		return from_chars_float(First, Last, Value);
+	}
+#	endif//!defined(__cpp_lib_to_chars)
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER char const* from_chars_values(char const* First, char const* Last, T* Values, length_t Count)
+	{
+		for(length_t i = 0; i < Count; ++i)
+			First = from_chars_value(First ? from_chars_skip(First, Last) : nullptr, Last, Values[i]);
+		return First;
+	}
+
+	template<typename genType>
+	struct compute_from_chars
+	{};
+
+	template<length_t L, typename T, qualifier Q>
+	struct compute_from_chars<vec<L, T, Q> >
+	{
+		GLM_FUNC_QUALIFIER static bool name(char const* First, char const* Last)
+		{
+			char const Suffix[] = {'v', 'e', 'c', static_cast<char>('0' + L), '\0'};
+			return from_chars_type(First, Last, Suffix);
+		}
+
+		GLM_FUNC_QUALIFIER static char const* call(char const* First, char const* Last, vec<L, T, Q>& x)
+		{
+			T Values[L];
+			First = from_chars_values(First, Last, Values, L);
+			if(First != nullptr)
+				for(length_t i = 0; i < L; ++i)
+					x[i] = Values[i];
+			return First;
+		}
+	};
+
+	template<length_t C, length_t R, typename T, qualifier Q>
+	struct compute_from_chars<mat<C, R, T, Q> >
+	{
+		// "mat3x3" or "mat3"
+		GLM_FUNC_QUALIFIER static bool name(char const* First, char const* Last)
+		{
+			char const Suffix[] = {'m', 'a', 't', static_cast<char>('0' + C), 'x', static_cast<char>('0' + R), '\0'};
+			char const Square[] = {'m', 'a', 't', static_cast<char>('0' + C), '\0'};
+			return from_chars_type(First, Last, Suffix) || (C == R && from_chars_type(First, Last, Square));
+		}
+
+		GLM_FUNC_QUALIFIER static char const* call(char const* First, char const* Last, mat<C, R, T, Q>& x)
+		{
+			T Values[C * R];
+			First = from_chars_values(First, Last, Values, C * R);
+			if(First != nullptr)
+				for(length_t i = 0; i < C; ++i)
+				for(length_t j = 0; j < R; ++j)
+					x[i][j] = Values[i * R + j];
+			return First;
+		}
+	};
+
+	template<typename T, qualifier Q>
+	struct compute_from_chars<qua<T, Q> >
+	{
+		GLM_FUNC_QUALIFIER static bool name(char const* First, char const* Last)
+		{
+			return from_chars_type(First, Last, "quat");
+		}
+
+		GLM_FUNC_QUALIFIER static char const* call(char const* First, char const* Last, qua<T, Q>& q)
+		{
+			T Values[4];
+			First = from_chars_values(First, Last, Values, 4);
+			if(First != nullptr)
+				q = qua<T, Q>::wxyz(Values[0], Values[1], Values[2], Values[3]);
+			return First;
+		}
+	};
+
+	template<typename T, qualifier Q>
+	struct compute_from_chars<tdualquat<T, Q> >
+	{
+		GLM_FUNC_QUALIFIER static bool name(char const* First, char const* Last)
+		{
+			return from_chars_type(First, Last, "dualquat");
+		}
+
+		GLM_FUNC_QUALIFIER static char const* call(char const* First, char const* Last, tdualquat<T, Q>& x)
+		{
+			T Values[8];
+			First = from_chars_values(First, Last, Values, 8);
+			if(First != nullptr)
+			{
+				x.real = qua<T, Q>::wxyz(Values[0], Values[1], Values[2], Values[3]);
+				x.dual = qua<T, Q>::wxyz(Values[4], Values[5], Values[6], Values[7]);
+			}
+			return First;
+		}
+	};
+
+	// Base of the std::format and fmt formatters, only the empty format specification "{}" is accepted.
+	// errorType is the format_error of the formatting library.
+	template<typename errorType>
+	struct to_chars_formatter
+	{
+		template<typename parseContext>
+		constexpr typename parseContext::iterator parse(parseContext& Context)
+		{
+			typename parseContext::iterator const It = Context.begin();
+			if(It != Context.end() && *It != '}')
+				throw errorType("GLM: format specifications are not supported by GLM types, use \"{}\"");
+			return It;
+		}
+
+		template<typename genType, typename formatContext>
+		typename formatContext::iterator format(genType const& x, formatContext& Context) const
+		{
+			char Buffer[compute_to_chars<genType>::capacity];
+			char* const End = compute_to_chars<genType>::call(Buffer, Buffer + sizeof(Buffer), x);
+			assert(End != nullptr);
+			return std::copy(Buffer, End, Context.out());
+		}
+	};
+}//namespace detail
+
+template<typename genType>
+GLM_FUNC_QUALIFIER std::to_chars_result to_chars(char* First, char* Last, genType const& x)
+{
+	char* const End = detail::compute_to_chars<genType>::call(First, Last, x);
+
+	std::to_chars_result Result;
+	Result.ptr = End != nullptr ? End : Last;
+	Result.ec = End != nullptr ? std::errc() : std::errc::value_too_large;
+	return Result;
+}
+
+template<typename genType>
+GLM_FUNC_QUALIFIER std::from_chars_result from_chars(char const* First, char const* Last, genType& x)
+{
+	genType Value;
+	char const* const Begin = detail::from_chars_name<genType>(detail::from_chars_skip(First, Last), Last);
+	char const* const End = detail::compute_from_chars<genType>::call(Begin, Last, Value);
+	char const* const Close = End != nullptr ? detail::from_chars_close(First, End, Last) : nullptr;
+	if(Close != nullptr)
+		x = Value;
+
+	std::from_chars_result Result;
+	Result.ptr = Close != nullptr ? Close : First;
+	Result.ec = Close != nullptr ? std::errc() : std::errc::invalid_argument;
+	return Result;
+}
+
+template<typename genType>
+GLM_FUNC_QUALIFIER std::from_chars_result from_chars(char const* First, char const* Last, std::vector<genType>& Values)
+{
+	for(;;)
+	{
+		First = detail::from_chars_skip(First, Last);
+		if(First == Last)
+			break;
+
+		genType Value;
+		std::from_chars_result const Result = from_chars(First, Last, Value);
+		if(Result.ec != std::errc())
+			return Result;
+
+		Values.push_back(Value);
+		First = Result.ptr;
+	}
+
+	std::from_chars_result Result;
+	Result.ptr = Last;
+	Result.ec = std::errc();
+	return Result;
+}
+#endif//GLM_LANG & GLM_LANG_CXX17_FLAG
+
 }//namespace glm
+
+#if (GLM_LANG & GLM_LANG_CXX20_FLAG) && defined(__has_include)
+#	if __has_include(<format>)
+#		include <format>
+#	endif
+#endif
+
+#if defined(__cpp_lib_format)
+namespace std
+{
+	template<glm::length_t L, typename T, glm::qualifier Q>
+	struct formatter<glm::vec<L, T, Q> > : public glm::detail::to_chars_formatter<std::format_error>
+	{};
+
+	template<glm::length_t C, glm::length_t R, typename T, glm::qualifier Q>
+	struct formatter<glm::mat<C, R, T, Q> > : public glm::detail::to_chars_formatter<std::format_error>
+	{};
+
+	template<typename T, glm::qualifier Q>
+	struct formatter<glm::qua<T, Q> > : public glm::detail::to_chars_formatter<std::format_error>
+	{};
+
+	template<typename T, glm::qualifier Q>
+	struct formatter<glm::tdualquat<T, Q> > : public glm::detail::to_chars_formatter<std::format_error>
+	{};
+}//namespace std
+#endif//defined(__cpp_lib_format)
+
+// The fmt formatters are declared when fmt is included before GLM
+#if (GLM_LANG & GLM_LANG_CXX17_FLAG) && defined(FMT_VERSION)
+namespace fmt
+{
+	template<glm::length_t L, typename T, glm::qualifier Q>
+	struct formatter<glm::vec<L, T, Q> > : public glm::detail::to_chars_formatter<fmt::format_error>
+	{};
+
+	template<glm::length_t C, glm::length_t R, typename T, glm::qualifier Q>
+	struct formatter<glm::mat<C, R, T, Q> > : public glm::detail::to_chars_formatter<fmt::format_error>
+	{};
+
+	template<typename T, glm::qualifier Q>
+	struct formatter<glm::qua<T, Q> > : public glm::detail::to_chars_formatter<fmt::format_error>
+	{};
+
+	template<typename T, glm::qualifier Q>
+	struct formatter<glm::tdualquat<T, Q> > : public glm::detail::to_chars_formatter<fmt::format_error>
+	{};
+}//namespace fmt
+#endif//(GLM_LANG & GLM_LANG_CXX17_FLAG) && defined(FMT_VERSION)
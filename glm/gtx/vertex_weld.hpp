@@ -0,0 +1,97 @@
+/// @ref gtx_vertex_weld
+/// @file glm/gtx/vertex_weld.hpp
+///
+/// @see core (dependence)
+/// @see gtx_hash (dependence)
+///
+/// @defgroup gtx_vertex_weld GLM_GTX_vertex_weld
+/// @ingroup gtx
+///
+/// Include <glm/gtx/vertex_weld.hpp> to use the features of this extension.
+///
+/// Vertex welding: merge vertices whose positions, and optionally attributes, are within an epsilon.
+/// Positions are quantized into grid cells of twice epsilon and stored in open addressing tables,
+/// each vertex only probes the neighbour cells on the side it is closest to.
+/// The multithreaded overloads use std::thread: link the program with the threads library, e.g. Threads::Threads with CMake.
+/// It is not included by <glm/ext.hpp> so that including all the extensions does not include <thread>.
+///
+/// Example:
+/// ```
+/// std::vector<glm::uint32> remap(positions.size());
+/// std::vector<glm::vec3> unique(positions.size());
+/// std::size_t uniqueCount = glm::weldVertices(positions.data(), positions.size(), 0.0001f, remap.data(), unique.data());
+/// unique.resize(uniqueCount);
+///
+/// // Apply the same welding to another vertex attribute
+/// std::vector<glm::vec2> uniqueTexcoords(uniqueCount);
+/// glm::remapVertices(texcoords.data(), texcoords.size(), remap.data(), uniqueTexcoords.data());
+/// ```
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/hash.hpp"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_vertex_weld is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_vertex_weld extension included")
+#endif
+
+#if GLM_LANG & GLM_LANG_CXX11
+
+#include <cstddef>
+
+namespace glm
+{
+	/// @addtogroup gtx_vertex_weld
+	/// @{
+
+	/// Welds Count positions: each vertex is mapped to a unique vertex whose position is within Epsilon on every component.
+	/// An Epsilon of zero only merges equal positions.
+	/// Unique vertices are numbered by order of first occurrence in Remap.
+	///
+	/// @param Positions Points to Count positions
+	/// @param Count Number of vertices, lower than 2^32 - 1
+	/// @param Epsilon Largest per component distance between merged positions, Positions / (2 * Epsilon) must fit an int
+	/// @param Remap Receives for each vertex the index of its unique vertex
+	/// @param UniquePositions Receives the unique positions, can hold up to Count positions, may be null
+	/// @return The number of unique vertices
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t weldVertices(
+		vec<L, T, Q> const* Positions, std::size_t Count, T Epsilon,
+		uint32* Remap, vec<L, T, Q>* UniquePositions);
+
+	/// Welds Count positions using up to Threads threads.
+	/// Space is split in slabs along X processed concurrently, vertices close to a slab boundary are welded afterward.
+	/// The result is deterministic for a given number of threads, but it may differ from the single threaded one
+	/// when several unique vertices are within Epsilon of a vertex.
+	/// @see weldVertices
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t weldVertices(
+		vec<L, T, Q> const* Positions, std::size_t Count, T Epsilon,
+		uint32* Remap, vec<L, T, Q>* UniquePositions, unsigned int Threads);
+
+	/// Welds Count vertices whose positions are within Epsilon and whose attributes, e.g. normals, are within AttributeEpsilon.
+	/// UniqueAttributes receives the attributes of the unique vertices and may be null.
+	/// The position and the attribute of a unique vertex come from the same vertex, every vertex welded to it is within both epsilons of it.
+	/// @see weldVertices
+	template<length_t L, typename T, qualifier Q, length_t LA, typename TA, qualifier QA>
+	GLM_FUNC_DECL std::size_t weldVertices(
+		vec<L, T, Q> const* Positions, vec<LA, TA, QA> const* Attributes, std::size_t Count, T Epsilon, TA AttributeEpsilon,
+		uint32* Remap, vec<L, T, Q>* UniquePositions, vec<LA, TA, QA>* UniqueAttributes, unsigned int Threads);
+
+	/// Gathers a vertex attribute of the unique vertices using the Remap table of weldVertices.
+	/// The attribute of a unique vertex is the one of its first occurrence.
+	/// It is also the vertex providing the unique position when welding with one thread,
+	/// with several threads it may be another vertex within Epsilon: weld the attributes with weldVertices instead to keep them consistent.
+	template<typename genType>
+	GLM_FUNC_DISCARD_DECL void remapVertices(genType const* In, std::size_t Count, uint32 const* Remap, genType* Out);
+
+	/// @}
+}//namespace glm
+
+#include "vertex_weld.inl"
+
+#endif//GLM_LANG & GLM_LANG_CXX11
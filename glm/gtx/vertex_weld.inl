@@ -0,0 +1,343 @@
+/// @ref gtx_vertex_weld
+
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR uint32 weld_empty()
+	{
+		return 0xFFFFFFFFu;
+	}
+
+	struct weld_match_none
+	{
+		GLM_FUNC_QUALIFIER bool operator()(std::size_t, std::size_t) const
+		{
+			return true;
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q>
+	struct weld_match_attribute
+	{
+		vec<L, T, Q> const* Attributes;
+		T Epsilon;
+
+		GLM_FUNC_QUALIFIER bool operator()(std::size_t a, std::size_t b) const
+		{
+			return all(lessThanEqual(abs(Attributes[a] - Attributes[b]), vec<L, T, Q>(Epsilon)));
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, typename matchType>
+	class weld_vertices
+	{
+		struct slot
+		{
+			uint32 Vertex;
+			uint32 Tag;
+		};
+
+		// Open addressing table with linear probing, storing the first vertex of each unique vertex
+		struct table
+		{
+			std::vector<slot> Slots;
+			std::size_t Mask;
+			std::size_t Count;
+		};
+
+	public:
+		weld_vertices(vec<L, T, Q> const* positions, std::size_t count, T epsilon, matchType const& match, unsigned int threads)
+			: Positions(positions)
+			, Count(count)
+			, Epsilon(epsilon)
+			, CellSize(epsilon * static_cast<T>(2))
+			, Exact(!(epsilon > static_cast<T>(0)))
+			, Match(match)
+			, Partitions(std::max(threads, 1u))
+			, CellBegin(0)
+			, CellRange(1)
+		{
+			if(!Exact && Partitions > 1 && Count > 0)
+			{
+				int CellMin = spatialCell(Positions[0], CellSize).x;
+				int CellMax = CellMin;
+				for(std::size_t i = 1; i < Count; ++i)
+				{
+					int const x = spatialCell(Positions[i], CellSize).x;
+					CellMin = std::min(CellMin, x);
+					CellMax = std::max(CellMax, x);
+				}
+				CellBegin = CellMin;
+				CellRange = static_cast<int64>(CellMax) - static_cast<int64>(CellMin) + 1;
+				if(static_cast<int64>(Partitions) > CellRange)
+					Partitions = static_cast<unsigned int>(CellRange);
+			}
+
+			Tables.resize(Partitions);
+			for(unsigned int p = 0; p < Partitions; ++p)
+				resize(Tables[p], Count / Partitions / 4 + 1);
+		}
+
+		std::size_t operator()(uint32* Remap, vec<L, T, Q>* UniquePositions)
+		{
+			if(Partitions > 1)
+				bucket();
+
+			std::vector<std::thread> Workers;
+			for(unsigned int p = 1; p < Partitions; ++p)
+				Workers.push_back(std::thread(&weld_vertices::weldPartition, this, p, Remap));
+			weldPartition(0, Remap);
+			for(std::size_t i = 0; i < Workers.size(); ++i)
+				Workers[i].join();
+
+			// Vertices that may match unique vertices of another partition, processed sequentially in input order
+			for(std::size_t i = 0; i < Deferred.size(); ++i)
+				Remap[Deferred[i]] = weldVertex(Deferred[i]);
+
+			// Number the unique vertices by order of first occurrence.
+			// Their position is the one of the representative every vertex was compared to, which may be a later vertex with several partitions.
+			std::vector<uint32> Unique(Count, weld_empty());
+			Representatives.clear();
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				uint32 const Vertex = Remap[i];
+				if(Unique[Vertex] == weld_empty())
+				{
+					if(UniquePositions)
+						UniquePositions[Representatives.size()] = Positions[Vertex];
+					Unique[Vertex] = static_cast<uint32>(Representatives.size());
+					Representatives.push_back(Vertex);
+				}
+				Remap[i] = Unique[Vertex];
+			}
+			return Representatives.size();
+		}
+
+		// Index of the vertex providing the position of a unique vertex
+		uint32 representative(std::size_t UniqueVertex) const
+		{
+			return Representatives[UniqueVertex];
+		}
+
+	private:
+		static uint32 tag(std::size_t Hash)
+		{
+			return static_cast<uint32>(Hash >> (sizeof(std::size_t) * 4));
+		}
+
+		std::size_t hash(std::size_t i, vec<L, int, Q> const& Cell) const
+		{
+			return Exact ? hashValue(Positions[i]) : spatialHash(Cell);
+		}
+
+		unsigned int partition(std::size_t Hash, vec<L, int, Q> const& Cell) const
+		{
+			if(Exact)
+				return static_cast<unsigned int>(tag(Hash) % Partitions);
+
+			int64 const p = (static_cast<int64>(Cell.x) - CellBegin) * Partitions / CellRange;
+			return static_cast<unsigned int>(glm::clamp<int64>(p, 0, Partitions - 1));
+		}
+
+		static void resize(table& Table, std::size_t Capacity)
+		{
+			std::size_t Size = 16;
+			while(Size < Capacity * 2)
+				Size <<= 1;
+
+			slot const Empty = {weld_empty(), 0};
+			std::vector<slot> Slots(Size, Empty);
+			std::swap(Slots, Table.Slots);
+			Table.Mask = Size - 1;
+			Table.Count = 0;
+
+			for(std::size_t i = 0; i < Slots.size(); ++i)
+				if(Slots[i].Vertex != weld_empty())
+					insert(Table, Slots[i]);
+		}
+
+		static void insert(table& Table, slot const& Slot)
+		{
+			std::size_t s = Slot.Tag & Table.Mask;
+			while(Table.Slots[s].Vertex != weld_empty())
+				s = (s + 1) & Table.Mask;
+			Table.Slots[s] = Slot;
+			++Table.Count;
+		}
+
+		void insert(unsigned int Partition, std::size_t i, std::size_t Hash)
+		{
+			table& Table = Tables[Partition];
+			if((Table.Count + 1) * 2 > Table.Slots.size())
+				resize(Table, Table.Slots.size());
+
+			slot const Slot = {static_cast<uint32>(i), static_cast<uint32>(mix(Hash))};
+			insert(Table, Slot);
+		}
+
+		// Slots are addressed and tagged with a 32 bits key folding both halves of the hash, so the table can be rebuilt without rehashing positions
+		static std::size_t mix(std::size_t Hash)
+		{
+			return static_cast<uint32>(Hash) ^ tag(Hash);
+		}
+
+		bool close(std::size_t a, std::size_t b) const
+		{
+			return all(lessThanEqual(abs(Positions[a] - Positions[b]), vec<L, T, Q>(Epsilon))) && Match(a, b);
+		}
+
+		// Returns the first vertex of a unique vertex matching i, weld_empty() if none
+		uint32 find(std::size_t i, vec<L, int, Q> const& Cell, std::size_t Hash) const
+		{
+			table const& Table = Tables[partition(Hash, Cell)];
+			uint32 const Key = static_cast<uint32>(mix(Hash));
+
+			for(std::size_t s = Key & Table.Mask; Table.Slots[s].Vertex != weld_empty(); s = (s + 1) & Table.Mask)
+				if(Table.Slots[s].Tag == Key && close(Table.Slots[s].Vertex, i))
+					return Table.Slots[s].Vertex;
+			return weld_empty();
+		}
+
+		// Cells of twice epsilon: a position within epsilon is either in the same cell or in the neighbour cell on the closest side, per axis
+		vec<L, int, Q> side(std::size_t i, vec<L, int, Q> const& Cell) const
+		{
+			vec<L, int, Q> Result;
+			for(length_t d = 0; d < L; ++d)
+				Result[d] = Positions[i][d] - static_cast<T>(Cell[d]) * CellSize < Epsilon ? -1 : 1;
+			return Result;
+		}
+
+		uint32 findNeighbours(std::size_t i, vec<L, int, Q> const& Cell) const
+		{
+			if(Exact)
+				return find(i, Cell, hash(i, Cell));
+
+			// The own cell first, it holds the match of most duplicates
+			vec<L, int, Q> const Side = side(i, Cell);
+			for(int Mask = 0; Mask < (1 << L); ++Mask)
+			{
+				vec<L, int, Q> Neighbour(Cell);
+				for(length_t d = 0; d < L; ++d)
+					if(Mask & (1 << d))
+						Neighbour[d] += Side[d];
+
+				uint32 const Vertex = find(i, Neighbour, spatialHash(Neighbour));
+				if(Vertex != weld_empty())
+					return Vertex;
+			}
+			return weld_empty();
+		}
+
+		uint32 weldVertex(std::size_t i)
+		{
+			vec<L, int, Q> const Cell = Exact ? vec<L, int, Q>(0) : spatialCell(Positions[i], CellSize);
+			uint32 const Vertex = findNeighbours(i, Cell);
+			if(Vertex != weld_empty())
+				return Vertex;
+
+			std::size_t const Hash = hash(i, Cell);
+			insert(partition(Hash, Cell), i, Hash);
+			return static_cast<uint32>(i);
+		}
+
+		// Splits the vertices between the partitions in a single pass, each thread then only walks its own vertices
+		void bucket()
+		{
+			Buckets.resize(Partitions);
+			for(unsigned int p = 0; p < Partitions; ++p)
+				Buckets[p].reserve(Count / Partitions + 1);
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				vec<L, int, Q> const Cell = Exact ? vec<L, int, Q>(0) : spatialCell(Positions[i], CellSize);
+				unsigned int const Partition = partition(Exact ? hashValue(Positions[i]) : std::size_t(0), Cell);
+
+				if(!Exact)
+				{
+					vec<L, int, Q> Neighbour(Cell);
+					Neighbour.x += side(i, Cell).x;
+					if(partition(0, Neighbour) != Partition)
+					{
+						Deferred.push_back(i);
+						continue;
+					}
+				}
+
+				Buckets[Partition].push_back(static_cast<uint32>(i));
+			}
+		}
+
+		void weldPartition(unsigned int Partition, uint32* Remap)
+		{
+			if(Partitions == 1)
+			{
+				for(std::size_t i = 0; i < Count; ++i)
+					Remap[i] = weldVertex(i);
+				return;
+			}
+
+			std::vector<uint32> const& Bucket = Buckets[Partition];
+			for(std::size_t i = 0; i < Bucket.size(); ++i)
+				Remap[Bucket[i]] = weldVertex(Bucket[i]);
+		}
+
+		vec<L, T, Q> const* Positions;
+		std::size_t Count;
+		T Epsilon;
+		T CellSize;
+		bool Exact;
+		matchType Match;
+		unsigned int Partitions;
+		int64 CellBegin;
+		int64 CellRange;
+		std::vector<table> Tables;
+		std::vector<std::vector<uint32> > Buckets;
+		std::vector<std::size_t> Deferred;
+		std::vector<uint32> Representatives;
+	};
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t weldVertices(vec<L, T, Q> const* Positions, std::size_t Count, T Epsilon, uint32* Remap, vec<L, T, Q>* UniquePositions)
+	{
+		return weldVertices(Positions, Count, Epsilon, Remap, UniquePositions, 1u);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t weldVertices(vec<L, T, Q> const* Positions, std::size_t Count, T Epsilon, uint32* Remap, vec<L, T, Q>* UniquePositions, unsigned int Threads)
+	{
+		detail::weld_vertices<L, T, Q, detail::weld_match_none> Weld(Positions, Count, Epsilon, detail::weld_match_none(), Threads);
+		return Weld(Remap, UniquePositions);
+	}
+
+	template<length_t L, typename T, qualifier Q, length_t LA, typename TA, qualifier QA>
+	GLM_FUNC_QUALIFIER std::size_t weldVertices(
+		vec<L, T, Q> const* Positions, vec<LA, TA, QA> const* Attributes, std::size_t Count, T Epsilon, TA AttributeEpsilon,
+		uint32* Remap, vec<L, T, Q>* UniquePositions, vec<LA, TA, QA>* UniqueAttributes, unsigned int Threads)
+	{
+		detail::weld_match_attribute<LA, TA, QA> const Match = {Attributes, AttributeEpsilon};
+		detail::weld_vertices<L, T, Q, detail::weld_match_attribute<LA, TA, QA> > Weld(Positions, Count, Epsilon, Match, Threads);
+		std::size_t const UniqueCount = Weld(Remap, UniquePositions);
+		if(UniqueAttributes)
+		{
+			// From the same vertex as the unique position
+			for(std::size_t i = 0; i < UniqueCount; ++i)
+				UniqueAttributes[i] = Attributes[Weld.representative(i)];
+		}
+		return UniqueCount;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER void remapVertices(genType const* In, std::size_t Count, uint32 const* Remap, genType* Out)
+	{
+		// Unique vertices are numbered by order of first occurrence
+		uint32 Next = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+			if(Remap[i] == Next)
+				Out[Next++] = In[i];
+	}
+}//namespace glm
@@ -17,4 +17,66 @@ GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sqrt_lowp(glm_f32vec4 x)
 	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
 }
 
+// One Newton-Raphson step refines the 12 bits estimate of rsqrtps: 0.5 * e * (3 - x * e * e)
+// For 0 and +inf, x * e * e is the NaN of 0 * inf and the estimate, inf and 0, is kept
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_fast_inversesqrt(glm_f32vec4 x)
+{
+	glm_f32vec4 const est0 = _mm_rsqrt_ps(x);
+	glm_f32vec4 const mul0 = _mm_mul_ps(_mm_mul_ps(x, est0), est0);
+	glm_f32vec4 const sub0 = _mm_sub_ps(_mm_set1_ps(3.0f), mul0);
+	glm_f32vec4 const new0 = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), est0), sub0);
+	glm_f32vec4 const nan0 = _mm_cmpunord_ps(mul0, mul0);
+	return _mm_or_ps(_mm_and_ps(nan0, est0), _mm_andnot_ps(nan0, new0));
+}
+
+// x * inversesqrt(x), with x itself for 0 and +inf instead of the NaN of 0 * inf
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_fast_sqrt(glm_f32vec4 x)
+{
+	glm_f32vec4 const mul0 = _mm_mul_ps(x, glm_vec4_fast_inversesqrt(x));
+	glm_f32vec4 const spc0 = _mm_or_ps(_mm_cmpeq_ps(x, _mm_setzero_ps()), _mm_cmpeq_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7F800000))));
+	return _mm_or_ps(_mm_and_ps(spc0, x), _mm_andnot_ps(spc0, mul0));
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_vec8_fast_inversesqrt(glm_f32vec8 x)
+{
+	glm_f32vec8 const est0 = _mm256_rsqrt_ps(x);
+	glm_f32vec8 const mul0 = _mm256_mul_ps(_mm256_mul_ps(x, est0), est0);
+	glm_f32vec8 const sub0 = _mm256_sub_ps(_mm256_set1_ps(3.0f), mul0);
+	glm_f32vec8 const new0 = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), est0), sub0);
+	return _mm256_blendv_ps(new0, est0, _mm256_cmp_ps(mul0, mul0, _CMP_UNORD_Q));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_vec8_fast_sqrt(glm_f32vec8 x)
+{
+	glm_f32vec8 const mul0 = _mm256_mul_ps(x, glm_vec8_fast_inversesqrt(x));
+	glm_f32vec8 const spc0 = _mm256_or_ps(_mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_EQ_OQ), _mm256_cmp_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x7F800000)), _CMP_EQ_OQ));
+	return _mm256_blendv_ps(mul0, x, spc0);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#if GLM_ARCH & GLM_ARCH_NEON_BIT
+
+// The estimate of vrsqrteq_f32 has 8 bits, two steps of vrsqrtsq_f32 give the accuracy of the SSE version
+// For 0 and +inf, x * e is the NaN of 0 * inf and the estimate, inf and 0, is kept
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_fast_inversesqrt(glm_f32vec4 x)
+{
+	float32x4_t const est0 = vrsqrteq_f32(x);
+	float32x4_t new0 = vmulq_f32(est0, vrsqrtsq_f32(vmulq_f32(x, est0), est0));
+	new0 = vmulq_f32(new0, vrsqrtsq_f32(vmulq_f32(x, new0), new0));
+	return vbslq_f32(vceqq_f32(new0, new0), new0, est0);
+}
+
+// x * inversesqrt(x), with x itself for 0 and +inf instead of the NaN of 0 * inf
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_fast_sqrt(glm_f32vec4 x)
+{
+	float32x4_t const mul0 = vmulq_f32(x, glm_vec4_fast_inversesqrt(x));
+	uint32x4_t const spc0 = vorrq_u32(vceqq_f32(x, vdupq_n_f32(0.0f)), vceqq_f32(x, vreinterpretq_f32_u32(vdupq_n_u32(0x7F800000))));
+	return vbslq_f32(spc0, x, mul0);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_NEON_BIT
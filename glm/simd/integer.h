@@ -3,6 +3,152 @@
 
 #pragma once
 
+// PDEP and PEXT are only used when the compiler targets BMI2, e.g. -mbmi2 or -march=haswell.
+// They are microcoded and slow on AMD processors before Zen 3, define GLM_FORCE_NO_BMI2 to use the shift and mask code instead.
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && defined(__BMI2__) && (defined(__x86_64__) || defined(_M_X64)) && !defined(GLM_FORCE_NO_BMI2)
+#	define GLM_HAS_BMI2 1
+#else
+#	define GLM_HAS_BMI2 0
+#endif
+
+// The spreading kernels are shared with the runtime dispatched batch kernels of GLM_GTC_bitfield.
+// With GLM_FORCE_CPU_DISPATCH, those GLM_ARCH doesn't include are compiled for their dispatch tier.
+#if GLM_CONFIG_CPU_DISPATCH == GLM_ENABLE
+#	include "../ext/cpu_dispatch.hpp"
+#endif
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	define GLM_SIMD_SPREAD_SSE2
+#elif GLM_CONFIG_CPU_DISPATCH == GLM_ENABLE
+#	define GLM_SIMD_SPREAD_SSE2 GLM_DISPATCH_SSE2
+#endif
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+#	define GLM_SIMD_SPREAD_AVX2
+#elif GLM_CONFIG_CPU_DISPATCH == GLM_ENABLE
+#	define GLM_SIMD_SPREAD_AVX2 GLM_DISPATCH_AVX2
+#endif
+
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && defined(__AVX512F__)
+#	define GLM_SIMD_SPREAD_AVX512
+#elif GLM_CONFIG_CPU_DISPATCH == GLM_ENABLE
+#	define GLM_SIMD_SPREAD_AVX512 GLM_DISPATCH_AVX512
+#endif
+
+#if defined(GLM_SIMD_SPREAD_SSE2)
+
+// Spreads the 32 low bits of each 64 bits lane of x, one zero bit between each bit
+GLM_SIMD_SPREAD_SSE2 GLM_FUNC_QUALIFIER __m128i glm_i128_spread2(__m128i x)
+{
+	__m128i Reg = x;
+	Reg = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(Reg, 16), Reg), _mm_set1_epi64x(0x0000FFFF0000FFFFll));
+	Reg = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(Reg,  8), Reg), _mm_set1_epi64x(0x00FF00FF00FF00FFll));
+	Reg = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(Reg,  4), Reg), _mm_set1_epi64x(0x0F0F0F0F0F0F0F0Fll));
+	Reg = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(Reg,  2), Reg), _mm_set1_epi64x(0x3333333333333333ll));
+	Reg = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(Reg,  1), Reg), _mm_set1_epi64x(0x5555555555555555ll));
+
+	return Reg;
+}
+
+// Spreads the 21 low bits of each 64 bits lane of x, two zero bits between each bit
+GLM_SIMD_SPREAD_SSE2 GLM_FUNC_QUALIFIER __m128i glm_i128_spread3(__m128i x)
+{
+	__m128i const Mask5 = _mm_set1_epi64x(0x00000000001FFFFFll);
+	__m128i const Mask4 = _mm_set1_epi64x(static_cast<long long>(0xFFFF00000000FFFFull));
+	__m128i const Mask3 = _mm_set1_epi64x(0x00FF0000FF0000FFll);
+	__m128i const Mask2 = _mm_set1_epi64x(static_cast<long long>(0xF00F00F00F00F00Full));
+	__m128i const Mask1 = _mm_set1_epi64x(0x30C30C30C30C30C3ll);
+	__m128i const Mask0 = _mm_set1_epi64x(static_cast<long long>(0x9249249249249249ull));
+
+	__m128i Reg = _mm_and_si128(x, Mask5);
+	Reg = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(Reg, 32), Reg), Mask4);
+	Reg = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(Reg, 16), Reg), Mask3);
+	Reg = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(Reg,  8), Reg), Mask2);
+	Reg = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(Reg,  4), Reg), Mask1);
+	Reg = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(Reg,  2), Reg), Mask0);
+
+	return Reg;
+}
+
+#endif//defined(GLM_SIMD_SPREAD_SSE2)
+
+#if defined(GLM_SIMD_SPREAD_AVX2)
+
+// Spreads the 32 low bits of each 64 bits lane of x, one zero bit between each bit
+GLM_SIMD_SPREAD_AVX2 GLM_FUNC_QUALIFIER __m256i glm_i256_spread2(__m256i x)
+{
+	__m256i Reg = x;
+	Reg = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(Reg, 16), Reg), _mm256_set1_epi64x(0x0000FFFF0000FFFFll));
+	Reg = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(Reg,  8), Reg), _mm256_set1_epi64x(0x00FF00FF00FF00FFll));
+	Reg = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(Reg,  4), Reg), _mm256_set1_epi64x(0x0F0F0F0F0F0F0F0Fll));
+	Reg = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(Reg,  2), Reg), _mm256_set1_epi64x(0x3333333333333333ll));
+	Reg = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(Reg,  1), Reg), _mm256_set1_epi64x(0x5555555555555555ll));
+
+	return Reg;
+}
+
+// Spreads the 21 low bits of each 64 bits lane of x, two zero bits between each bit
+GLM_SIMD_SPREAD_AVX2 GLM_FUNC_QUALIFIER __m256i glm_i256_spread3(__m256i x)
+{
+	__m256i const Mask5 = _mm256_set1_epi64x(0x00000000001FFFFFll);
+	__m256i const Mask4 = _mm256_set1_epi64x(static_cast<long long>(0xFFFF00000000FFFFull));
+	__m256i const Mask3 = _mm256_set1_epi64x(0x00FF0000FF0000FFll);
+	__m256i const Mask2 = _mm256_set1_epi64x(static_cast<long long>(0xF00F00F00F00F00Full));
+	__m256i const Mask1 = _mm256_set1_epi64x(0x30C30C30C30C30C3ll);
+	__m256i const Mask0 = _mm256_set1_epi64x(static_cast<long long>(0x9249249249249249ull));
+
+	__m256i Reg = _mm256_and_si256(x, Mask5);
+	Reg = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(Reg, 32), Reg), Mask4);
+	Reg = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(Reg, 16), Reg), Mask3);
+	Reg = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(Reg,  8), Reg), Mask2);
+	Reg = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(Reg,  4), Reg), Mask1);
+	Reg = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(Reg,  2), Reg), Mask0);
+
+	return Reg;
+}
+
+#endif//defined(GLM_SIMD_SPREAD_AVX2)
+
+#if defined(GLM_SIMD_SPREAD_AVX512)
+
+// The unmasked AVX-512 shifts pass an undefined source to their builtin, reported as uninitialized by GCC 12.
+// The zero masking forms with a full mask generate the same instructions.
+
+// Spreads the 32 low bits of each 64 bits lane of x, one zero bit between each bit
+GLM_SIMD_SPREAD_AVX512 GLM_FUNC_QUALIFIER __m512i glm_i512_spread2(__m512i x)
+{
+	__m512i Reg = x;
+	Reg = _mm512_and_si512(_mm512_or_si512(_mm512_maskz_slli_epi64(0xFF, Reg, 16), Reg), _mm512_set1_epi64(0x0000FFFF0000FFFFll));
+	Reg = _mm512_and_si512(_mm512_or_si512(_mm512_maskz_slli_epi64(0xFF, Reg,  8), Reg), _mm512_set1_epi64(0x00FF00FF00FF00FFll));
+	Reg = _mm512_and_si512(_mm512_or_si512(_mm512_maskz_slli_epi64(0xFF, Reg,  4), Reg), _mm512_set1_epi64(0x0F0F0F0F0F0F0F0Fll));
+	Reg = _mm512_and_si512(_mm512_or_si512(_mm512_maskz_slli_epi64(0xFF, Reg,  2), Reg), _mm512_set1_epi64(0x3333333333333333ll));
+	Reg = _mm512_and_si512(_mm512_or_si512(_mm512_maskz_slli_epi64(0xFF, Reg,  1), Reg), _mm512_set1_epi64(0x5555555555555555ll));
+
+	return Reg;
+}
+
+// Spreads the 21 low bits of each 64 bits lane of x, two zero bits between each bit
+GLM_SIMD_SPREAD_AVX512 GLM_FUNC_QUALIFIER __m512i glm_i512_spread3(__m512i x)
+{
+	__m512i const Mask5 = _mm512_set1_epi64(0x00000000001FFFFFll);
+	__m512i const Mask4 = _mm512_set1_epi64(static_cast<long long>(0xFFFF00000000FFFFull));
+	__m512i const Mask3 = _mm512_set1_epi64(0x00FF0000FF0000FFll);
+	__m512i const Mask2 = _mm512_set1_epi64(static_cast<long long>(0xF00F00F00F00F00Full));
+	__m512i const Mask1 = _mm512_set1_epi64(0x30C30C30C30C30C3ll);
+	__m512i const Mask0 = _mm512_set1_epi64(static_cast<long long>(0x9249249249249249ull));
+
+	__m512i Reg = _mm512_and_si512(x, Mask5);
+	Reg = _mm512_and_si512(_mm512_or_si512(_mm512_maskz_slli_epi64(0xFF, Reg, 32), Reg), Mask4);
+	Reg = _mm512_and_si512(_mm512_or_si512(_mm512_maskz_slli_epi64(0xFF, Reg, 16), Reg), Mask3);
+	Reg = _mm512_and_si512(_mm512_or_si512(_mm512_maskz_slli_epi64(0xFF, Reg,  8), Reg), Mask2);
+	Reg = _mm512_and_si512(_mm512_or_si512(_mm512_maskz_slli_epi64(0xFF, Reg,  4), Reg), Mask1);
+	Reg = _mm512_and_si512(_mm512_or_si512(_mm512_maskz_slli_epi64(0xFF, Reg,  2), Reg), Mask0);
+
+	return Reg;
+}
+
+#endif//defined(GLM_SIMD_SPREAD_AVX512)
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
 GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_interleave(glm_uvec4 x)
@@ -112,4 +258,119 @@ GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_interleave2(glm_uvec4 x, glm_uvec4 y)
 	return Reg1;
 }
 
+// Returns the position of the most significant bit set of each lane, -1 for zero.
+// Values below 2^24 convert exactly to float, whose exponent is then the position of the most significant bit.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_i128_findMSB(glm_uvec4 x)
+{
+	glm_ivec4 const High = _mm_srli_epi32(x, 8);
+	glm_ivec4 const IsHigh = _mm_cmpgt_epi32(High, _mm_setzero_si128());
+	glm_ivec4 const Value = _mm_or_si128(_mm_and_si128(IsHigh, High), _mm_andnot_si128(IsHigh, x));
+	glm_ivec4 const Exponent = _mm_srli_epi32(_mm_castps_si128(_mm_cvtepi32_ps(Value)), 23);
+	glm_ivec4 const Result = _mm_add_epi32(_mm_sub_epi32(Exponent, _mm_set1_epi32(127)), _mm_and_si128(IsHigh, _mm_set1_epi32(8)));
+	return _mm_or_si128(Result, _mm_cmpeq_epi32(x, _mm_setzero_si128()));
+}
+
+// Returns the position of the least significant bit set of each lane, -1 for zero
+GLM_FUNC_QUALIFIER glm_ivec4 glm_i128_findLSB(glm_uvec4 x)
+{
+	// The isolated bit is a power of two, exactly converted to float even when it is the sign bit
+	glm_ivec4 const Low = _mm_and_si128(x, _mm_sub_epi32(_mm_setzero_si128(), x));
+	glm_ivec4 const Exponent = _mm_and_si128(_mm_srli_epi32(_mm_castps_si128(_mm_cvtepi32_ps(Low)), 23), _mm_set1_epi32(0xFF));
+	glm_ivec4 const Result = _mm_sub_epi32(Exponent, _mm_set1_epi32(127));
+	return _mm_or_si128(Result, _mm_cmpeq_epi32(x, _mm_setzero_si128()));
+}
+
+#if GLM_ARCH & GLM_ARCH_SSSE3_BIT
+// Counts the bits set of each lane with a nibble lookup table
+GLM_FUNC_QUALIFIER glm_ivec4 glm_i128_bitCount(glm_uvec4 x)
+{
+	glm_uvec4 const Table = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	glm_uvec4 const Mask = _mm_set1_epi8(0x0F);
+	glm_uvec4 const Low = _mm_shuffle_epi8(Table, _mm_and_si128(x, Mask));
+	glm_uvec4 const High = _mm_shuffle_epi8(Table, _mm_and_si128(_mm_srli_epi16(x, 4), Mask));
+	glm_uvec4 const Bytes = _mm_add_epi8(Low, High);
+	return _mm_madd_epi16(_mm_maddubs_epi16(Bytes, _mm_set1_epi8(1)), _mm_set1_epi16(1));
+}
+#endif//GLM_ARCH & GLM_ARCH_SSSE3_BIT
+
+// Unsigned x < y of each lane, all bits set when true
+GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_lessThan_u32(glm_uvec4 x, glm_uvec4 y)
+{
+	glm_uvec4 const Sign = _mm_set1_epi32(static_cast<int>(0x80000000u));
+	return _mm_cmpgt_epi32(_mm_xor_si128(y, Sign), _mm_xor_si128(x, Sign));
+}
+
+// Computes the 64 bits products of each lane, returns the 32 least significant bits and writes the 32 most significant bits to msb
+GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_umulExtended(glm_uvec4 x, glm_uvec4 y, glm_uvec4* msb)
+{
+	// Products of lanes 0, 2 and of lanes 1, 3 as (low, high) pairs
+	glm_uvec4 const Even = _mm_shuffle_epi32(_mm_mul_epu32(x, y), _MM_SHUFFLE(3, 1, 2, 0));
+	glm_uvec4 const Odd = _mm_shuffle_epi32(_mm_mul_epu32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32)), _MM_SHUFFLE(3, 1, 2, 0));
+	*msb = _mm_unpackhi_epi32(Even, Odd);
+	return _mm_unpacklo_epi32(Even, Odd);
+}
+
+// Signed version of glm_i128_umulExtended: the unsigned product of two's complement values exceeds the signed one
+// by y * 2^32 when x is negative and by x * 2^32 when y is negative.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_i128_imulExtended(glm_ivec4 x, glm_ivec4 y, glm_ivec4* msb)
+{
+	glm_uvec4 High;
+	glm_uvec4 const Low = glm_i128_umulExtended(x, y, &High);
+	glm_ivec4 const Correction = _mm_add_epi32(
+		_mm_and_si128(_mm_srai_epi32(x, 31), y),
+		_mm_and_si128(_mm_srai_epi32(y, 31), x));
+	*msb = _mm_sub_epi32(High, Correction);
+	return Low;
+}
+
+// Shifts each lane of x right by the matching lane of Shift, lower than 32
+GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_srlv(glm_uvec4 x, glm_uvec4 Shift)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm_srlv_epi32(x, Shift);
+#	else
+		// x * 2^(31 - Shift) >> 31 with 64 bits products, 2^31 converts to 0x80000000 as the integer overflow value
+		glm_uvec4 const Exponent = _mm_slli_epi32(_mm_sub_epi32(_mm_set1_epi32(127 + 31), Shift), 23);
+		glm_uvec4 const Scale = _mm_cvttps_epi32(_mm_castsi128_ps(Exponent));
+		glm_uvec4 const Even = _mm_srli_epi64(_mm_mul_epu32(x, Scale), 31);
+		glm_uvec4 const Odd = _mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(x, 32), _mm_srli_epi64(Scale, 32)), 1);
+		glm_uvec4 const Low32 = _mm_set_epi32(0, -1, 0, -1);
+		return _mm_or_si128(_mm_and_si128(Even, Low32), _mm_andnot_si128(Low32, Odd));
+#	endif
+}
+
+// Quotient of n by d with the multiplier Magic and the final shift Shift of the Granlund-Montgomery round-up method
+GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_udivMagic(glm_uvec4 n, glm_uvec4 d, glm_uvec4 Magic, glm_uvec4 Shift)
+{
+	glm_uvec4 t;
+	glm_i128_umulExtended(Magic, n, &t);
+	glm_uvec4 const q = glm_i128_srlv(_mm_add_epi32(t, _mm_srli_epi32(_mm_sub_epi32(n, t), 1)), Shift);
+
+	// The method doesn't apply to a division by one
+	glm_uvec4 const One = _mm_cmpeq_epi32(d, _mm_set1_epi32(1));
+	return _mm_or_si128(_mm_and_si128(One, n), _mm_andnot_si128(One, q));
+}
+
+// Interleaves the bits of the two 64 bits lanes of x, y and z, each holding a 21 bits value
+GLM_FUNC_QUALIFIER glm_u64vec2 glm_i128_interleave3(glm_u64vec2 x, glm_u64vec2 y, glm_u64vec2 z)
+{
+	return _mm_or_si128(_mm_or_si128(
+		glm_i128_spread3(x),
+		_mm_slli_epi64(glm_i128_spread3(y), 1)),
+		_mm_slli_epi64(glm_i128_spread3(z), 2));
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+// Interleaves the bits of the four 64 bits lanes of x, y and z, each holding a 21 bits value
+GLM_FUNC_QUALIFIER glm_u64vec4 glm_i256_interleave3(glm_u64vec4 x, glm_u64vec4 y, glm_u64vec4 z)
+{
+	return _mm256_or_si256(_mm256_or_si256(
+		glm_i256_spread3(x),
+		_mm256_slli_epi64(glm_i256_spread3(y), 1)),
+		_mm256_slli_epi64(glm_i256_spread3(z), 2));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
@@ -0,0 +1,93 @@
+/// @ref simd
+/// @file glm/simd/quaternion.h
+
+#pragma once
+
+#include "platform.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// Expects a (x, y, z, w) quaternion, writes the three rotation columns with a zero fourth component
+GLM_FUNC_QUALIFIER void glm_quat_mat3_cast(glm_vec4 q, glm_vec4 out[3])
+{
+	glm_vec4 const q2 = _mm_add_ps(q, q);
+	glm_vec4 const MaskXYZ = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+
+	// (1 - 2(yy + zz), 2(xy + wz), 2(xz - wy))
+	glm_vec4 const a0 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 0, 1)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 2, 1, 1)));
+	glm_vec4 const b0 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 3, 2)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 1, 2, 2)));
+	glm_vec4 const s0 = _mm_add_ps(
+		_mm_xor_ps(a0, _mm_set_ps(0.0f, 0.0f, 0.0f, -0.0f)),
+		_mm_xor_ps(b0, _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f)));
+	out[0] = _mm_and_ps(_mm_add_ps(_mm_set_ps(0.0f, 0.0f, 0.0f, 1.0f), s0), MaskXYZ);
+
+	// (2(xy - wz), 1 - 2(xx + zz), 2(yz + wx))
+	glm_vec4 const a1 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 0)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 2, 0, 1)));
+	glm_vec4 const b1 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 2, 3)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 0, 2, 2)));
+	glm_vec4 const s1 = _mm_add_ps(
+		_mm_xor_ps(a1, _mm_set_ps(0.0f, 0.0f, -0.0f, 0.0f)),
+		_mm_xor_ps(b1, _mm_set_ps(0.0f, 0.0f, -0.0f, -0.0f)));
+	out[1] = _mm_and_ps(_mm_add_ps(_mm_set_ps(0.0f, 0.0f, 1.0f, 0.0f), s1), MaskXYZ);
+
+	// (2(xz + wy), 2(yz - wx), 1 - 2(xx + yy))
+	glm_vec4 const a2 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 1, 0)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 0, 2, 2)));
+	glm_vec4 const b2 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 3, 3)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 1, 0, 1)));
+	glm_vec4 const s2 = _mm_add_ps(
+		_mm_xor_ps(a2, _mm_set_ps(0.0f, -0.0f, 0.0f, 0.0f)),
+		_mm_xor_ps(b2, _mm_set_ps(0.0f, -0.0f, -0.0f, 0.0f)));
+	out[2] = _mm_and_ps(_mm_add_ps(_mm_set_ps(0.0f, 1.0f, 0.0f, 0.0f), s2), MaskXYZ);
+}
+
+// Expects the three rotation columns of a matrix, returns a (x, y, z, w) quaternion.
+// All four candidate solutions are evaluated and the one built on the largest diagonal term is
+// selected with masks, with the same w, x, y, z priority as the scalar code on ties.
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat3_quat_cast(glm_vec4 const in[3])
+{
+	glm_vec4 const c0 = in[0];
+	glm_vec4 const c1 = in[1];
+	glm_vec4 const c2 = in[2];
+
+	// (m12, m20, m01) and (m21, m02, m10)
+	glm_vec4 const t0 = _mm_shuffle_ps(c1, c2, _MM_SHUFFLE(0, 0, 2, 2));
+	glm_vec4 const A = _mm_shuffle_ps(t0, c0, _MM_SHUFFLE(1, 1, 2, 0));
+	glm_vec4 const t1 = _mm_shuffle_ps(c2, c0, _MM_SHUFFLE(2, 2, 1, 1));
+	glm_vec4 const B = _mm_shuffle_ps(t1, c1, _MM_SHUFFLE(0, 0, 2, 0));
+	glm_vec4 const D = _mm_sub_ps(A, B);
+	glm_vec4 const S = _mm_add_ps(A, B);
+
+	// (4xx, 4yy, 4zz, 4ww)
+	glm_vec4 const m00 = _mm_shuffle_ps(c0, c0, _MM_SHUFFLE(0, 0, 0, 0));
+	glm_vec4 const m11 = _mm_shuffle_ps(c1, c1, _MM_SHUFFLE(1, 1, 1, 1));
+	glm_vec4 const m22 = _mm_shuffle_ps(c2, c2, _MM_SHUFFLE(2, 2, 2, 2));
+	glm_vec4 const F = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+		_mm_xor_ps(m00, _mm_set_ps(0.0f, -0.0f, -0.0f, 0.0f)),
+		_mm_xor_ps(m11, _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f))),
+		_mm_xor_ps(m22, _mm_set_ps(0.0f, 0.0f, -0.0f, -0.0f))),
+		_mm_set1_ps(1.0f));
+
+	glm_vec4 const CandX = _mm_shuffle_ps(
+		_mm_shuffle_ps(F, S, _MM_SHUFFLE(1, 2, 0, 0)),
+		_mm_shuffle_ps(S, D, _MM_SHUFFLE(0, 0, 1, 1)), _MM_SHUFFLE(2, 0, 2, 0));
+	glm_vec4 const CandY = _mm_shuffle_ps(
+		_mm_shuffle_ps(S, F, _MM_SHUFFLE(1, 1, 2, 2)),
+		_mm_shuffle_ps(S, D, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+	glm_vec4 const CandZ = _mm_shuffle_ps(S, _mm_shuffle_ps(F, D, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 0, 1));
+	glm_vec4 const CandW = _mm_shuffle_ps(D, _mm_shuffle_ps(D, F, _MM_SHUFFLE(3, 3, 2, 2)), _MM_SHUFFLE(2, 0, 1, 0));
+
+	glm_vec4 const Max0 = _mm_max_ps(F, _mm_shuffle_ps(F, F, _MM_SHUFFLE(1, 0, 3, 2)));
+	glm_vec4 const Max1 = _mm_max_ps(Max0, _mm_shuffle_ps(Max0, Max0, _MM_SHUFFLE(2, 3, 0, 1)));
+	glm_vec4 const Biggest = _mm_cmpeq_ps(F, Max1);
+
+	glm_vec4 Result = CandZ;
+	glm_vec4 const MaskY = _mm_shuffle_ps(Biggest, Biggest, _MM_SHUFFLE(1, 1, 1, 1));
+	Result = _mm_or_ps(_mm_and_ps(MaskY, CandY), _mm_andnot_ps(MaskY, Result));
+	glm_vec4 const MaskX = _mm_shuffle_ps(Biggest, Biggest, _MM_SHUFFLE(0, 0, 0, 0));
+	Result = _mm_or_ps(_mm_and_ps(MaskX, CandX), _mm_andnot_ps(MaskX, Result));
+	glm_vec4 const MaskW = _mm_shuffle_ps(Biggest, Biggest, _MM_SHUFFLE(3, 3, 3, 3));
+	Result = _mm_or_ps(_mm_and_ps(MaskW, CandW), _mm_andnot_ps(MaskW, Result));
+
+	// 0.25 / (0.5 * sqrt(F)) scales the other components, F * that same factor gives the biggest one
+	return _mm_mul_ps(Result, _mm_div_ps(_mm_set1_ps(0.5f), _mm_sqrt_ps(Max1)));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
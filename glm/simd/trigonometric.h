@@ -3,7 +3,124 @@
 
 #pragma once
 
+#include "common.h"
+
+// The kernels of GLM_GTX_fast_trigonometry: x is wrapped to [-pi, pi] with 2 pi split in two constants,
+// then the cos_52s polynomial is evaluated on [0, pi / 2] and reflected around pi beyond pi / 2.
+// sin(x) is cos(pi / 2 - x), so the cosine kernel takes angles in [0, 3 pi / 2].
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_wrap_pi(glm_f32vec4 x)
+{
+	glm_f32vec4 const rnd0 = glm_vec4_round(_mm_mul_ps(x, _mm_set1_ps(0.159154943091895335768883763372514362f)));
+	glm_f32vec4 const sub0 = _mm_sub_ps(x, _mm_mul_ps(rnd0, _mm_set1_ps(6.28125f)));
+	return _mm_sub_ps(sub0, _mm_mul_ps(rnd0, _mm_set1_ps(0.00193530717958647692528676655900576839f)));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_fast_cos_positive(glm_f32vec4 t)
+{
+	glm_f32vec4 const cmp0 = _mm_cmpgt_ps(t, _mm_set1_ps(1.57079632679489661923132169163975144f));
+	glm_f32vec4 const ref0 = glm_vec4_abs(_mm_sub_ps(t, _mm_set1_ps(3.14159265358979323846264338327950288f)));
+	glm_f32vec4 const ang0 = _mm_or_ps(_mm_and_ps(cmp0, ref0), _mm_andnot_ps(cmp0, t));
+	glm_f32vec4 const xx0 = _mm_mul_ps(ang0, ang0);
+
+	glm_f32vec4 pol0 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(-0.0012712095f), xx0), _mm_set1_ps(0.0414877472f));
+	pol0 = _mm_add_ps(_mm_mul_ps(pol0, xx0), _mm_set1_ps(-0.4999124376f));
+	pol0 = _mm_add_ps(_mm_mul_ps(pol0, xx0), _mm_set1_ps(0.9999932946f));
+	return _mm_xor_ps(pol0, _mm_and_ps(cmp0, _mm_set1_ps(-0.0f)));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_fast_cos(glm_f32vec4 x)
+{
+	return glm_vec4_fast_cos_positive(glm_vec4_abs(glm_vec4_wrap_pi(x)));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_fast_sin(glm_f32vec4 x)
+{
+	glm_f32vec4 const sub0 = _mm_sub_ps(_mm_set1_ps(1.57079632679489661923132169163975144f), glm_vec4_wrap_pi(x));
+	return glm_vec4_fast_cos_positive(glm_vec4_abs(sub0));
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_vec8_wrap_pi(glm_f32vec8 x)
+{
+	glm_f32vec8 const rnd0 = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(0.159154943091895335768883763372514362f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	glm_f32vec8 const sub0 = _mm256_sub_ps(x, _mm256_mul_ps(rnd0, _mm256_set1_ps(6.28125f)));
+	return _mm256_sub_ps(sub0, _mm256_mul_ps(rnd0, _mm256_set1_ps(0.00193530717958647692528676655900576839f)));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_vec8_fast_cos_positive(glm_f32vec8 t)
+{
+	glm_f32vec8 const cmp0 = _mm256_cmp_ps(t, _mm256_set1_ps(1.57079632679489661923132169163975144f), _CMP_GT_OQ);
+	glm_f32vec8 const sub0 = _mm256_sub_ps(t, _mm256_set1_ps(3.14159265358979323846264338327950288f));
+	glm_f32vec8 const ref0 = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), sub0);
+	glm_f32vec8 const ang0 = _mm256_blendv_ps(t, ref0, cmp0);
+	glm_f32vec8 const xx0 = _mm256_mul_ps(ang0, ang0);
+
+	glm_f32vec8 pol0 = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(-0.0012712095f), xx0), _mm256_set1_ps(0.0414877472f));
+	pol0 = _mm256_add_ps(_mm256_mul_ps(pol0, xx0), _mm256_set1_ps(-0.4999124376f));
+	pol0 = _mm256_add_ps(_mm256_mul_ps(pol0, xx0), _mm256_set1_ps(0.9999932946f));
+	return _mm256_xor_ps(pol0, _mm256_and_ps(cmp0, _mm256_set1_ps(-0.0f)));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_vec8_fast_cos(glm_f32vec8 x)
+{
+	glm_f32vec8 const wrp0 = glm_vec8_wrap_pi(x);
+	return glm_vec8_fast_cos_positive(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), wrp0));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_vec8_fast_sin(glm_f32vec8 x)
+{
+	glm_f32vec8 const sub0 = _mm256_sub_ps(_mm256_set1_ps(1.57079632679489661923132169163975144f), glm_vec8_wrap_pi(x));
+	return glm_vec8_fast_cos_positive(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), sub0));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#if GLM_ARCH & GLM_ARCH_NEON_BIT
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_wrap_pi(glm_f32vec4 x)
+{
+	float32x4_t const mul0 = vmulq_f32(x, vdupq_n_f32(0.159154943091895335768883763372514362f));
+#	if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+		float32x4_t const rnd0 = vrndnq_f32(mul0);
+#	else
+		// Rounds half away from zero by truncating x + 0.5 with the sign of x
+		uint32x4_t const sgn0 = vandq_u32(vreinterpretq_u32_f32(mul0), vdupq_n_u32(0x80000000));
+		float32x4_t const hlf0 = vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(vdupq_n_f32(0.5f)), sgn0));
+		float32x4_t const rnd0 = vcvtq_f32_s32(vcvtq_s32_f32(vaddq_f32(mul0, hlf0)));
+#	endif
+	float32x4_t const sub0 = vsubq_f32(x, vmulq_f32(rnd0, vdupq_n_f32(6.28125f)));
+	return vsubq_f32(sub0, vmulq_f32(rnd0, vdupq_n_f32(0.00193530717958647692528676655900576839f)));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_fast_cos_positive(glm_f32vec4 t)
+{
+	uint32x4_t const cmp0 = vcgtq_f32(t, vdupq_n_f32(1.57079632679489661923132169163975144f));
+	float32x4_t const ref0 = vabsq_f32(vsubq_f32(t, vdupq_n_f32(3.14159265358979323846264338327950288f)));
+	float32x4_t const ang0 = vbslq_f32(cmp0, ref0, t);
+	float32x4_t const xx0 = vmulq_f32(ang0, ang0);
+
+	float32x4_t pol0 = vaddq_f32(vmulq_f32(vdupq_n_f32(-0.0012712095f), xx0), vdupq_n_f32(0.0414877472f));
+	pol0 = vaddq_f32(vmulq_f32(pol0, xx0), vdupq_n_f32(-0.4999124376f));
+	pol0 = vaddq_f32(vmulq_f32(pol0, xx0), vdupq_n_f32(0.9999932946f));
+	uint32x4_t const sgn0 = vandq_u32(cmp0, vdupq_n_u32(0x80000000));
+	return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(pol0), sgn0));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_fast_cos(glm_f32vec4 x)
+{
+	return glm_vec4_fast_cos_positive(vabsq_f32(glm_vec4_wrap_pi(x)));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_fast_sin(glm_f32vec4 x)
+{
+	float32x4_t const sub0 = vsubq_f32(vdupq_n_f32(1.57079632679489661923132169163975144f), glm_vec4_wrap_pi(x));
+	return glm_vec4_fast_cos_positive(vabsq_f32(sub0));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_NEON_BIT
@@ -0,0 +1,287 @@
+// Checks the compilation cost of each public header against its budget.
+// Each header is preprocessed alone: the preprocessed GLM code is measured and the standard headers it includes directly are listed.
+// Only the headers over budget are printed, the full report with GLM_PERF_TEST_ENABLE.
+// With GLM_PERF_TEST_ENABLE, the compilation time of the most included headers is also measured relative to the compilation time of <cmath>.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// The compiler is known with GCC and Clang builds
+#if defined(GLM_COMPILE_CXX_COMPILER)
+
+struct header_budget
+{
+	char const* Header;
+	std::size_t Size;	// Preprocessed GLM code in KB, without blank lines
+	double Time;		// Compilation time relative to the compilation of <cmath>, 0 when not measured
+};
+
+// Headers included the most, the other headers use the budget of their directory
+static header_budget const Budgets[] =
+{
+	{"glm/vec3.hpp", 72, 1.5},
+	{"glm/mat4x4.hpp", 500, 5.0},
+	{"glm/glm.hpp", 575, 5.0},
+	{"glm/ext.hpp", 980, 9.0},
+	{"glm/ext/matrix_transform.hpp", 510, 5.0},
+	{"glm/ext/matrix_clip_space.hpp", 250, 0.0},
+	{"glm/ext/quaternion_float.hpp", 580, 5.0},
+	{"glm/ext/scalar_constants.hpp", 8, 0.0},
+	{"glm/gtc/matrix_transform.hpp", 550, 0.0},
+	{"glm/gtc/quaternion.hpp", 590, 0.0},
+	{"glm/gtc/type_ptr.hpp", 610, 0.0}
+};
+
+static header_budget const DirectoryBudgets[] =
+{
+	{"glm/ext/", 580, 0.0},
+	{"glm/gtc/", 680, 0.0},
+	{"glm/gtx/", 760, 0.0},
+	{"glm/", 500, 0.0}
+};
+
+// Standard headers the core, stable and recommended extensions may include, the experimental extensions include any
+static char const* const AllowedIncludes[] =
+{
+	"atomic", "cassert", "cfloat", "climits", "cmath", "cpuid.h", "cstddef", "cstdint", "cstdlib", "cstring", "ctime", "intrin.h", "limits", "type_traits"
+};
+
+// Headers requiring a configuration, e.g. GLM_FORCE_DEFAULT_ALIGNED_GENTYPES
+static char const* const Skipped[] =
+{
+	"glm/gtc/type_aligned.hpp"
+};
+
+static bool starts_with(std::string const& s, char const* Prefix)
+{
+	return s.compare(0, std::strlen(Prefix), Prefix) == 0;
+}
+
+static header_budget budget(std::string const& Header)
+{
+	for(std::size_t i = 0; i < sizeof(Budgets) / sizeof(Budgets[0]); ++i)
+		if(Header == Budgets[i].Header)
+			return Budgets[i];
+
+	for(std::size_t i = 0; i < sizeof(DirectoryBudgets) / sizeof(DirectoryBudgets[0]); ++i)
+		if(starts_with(Header, DirectoryBudgets[i].Header))
+			return DirectoryBudgets[i];
+
+	header_budget const Default = {"", 0, 0.0};
+	return Default;
+}
+
+static int run(std::string const& Options, char const* Output, double& Duration)
+{
+	std::string const Command = std::string("\"") + GLM_COMPILE_CXX_COMPILER + "\" " + GLM_COMPILE_CXX_STANDARD + " -I\"" + GLM_COMPILE_INCLUDE_DIR + "\" " + Options + " compile_header_budget_unit.cpp > " + Output;
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	int const Result = std::system(Command.c_str());
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	Duration = std::chrono::duration<double, std::milli>(t2 - t1).count();
+	return Result;
+}
+
+static void write_unit(std::string const& Source)
+{
+	std::ofstream File("compile_header_budget_unit.cpp");
+	File << Source;
+}
+
+#if defined(GLM_TEST_PERF)
+// Shortest of a few compilations to reduce the noise of the machine load
+static double compile_time(std::string const& Source)
+{
+	write_unit(Source);
+
+	double Shortest = 0.0;
+	for(int i = 0; i < 3; ++i)
+	{
+		double Duration = 0.0;
+		if(run("-fsyntax-only", "compile_header_budget.log", Duration) != 0)
+			return -1.0;
+		Shortest = i == 0 ? Duration : std::min(Shortest, Duration);
+	}
+	return Shortest;
+}
+#endif//defined(GLM_TEST_PERF)
+
+struct header_cost
+{
+	std::size_t Size;
+	std::vector<std::string> Includes;
+};
+
+// Parses the line markers of the preprocessed output: '# line "file" flags', with flag 1 when entering an included file
+static bool preprocess(std::string const& Source, header_cost& Cost)
+{
+	write_unit(Source);
+
+	double Duration = 0.0;
+	if(run("-E", "compile_header_budget.i", Duration) != 0)
+		return false;
+
+	std::string const Root = std::string(GLM_COMPILE_INCLUDE_DIR) + "/glm/";
+
+	std::ifstream File("compile_header_budget.i");
+	std::string Line;
+	bool InGLM = false;
+	Cost.Size = 0;
+	Cost.Includes.clear();
+	while(std::getline(File, Line))
+	{
+		if(starts_with(Line, "# "))
+		{
+			std::size_t const First = Line.find('"');
+			std::size_t const Last = Line.rfind('"');
+			if(First == std::string::npos || Last == First)
+				continue;
+
+			std::string const Path = Line.substr(First + 1, Last - First - 1);
+			bool const Entering = Line.find(" 1", Last) != std::string::npos;
+			bool const ToGLM = starts_with(Path, Root.c_str());
+			if(Entering && InGLM && !ToGLM && Path[0] != '<')
+			{
+				std::string const Name = Path.substr(Path.find_last_of("/\\") + 1);
+				if(std::find(Cost.Includes.begin(), Cost.Includes.end(), Name) == Cost.Includes.end())
+					Cost.Includes.push_back(Name);
+			}
+			InGLM = ToGLM;
+			continue;
+		}
+
+		if(!InGLM)
+			continue;
+
+		std::size_t const Begin = Line.find_first_not_of(" \t");
+		if(Begin != std::string::npos)
+			Cost.Size += Line.size() - Begin + 1;
+	}
+
+	return true;
+}
+
+static bool allowed(std::string const& Header, std::string const& Include)
+{
+	if(starts_with(Header, "glm/gtx/"))
+		return true;
+
+	for(std::size_t i = 0; i < sizeof(AllowedIncludes) / sizeof(AllowedIncludes[0]); ++i)
+		if(Include == AllowedIncludes[i])
+			return true;
+	return false;
+}
+
+static std::string source(std::string const& Header)
+{
+	return std::string(starts_with(Header, "glm/gtx/") ? "#define GLM_ENABLE_EXPERIMENTAL\n" : "") + "#include <" + Header + ">\n";
+}
+
+static int test_size(std::vector<std::string> const& Headers)
+{
+	int Error = 0;
+
+	for(std::size_t i = 0; i < Headers.size(); ++i)
+	{
+		std::string const& Header = Headers[i];
+
+		header_cost Cost;
+		if(!preprocess(source(Header), Cost))
+		{
+			std::printf("%s: preprocessing failed\n", Header.c_str());
+			++Error;
+			continue;
+		}
+
+		header_budget const Budget = budget(Header);
+		bool const OverBudget = Cost.Size > Budget.Size * 1024;
+#		if defined(GLM_TEST_PERF)
+			std::printf("%-48s %5d KB / %4d KB%s\n", Header.c_str(), static_cast<int>(Cost.Size / 1024), static_cast<int>(Budget.Size), OverBudget ? " OVER BUDGET" : "");
+#		else
+			if(OverBudget)
+				std::printf("%-48s %5d KB / %4d KB OVER BUDGET\n", Header.c_str(), static_cast<int>(Cost.Size / 1024), static_cast<int>(Budget.Size));
+#		endif
+		Error += OverBudget ? 1 : 0;
+
+		for(std::size_t j = 0; j < Cost.Includes.size(); ++j)
+		{
+			if(allowed(Header, Cost.Includes[j]))
+				continue;
+			std::printf("%-48s includes <%s>\n", Header.c_str(), Cost.Includes[j].c_str());
+			++Error;
+		}
+	}
+
+	return Error;
+}
+
+#if defined(GLM_TEST_PERF)
+// Timings depend on the machine load, only measured with the perf tests
+static int test_time()
+{
+	int Error = 0;
+
+	double const Reference = compile_time("#include <cmath>\n");
+	if(Reference <= 0.0)
+		return 1;
+	std::printf("<cmath>: %.0f ms\n", Reference);
+
+	for(std::size_t i = 0; i < sizeof(Budgets) / sizeof(Budgets[0]); ++i)
+	{
+		if(Budgets[i].Time <= 0.0)
+			continue;
+
+		double const Duration = compile_time(source(Budgets[i].Header));
+		bool const OverBudget = Duration < 0.0 || Duration > Reference * Budgets[i].Time;
+		std::printf("%-48s %5.0f ms, %.1fx <cmath> / %.1fx%s\n", Budgets[i].Header, Duration, Duration / Reference, Budgets[i].Time, OverBudget ? " OVER BUDGET" : "");
+		Error += OverBudget ? 1 : 0;
+	}
+
+	return Error;
+}
+#endif//defined(GLM_TEST_PERF)
+
+// The public headers are listed by CMake, the headers starting with '_' are internal
+static std::vector<std::string> public_headers()
+{
+	std::vector<std::string> Headers;
+
+	std::ifstream File(GLM_COMPILE_HEADER_LIST);
+	std::string Line;
+	while(std::getline(File, Line))
+	{
+		if(Line.empty() || Line[Line.find_last_of('/') + 1] == '_')
+			continue;
+		if(std::find(Skipped, Skipped + sizeof(Skipped) / sizeof(Skipped[0]), Line) != Skipped + sizeof(Skipped) / sizeof(Skipped[0]))
+			continue;
+		Headers.push_back(Line);
+	}
+
+	return Headers;
+}
+
+#endif//defined(GLM_COMPILE_CXX_COMPILER)
+
+int main()
+{
+	int Error = 0;
+
+#	if defined(GLM_COMPILE_CXX_COMPILER)
+		std::vector<std::string> const Headers = public_headers();
+		Error += Headers.empty() ? 1 : 0;
+
+		Error += test_size(Headers);
+#		if defined(GLM_TEST_PERF)
+			Error += test_time();
+#		endif
+#	endif
+
+	return Error;
+}
@@ -0,0 +1,151 @@
+// Checks the code generated for the swizzle operators of the aligned types.
+// A unit of swizzles is compiled to assembly with the SIMD instruction sets: each swizzle must be a single shuffle,
+// with the loads and stores of its operands, and each function is limited to a number of instructions.
+// The shuffles are always checked, the numbers of instructions with GLM_PERF_TEST_ENABLE, as they depend on the compiler version.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+// The compiler is known with GCC and Clang builds, the instructions are counted on x86-64
+#if defined(GLM_COMPILE_CXX_COMPILER) && defined(__x86_64__)
+
+static char const* const Unit =
+	"#include <glm/glm.hpp>\n"
+	"#include <glm/gtc/type_aligned.hpp>\n"
+	"extern \"C\" void swizzle_read_xxxx(glm::aligned_vec4* Out, glm::aligned_vec4 const* In) { *Out = In->xxxx; }\n"
+	"extern \"C\" void swizzle_read_xyz(glm::aligned_vec3* Out, glm::aligned_vec4 const* In) { *Out = In->xyz; }\n"
+	"extern \"C\" void swizzle_read4(glm::aligned_vec4* Out, glm::aligned_vec4 const* In) { *Out = In->wzyx; }\n"
+	"extern \"C\" void swizzle_read3(glm::aligned_vec3* Out, glm::aligned_vec3 const* In) { *Out = In->zxy; }\n"
+	"extern \"C\" void swizzle_read_vec2(glm::aligned_vec4* Out, glm::aligned_vec2 const* In) { *Out = In->yxyx; }\n"
+	"extern \"C\" void swizzle_read_int(glm::aligned_ivec4* Out, glm::aligned_ivec4 const* In) { *Out = In->yxwz; }\n"
+	"extern \"C\" void swizzle_mul(glm::aligned_vec3* Out, glm::aligned_vec4 const* In) { *Out = In->zxy * 2.0f; }\n"
+	"extern \"C\" void swizzle_write4(glm::aligned_vec4* Out, glm::aligned_vec4 const* In) { Out->wzyx = *In; }\n"
+	"extern \"C\" void swizzle_add3(glm::aligned_vec4* Out, glm::aligned_vec3 const* In) { Out->zxy += *In; }\n";
+
+struct codegen_budget
+{
+	char const* Function;
+	int Instructions;	// Including the loads, the stores and the return
+	int NoSSE41;		// Instructions when the unwritten lane is masked without the SSE4.1 blends
+};
+
+static codegen_budget const Budgets[] =
+{
+	{"swizzle_read_xxxx", 4, 4},
+	{"swizzle_read_xyz", 4, 4},
+	{"swizzle_read4", 4, 4},
+	{"swizzle_read3", 4, 4},
+	{"swizzle_read_vec2", 5, 5},
+	{"swizzle_read_int", 4, 4},
+	{"swizzle_mul", 5, 5},
+	{"swizzle_write4", 4, 4},
+	{"swizzle_add3", 6, 11}
+};
+
+struct codegen_cost
+{
+	int Instructions;
+	int Shuffles;
+};
+
+static bool starts_with(std::string const& s, char const* Prefix)
+{
+	return s.compare(0, std::strlen(Prefix), Prefix) == 0;
+}
+
+static bool compile(char const* Options)
+{
+	{
+		std::ofstream File("compile_swizzle_codegen_unit.cpp");
+		File << Unit;
+	}
+
+	std::string const Command = std::string("\"") + GLM_COMPILE_CXX_COMPILER + "\" " + GLM_COMPILE_CXX_STANDARD + " -I\"" + GLM_COMPILE_INCLUDE_DIR + "\" " +
+		"-O2 -S -DGLM_FORCE_SWIZZLE -DGLM_FORCE_INTRINSICS -DGLM_FORCE_ALIGNED_GENTYPES " + Options +
+		" compile_swizzle_codegen_unit.cpp -o compile_swizzle_codegen.s";
+	return std::system(Command.c_str()) == 0;
+}
+
+// Counts the instructions between the label of the function and the end of its procedure, the directives start with '.'
+static bool measure(char const* Function, codegen_cost& Cost)
+{
+	std::string const Label = std::string(Function) + ":";
+
+	std::ifstream File("compile_swizzle_codegen.s");
+	std::string Line;
+	bool InFunction = false;
+	Cost.Instructions = 0;
+	Cost.Shuffles = 0;
+	while(std::getline(File, Line))
+	{
+		if(!InFunction)
+		{
+			InFunction = Line == Label;
+			continue;
+		}
+
+		if(Line.find(".cfi_endproc") != std::string::npos || starts_with(Line, "\t.size"))
+			return true;
+		if(!starts_with(Line, "\t") || starts_with(Line, "\t."))
+			continue;
+
+		std::string const Mnemonic = Line.substr(1, Line.find_first_of(" \t", 1) - 1);
+		++Cost.Instructions;
+		Cost.Shuffles += Mnemonic.find("shuf") != std::string::npos || Mnemonic.find("perm") != std::string::npos ? 1 : 0;
+	}
+
+	return InFunction;
+}
+
+static int test_codegen(char const* Options, bool SSE41)
+{
+	int Error = 0;
+
+	if(!compile(Options))
+	{
+		std::printf("%s: compilation failed\n", Options);
+		return 1;
+	}
+
+	for(std::size_t i = 0; i < sizeof(Budgets) / sizeof(Budgets[0]); ++i)
+	{
+		codegen_cost Cost;
+		if(!measure(Budgets[i].Function, Cost))
+		{
+			std::printf("%s %s: function not found\n", Options, Budgets[i].Function);
+			++Error;
+			continue;
+		}
+
+		int const Budget = SSE41 ? Budgets[i].Instructions : Budgets[i].NoSSE41;
+#		ifdef GLM_TEST_PERF
+			bool const OverBudget = Cost.Instructions > Budget || Cost.Shuffles != 1;
+			std::printf("%-8s %-20s %2d instructions / %2d, %d shuffle%s\n", Options, Budgets[i].Function, Cost.Instructions, Budget, Cost.Shuffles, OverBudget ? " OVER BUDGET" : "");
+#		else
+			bool const OverBudget = Cost.Shuffles != 1;
+			if(OverBudget)
+				std::printf("%-8s %-20s %2d instructions / %2d, %d shuffles instead of 1\n", Options, Budgets[i].Function, Cost.Instructions, Budget, Cost.Shuffles);
+#		endif
+		Error += OverBudget ? 1 : 0;
+	}
+
+	return Error;
+}
+
+#endif//defined(GLM_COMPILE_CXX_COMPILER) && defined(__x86_64__)
+
+int main()
+{
+	int Error = 0;
+
+#	if defined(GLM_COMPILE_CXX_COMPILER) && defined(__x86_64__)
+		Error += test_codegen("-msse2", false);
+		Error += test_codegen("-msse4.1", true);
+		Error += test_codegen("-mavx", true);
+#	endif
+
+	return Error;
+}
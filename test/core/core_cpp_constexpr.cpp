@@ -11,6 +11,7 @@
 #include <glm/ext/vector_bool4.hpp>
 #include <glm/ext/vector_float1.hpp>
 #include <glm/vector_relational.hpp>
+#include <cmath>
 
 static int test_vec1()
 {
@@ -811,6 +812,187 @@ static int test_common()
 	return 0;
 }
 
+static int test_geometric()
+{
+	int Error = 0;
+
+	{
+		constexpr glm::vec3 I(1.0f, -2.0f, 3.0f);
+		constexpr glm::vec3 N(0.0f, 1.0f, 0.0f);
+		static_assert(glm::all(glm::equal(glm::reflect(I, N), glm::vec3(1.0f, 2.0f, 3.0f), glm::epsilon<float>())), "GLM: Failed constexpr");
+		static_assert(glm::all(glm::equal(glm::faceforward(N, I, N), N, glm::epsilon<float>())), "GLM: Failed constexpr");
+		static_assert(glm::length(-2.0f) > 1.0f, "GLM: Failed constexpr");
+	}
+
+#	if GLM_HAS_CONSTANT_EVALUATED
+	{
+		static_assert(glm::abs(glm::length(glm::vec3(2.0f, 3.0f, 6.0f)) - 7.0f) <= glm::epsilon<float>(), "GLM: Failed constexpr");
+		static_assert(glm::abs(glm::distance(glm::dvec2(1.0, 1.0), glm::dvec2(4.0, 5.0)) - 5.0) <= glm::epsilon<double>(), "GLM: Failed constexpr");
+		static_assert(glm::abs(glm::length(glm::vec4(1.0f)) - 2.0f) <= glm::epsilon<float>(), "GLM: Failed constexpr");
+
+		constexpr glm::vec3 N = glm::normalize(glm::vec3(3.0f, 0.0f, 4.0f));
+		static_assert(glm::all(glm::equal(N, glm::vec3(0.6f, 0.0f, 0.8f), glm::epsilon<float>())), "GLM: Failed constexpr");
+
+		constexpr glm::vec3 R = glm::refract(glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f), 0.5f);
+		static_assert(glm::all(glm::equal(R, glm::vec3(0.0f, -1.0f, 0.0f), glm::epsilon<float>())), "GLM: Failed constexpr");
+
+		// The scalar code of the constant evaluation matches <cmath> and the SIMD code at run time
+		glm::vec3 const V(3.0f, 0.0f, 4.0f);
+		Error += glm::all(glm::equal(glm::normalize(V), N, glm::epsilon<float>())) ? 0 : 1;
+		Error += glm::abs(glm::length(glm::vec3(2.0f, 3.0f, 6.0f)) - glm::length(V + glm::vec3(-1.0f, 3.0f, 2.0f))) <= glm::epsilon<float>() ? 0 : 1;
+	}
+#	endif
+
+	return Error;
+}
+
+// Within about N ULPs of the correctly rounded value
+static constexpr bool equal_ulps(double x, double Expected, double N)
+{
+	return glm::abs(x - Expected) <= N * glm::epsilon<double>() * glm::abs(Expected);
+}
+
+static int test_trigonometric()
+{
+	int Error = 0;
+
+	{
+		static_assert(equal_ulps(glm::detail::constexpr_sin(0.5), 0.479425538604203, 2.0), "GLM: Failed constexpr");
+		static_assert(equal_ulps(glm::detail::constexpr_cos(0.5), 0.8775825618903728, 2.0), "GLM: Failed constexpr");
+
+		// Cody-Waite reduction below 2^20 pi / 2
+		static_assert(equal_ulps(glm::detail::constexpr_sin(1e3), 0.8268795405320025, 4.0), "GLM: Failed constexpr");
+		static_assert(equal_ulps(glm::detail::constexpr_cos(1e3), 0.5623790762907029, 4.0), "GLM: Failed constexpr");
+		static_assert(equal_ulps(glm::detail::constexpr_sin(-1e4), 0.30561438888825215, 4.0), "GLM: Failed constexpr");
+		static_assert(equal_ulps(glm::detail::constexpr_cos(-1e4), -0.9521553682590148, 4.0), "GLM: Failed constexpr");
+		static_assert(equal_ulps(glm::detail::constexpr_sin(1e5), 0.03574879797201651, 4.0), "GLM: Failed constexpr");
+		static_assert(equal_ulps(glm::detail::constexpr_cos(1e5), -0.9993608074382124, 4.0), "GLM: Failed constexpr");
+		static_assert(equal_ulps(glm::detail::constexpr_sin(1e6), -0.34999350217129294, 4.0), "GLM: Failed constexpr");
+		static_assert(equal_ulps(glm::detail::constexpr_cos(1e6), 0.9367521275331447, 4.0), "GLM: Failed constexpr");
+		static_assert(equal_ulps(glm::detail::constexpr_tan(1e6), -0.34999350217129294 / 0.9367521275331447, 8.0), "GLM: Failed constexpr");
+
+		// Payne-Hanek reduction above, up to the largest double
+		static_assert(equal_ulps(glm::detail::constexpr_sin(1e7), 0.4205477931907825, 4.0), "GLM: Failed constexpr");
+		static_assert(equal_ulps(glm::detail::constexpr_cos(1e7), -0.9072703861817396, 4.0), "GLM: Failed constexpr");
+		static_assert(equal_ulps(glm::detail::constexpr_sin(1e22), -0.8522008497671888, 4.0), "GLM: Failed constexpr");
+		static_assert(equal_ulps(glm::detail::constexpr_cos(1e22), 0.523214785395139, 4.0), "GLM: Failed constexpr");
+		static_assert(equal_ulps(glm::detail::constexpr_sin(-1e300), 0.8178819121159085, 4.0), "GLM: Failed constexpr");
+		static_assert(equal_ulps(glm::detail::constexpr_cos(-1e300), -0.5753861119575491, 4.0), "GLM: Failed constexpr");
+
+		// The double closest to a multiple of pi / 2, its cosine is 2^-61
+		static_assert(equal_ulps(glm::detail::constexpr_cos(5.319372648326541e+255), -4.687165924254628e-19, 4.0), "GLM: Failed constexpr");
+		static_assert(equal_ulps(glm::detail::constexpr_sin(5.319372648326541e+255), 1.0, 4.0), "GLM: Failed constexpr");
+
+		static_assert(glm::abs(glm::detail::constexpr_sin(1e6f) + 0.3499935f) <= glm::epsilon<float>(), "GLM: Failed constexpr");
+
+		// Close to <cmath> at run time
+		double const Angles[] = {1e3, -1e4, 1e5, 1e6, 1e7, 1e15, 1e22, -1e300};
+		for(std::size_t i = 0; i < sizeof(Angles) / sizeof(Angles[0]); ++i)
+		{
+			Error += equal_ulps(glm::detail::constexpr_sin(Angles[i]), std::sin(Angles[i]), 4.0) ? 0 : 1;
+			Error += equal_ulps(glm::detail::constexpr_cos(Angles[i]), std::cos(Angles[i]), 4.0) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+static int test_matrix()
+{
+	int Error = 0;
+
+	{
+		constexpr glm::mat2 A(4.0f, 3.0f, 6.0f, 3.0f);
+		static_assert(glm::abs(glm::determinant(A) + 6.0f) <= glm::epsilon<float>(), "GLM: Failed constexpr");
+		static_assert(glm::all(glm::equal(A * glm::inverse(A), glm::mat2(1.0f), glm::epsilon<float>())), "GLM: Failed constexpr");
+
+		constexpr glm::mat3 B(2.0f, 0.0f, 1.0f, 1.0f, 3.0f, 0.0f, 0.0f, 1.0f, 4.0f);
+		static_assert(glm::abs(glm::determinant(B) - 25.0f) <= glm::epsilon<float>(), "GLM: Failed constexpr");
+		static_assert(glm::all(glm::equal(B * glm::inverse(B), glm::mat3(1.0f), 0.00001f)), "GLM: Failed constexpr");
+
+		constexpr glm::dmat4 C(2.0, 0.0, 0.0, 0.0, 0.0, 4.0, 1.0, 0.0, 0.0, 0.0, 8.0, 0.0, 1.0, 2.0, 3.0, 1.0);
+		static_assert(glm::abs(glm::determinant(C) - 64.0) <= glm::epsilon<double>(), "GLM: Failed constexpr");
+		static_assert(glm::all(glm::equal(C * glm::inverse(C), glm::dmat4(1.0), glm::epsilon<double>())), "GLM: Failed constexpr");
+		static_assert(glm::all(glm::equal(glm::transpose(glm::transpose(C)), C, glm::epsilon<double>())), "GLM: Failed constexpr");
+
+		glm::dmat4 const D(C);
+		Error += glm::all(glm::equal(glm::inverse(D), glm::inverse(C), glm::epsilon<double>())) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_transform()
+{
+	int Error = 0;
+
+	{
+		constexpr glm::mat4 T = glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 2.0f, 3.0f));
+		static_assert(glm::all(glm::equal(T[3], glm::vec4(1.0f, 2.0f, 3.0f, 1.0f), glm::epsilon<float>())), "GLM: Failed constexpr");
+	}
+
+#	if GLM_HAS_CONSTANT_EVALUATED
+	{
+		constexpr glm::mat4 S = glm::scale(glm::mat4(1.0f), glm::vec3(2.0f));
+		static_assert(glm::all(glm::equal(S * glm::vec4(1.0f), glm::vec4(2.0f, 2.0f, 2.0f, 1.0f), glm::epsilon<float>())), "GLM: Failed constexpr");
+
+		constexpr glm::mat4 R = glm::rotate(glm::mat4(1.0f), glm::pi<float>() * 0.5f, glm::vec3(0.0f, 0.0f, 1.0f));
+		static_assert(glm::all(glm::equal(R * glm::vec4(1.0f, 0.0f, 0.0f, 1.0f), glm::vec4(0.0f, 1.0f, 0.0f, 1.0f), 0.00001f)), "GLM: Failed constexpr");
+
+		constexpr glm::mat4 V = glm::lookAt(glm::vec3(0.0f, 0.0f, 5.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+		static_assert(glm::all(glm::equal(V * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), glm::vec4(0.0f, 0.0f, -5.0f, 1.0f), 0.00001f)), "GLM: Failed constexpr");
+
+		constexpr glm::mat4 P = glm::perspective(glm::radians(90.0f), 2.0f, 1.0f, 100.0f);
+		static_assert(glm::abs(P[1][1] - 1.0f) <= 0.00001f && glm::abs(P[0][0] - 0.5f) <= 0.00001f, "GLM: Failed constexpr");
+
+		constexpr glm::dmat4 F = glm::perspectiveFov(glm::radians(60.0), 1920.0, 1080.0, 0.1, 1000.0);
+		static_assert(glm::abs(glm::determinant(F)) > 0.0, "GLM: Failed constexpr");
+
+		// Lookup tables baked at compile time match the matrices computed at run time
+		float const Angle = glm::pi<float>() * 0.5f;
+		Error += glm::all(glm::equal(glm::rotate(glm::mat4(1.0f), Angle, glm::vec3(0.0f, 0.0f, 1.0f)), R, 0.00001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::lookAt(glm::vec3(0.0f, 0.0f, 5.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)), V, 0.00001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::perspective(glm::radians(90.0f), 2.0f, 1.0f, 100.0f), P, 0.00001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::perspectiveFov(glm::radians(60.0), 1920.0, 1080.0, 0.1, 1000.0), F, 0.000001)) ? 0 : 1;
+	}
+#	endif
+
+	return Error;
+}
+
+static int test_quat_cast()
+{
+	int Error = 0;
+
+	{
+		constexpr glm::quat Q(0.5f, 0.5f, 0.5f, 0.5f);
+		constexpr glm::mat3 M3 = glm::mat3_cast(Q);
+		constexpr glm::mat4 M4 = glm::mat4_cast(Q);
+		static_assert(glm::all(glm::equal(M3 * glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f), glm::epsilon<float>())), "GLM: Failed constexpr");
+		static_assert(glm::all(glm::equal(M4 * glm::vec4(0.0f, 1.0f, 0.0f, 0.0f), glm::vec4(0.0f, 0.0f, 1.0f, 0.0f), glm::epsilon<float>())), "GLM: Failed constexpr");
+		static_assert(glm::all(glm::equal(glm::inverse(Q) * Q, glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::epsilon<float>())), "GLM: Failed constexpr");
+	}
+
+#	if GLM_HAS_CONSTANT_EVALUATED
+	{
+		constexpr glm::quat Q = glm::angleAxis(glm::pi<float>() * 0.5f, glm::vec3(0.0f, 0.0f, 1.0f));
+		static_assert(glm::abs(glm::length(Q) - 1.0f) <= glm::epsilon<float>(), "GLM: Failed constexpr");
+		static_assert(glm::all(glm::equal(glm::quat_cast(glm::mat4_cast(Q)), Q, 0.00001f)), "GLM: Failed constexpr");
+		static_assert(glm::all(glm::equal(glm::quat_cast(glm::mat3_cast(Q)), Q, 0.00001f)), "GLM: Failed constexpr");
+
+		constexpr glm::quat R = glm::rotate(glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::pi<float>() * 0.5f, glm::vec3(0.0f, 0.0f, 1.0f));
+		static_assert(glm::all(glm::equal(R, Q, 0.00001f)), "GLM: Failed constexpr");
+		static_assert(glm::all(glm::equal(glm::normalize(Q * 2.0f), Q, 0.00001f)), "GLM: Failed constexpr");
+
+		glm::mat4 const M(glm::mat4_cast(Q));
+		Error += glm::all(glm::equal(glm::quat_cast(M), Q, 0.00001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::angleAxis(glm::pi<float>() * 0.5f, glm::vec3(0.0f, 0.0f, 1.0f)), Q, 0.00001f)) ? 0 : 1;
+	}
+#	endif
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -828,6 +1010,11 @@ int main()
 	Error += test_mat4x4();
 
 	Error += test_common();
+	Error += test_geometric();
+	Error += test_trigonometric();
+	Error += test_matrix();
+	Error += test_transform();
+	Error += test_quat_cast();
 
 	return Error;
 }
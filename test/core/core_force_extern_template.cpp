@@ -0,0 +1,60 @@
+#ifndef GLM_FORCE_EXTERN_TEMPLATE
+#	define GLM_FORCE_EXTERN_TEMPLATE
+#endif
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/matrix_relational.hpp>
+
+// Taking the address of the functions requires the definitions of the glm library
+static int test_functions()
+{
+	int Error = 0;
+
+	glm::vec3 (*Normalize)(glm::vec3 const&) = glm::normalize;
+	glm::vec3 (*Cross)(glm::vec3 const&, glm::vec3 const&) = glm::cross;
+	float (*Dot)(glm::vec4 const&, glm::vec4 const&) = glm::dot;
+	glm::dvec2 (*Clamp)(glm::dvec2 const&, double, double) = glm::clamp;
+	glm::ivec4 (*Max)(glm::ivec4 const&, glm::ivec4 const&) = glm::max;
+
+	Error += glm::all(glm::equal(Normalize(glm::vec3(0, 3, 4)), glm::vec3(0, 0.6f, 0.8f), 0.0001f)) ? 0 : 1;
+	Error += glm::all(glm::equal(Cross(glm::vec3(1, 0, 0), glm::vec3(0, 1, 0)), glm::vec3(0, 0, 1), 0.0f)) ? 0 : 1;
+	Error += glm::equal(Dot(glm::vec4(1, 2, 3, 4), glm::vec4(1)), 10.0f, 0.0f) ? 0 : 1;
+	Error += glm::all(glm::equal(Clamp(glm::dvec2(-1, 2), 0.0, 1.0), glm::dvec2(0, 1), 0.0)) ? 0 : 1;
+	Error += Max(glm::ivec4(1, 5, 3, 7), glm::ivec4(4)) == glm::ivec4(4, 5, 4, 7) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_operators()
+{
+	int Error = 0;
+
+	glm::mat4 (*Inverse)(glm::mat4 const&) = glm::inverse;
+	glm::vec4 (*Transform)(glm::mat4 const&, glm::vec4 const&) = glm::operator*;
+	glm::dmat3 (*Multiply)(glm::dmat3 const&, glm::dmat3 const&) = glm::operator*;
+	glm::mat2x3 (*Transpose)(glm::mat3x2 const&) = glm::transpose;
+
+	glm::mat4 const Scale(2.0f);
+	Error += glm::all(glm::equal(Inverse(Scale), glm::mat4(0.5f), 0.0001f)) ? 0 : 1;
+	Error += glm::all(glm::equal(Transform(Scale, glm::vec4(1, 2, 3, 1)), glm::vec4(2, 4, 6, 2), 0.0f)) ? 0 : 1;
+	Error += glm::all(glm::equal(Multiply(glm::dmat3(2.0), glm::dmat3(3.0)), glm::dmat3(6.0), 0.0)) ? 0 : 1;
+	Error += glm::all(glm::equal(Transpose(glm::mat3x2(1, 2, 3, 4, 5, 6)), glm::mat2x3(1, 3, 5, 2, 4, 6), 0.0f)) ? 0 : 1;
+
+	glm::quat const q = glm::angleAxis(glm::radians(90.0f), glm::vec3(0, 0, 1));
+	Error += glm::all(glm::equal(q * glm::vec3(1, 0, 0), glm::vec3(0, 1, 0), 0.0001f)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_functions();
+	Error += test_operators();
+
+	return Error;
+}
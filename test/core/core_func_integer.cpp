@@ -10,6 +10,9 @@
 #include <glm/ext/vector_uint4.hpp>
 #include <glm/ext/scalar_int_sized.hpp>
 #include <glm/ext/scalar_uint_sized.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 #include <vector>
 #include <ctime>
 #include <cstdio>
@@ -1557,6 +1560,70 @@ namespace bitCount
 	}
 }//bitCount
 
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+namespace aligned
+{
+	// Aligned vectors use SIMD code paths, their results must match the scalar functions
+	static int test()
+	{
+		int Error = 0;
+
+		std::vector<glm::uint> Values;
+		glm::uint const Edges[] = {0u, 1u, 2u, 3u, 0x7Fu, 0xFFu, 0x100u, 0xFFFFFFu, 0x1000000u, 0x1FFFFFFu, 0x7FFFFFFFu, 0x80000000u, 0x80000001u, 0xFFFFFFFEu, 0xFFFFFFFFu};
+		Values.insert(Values.end(), Edges, Edges + sizeof(Edges) / sizeof(Edges[0]));
+		glm::uint Seed = 1;
+		for(int i = 0; i < 1000; ++i)
+		{
+			Seed = Seed * 1664525u + 1013904223u;
+			Values.push_back(Seed >> (i % 32));
+		}
+
+		for(std::size_t i = 0; i + 4 <= Values.size(); ++i)
+		{
+			glm::uvec4 const u(Values[i], Values[(i + 5) % Values.size()], Values[(i + 11) % Values.size()], Values[i + 3]);
+			glm::uvec4 const v(Values[i + 1], Values[(i + 7) % Values.size()], Values[i + 2], Values[(i + 13) % Values.size()]);
+			glm::ivec4 const s(u);
+			glm::ivec4 const t(v);
+			glm::aligned_uvec4 const au(u);
+			glm::aligned_uvec4 const av(v);
+			glm::aligned_ivec4 const as(s);
+			glm::aligned_ivec4 const at(t);
+
+			Error += glm::all(glm::equal(glm::ivec4(glm::findMSB(au)), glm::findMSB(u))) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::ivec4(glm::findMSB(as)), glm::findMSB(s))) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::ivec4(glm::findLSB(au)), glm::findLSB(u))) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::ivec4(glm::findLSB(as)), glm::findLSB(s))) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::ivec4(glm::bitCount(au)), glm::bitCount(u))) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::ivec4(glm::bitCount(as)), glm::bitCount(s))) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::uvec4(glm::bitfieldReverse(au)), glm::bitfieldReverse(u))) ? 0 : 1;
+
+			glm::uvec4 Carry;
+			glm::aligned_uvec4 AlignedCarry;
+			Error += glm::all(glm::equal(glm::uvec4(glm::uaddCarry(au, av, AlignedCarry)), glm::uaddCarry(u, v, Carry))) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::uvec4(AlignedCarry), Carry)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::uvec4(glm::usubBorrow(au, av, AlignedCarry)), glm::usubBorrow(u, v, Carry))) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::uvec4(AlignedCarry), Carry)) ? 0 : 1;
+
+			glm::uvec4 MsbU, LsbU;
+			glm::aligned_uvec4 AlignedMsbU, AlignedLsbU;
+			glm::umulExtended(u, v, MsbU, LsbU);
+			glm::umulExtended(au, av, AlignedMsbU, AlignedLsbU);
+			Error += glm::all(glm::equal(glm::uvec4(AlignedMsbU), MsbU)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::uvec4(AlignedLsbU), LsbU)) ? 0 : 1;
+
+			glm::ivec4 MsbI, LsbI;
+			glm::aligned_ivec4 AlignedMsbI, AlignedLsbI;
+			glm::imulExtended(s, t, MsbI, LsbI);
+			glm::imulExtended(as, at, AlignedMsbI, AlignedLsbI);
+			Error += glm::all(glm::equal(glm::ivec4(AlignedMsbI), MsbI)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::ivec4(AlignedLsbI), LsbI)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace aligned
+#endif//GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+
 int main()
 {
 	int Error = 0;
@@ -1571,6 +1638,9 @@ int main()
 	Error += ::usubBorrow::test();
 	Error += ::bitfieldInsert::test();
 	Error += ::bitfieldExtract::test();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += ::aligned::test();
+#	endif
 
 #	ifdef NDEBUG
 		std::size_t const Samples = 1000;
@@ -2,6 +2,9 @@
 #include <glm/ext/scalar_relational.hpp>
 #include <glm/ext/vector_relational.hpp>
 #include <glm/glm.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 
 static int test_ivec2_swizzle()
 {
@@ -148,6 +151,63 @@ static int test_vec4_swizzle()
 	return Error;
 }
 
+// The aligned swizzles are shuffles of the SIMD registers
+static int test_aligned_swizzle()
+{
+	int Error = 0;
+
+#	if GLM_CONFIG_SWIZZLE == GLM_SWIZZLE_OPERATOR && GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	{
+		// Only the 8 bytes of a vec2 may be read
+		glm::aligned_vec2 const A[2] = {glm::aligned_vec2(1, 2), glm::aligned_vec2(3, 4)};
+		glm::aligned_vec3 const B = A[1].yxy;
+		glm::aligned_vec4 const C = A[1].yxyx;
+		Error += glm::all(glm::equal(B, glm::aligned_vec3(4, 3, 4), 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(C, glm::aligned_vec4(4, 3, 4, 3), 0.0001f)) ? 0 : 1;
+
+		glm::aligned_ivec2 const D(5, 6);
+		glm::aligned_uvec2 const E(5, 6);
+		Error += glm::aligned_ivec4(D.yxyx) == glm::aligned_ivec4(6, 5, 6, 5) ? 0 : 1;
+		Error += glm::aligned_uvec3(E.yyx) == glm::aligned_uvec3(6, 6, 5) ? 0 : 1;
+	}
+	{
+		glm::aligned_vec4 A(1, 2, 3, 4);
+		Error += glm::all(glm::equal(glm::aligned_vec4(A.wzyx), glm::aligned_vec4(4, 3, 2, 1), 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::aligned_vec3(A.zwx), glm::aligned_vec3(3, 4, 1), 0.0001f)) ? 0 : 1;
+
+		A.wzyx = glm::aligned_vec4(10, 20, 30, 40);
+		Error += glm::all(glm::equal(A, glm::aligned_vec4(40, 30, 20, 10), 0.0001f)) ? 0 : 1;
+
+		// The unwritten component is left unchanged
+		A.xzy = glm::aligned_vec3(1, 2, 3);
+		Error += glm::all(glm::equal(A, glm::aligned_vec4(1, 3, 2, 10), 0.0001f)) ? 0 : 1;
+		A.zxy += glm::aligned_vec3(1, 2, 3);
+		Error += glm::all(glm::equal(A, glm::aligned_vec4(3, 6, 3, 10), 0.0001f)) ? 0 : 1;
+		A.yxz *= glm::aligned_vec3(2, 3, 4);
+		Error += glm::all(glm::equal(A, glm::aligned_vec4(9, 12, 12, 10), 0.0001f)) ? 0 : 1;
+
+		// The assigned vector may be the destination
+		A.wzyx = A;
+		Error += glm::all(glm::equal(A, glm::aligned_vec4(10, 12, 12, 9), 0.0001f)) ? 0 : 1;
+	}
+	{
+		glm::aligned_ivec4 A(1, 2, 3, 4);
+		A.wzyx = glm::aligned_ivec4(A);
+		Error += A == glm::aligned_ivec4(4, 3, 2, 1) ? 0 : 1;
+		A.xzy = glm::aligned_ivec3(7, 8, 9);
+		Error += A == glm::aligned_ivec4(7, 9, 8, 1) ? 0 : 1;
+		A.wzyx /= glm::aligned_ivec4(1, 3, 2, 7);
+		Error += A == glm::aligned_ivec4(1, 4, 2, 1) ? 0 : 1;
+
+		glm::aligned_uvec4 B(1, 2, 3, 4);
+		B.zyx = glm::aligned_uvec3(5, 6, 7);
+		Error += B == glm::aligned_uvec4(7, 6, 5, 4) ? 0 : 1;
+	}
+#	endif
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -156,6 +216,7 @@ int main()
 	Error += test_ivec3_swizzle();
 	Error += test_ivec4_swizzle();
 	Error += test_vec4_swizzle();
+	Error += test_aligned_swizzle();
 
 	return Error;
 }
@@ -0,0 +1,164 @@
+#define GLM_FORCE_CPU_DISPATCH
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/ext/cpu_dispatch.hpp>
+#include <glm/gtc/bitfield.hpp>
+#include <glm/gtx/serialize.hpp>
+#include <glm/ext/vector_uint2_sized.hpp>
+#include <glm/ext/vector_uint3_sized.hpp>
+#include <glm/ext/vector_uint4_sized.hpp>
+
+#include <vector>
+#include <cstring>
+
+static int test_tier()
+{
+	int Error = 0;
+
+	glm::cpu_tier const Host = glm::cpuTier();
+	Error += Host >= glm::cpu_generic && Host <= glm::cpu_avx512 ? 0 : 1;
+	Error += glm::cpuTier() == Host ? 0 : 1;
+	Error += glm::dispatchTier() == Host ? 0 : 1;
+
+#	if GLM_HAS_CPUID && (defined(__x86_64__) || defined(_M_X64))
+		Error += Host >= glm::cpu_sse2 ? 0 : 1;
+#	endif
+
+	Error += glm::setDispatchTier(glm::cpu_generic) ? 0 : 1;
+	Error += glm::dispatchTier() == glm::cpu_generic ? 0 : 1;
+
+	// A tier above the host is refused
+	if(Host < glm::cpu_avx512)
+	{
+		Error += glm::setDispatchTier(static_cast<glm::cpu_tier>(Host + 1)) ? 1 : 0;
+		Error += glm::dispatchTier() == glm::cpu_generic ? 0 : 1;
+	}
+
+	Error += glm::setDispatchTier(Host) ? 0 : 1;
+	Error += glm::dispatchTier() == Host ? 0 : 1;
+
+	return Error;
+}
+
+// Each scalar of the swapped payload has the bytes of the host payload in reverse order
+template<typename genType>
+static int test_byteswap(std::size_t Count)
+{
+	typedef typename genType::value_type T;
+
+	int Error = 0;
+
+	std::vector<genType> Values(Count + 1);
+	for(std::size_t i = 0; i < Values.size(); ++i)
+	for(glm::length_t c = 0; c < genType::length(); ++c)
+		Values[i][c] = static_cast<T>(i * 37 + static_cast<std::size_t>(c) * 11 + 1);
+
+	glm::serial_endianness const Other = glm::hostEndianness() == glm::serial_little_endian ? glm::serial_big_endian : glm::serial_little_endian;
+	std::size_t const Size = glm::serializedSize<genType>(Count, glm::serial_raw);
+
+	std::vector<unsigned char> Host(Size);
+	std::vector<unsigned char> Swapped(Size);
+	Error += glm::serialize(&Values[0], Count, glm::hostEndianness(), glm::serial_raw, &Host[0], Size) == Size ? 0 : 1;
+	Error += glm::serialize(&Values[0], Count, Other, glm::serial_raw, &Swapped[0], Size) == Size ? 0 : 1;
+
+	for(std::size_t i = glm::serial_header_size; i < Size; i += sizeof(T))
+	for(std::size_t b = 0; b < sizeof(T); ++b)
+		Error += Swapped[i + b] == Host[i + sizeof(T) - 1 - b] ? 0 : 1;
+
+	std::vector<genType> Result(Count + 1);
+	Error += glm::deserialize(&Swapped[0], Size, &Result[0], Count) == Count ? 0 : 1;
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Result[i] == Values[i] ? 0 : 1;
+
+	return Error;
+}
+
+static int test_interleave(std::size_t Count)
+{
+	int Error = 0;
+
+	std::vector<glm::u32vec2> In2(Count + 1);
+	std::vector<glm::u32vec3> In3(Count + 1);
+	glm::uint32 Seed = 0x9E3779B9u;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		In2[i] = glm::u32vec2(Seed, ~Seed);
+		In3[i] = glm::u32vec3(Seed, Seed >> 7, Seed * 3u) & glm::u32vec3(0x001FFFFFu);
+	}
+
+	std::vector<glm::uint64> Out2(Count + 1);
+	std::vector<glm::uint64> Out3(Count + 1);
+	glm::bitfieldInterleave(&In2[0], Count, &Out2[0]);
+	glm::bitfieldInterleave(&In3[0], Count, &Out3[0]);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Out2[i] == glm::bitfieldInterleave(In2[i].x, In2[i].y) ? 0 : 1;
+		Error += Out3[i] == glm::bitfieldInterleave(In3[i].x, In3[i].y, In3[i].z) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// The codes of the kernels of the dispatch tier match the codes of the generic kernels
+static int test_morton(std::size_t Count)
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> Positions(Count + 1);
+	for(std::size_t i = 0; i < Count; ++i)
+		Positions[i] = glm::vec3(static_cast<float>(i % 17), static_cast<float>(i % 5) * 3.5f, static_cast<float>(i) * 0.25f);
+
+	glm::vec3 const Min(0.0f);
+	glm::vec3 const Max(17.0f, 17.5f, static_cast<float>(Count) * 0.25f + 1.0f);
+
+	std::vector<glm::uint64> Codes(Count + 1);
+	glm::mortonEncode(&Positions[0], Count, Min, Max, &Codes[0]);
+
+	glm::cpu_tier const Tier = glm::dispatchTier();
+	Error += glm::setDispatchTier(glm::cpu_generic) ? 0 : 1;
+	std::vector<glm::uint64> Expected(Count + 1);
+	glm::mortonEncode(&Positions[0], Count, Min, Max, &Expected[0]);
+	Error += glm::setDispatchTier(Tier) ? 0 : 1;
+
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Codes[i] == Expected[i] ? 0 : 1;
+
+	return Error;
+}
+
+// Runs the batch functions with the kernels of each tier supported by the host
+static int test_tiers()
+{
+	int Error = 0;
+
+	for(int Tier = glm::cpu_generic; Tier <= glm::cpuTier(); ++Tier)
+	{
+		Error += glm::setDispatchTier(static_cast<glm::cpu_tier>(Tier)) ? 0 : 1;
+
+		for(std::size_t Count = 0; Count < 70; ++Count)
+		{
+			Error += test_byteswap<glm::u16vec3>(Count);
+			Error += test_byteswap<glm::vec3>(Count);
+			Error += test_byteswap<glm::dvec4>(Count);
+			Error += test_interleave(Count);
+			Error += test_morton(Count);
+		}
+		Error += test_byteswap<glm::vec4>(4099);
+		Error += test_interleave(1027);
+	}
+
+	Error += glm::setDispatchTier(glm::cpuTier()) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_tier();
+	Error += test_tiers();
+
+	return Error;
+}
@@ -7,10 +7,15 @@
 #include <glm/ext/vector_int2.hpp>
 #include <glm/ext/vector_int3.hpp>
 #include <glm/ext/vector_int4.hpp>
+#include <glm/ext/vector_uint2.hpp>
+#include <glm/ext/vector_uint4.hpp>
 #include <glm/ext/vector_bool1.hpp>
 #include <glm/ext/vector_bool2.hpp>
 #include <glm/ext/vector_bool3.hpp>
 #include <glm/ext/vector_bool4.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 #include <vector>
 #include <ctime>
 #include <cstdio>
@@ -724,6 +729,166 @@ static int test_mix()
 	return Error;
 }
 
+namespace divider
+{
+	static glm::uint next(glm::uint& Seed)
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		return Seed;
+	}
+
+	template<glm::qualifier Q>
+	static int test_uint()
+	{
+		typedef glm::vec<4, glm::uint, Q> uvec4;
+
+		int Error = 0;
+
+		glm::uint const Divisors[] = {1u, 2u, 3u, 5u, 7u, 10u, 16u, 641u, 0x7FFFFFFFu, 0x80000000u, 0x80000001u, 0xFFFFFFFEu, 0xFFFFFFFFu};
+		glm::uint const Numerators[] = {0u, 1u, 2u, 6u, 0x7FFFFFFFu, 0x80000000u, 0xFFFFFFFEu, 0xFFFFFFFFu};
+		std::size_t const DivisorCount = sizeof(Divisors) / sizeof(Divisors[0]);
+
+		glm::uint Seed = 1;
+		for(std::size_t i = 0; i < DivisorCount; ++i)
+		{
+			uvec4 const d(Divisors[i], Divisors[(i + 1) % DivisorCount], next(Seed) | 1u, (next(Seed) >> (next(Seed) % 32)) + 1u);
+			glm::divider<uvec4> const Divider(d);
+
+			for(std::size_t j = 0; j < sizeof(Numerators) / sizeof(Numerators[0]); ++j)
+			{
+				uvec4 const n(Numerators[j], Numerators[j] - 1u, next(Seed), Numerators[j] / 3u);
+				Error += glm::all(glm::equal(n / Divider, n / d)) ? 0 : 1;
+				Error += glm::all(glm::equal(n % Divider, n % d)) ? 0 : 1;
+			}
+
+			for(int j = 0; j < 1000; ++j)
+			{
+				uvec4 const n(next(Seed), next(Seed), next(Seed) >> 16, next(Seed) >> (next(Seed) % 32));
+				Error += glm::all(glm::equal(n / Divider, n / d)) ? 0 : 1;
+				Error += glm::all(glm::equal(n % Divider, n % d)) ? 0 : 1;
+			}
+		}
+
+		glm::divider<uvec4> const Seven(7u);
+		Error += glm::all(glm::equal(uvec4(100u) / Seven, uvec4(14u))) ? 0 : 1;
+
+		return Error;
+	}
+
+	template<glm::qualifier Q>
+	static int test_int()
+	{
+		typedef glm::vec<4, int, Q> ivec4;
+
+		int const Min = std::numeric_limits<int>::min();
+		int const Max = std::numeric_limits<int>::max();
+
+		int Error = 0;
+
+		int const Divisors[] = {1, -1, 2, -2, 3, -3, 7, -10, 16, Max, -Max, Min};
+		int const Numerators[] = {0, 1, -1, 6, -6, Max, -Max, Min + 1};
+		std::size_t const DivisorCount = sizeof(Divisors) / sizeof(Divisors[0]);
+
+		glm::uint Seed = 2;
+		for(std::size_t i = 0; i < DivisorCount; ++i)
+		{
+			ivec4 const d(Divisors[i], Divisors[(i + 1) % DivisorCount], static_cast<int>(next(Seed) | 1u), static_cast<int>(next(Seed) >> 20) - 2048);
+			if(d.w == 0)
+				continue;
+			glm::divider<ivec4> const Divider(d);
+
+			for(std::size_t j = 0; j < sizeof(Numerators) / sizeof(Numerators[0]); ++j)
+			{
+				ivec4 const n(Numerators[j], -Numerators[j], static_cast<int>(next(Seed)), Numerators[j] / 3);
+				Error += glm::all(glm::equal(n / Divider, n / d)) ? 0 : 1;
+				Error += glm::all(glm::equal(n % Divider, n % d)) ? 0 : 1;
+			}
+
+			for(int j = 0; j < 1000; ++j)
+			{
+				ivec4 const n(static_cast<int>(next(Seed)), static_cast<int>(next(Seed)), static_cast<int>(next(Seed)) >> 16, static_cast<int>(next(Seed)) >> (next(Seed) % 32));
+				Error += glm::all(glm::equal(n / Divider, n / d)) ? 0 : 1;
+				Error += glm::all(glm::equal(n % Divider, n % d)) ? 0 : 1;
+			}
+		}
+
+		// Min / -1 overflows, Min divided by other values is defined
+		glm::divider<ivec4> const Divider(ivec4(1, 2, -3, Min));
+		ivec4 const n(Min);
+		Error += glm::all(glm::equal(n / Divider, ivec4(Min, Min / 2, Min / -3, 1))) ? 0 : 1;
+		Error += glm::all(glm::equal(n % Divider, ivec4(0, 0, Min % -3, 0))) ? 0 : 1;
+
+		return Error;
+	}
+
+	static int test_vec2()
+	{
+		int Error = 0;
+
+		glm::divider<glm::uvec2> const Size(glm::uvec2(640u, 480u));
+		glm::uvec2 const Pixel(1000u, 1000u);
+		Error += glm::all(glm::equal(Pixel / Size, glm::uvec2(1u, 2u))) ? 0 : 1;
+		Error += glm::all(glm::equal(Pixel % Size, glm::uvec2(360u, 40u))) ? 0 : 1;
+
+		return Error;
+	}
+
+	static int test()
+	{
+		int Error = 0;
+
+		Error += test_uint<glm::defaultp>();
+		Error += test_int<glm::defaultp>();
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			Error += test_uint<glm::aligned_highp>();
+			Error += test_int<glm::aligned_highp>();
+#		endif
+		Error += test_vec2();
+
+		return Error;
+	}
+}//namespace divider
+
+namespace fastDivide
+{
+	template<glm::qualifier Q>
+	static int test_qualifier()
+	{
+		typedef glm::vec<4, int, Q> ivec4;
+		typedef glm::vec<4, glm::uint, Q> uvec4;
+
+		int Error = 0;
+
+		int const Limit = (1 << 24) - 1;
+		for(int i = 0; i < 4096; ++i)
+		{
+			ivec4 const x(i * 4096 + i, Limit - i, -i * 3001, Limit - i * 4093);
+			ivec4 const y(i + 1, (i + 1) * 4095, Limit - i * 17, -(i % 255) - 1);
+			Error += glm::all(glm::equal(glm::fastDivide(x, y), x / y)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::fastMod(x, y), x % y)) ? 0 : 1;
+
+			uvec4 const ux(x & Limit);
+			uvec4 const uy((y & Limit) | 1);
+			Error += glm::all(glm::equal(glm::fastDivide(ux, uy), ux / uy)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::fastMod(ux, uy), ux % uy)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	static int test()
+	{
+		int Error = 0;
+
+		Error += test_qualifier<glm::defaultp>();
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			Error += test_qualifier<glm::aligned_highp>();
+#		endif
+
+		return Error;
+	}
+}//namespace fastDivide
+
 int main()
 {
 	int Error = 0;
@@ -734,6 +899,8 @@ int main()
 	Error += prevMultiple::test();
 	Error += nextMultiple::test();
 	Error += findNSB::test();
+	Error += divider::test();
+	Error += fastDivide::test();
 
 	Error += test_mix();
 
@@ -2,6 +2,10 @@
 #include <glm/gtc/type_precision.hpp>
 #include <glm/vector_relational.hpp>
 #include <glm/integer.hpp>
+#include <glm/common.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 #include <ctime>
 #include <cstdio>
 #include <vector>
@@ -999,6 +1003,189 @@ namespace bitfieldInterleave5
 }//namespace bitfieldInterleave5
 #endif//GLM_TEST_PERF
 
+namespace morton
+{
+	static glm::uint32 next(glm::uint32& Seed)
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		return Seed;
+	}
+
+	static glm::uint64 refInterleave3(glm::u32vec3 const& v)
+	{
+		glm::uint64 Result = 0;
+		for(glm::uint64 i = 0; i < 21; ++i)
+		{
+			Result |= ((glm::uint64(v.x) >> i) & 1) << (i * 3 + 0);
+			Result |= ((glm::uint64(v.y) >> i) & 1) << (i * 3 + 1);
+			Result |= ((glm::uint64(v.z) >> i) & 1) << (i * 3 + 2);
+		}
+		return Result;
+	}
+
+	static int test_deinterleave()
+	{
+		int Error = 0;
+
+		glm::uint32 Seed = 1;
+		for(int i = 0; i < 1000; ++i)
+		{
+			glm::u32vec3 const v(next(Seed) & 0x1FFFFF, next(Seed) & 0x1FFFFF, next(Seed) & 0x1FFFFF);
+			glm::uint64 const Code = glm::bitfieldInterleave(v);
+			Error += Code == refInterleave3(v) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::bitfieldDeinterleave3(Code), v)) ? 0 : 1;
+
+			// Bits above 21 are ignored
+			Error += glm::bitfieldInterleave(v | glm::u32vec3(0xFFE00000u)) == Code ? 0 : 1;
+
+			glm::u8vec3 const w(v);
+			Error += glm::all(glm::equal(glm::bitfieldDeinterleave3(glm::bitfieldInterleave(w.x, w.y, w.z)), w)) ? 0 : 1;
+
+			glm::u32vec2 const u(next(Seed), next(Seed));
+			Error += glm::all(glm::equal(glm::bitfieldDeinterleave(glm::bitfieldInterleave(u)), u)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	template<glm::qualifier Q>
+	static int test_batch()
+	{
+		typedef glm::vec<2, glm::uint32, Q> u32vec2;
+		typedef glm::vec<3, glm::uint32, Q> u32vec3;
+
+		int Error = 0;
+
+		glm::uint32 Seed = 2;
+		std::vector<u32vec2> In2(67);
+		std::vector<u32vec3> In3(67);
+		for(std::size_t i = 0; i < In3.size(); ++i)
+		{
+			In2[i] = u32vec2(next(Seed), next(Seed));
+			In3[i] = u32vec3(next(Seed), next(Seed), next(Seed));
+		}
+
+		std::vector<glm::uint64> Out(In3.size());
+		glm::bitfieldInterleave(&In2[0], In2.size(), &Out[0]);
+		for(std::size_t i = 0; i < In2.size(); ++i)
+			Error += Out[i] == glm::bitfieldInterleave(In2[i].x, In2[i].y) ? 0 : 1;
+
+		glm::bitfieldInterleave(&In3[0], In3.size(), &Out[0]);
+		for(std::size_t i = 0; i < In3.size(); ++i)
+			Error += Out[i] == glm::bitfieldInterleave(In3[i].x, In3[i].y, In3[i].z) ? 0 : 1;
+
+		return Error;
+	}
+
+	static int test_hilbert()
+	{
+		int Error = 0;
+
+		// The first cells of the 2D curve
+		glm::u32vec2 const Cells[] = {glm::u32vec2(0, 0), glm::u32vec2(0, 1), glm::u32vec2(1, 1), glm::u32vec2(1, 0)};
+		for(glm::uint64 i = 0; i < 4; ++i)
+		{
+			glm::u32vec2 const Cell = glm::hilbertDecode2(i);
+			Error += glm::all(glm::equal(Cell, Cells[i])) || glm::all(glm::equal(glm::u32vec2(Cell.y, Cell.x), Cells[i])) ? 0 : 1;
+		}
+
+		glm::uint32 Seed = 3;
+		for(int i = 0; i < 1000; ++i)
+		{
+			glm::u32vec2 const v2(next(Seed), next(Seed));
+			Error += glm::all(glm::equal(glm::hilbertDecode2(glm::hilbertEncode(v2)), v2)) ? 0 : 1;
+
+			glm::u32vec3 const v3(next(Seed) & 0x1FFFFF, next(Seed) & 0x1FFFFF, next(Seed) & 0x1FFFFF);
+			Error += glm::all(glm::equal(glm::hilbertDecode3(glm::hilbertEncode(v3)), v3)) ? 0 : 1;
+		}
+
+		// Consecutive indices are neighbour cells
+		for(int i = 0; i < 4096; ++i)
+		{
+			glm::uint64 const Index2 = i < 2048 ? glm::uint64(i) : (glm::uint64(next(Seed)) << 32 | next(Seed)) - 1;
+			glm::u32vec2 const a2 = glm::hilbertDecode2(Index2);
+			glm::u32vec2 const b2 = glm::hilbertDecode2(Index2 + 1);
+			Error += glm::abs(glm::ivec2(a2 - b2)).x + glm::abs(glm::ivec2(a2 - b2)).y == 1 ? 0 : 1;
+
+			glm::uint64 const Index3 = i < 2048 ? glm::uint64(i) : ((glm::uint64(next(Seed)) << 32 | next(Seed)) >> 1) % ((glm::uint64(1) << 63) - 1);
+			glm::ivec3 const d3(glm::hilbertDecode3(Index3) - glm::hilbertDecode3(Index3 + 1));
+			Error += glm::abs(d3).x + glm::abs(d3).y + glm::abs(d3).z == 1 ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	template<glm::qualifier Q>
+	static int test_quantize()
+	{
+		typedef glm::vec<2, float, Q> vec2;
+		typedef glm::vec<3, float, Q> vec3;
+
+		int Error = 0;
+
+		vec3 const Min(-1.0f, 0.0f, 2.0f);
+		vec3 const Max(1.0f, 4.0f, 3.0f);
+
+		glm::uint32 Seed = 4;
+		std::vector<vec3> Positions3;
+		std::vector<vec2> Positions2;
+		for(int i = 0; i < 130; ++i)
+		{
+			vec3 const t(static_cast<float>(next(Seed) % 1000), static_cast<float>(next(Seed) % 1000), static_cast<float>(next(Seed) % 1000));
+			Positions3.push_back(Min + (Max - Min) * t / 999.0f);
+			Positions2.push_back(vec2(Positions3.back()));
+		}
+
+		// Clamped to the box
+		Positions3.push_back(Min - 1.0f);
+		Positions3.push_back(Max + 1.0f);
+		Positions2.push_back(vec2(Min) - 1.0f);
+		Positions2.push_back(vec2(Max) + 1.0f);
+
+		std::vector<glm::uint64> Morton(Positions3.size());
+		std::vector<glm::uint64> Hilbert(Positions3.size());
+
+		glm::mortonEncode(&Positions3[0], Positions3.size(), Min, Max, &Morton[0]);
+		glm::hilbertEncode(&Positions3[0], Positions3.size(), Min, Max, &Hilbert[0]);
+		for(std::size_t i = 0; i < Positions3.size(); ++i)
+		{
+			glm::u32vec3 const Cell = glm::bitfieldDeinterleave3(Morton[i]);
+			Error += glm::all(glm::equal(glm::hilbertDecode3(Hilbert[i]), Cell)) ? 0 : 1;
+
+			glm::vec3 const Expected = glm::clamp((glm::vec3(Positions3[i]) - glm::vec3(Min)) / (glm::vec3(Max) - glm::vec3(Min)), 0.0f, 1.0f) * 2097151.0f;
+			Error += glm::all(glm::lessThanEqual(glm::abs(glm::vec3(Cell) - Expected), glm::vec3(2.0f))) ? 0 : 1;
+		}
+		Error += Morton[Morton.size() - 2] == 0 ? 0 : 1;
+		Error += Morton[Morton.size() - 1] == 0x7FFFFFFFFFFFFFFFull ? 0 : 1;
+
+		glm::mortonEncode(&Positions2[0], Positions2.size(), vec2(Min), vec2(Max), &Morton[0]);
+		glm::hilbertEncode(&Positions2[0], Positions2.size(), vec2(Min), vec2(Max), &Hilbert[0]);
+		for(std::size_t i = 0; i < Positions2.size(); ++i)
+			Error += glm::all(glm::equal(glm::hilbertDecode2(Hilbert[i]), glm::bitfieldDeinterleave(Morton[i]))) ? 0 : 1;
+		Error += Morton[Morton.size() - 2] == 0 ? 0 : 1;
+		Error += Morton[Morton.size() - 1] == 0xFFFFFFFFFFFFFFFFull ? 0 : 1;
+
+		return Error;
+	}
+
+	static int test()
+	{
+		int Error = 0;
+
+		Error += test_deinterleave();
+		Error += test_batch<glm::defaultp>();
+		Error += test_hilbert();
+		Error += test_quantize<glm::defaultp>();
+		Error += test_quantize<glm::packed_highp>();
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			Error += test_batch<glm::aligned_highp>();
+			Error += test_quantize<glm::aligned_highp>();
+#		endif
+
+		return Error;
+	}
+}//namespace morton
+
 static int test_bitfieldRotateRight()
 {
 	std::clock_t const LastTime = std::clock();
@@ -1057,5 +1244,7 @@ int main()
 	Error += test_bitfieldRotateRight();
 	Error += test_bitfieldRotateLeft();
 
+	Error += ::morton::test();
+
 	return Error;
 }
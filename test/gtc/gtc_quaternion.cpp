@@ -5,6 +5,9 @@
 #include <glm/ext/vector_relational.hpp>
 #include <glm/ext/scalar_relational.hpp>
 #include <glm/glm.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 #include <vector>
 
 static int test_quat_angle()
@@ -329,6 +332,104 @@ static int test_identity()
 	return Error;
 }
 
+template<glm::qualifier Q>
+static int test_quat_mat_cast_qualifier()
+{
+	typedef glm::qua<float, Q> quatType;
+	typedef glm::vec<3, float, Q> vec3Type;
+	typedef glm::mat<3, 3, float, Q> mat3Type;
+	typedef glm::mat<4, 4, float, Q> mat4Type;
+
+	int Error = 0;
+
+	vec3Type const Axes[] = {
+		vec3Type(1, 0, 0), vec3Type(0, 1, 0), vec3Type(0, 0, 1),
+		glm::normalize(vec3Type(1, 1, 0)), glm::normalize(vec3Type(1, -1, 0)), glm::normalize(vec3Type(-1, 2, 3))};
+	float const Angles[] = {0.0f, 0.1f, 1.0f, glm::half_pi<float>(), 3.0f, glm::pi<float>()};
+
+	for(std::size_t i = 0; i < sizeof(Axes) / sizeof(Axes[0]); ++i)
+	for(std::size_t j = 0; j < sizeof(Angles) / sizeof(Angles[0]); ++j)
+	{
+		quatType const Q0 = glm::angleAxis(Angles[j], Axes[i]);
+		glm::quat const P0(Q0.w, Q0.x, Q0.y, Q0.z);
+
+		mat3Type const M3 = glm::mat3_cast(Q0);
+		mat4Type const M4 = glm::mat4_cast(Q0);
+		glm::mat3 const N3 = glm::mat3_cast(P0);
+		glm::mat4 const N4 = glm::mat4_cast(P0);
+
+		for(glm::length_t c = 0; c < 3; ++c)
+		for(glm::length_t r = 0; r < 3; ++r)
+		{
+			Error += glm::equal(M3[c][r], N3[c][r], 0.00001f) ? 0 : 1;
+			Error += glm::equal(M4[c][r], N4[c][r], 0.00001f) ? 0 : 1;
+		}
+		Error += glm::all(glm::equal(glm::vec4(M4[3].x, M4[3].y, M4[3].z, M4[3].w), glm::vec4(0, 0, 0, 1), 0.0f)) ? 0 : 1;
+
+		quatType const Q3 = glm::quat_cast(M3);
+		quatType const Q4 = glm::quat_cast(M4);
+		glm::quat const R3 = glm::quat_cast(N3);
+
+		// The conversion picks the same sign as the scalar code, not only the same rotation
+		Error += glm::all(glm::equal(glm::vec4(Q3.x, Q3.y, Q3.z, Q3.w), glm::vec4(R3.x, R3.y, R3.z, R3.w), 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::vec4(Q4.x, Q4.y, Q4.z, Q4.w), glm::vec4(R3.x, R3.y, R3.z, R3.w), 0.0001f)) ? 0 : 1;
+		Error += glm::abs(glm::dot(Q3, Q0)) > 0.9999f ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_quat_mat_cast()
+{
+	int Error = 0;
+
+	Error += test_quat_mat_cast_qualifier<glm::defaultp>();
+	Error += test_quat_mat_cast_qualifier<glm::packed_highp>();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_quat_mat_cast_qualifier<glm::aligned_highp>();
+#	endif
+
+	return Error;
+}
+
+static int test_quat_mat_cast_trs()
+{
+	int Error = 0;
+
+	glm::vec3 const T(1.0f, -2.0f, 3.0f);
+	glm::quat const R = glm::angleAxis(0.7f, glm::normalize(glm::vec3(1, 2, 3)));
+	glm::vec3 const S(2.0f, 0.5f, -1.0f);
+
+	glm::mat4 const Expected = glm::translate(glm::mat4(1.0f), T) * glm::mat4_cast(R) * glm::scale(glm::mat4(1.0f), S);
+	glm::mat4 const M = glm::mat4_cast(T, R, S);
+	Error += glm::all(glm::equal(M, Expected, 0.00001f)) ? 0 : 1;
+
+	glm::mat3x4 const A = glm::mat3x4_cast(T, R, S);
+	Error += glm::all(glm::equal(A, glm::mat3x4(glm::transpose(Expected)), 0.00001f)) ? 0 : 1;
+
+	std::vector<glm::vec3> Translations(5, T);
+	std::vector<glm::quat> Orientations(5, R);
+	std::vector<glm::vec3> Scales(5, S);
+	std::vector<glm::mat4> Matrices(5);
+	std::vector<glm::mat3x4> Rows(5);
+	std::vector<glm::quat> Quats(5);
+
+	glm::mat4_cast(&Translations[0], &Orientations[0], &Scales[0], Matrices.size(), &Matrices[0]);
+	glm::mat3x4_cast(&Translations[0], &Orientations[0], &Scales[0], Rows.size(), &Rows[0]);
+	for(std::size_t i = 0; i < Matrices.size(); ++i)
+	{
+		Error += glm::all(glm::equal(Matrices[i], Expected, 0.00001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Rows[i], A, 0.00001f)) ? 0 : 1;
+	}
+
+	glm::mat4_cast(&Orientations[0], Matrices.size(), &Matrices[0]);
+	glm::quat_cast(&Matrices[0], Matrices.size(), &Quats[0]);
+	for(std::size_t i = 0; i < Quats.size(); ++i)
+		Error += glm::all(glm::equal(Quats[i], R, 0.0001f)) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -343,6 +444,8 @@ int main()
 	Error += test_quat_slerp();
     Error += test_quat_slerp_spins();
 	Error += test_identity();
+	Error += test_quat_mat_cast();
+	Error += test_quat_mat_cast_trs();
 
 	return Error;
 }
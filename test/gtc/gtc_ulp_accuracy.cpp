@@ -0,0 +1,514 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtc/ulp.hpp>
+#include <glm/gtx/fast_exponential.hpp>
+#include <glm/gtx/fast_square_root.hpp>
+#include <glm/gtx/fast_trigonometry.hpp>
+#include <glm/common.hpp>
+#include <glm/exponential.hpp>
+#include <glm/geometric.hpp>
+#include <glm/trigonometric.hpp>
+#include <glm/matrix.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_double4.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cmath>
+
+// Each code path of a function is swept over an input domain and compared with a double precision reference.
+// The test fails when the maximum error of a path exceeds its bound, only the failed paths are printed.
+// With GLM_PERF_TEST_ENABLE, the maximum and mean errors of every path are reported with its throughput. Bounds are given separately for the generic highp paths (scalar
+// and packed_highp vectors), for packed_lowp vectors and for the SIMD paths (aligned_highp vectors and batch functions).
+namespace accuracy
+{
+	static std::size_t const Samples = 1 << 16;
+
+	enum metric
+	{
+		ULP,
+		ABSOLUTE
+	};
+
+	struct bound
+	{
+		bound(double All) : Highp(All), Lowp(All), Simd(All) {}
+		bound(double HighpBound, double LowpBound, double SimdBound) : Highp(HighpBound), Lowp(LowpBound), Simd(SimdBound) {}
+
+		double Highp;
+		double Lowp;
+		double Simd;
+	};
+
+	struct stats
+	{
+		stats() : MaxUlp(0), MeanUlp(0), MaxAbs(0), Nanoseconds(0) {}
+
+		double MaxUlp;
+		double MeanUlp;
+		double MaxAbs;
+		double Nanoseconds;
+	};
+
+	typedef std::chrono::high_resolution_clock clock;
+
+	static double nanoseconds(clock::time_point Begin, clock::time_point End, std::size_t Count)
+	{
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(End - Begin).count()) / static_cast<double>(Count);
+	}
+
+	// float_distance compares the bit patterns, values of opposite signs are measured through zero
+	static double ulp_distance(float Value, float Reference)
+	{
+		if(std::isnan(Value) || std::isnan(Reference))
+			return std::isnan(Value) && std::isnan(Reference) ? 0.0 : HUGE_VAL;
+		if(std::signbit(Value) != std::signbit(Reference))
+			return static_cast<double>(glm::float_distance(glm::abs(Value), 0.0f)) + static_cast<double>(glm::float_distance(glm::abs(Reference), 0.0f));
+		return static_cast<double>(glm::float_distance(Value, Reference));
+	}
+
+	static stats measure(std::vector<float> const& Out, std::vector<double> const& Reference, double Nanoseconds)
+	{
+		stats Result;
+		Result.Nanoseconds = Nanoseconds;
+
+		for(std::size_t i = 0; i < Out.size(); ++i)
+		{
+			double const Ulp = ulp_distance(Out[i], static_cast<float>(Reference[i]));
+			Result.MaxUlp = glm::max(Result.MaxUlp, Ulp);
+			Result.MeanUlp += Ulp;
+			Result.MaxAbs = glm::max(Result.MaxAbs, std::fabs(static_cast<double>(Out[i]) - Reference[i]));
+		}
+		Result.MeanUlp /= static_cast<double>(Out.size());
+
+		return Result;
+	}
+
+	static int report(char const* Function, char const* Path, stats const& Stats, metric Metric, double Bound)
+	{
+		double const Error = Metric == ULP ? Stats.MaxUlp : Stats.MaxAbs;
+		bool const Failed = !(Error <= Bound);
+
+#		ifdef GLM_TEST_PERF
+			std::printf("%-16s %-14s max %10.1f ulp, mean %9.2f ulp, abs %8.1e, %6.2f ns%s\n",
+				Function, Path, Stats.MaxUlp, Stats.MeanUlp, Stats.MaxAbs, Stats.Nanoseconds, Failed ? " FAILED" : "");
+#		else
+			if(Failed)
+				std::printf("%-16s %-14s max %10.1f ulp, mean %9.2f ulp, abs %8.1e, bound %8.1e FAILED\n",
+					Function, Path, Stats.MaxUlp, Stats.MeanUlp, Stats.MaxAbs, Bound);
+#		endif
+
+		return Failed ? 1 : 0;
+	}
+
+	// Component-wise paths: F::call is the tested function and F::reference its double precision counterpart
+
+	template<typename F>
+	static double run_scalar(std::vector<float> const& In, std::vector<float>& Out)
+	{
+		clock::time_point const Begin = clock::now();
+		for(std::size_t i = 0; i < In.size(); ++i)
+			Out[i] = F::call(In[i]);
+		clock::time_point const End = clock::now();
+
+		return nanoseconds(Begin, End, In.size());
+	}
+
+	template<typename F, glm::qualifier Q>
+	static double run_vec4(std::vector<float> const& In, std::vector<float>& Out)
+	{
+		clock::time_point const Begin = clock::now();
+		for(std::size_t i = 0; i < In.size(); i += 4)
+		{
+			glm::vec<4, float, Q> const Result = F::call(glm::vec<4, float, Q>(In[i + 0], In[i + 1], In[i + 2], In[i + 3]));
+			for(glm::length_t j = 0; j < 4; ++j)
+				Out[i + static_cast<std::size_t>(j)] = Result[j];
+		}
+		clock::time_point const End = clock::now();
+
+		return nanoseconds(Begin, End, In.size());
+	}
+
+	template<typename F>
+	static double run_batch(std::vector<float> const& In, std::vector<float>& Out)
+	{
+		clock::time_point const Begin = clock::now();
+		F::batch(&In[0], In.size(), &Out[0]);
+		clock::time_point const End = clock::now();
+
+		return nanoseconds(Begin, End, In.size());
+	}
+
+	template<typename F>
+	static void sample(float Min, float Max, std::vector<float>& In, std::vector<double>& Reference)
+	{
+		In.resize(Samples);
+		Reference.resize(Samples);
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			In[i] = glm::mix(Min, Max, static_cast<float>(i) / static_cast<float>(Samples - 1));
+			Reference[i] = F::reference(static_cast<double>(In[i]));
+		}
+	}
+
+	template<typename F>
+	static int check(float Min, float Max, metric Metric, bound const& Bound)
+	{
+		int Error = 0;
+
+		std::vector<float> In;
+		std::vector<double> Reference;
+		sample<F>(Min, Max, In, Reference);
+
+		std::vector<float> Out(In.size());
+
+		Error += report(F::name(), "scalar", measure(Out, Reference, run_scalar<F>(In, Out)), Metric, Bound.Highp);
+		Error += report(F::name(), "packed_highp", measure(Out, Reference, run_vec4<F, glm::packed_highp>(In, Out)), Metric, Bound.Highp);
+		Error += report(F::name(), "packed_lowp", measure(Out, Reference, run_vec4<F, glm::packed_lowp>(In, Out)), Metric, Bound.Lowp);
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			Error += report(F::name(), "aligned_highp", measure(Out, Reference, run_vec4<F, glm::aligned_highp>(In, Out)), Metric, Bound.Simd);
+#		endif
+
+		return Error;
+	}
+
+	// Functions with a batch overload, F::batch processes the whole array and only uses SIMD instructions when they are enabled
+	template<typename F>
+	static int check_batch(float Min, float Max, metric Metric, bound const& Bound)
+	{
+#		if GLM_CONFIG_SIMD == GLM_ENABLE
+			double const BatchBound = Bound.Simd;
+#		else
+			double const BatchBound = Bound.Highp;
+#		endif
+
+		int Error = check<F>(Min, Max, Metric, Bound);
+
+		std::vector<float> In;
+		std::vector<double> Reference;
+		sample<F>(Min, Max, In, Reference);
+
+		std::vector<float> Out(In.size());
+
+		Error += report(F::name(), "batch", measure(Out, Reference, run_batch<F>(In, Out)), Metric, BatchBound);
+
+		return Error;
+	}
+
+	// Geometric paths: F::call and F::reference take a whole vector and return one value per component
+
+	template<typename F, glm::qualifier Q>
+	static int check_geometric_path(char const* Path, std::vector<glm::vec4> const& In, std::vector<double> const& Reference, metric Metric, double Bound)
+	{
+		std::vector<float> Out(In.size() * 4);
+
+		clock::time_point const Begin = clock::now();
+		for(std::size_t i = 0; i < In.size(); ++i)
+		{
+			glm::vec<4, float, Q> const Result = F::call(glm::vec<4, float, Q>(In[i]));
+			for(glm::length_t j = 0; j < 4; ++j)
+				Out[i * 4 + static_cast<std::size_t>(j)] = Result[j];
+		}
+		clock::time_point const End = clock::now();
+
+		return report(F::name(), Path, measure(Out, Reference, nanoseconds(Begin, End, In.size())), Metric, Bound);
+	}
+
+	template<typename F>
+	static int check_geometric(float Min, float Max, metric Metric, bound const& Bound)
+	{
+		int Error = 0;
+
+		std::size_t const Count = Samples / 4;
+
+		std::vector<glm::vec4> In(Count);
+		std::vector<double> Reference(Count * 4);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const a = static_cast<float>(i) / static_cast<float>(Count - 1);
+			In[i] = glm::mix(glm::vec4(Min), glm::vec4(Max), glm::vec4(a, glm::fract(a * 7.0f), glm::fract(a * 31.0f), glm::fract(a * 127.0f)));
+
+			glm::dvec4 const Result = F::reference(glm::dvec4(In[i]));
+			for(glm::length_t j = 0; j < 4; ++j)
+				Reference[i * 4 + static_cast<std::size_t>(j)] = Result[j];
+		}
+
+		Error += check_geometric_path<F, glm::packed_highp>("packed_highp", In, Reference, Metric, Bound.Highp);
+		Error += check_geometric_path<F, glm::packed_lowp>("packed_lowp", In, Reference, Metric, Bound.Lowp);
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			Error += check_geometric_path<F, glm::aligned_highp>("aligned_highp", In, Reference, Metric, Bound.Simd);
+#		endif
+
+		return Error;
+	}
+
+	// Matrix paths: F::call and F::reference take a 4x4 matrix and return a 4x4 matrix
+
+	template<typename F, glm::qualifier Q>
+	static int check_matrix_path(char const* Path, std::vector<glm::mat4> const& In, std::vector<double> const& Reference, metric Metric, double Bound)
+	{
+		std::vector<float> Out(In.size() * 16);
+
+		clock::time_point const Begin = clock::now();
+		for(std::size_t i = 0; i < In.size(); ++i)
+		{
+			glm::mat<4, 4, float, Q> const Result = F::call(glm::mat<4, 4, float, Q>(In[i]));
+			for(glm::length_t c = 0; c < 4; ++c)
+			for(glm::length_t r = 0; r < 4; ++r)
+				Out[i * 16 + static_cast<std::size_t>(c * 4 + r)] = Result[c][r];
+		}
+		clock::time_point const End = clock::now();
+
+		return report(F::name(), Path, measure(Out, Reference, nanoseconds(Begin, End, In.size())), Metric, Bound);
+	}
+
+	// The matrices are diagonally dominant to bound their condition number: the errors only depend on the code paths
+	template<typename F>
+	static int check_matrix(metric Metric, bound const& Bound)
+	{
+		int Error = 0;
+
+		std::size_t const Count = Samples / 16;
+
+		std::vector<glm::mat4> In(Count);
+		std::vector<double> Reference(Count * 16);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const a = static_cast<float>(i) / static_cast<float>(Count - 1);
+			for(glm::length_t c = 0; c < 4; ++c)
+			for(glm::length_t r = 0; r < 4; ++r)
+				In[i][c][r] = glm::fract(a * static_cast<float>(7 + 16 * c + 4 * r)) * 2.0f - 1.0f + (c == r ? 4.0f : 0.0f);
+
+			glm::dmat4 const Result = F::reference(glm::dmat4(In[i]));
+			for(glm::length_t c = 0; c < 4; ++c)
+			for(glm::length_t r = 0; r < 4; ++r)
+				Reference[i * 16 + static_cast<std::size_t>(c * 4 + r)] = Result[c][r];
+		}
+
+		Error += check_matrix_path<F, glm::packed_highp>("packed_highp", In, Reference, Metric, Bound.Highp);
+		Error += check_matrix_path<F, glm::packed_lowp>("packed_lowp", In, Reference, Metric, Bound.Lowp);
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			Error += check_matrix_path<F, glm::aligned_highp>("aligned_highp", In, Reference, Metric, Bound.Simd);
+#		endif
+
+		return Error;
+	}
+}//namespace accuracy
+
+namespace functions
+{
+#	define GLM_ACCURACY_FUNCTION(Name, Function, Reference) \
+	struct Name \
+	{ \
+		static char const* name() {return #Function;} \
+		static double reference(double x) {return Reference(x);} \
+		template<typename genType> \
+		static genType call(genType const& x) {return glm::Function(x);} \
+	};
+
+#	define GLM_ACCURACY_BATCH(Name, Function, Reference) \
+	struct Name \
+	{ \
+		static char const* name() {return #Function;} \
+		static double reference(double x) {return Reference(x);} \
+		template<typename genType> \
+		static genType call(genType const& x) {return glm::Function(x);} \
+		static void batch(float const* In, std::size_t Count, float* Out) {glm::Function(In, Count, Out);} \
+	};
+
+	static double inversesqrt(double x) {return 1.0 / std::sqrt(x);}
+	static double exp2(double x) {return std::pow(2.0, x);}
+	static double log2(double x) {return std::log(x) / std::log(2.0);}
+	static double fract(double x) {return x - std::floor(x);}
+
+	GLM_ACCURACY_FUNCTION(abs_t, abs, std::fabs)
+	GLM_ACCURACY_FUNCTION(floor_t, floor, std::floor)
+	GLM_ACCURACY_FUNCTION(ceil_t, ceil, std::ceil)
+	GLM_ACCURACY_FUNCTION(fract_t, fract, fract)
+	GLM_ACCURACY_FUNCTION(sqrt_t, sqrt, std::sqrt)
+	GLM_ACCURACY_FUNCTION(inversesqrt_t, inversesqrt, inversesqrt)
+	GLM_ACCURACY_FUNCTION(exp_t, exp, std::exp)
+	GLM_ACCURACY_FUNCTION(log_t, log, std::log)
+	GLM_ACCURACY_FUNCTION(exp2_t, exp2, exp2)
+	GLM_ACCURACY_FUNCTION(log2_t, log2, log2)
+	GLM_ACCURACY_FUNCTION(sin_t, sin, std::sin)
+	GLM_ACCURACY_FUNCTION(cos_t, cos, std::cos)
+	GLM_ACCURACY_FUNCTION(tan_t, tan, std::tan)
+	GLM_ACCURACY_FUNCTION(asin_t, asin, std::asin)
+	GLM_ACCURACY_FUNCTION(acos_t, acos, std::acos)
+	GLM_ACCURACY_FUNCTION(atan_t, atan, std::atan)
+
+	GLM_ACCURACY_BATCH(fastSqrt_t, fastSqrt, std::sqrt)
+	GLM_ACCURACY_BATCH(fastInverseSqrt_t, fastInverseSqrt, inversesqrt)
+	GLM_ACCURACY_BATCH(fastSin_t, fastSin, std::sin)
+	GLM_ACCURACY_BATCH(fastCos_t, fastCos, std::cos)
+	GLM_ACCURACY_FUNCTION(fastTan_t, fastTan, std::tan)
+	GLM_ACCURACY_FUNCTION(fastAsin_t, fastAsin, std::asin)
+	GLM_ACCURACY_FUNCTION(fastAcos_t, fastAcos, std::acos)
+	GLM_ACCURACY_FUNCTION(fastAtan_t, fastAtan, std::atan)
+	GLM_ACCURACY_FUNCTION(fastExp_t, fastExp, std::exp)
+	GLM_ACCURACY_FUNCTION(fastLog_t, fastLog, std::log)
+	GLM_ACCURACY_FUNCTION(fastExp2_t, fastExp2, exp2)
+	GLM_ACCURACY_FUNCTION(fastLog2_t, fastLog2, log2)
+
+#	undef GLM_ACCURACY_BATCH
+#	undef GLM_ACCURACY_FUNCTION
+
+	struct length_t
+	{
+		static char const* name() {return "length";}
+		static glm::dvec4 reference(glm::dvec4 const& x) {return glm::dvec4(std::sqrt(x.x * x.x + x.y * x.y + x.z * x.z + x.w * x.w));}
+		template<typename vecType>
+		static vecType call(vecType const& x) {return vecType(glm::length(x));}
+	};
+
+	struct normalize_t
+	{
+		static char const* name() {return "normalize";}
+		static glm::dvec4 reference(glm::dvec4 const& x) {return x / length_t::reference(x);}
+		template<typename vecType>
+		static vecType call(vecType const& x) {return glm::normalize(x);}
+	};
+
+	struct fastLength_t
+	{
+		static char const* name() {return "fastLength";}
+		static glm::dvec4 reference(glm::dvec4 const& x) {return length_t::reference(x);}
+		template<typename vecType>
+		static vecType call(vecType const& x) {return vecType(glm::fastLength(x));}
+	};
+
+	struct fastNormalize_t
+	{
+		static char const* name() {return "fastNormalize";}
+		static glm::dvec4 reference(glm::dvec4 const& x) {return normalize_t::reference(x);}
+		template<typename vecType>
+		static vecType call(vecType const& x) {return glm::fastNormalize(x);}
+	};
+
+	// The reference is computed in double precision, by the same cofactor expansion
+	struct inverse_t
+	{
+		static char const* name() {return "inverse";}
+		static glm::dmat4 reference(glm::dmat4 const& m) {return glm::inverse(m);}
+		template<typename matType>
+		static matType call(matType const& m) {return glm::inverse(m);}
+	};
+
+	// The determinant is stored in every component
+	struct determinant_t
+	{
+		static char const* name() {return "determinant";}
+		static glm::dmat4 reference(glm::dmat4 const& m) {return fill(glm::determinant(m));}
+		template<typename matType>
+		static matType call(matType const& m) {return fill<matType>(glm::determinant(m));}
+
+		template<typename matType = glm::dmat4>
+		static matType fill(typename matType::value_type Value)
+		{
+			typename matType::col_type const Column(Value);
+			return matType(Column, Column, Column, Column);
+		}
+	};
+}//namespace functions
+
+static int test_common()
+{
+	int Error = 0;
+
+	Error += accuracy::check<functions::abs_t>(-1000.0f, 1000.0f, accuracy::ULP, 0);
+	Error += accuracy::check<functions::floor_t>(-1000.0f, 1000.0f, accuracy::ULP, 0);
+	Error += accuracy::check<functions::ceil_t>(-1000.0f, 1000.0f, accuracy::ULP, 0);
+	Error += accuracy::check<functions::fract_t>(-1000.0f, 1000.0f, accuracy::ULP, 0);
+
+	return Error;
+}
+
+// The lowp inversesqrt is computed with a single Newton step from an integer estimate
+static int test_exponential()
+{
+	int Error = 0;
+
+	Error += accuracy::check<functions::sqrt_t>(0.0f, 10000.0f, accuracy::ULP, 0);
+	Error += accuracy::check<functions::inversesqrt_t>(0.001f, 10000.0f, accuracy::ULP, accuracy::bound(1, 32768, 1));
+	Error += accuracy::check<functions::exp_t>(-80.0f, 80.0f, accuracy::ULP, 1);
+	Error += accuracy::check<functions::log_t>(0.001f, 10000.0f, accuracy::ULP, 1);
+	Error += accuracy::check<functions::exp2_t>(-100.0f, 100.0f, accuracy::ULP, 1);
+	Error += accuracy::check<functions::log2_t>(0.001f, 10000.0f, accuracy::ULP, 1);
+
+	return Error;
+}
+
+static int test_trigonometric()
+{
+	int Error = 0;
+
+	Error += accuracy::check<functions::sin_t>(-100.0f, 100.0f, accuracy::ULP, 1);
+	Error += accuracy::check<functions::cos_t>(-100.0f, 100.0f, accuracy::ULP, 1);
+	Error += accuracy::check<functions::tan_t>(-1.5f, 1.5f, accuracy::ULP, 1);
+	Error += accuracy::check<functions::asin_t>(-1.0f, 1.0f, accuracy::ULP, 1);
+	Error += accuracy::check<functions::acos_t>(-1.0f, 1.0f, accuracy::ULP, 1);
+	Error += accuracy::check<functions::atan_t>(-100.0f, 100.0f, accuracy::ULP, 1);
+
+	return Error;
+}
+
+// The SIMD normalize multiplies by the inverse of the length instead of dividing each component
+static int test_geometric()
+{
+	int Error = 0;
+
+	Error += accuracy::check_geometric<functions::length_t>(-100.0f, 100.0f, accuracy::ULP, 1);
+	Error += accuracy::check_geometric<functions::normalize_t>(-100.0f, 100.0f, accuracy::ULP, accuracy::bound(2, 2, 4));
+
+	return Error;
+}
+
+static int test_matrix()
+{
+	int Error = 0;
+
+	Error += accuracy::check_matrix<functions::inverse_t>(accuracy::ABSOLUTE, 2e-5);
+	Error += accuracy::check_matrix<functions::determinant_t>(accuracy::ULP, 32);
+
+	return Error;
+}
+
+// The fast trigonometric functions are bounded by their absolute error, reported in the header of GLM_GTX_fast_trigonometry
+static int test_fast()
+{
+	int Error = 0;
+
+	Error += accuracy::check_batch<functions::fastSqrt_t>(0.001f, 10000.0f, accuracy::ULP, accuracy::bound(32768, 32768, 4));
+	Error += accuracy::check_batch<functions::fastInverseSqrt_t>(0.001f, 10000.0f, accuracy::ULP, accuracy::bound(32768, 32768, 4));
+	Error += accuracy::check_batch<functions::fastSin_t>(-100.0f, 100.0f, accuracy::ABSOLUTE, accuracy::bound(2e-5, 2e-5, 1e-5));
+	Error += accuracy::check_batch<functions::fastCos_t>(-100.0f, 100.0f, accuracy::ABSOLUTE, accuracy::bound(2e-5, 2e-5, 1e-5));
+	Error += accuracy::check<functions::fastTan_t>(-0.5f, 0.5f, accuracy::ABSOLUTE, 1e-4);
+	Error += accuracy::check<functions::fastAsin_t>(-0.5f, 0.5f, accuracy::ABSOLUTE, 2e-5);
+	Error += accuracy::check<functions::fastAcos_t>(-0.5f, 0.5f, accuracy::ABSOLUTE, 2e-5);
+	Error += accuracy::check<functions::fastAtan_t>(-0.5f, 0.5f, accuracy::ABSOLUTE, 1e-5);
+	Error += accuracy::check<functions::fastExp_t>(-1.0f, 1.0f, accuracy::ULP, 65536);
+	Error += accuracy::check<functions::fastLog_t>(0.001f, 10000.0f, accuracy::ULP, 1);
+	Error += accuracy::check<functions::fastExp2_t>(-1.0f, 1.0f, accuracy::ULP, 8192);
+	Error += accuracy::check<functions::fastLog2_t>(0.001f, 10000.0f, accuracy::ULP, 1);
+	Error += accuracy::check_geometric<functions::fastLength_t>(-100.0f, 100.0f, accuracy::ULP, 32768);
+	Error += accuracy::check_geometric<functions::fastNormalize_t>(-100.0f, 100.0f, accuracy::ULP, accuracy::bound(32768, 32768, 4));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_common();
+	Error += test_exponential();
+	Error += test_trigonometric();
+	Error += test_geometric();
+	Error += test_matrix();
+	Error += test_fast();
+
+	return Error;
+}
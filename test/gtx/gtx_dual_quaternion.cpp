@@ -6,6 +6,10 @@
 #include <glm/gtx/euler_angles.hpp>
 #include <glm/vector_relational.hpp>
 #include <type_traits>
+#include <vector>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 
 static int myrand()
 {
@@ -188,6 +192,89 @@ static int test_size()
 	return Error;
 }
 
+template<glm::qualifier Q>
+static int test_skin_qualifier()
+{
+	typedef glm::tdualquat<float, Q> dualquatType;
+	typedef glm::qua<float, Q> quatType;
+	typedef glm::vec<3, float, Q> vec3Type;
+
+	int Error = 0;
+	float const Epsilon = 0.0001f;
+
+	std::vector<dualquatType> Palette;
+	Palette.push_back(dualquatType(glm::angleAxis(0.5f, glm::normalize(vec3Type(1, 2, 3))), vec3Type(1, 0, 0)));
+	Palette.push_back(dualquatType(glm::angleAxis(-1.2f, glm::normalize(vec3Type(0, 1, 0))), vec3Type(0, 2, -1)));
+	// Same transform as the first bone, stored in the opposite hemisphere
+	Palette.push_back(-Palette[0]);
+
+	vec3Type const Position(0.5f, -1.0f, 2.0f);
+	vec3Type const Normal(glm::normalize(vec3Type(1, 1, 0)));
+
+	// A single influence matches the dual quaternion transform
+	{
+		unsigned int const Indices[] = {1};
+		float const Weights[] = {1.0f};
+		dualquatType const Blend = glm::dualquat_blend(&Palette[0], Indices, Weights, 1);
+		Error += glm::all(glm::epsilonEqual(Blend * Position, Palette[1] * Position, Epsilon)) ? 0 : 1;
+	}
+
+	// Antipodal influences describe the same transform and must not cancel each other
+	{
+		unsigned int const Indices[] = {0, 2, 2, 0};
+		float const Weights[] = {0.25f, 0.25f, 0.25f, 0.25f};
+		dualquatType const Blend = glm::dualquat_blend(&Palette[0], Indices, Weights, 4);
+		Error += glm::all(glm::epsilonEqual(Blend * Position, Palette[0] * Position, Epsilon)) ? 0 : 1;
+	}
+
+	// Skinning matches per vertex blending followed by the mat3x4_cast path
+	{
+		std::size_t const Count = 16;
+		glm::length_t const Influences = 2;
+		std::vector<unsigned short> Indices(Count * Influences);
+		std::vector<float> Weights(Count * Influences);
+		std::vector<vec3Type> Positions(Count, Position), Normals(Count, Normal);
+		std::vector<vec3Type> OutPositions(Count), OutNormals(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Indices[i * 2 + 0] = static_cast<unsigned short>(i % 3);
+			Indices[i * 2 + 1] = static_cast<unsigned short>((i + 1) % 3);
+			Weights[i * 2 + 0] = static_cast<float>(i) / static_cast<float>(Count);
+			Weights[i * 2 + 1] = 1.0f - Weights[i * 2 + 0];
+			Positions[i] += vec3Type(static_cast<float>(i));
+		}
+
+		glm::dualquat_skin(&Palette[0], &Indices[0], &Weights[0], Influences, &Positions[0], &Normals[0], Count, &OutPositions[0], &OutNormals[0]);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			dualquatType const Blend = glm::dualquat_blend(&Palette[0], &Indices[i * 2], &Weights[i * 2], Influences);
+			glm::mat<3, 4, float, Q> const M = glm::mat3x4_cast(Blend);
+			glm::vec<4, float, Q> const P(Positions[i], 1.0f);
+			vec3Type const Expected(glm::dot(M[0], P), glm::dot(M[1], P), glm::dot(M[2], P));
+			quatType const Rotation(Blend.real);
+
+			Error += glm::all(glm::epsilonEqual(OutPositions[i], Expected, 0.001f)) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(OutNormals[i], Rotation * Normals[i], Epsilon)) ? 0 : 1;
+			Error += glm::epsilonEqual(glm::length(OutNormals[i]), 1.0f, Epsilon) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+static int test_skin()
+{
+	int Error = 0;
+
+	Error += test_skin_qualifier<glm::defaultp>();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_skin_qualifier<glm::aligned_highp>();
+#	endif
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -198,6 +285,7 @@ int main()
 	Error += test_inverse();
 	Error += test_mul();
 	Error += test_size();
+	Error += test_skin();
 
 	return Error;
 }
@@ -2,6 +2,13 @@
 #include <glm/glm.hpp>
 #include <glm/gtx/quaternion.hpp>
 #include <glm/gtx/easing.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+
+#include <vector>
 
 namespace
 {
@@ -79,6 +86,144 @@ namespace
 	}
 }
 
+// The vector overloads and ease match the scalar functions
+template<typename T>
+struct easing_reference
+{
+	glm::easing_curve Curve;
+	T (*Scalar)(T const&);
+};
+
+template<typename T>
+static std::vector<easing_reference<T> > easing_references()
+{
+	easing_reference<T> const References[] =
+	{
+		{glm::easing_linear, glm::linearInterpolation<T>},
+		{glm::easing_quadratic_in, glm::quadraticEaseIn<T>},
+		{glm::easing_quadratic_out, glm::quadraticEaseOut<T>},
+		{glm::easing_quadratic_in_out, glm::quadraticEaseInOut<T>},
+		{glm::easing_cubic_in, glm::cubicEaseIn<T>},
+		{glm::easing_cubic_out, glm::cubicEaseOut<T>},
+		{glm::easing_cubic_in_out, glm::cubicEaseInOut<T>},
+		{glm::easing_quartic_in, glm::quarticEaseIn<T>},
+		{glm::easing_quartic_out, glm::quarticEaseOut<T>},
+		{glm::easing_quartic_in_out, glm::quarticEaseInOut<T>},
+		{glm::easing_quintic_in, glm::quinticEaseIn<T>},
+		{glm::easing_quintic_out, glm::quinticEaseOut<T>},
+		{glm::easing_quintic_in_out, glm::quinticEaseInOut<T>},
+		{glm::easing_sine_in, glm::sineEaseIn<T>},
+		{glm::easing_sine_out, glm::sineEaseOut<T>},
+		{glm::easing_sine_in_out, glm::sineEaseInOut<T>},
+		{glm::easing_circular_in, glm::circularEaseIn<T>},
+		{glm::easing_circular_out, glm::circularEaseOut<T>},
+		{glm::easing_circular_in_out, glm::circularEaseInOut<T>},
+		{glm::easing_exponential_in, glm::exponentialEaseIn<T>},
+		{glm::easing_exponential_out, glm::exponentialEaseOut<T>},
+		{glm::easing_exponential_in_out, glm::exponentialEaseInOut<T>},
+		{glm::easing_elastic_in, glm::elasticEaseIn<T>},
+		{glm::easing_elastic_out, glm::elasticEaseOut<T>},
+		{glm::easing_elastic_in_out, glm::elasticEaseInOut<T>},
+		{glm::easing_back_in, glm::backEaseIn<T>},
+		{glm::easing_back_out, glm::backEaseOut<T>},
+		{glm::easing_back_in_out, glm::backEaseInOut<T>},
+		{glm::easing_bounce_in, glm::bounceEaseIn<T>},
+		{glm::easing_bounce_out, glm::bounceEaseOut<T>},
+		{glm::easing_bounce_in_out, glm::bounceEaseInOut<T>}
+	};
+	return std::vector<easing_reference<T> >(References, References + sizeof(References) / sizeof(References[0]));
+}
+
+// Parameters in [0, 1] including the bounds and the edges of the pieces, not a multiple of 4
+template<typename T>
+static std::vector<T> easing_parameters()
+{
+	std::vector<T> Params;
+	for(int i = 0; i <= 200; ++i)
+		Params.push_back(static_cast<T>(i) / static_cast<T>(200));
+	Params.push_back(static_cast<T>(4.0 / 11.0));
+	Params.push_back(static_cast<T>(8.0 / 11.0));
+	return Params;
+}
+
+template<typename T>
+static int test_ease()
+{
+	int Error = 0;
+
+	std::vector<easing_reference<T> > const References = easing_references<T>();
+	std::vector<T> const Params = easing_parameters<T>();
+	T const Epsilon = static_cast<T>(0.00001);
+
+	for(std::size_t k = 0; k < References.size(); ++k)
+	{
+		for(std::size_t Count = 0; Count <= Params.size(); Count += Count < 8 ? 1 : Params.size() - 8)
+		{
+			std::vector<T> Out(Count + 1, static_cast<T>(-7));
+			glm::ease(References[k].Curve, &Params[0], Count, &Out[0]);
+
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += glm::equal(Out[i], References[k].Scalar(Params[i]), Epsilon) ? 0 : 1;
+			Error += Out[Count] == static_cast<T>(-7) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+template<typename vecType>
+static int test_vector(vecType (*Function)(vecType const&), typename vecType::value_type (*Scalar)(typename vecType::value_type const&))
+{
+	typedef typename vecType::value_type T;
+
+	int Error = 0;
+
+	std::vector<T> const Params = easing_parameters<T>();
+	for(std::size_t i = 0; i + vecType::length() <= Params.size(); ++i)
+	{
+		vecType a;
+		for(glm::length_t j = 0; j < vecType::length(); ++j)
+			a[j] = Params[i + static_cast<std::size_t>(j)];
+
+		vecType const Result = Function(a);
+		for(glm::length_t j = 0; j < vecType::length(); ++j)
+			Error += glm::equal(Result[j], Scalar(a[j]), static_cast<T>(0.00001)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<glm::length_t L, typename T, glm::qualifier Q>
+static int test_vectors()
+{
+	typedef glm::vec<L, T, Q> vecType;
+
+	int Error = 0;
+
+	Error += test_vector<vecType>(glm::quadraticEaseInOut, glm::quadraticEaseInOut);
+	Error += test_vector<vecType>(glm::cubicEaseInOut, glm::cubicEaseInOut);
+	Error += test_vector<vecType>(glm::quarticEaseOut, glm::quarticEaseOut);
+	Error += test_vector<vecType>(glm::quinticEaseInOut, glm::quinticEaseInOut);
+	Error += test_vector<vecType>(glm::sineEaseIn, glm::sineEaseIn);
+	Error += test_vector<vecType>(glm::circularEaseInOut, glm::circularEaseInOut);
+	Error += test_vector<vecType>(glm::exponentialEaseIn, glm::exponentialEaseIn);
+	Error += test_vector<vecType>(glm::exponentialEaseOut, glm::exponentialEaseOut);
+	Error += test_vector<vecType>(glm::elasticEaseInOut, glm::elasticEaseInOut);
+	Error += test_vector<vecType>(glm::backEaseInOut, glm::backEaseInOut);
+	Error += test_vector<vecType>(glm::bounceEaseOut, glm::bounceEaseOut);
+	Error += test_vector<vecType>(glm::bounceEaseInOut, glm::bounceEaseInOut);
+
+	// Overshoot per component
+	vecType const a(static_cast<T>(0.25));
+	vecType o(static_cast<T>(1.70158));
+	o[0] = static_cast<T>(3);
+	vecType const Result = glm::backEaseIn(a, o);
+	Error += glm::equal(Result[0], glm::backEaseIn(a[0], o[0]), static_cast<T>(0.00001)) ? 0 : 1;
+	Error += glm::equal(Result[L - 1], glm::backEaseIn(a[L - 1]), static_cast<T>(0.00001)) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -86,6 +231,17 @@ int main()
 	_test_easing<float>();
 	_test_easing<double>();
 
+	Error += test_ease<float>();
+	Error += test_ease<double>();
+
+	Error += test_vectors<2, float, glm::defaultp>();
+	Error += test_vectors<4, float, glm::defaultp>();
+	Error += test_vectors<3, double, glm::defaultp>();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_vectors<4, float, glm::aligned_highp>();
+		Error += test_vectors<4, double, glm::aligned_highp>();
+#	endif
+
 	return Error;
 }
 
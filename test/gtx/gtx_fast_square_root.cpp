@@ -3,6 +3,14 @@
 #include <glm/gtc/type_precision.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/vector_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <cmath>
+#include <limits>
+#include <vector>
 
 static int test_fastInverseSqrt()
 {
@@ -34,12 +42,91 @@ static int test_fastDistance()
 	return Error;
 }
 
+// Relative errors of the table of the extension documentation
+static int test_error_bound()
+{
+	int Error = 0;
+
+	std::size_t const Count = 10003;
+	std::vector<float> In(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = 0.001f + 1000.0f * static_cast<float>(i) / static_cast<float>(Count - 1);
+
+	std::vector<float> Sqrt(Count);
+	std::vector<float> InverseSqrt(Count);
+	glm::fastSqrt(&In[0], Count, &Sqrt[0]);
+	glm::fastInverseSqrt(&In[0], Count, &InverseSqrt[0]);
+
+	float const Bound = GLM_CONFIG_SIMD == GLM_ENABLE ? 3e-7f : 1.8e-3f;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		double const Reference = std::sqrt(static_cast<double>(In[i]));
+		Error += std::abs(Sqrt[i] - Reference) <= Bound * Reference ? 0 : 1;
+		Error += std::abs(InverseSqrt[i] - 1.0 / Reference) <= Bound / Reference ? 0 : 1;
+		Error += std::abs(glm::fastSqrt(In[i]) - Reference) <= 1.8e-3 * Reference ? 0 : 1;
+		Error += std::abs(glm::fastInverseSqrt(In[i]) - 1.0 / Reference) <= 1.8e-3 / Reference ? 0 : 1;
+	}
+
+	// The last values of the batch are computed like the others
+	std::vector<float> Tail(In.end() - 3, In.end());
+	glm::fastSqrt(&Tail[0], Tail.size(), &Tail[0]);
+	for(std::size_t i = 0; i < Tail.size(); ++i)
+		Error += glm::equal(Tail[i], Sqrt[Count - 3 + i], 0.0f) ? 0 : 1;
+
+	float Zero = 0.0f;
+	glm::fastSqrt(&Zero, 1, &Zero);
+	Error += GLM_CONFIG_SIMD == GLM_DISABLE || Zero == 0.0f ? 0 : 1;
+
+	// 0 and +inf in the vectors and in the remaining values of the SIMD batches
+#	if GLM_CONFIG_SIMD == GLM_ENABLE
+	{
+		float const Inf = std::numeric_limits<float>::infinity();
+		float const Special[9] = {0.0f, Inf, 4.0f, 1.0f, Inf, 0.0f, 16.0f, 0.25f, 0.0f};
+		float SpecialSqrt[9];
+		float SpecialInverseSqrt[9];
+		glm::fastSqrt(Special, 9, SpecialSqrt);
+		glm::fastInverseSqrt(Special, 9, SpecialInverseSqrt);
+		for(std::size_t i = 0; i < 9; ++i)
+		{
+			if(Special[i] == 0.0f || Special[i] == Inf)
+			{
+				Error += SpecialSqrt[i] == Special[i] ? 0 : 1;
+				Error += SpecialInverseSqrt[i] == 1.0f / Special[i] ? 0 : 1;
+			}
+			else
+			{
+				Error += glm::equal(SpecialSqrt[i], std::sqrt(Special[i]), 1e-5f) ? 0 : 1;
+				Error += glm::equal(SpecialInverseSqrt[i], 1.0f / std::sqrt(Special[i]), 1e-5f) ? 0 : 1;
+			}
+		}
+	}
+#	endif
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	{
+		glm::aligned_vec4 const V(0.25f, 4.0f, 9.0f, 0.0f);
+		Error += glm::all(glm::equal(glm::fastSqrt(V), glm::aligned_vec4(0.5f, 2.0f, 3.0f, 0.0f), 1e-5f)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::fastInverseSqrt(glm::aligned_vec4(0.25f, 4.0f, 16.0f, 1.0f)), glm::aligned_vec4(2.0f, 0.5f, 0.25f, 1.0f), 1e-5f)) ? 0 : 1;
+		Error += glm::abs(glm::length(glm::fastNormalize(glm::aligned_vec4(1.0f, 2.0f, 3.0f, 4.0f))) - 1.0f) < 1e-5f ? 0 : 1;
+
+		float const Inf = std::numeric_limits<float>::infinity();
+		glm::aligned_vec4 const S = glm::fastSqrt(glm::aligned_vec4(0.0f, Inf, 4.0f, 1.0f));
+		glm::aligned_vec4 const I = glm::fastInverseSqrt(glm::aligned_vec4(0.0f, Inf, 4.0f, 1.0f));
+		Error += S.x == 0.0f && S.y == Inf && glm::all(glm::equal(glm::vec2(S.z, S.w), glm::vec2(2.0f, 1.0f), 1e-5f)) ? 0 : 1;
+		Error += I.x == Inf && I.y == 0.0f && glm::all(glm::equal(glm::vec2(I.z, I.w), glm::vec2(0.5f, 1.0f), 1e-5f)) ? 0 : 1;
+	}
+#	endif
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
 
 	Error += test_fastInverseSqrt();
 	Error += test_fastDistance();
+	Error += test_error_bound();
 
 	return Error;
 }
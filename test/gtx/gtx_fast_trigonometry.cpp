@@ -8,6 +8,11 @@
 #include <glm/gtc/constants.hpp>
 #include <glm/gtc/vec1.hpp>
 #include <glm/trigonometric.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 #include <cmath>
 #include <ctime>
 #include <cstdio>
@@ -573,10 +578,118 @@ namespace taylor2
 
 }//namespace taylor2
 
+// Absolute errors of the table of the extension documentation
+namespace errorBound
+{
+	template<typename genType>
+	static double max_error(std::vector<float> const& In, std::vector<genType> const& Out, double (*Reference)(double))
+	{
+		double Result = 0.0;
+		for(std::size_t i = 0; i < In.size(); ++i)
+			Result = glm::max(Result, glm::abs(static_cast<double>(Out[i]) - Reference(static_cast<double>(In[i]))));
+		return Result;
+	}
+
+	static std::vector<float> angles(float Begin, float End, std::size_t Count)
+	{
+		std::vector<float> Result(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = Begin + (End - Begin) * static_cast<float>(i) / static_cast<float>(Count - 1);
+		return Result;
+	}
+
+	static double sin(double x) { return std::sin(x); }
+	static double cos(double x) { return std::cos(x); }
+	static double tan(double x) { return std::tan(x); }
+	static double asin(double x) { return std::asin(x); }
+	static double acos(double x) { return std::acos(x); }
+	static double atan(double x) { return std::atan(x); }
+
+	// Scalar, vector and batch sin and cos
+	static int test_sincos(float Begin, float End, double ScalarBound, double SimdBound)
+	{
+		int Error = 0;
+
+		std::vector<float> const In = angles(Begin, End, 20003);
+		std::vector<float> Sin(In.size()), Cos(In.size());
+		std::vector<float> ScalarSin(In.size()), ScalarCos(In.size());
+		std::vector<float> VectorSin(In.size()), VectorCos(In.size());
+		for(std::size_t i = 0; i < In.size(); ++i)
+		{
+			ScalarSin[i] = glm::fastSin(In[i]);
+			ScalarCos[i] = glm::fastCos(In[i]);
+			VectorSin[i] = glm::fastSin(glm::vec3(In[i])).z;
+			VectorCos[i] = glm::fastCos(glm::vec3(In[i])).z;
+		}
+		glm::fastSin(&In[0], In.size(), &Sin[0]);
+		glm::fastCos(&In[0], In.size(), &Cos[0]);
+
+		Error += max_error(In, ScalarSin, sin) <= ScalarBound ? 0 : 1;
+		Error += max_error(In, ScalarCos, cos) <= ScalarBound ? 0 : 1;
+		Error += max_error(In, VectorSin, sin) <= ScalarBound ? 0 : 1;
+		Error += max_error(In, VectorCos, cos) <= ScalarBound ? 0 : 1;
+
+		double const BatchBound = GLM_CONFIG_SIMD == GLM_ENABLE ? SimdBound : ScalarBound;
+		Error += max_error(In, Sin, sin) <= BatchBound ? 0 : 1;
+		Error += max_error(In, Cos, cos) <= BatchBound ? 0 : 1;
+
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			std::vector<float> AlignedSin(In.size()), AlignedCos(In.size());
+			for(std::size_t i = 0; i < In.size(); ++i)
+			{
+				AlignedSin[i] = glm::fastSin(glm::aligned_vec4(In[i])).w;
+				AlignedCos[i] = glm::fastCos(glm::aligned_vec4(In[i])).w;
+			}
+			Error += max_error(In, AlignedSin, sin) <= BatchBound ? 0 : 1;
+			Error += max_error(In, AlignedCos, cos) <= BatchBound ? 0 : 1;
+#		endif
+
+		// In place, the last angles of the batch are computed like the others
+		std::vector<float> Tail(In.end() - 7, In.end());
+		glm::fastCos(&Tail[0], Tail.size(), &Tail[0]);
+		for(std::size_t i = 0; i < Tail.size(); ++i)
+			Error += glm::equal(Tail[i], Cos[In.size() - 7 + i], 0.0f) ? 0 : 1;
+
+		return Error;
+	}
+
+	template<typename genType>
+	static int test_polynomial(genType (*Function)(genType const&), double (*Reference)(double), float Begin, float End, double Bound)
+	{
+		std::vector<float> const In = angles(Begin, End, 20003);
+		std::vector<float> Out(In.size());
+		for(std::size_t i = 0; i < In.size(); ++i)
+			Out[i] = Function(genType(In[i])).x;
+		return max_error(In, Out, Reference) <= Bound ? 0 : 1;
+	}
+
+	static int test()
+	{
+		int Error = 0;
+
+		Error += test_sincos(-glm::pi<float>(), glm::pi<float>(), 7.1e-6, 7.0e-6);
+		Error += test_sincos(-100.0f, 100.0f, 1.6e-5, 7.1e-6);
+		Error += test_sincos(-10000.0f, 10000.0f, 1.3e-3, 7.1e-6);
+
+		Error += test_polynomial<glm::vec4>(glm::fastTan, tan, -0.5f, 0.5f, 4.8e-5);
+		Error += test_polynomial<glm::vec4>(glm::fastAsin, asin, -0.5f, 0.5f, 1.4e-5);
+		Error += test_polynomial<glm::vec4>(glm::fastAcos, acos, -0.5f, 0.5f, 1.4e-5);
+		Error += test_polynomial<glm::vec4>(glm::fastAtan, atan, -0.5f, 0.5f, 7.8e-6);
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			Error += test_polynomial<glm::aligned_vec4>(glm::fastTan, tan, -0.5f, 0.5f, 4.8e-5);
+			Error += test_polynomial<glm::aligned_vec4>(glm::fastAtan, atan, -0.5f, 0.5f, 7.8e-6);
+#		endif
+
+		return Error;
+	}
+}//namespace errorBound
+
 int main()
 {
 	int Error(0);
 
+	Error += ::errorBound::test();
+
 	Error += ::taylor2::perf(1000);
 	Error += ::taylorCos::test();
 	Error += ::taylorCos::perf(1000);
@@ -1,5 +1,8 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/gradient_paint.hpp>
+#include <glm/ext/scalar_relational.hpp>
+
+#include <vector>
 
 static int test_radialGradient()
 {
@@ -21,12 +24,48 @@ static int test_linearGradient()
 	return Error;
 }
 
+// The rows match the gradients at each position, the lengths are not multiples of 4
+template<typename T>
+static int test_rows()
+{
+	int Error = 0;
+
+	typedef glm::vec<2, T, glm::defaultp> vec2;
+	vec2 const Position(static_cast<T>(-3.5), static_cast<T>(1.25));
+
+	for(std::size_t Count = 0; Count < 70; Count += 7)
+	{
+		vec2 const Step = Count % 2 ? vec2(static_cast<T>(0.125), static_cast<T>(0)) : vec2(static_cast<T>(0.0625), static_cast<T>(0.03125));
+
+		std::vector<T> Radial(Count + 1, static_cast<T>(-7));
+		std::vector<T> Linear(Count + 1, static_cast<T>(-7));
+		glm::radialGradient(vec2(static_cast<T>(0)), static_cast<T>(8), vec2(static_cast<T>(1), static_cast<T>(-2)), Position, Step, Count, &Radial[0]);
+		glm::linearGradient(vec2(static_cast<T>(-1)), vec2(static_cast<T>(3), static_cast<T>(2)), Position, Step, Count, &Linear[0]);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec2 const Pixel = Position + Step * static_cast<T>(i);
+			T const ExpectedRadial = glm::radialGradient(vec2(static_cast<T>(0)), static_cast<T>(8), vec2(static_cast<T>(1), static_cast<T>(-2)), Pixel);
+			T const ExpectedLinear = glm::linearGradient(vec2(static_cast<T>(-1)), vec2(static_cast<T>(3), static_cast<T>(2)), Pixel);
+			Error += glm::equal(Radial[i], ExpectedRadial, static_cast<T>(0.00001)) ? 0 : 1;
+			Error += glm::equal(Linear[i], ExpectedLinear, static_cast<T>(0.00001)) ? 0 : 1;
+		}
+
+		Error += Radial[Count] == static_cast<T>(-7) ? 0 : 1;
+		Error += Linear[Count] == static_cast<T>(-7) ? 0 : 1;
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
 
     Error += test_radialGradient();
     Error += test_linearGradient();
+	Error += test_rows<float>();
+	Error += test_rows<double>();
     
 	return Error;
 }
@@ -11,6 +11,11 @@
 #include <glm/gtx/hash.hpp>
 
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 
 static int test_compile()
 {
@@ -55,11 +60,98 @@ static int test_compile()
     return Error > 0 ? 0 : 1;
 }
 
+static int test_signed_zero()
+{
+    int Error = 0;
+
+    Error += std::hash<glm::vec3>()(glm::vec3(-0.0f, 1.0f, -0.0f)) == std::hash<glm::vec3>()(glm::vec3(0.0f, 1.0f, 0.0f)) ? 0 : 1;
+    Error += std::hash<glm::dvec2>()(glm::dvec2(-0.0, 0.0)) == std::hash<glm::dvec2>()(glm::dvec2(0.0)) ? 0 : 1;
+    Error += std::hash<glm::quat>()(glm::quat(-0.0f, 0.0f, 0.0f, 1.0f)) == std::hash<glm::quat>()(glm::quat(0.0f, 0.0f, 0.0f, 1.0f)) ? 0 : 1;
+
+    std::unordered_map<glm::vec3, int> Map;
+    Map[glm::vec3(0.0f)] = 1;
+    Error += Map.count(glm::vec3(-0.0f)) == 1 ? 0 : 1;
+
+    return Error;
+}
+
+// Low bits are what bucket indices use, they must be well distributed even for a regular integer grid
+static int test_distribution()
+{
+    int Error = 0;
+
+    std::unordered_set<std::size_t> Hashes;
+    std::unordered_set<std::size_t> Buckets;
+    for(int z = -16; z < 16; ++z)
+    for(int y = -16; y < 16; ++y)
+    for(int x = -16; x < 16; ++x)
+    {
+        std::size_t const Hash = glm::spatialHash(glm::ivec3(x, y, z));
+        Hashes.insert(Hash);
+        Buckets.insert(Hash & 1023);
+    }
+    Error += Hashes.size() == 32 * 32 * 32 ? 0 : 1;
+    Error += Buckets.size() == 1024 ? 0 : 1;
+
+    Error += std::hash<glm::vec2>()(glm::vec2(1, 2)) != std::hash<glm::vec2>()(glm::vec2(2, 1)) ? 0 : 1;
+    Error += std::hash<glm::mat2>()(glm::mat2(1, 2, 3, 4)) != std::hash<glm::mat2>()(glm::mat2(1, 3, 2, 4)) ? 0 : 1;
+
+    return Error;
+}
+
+template<glm::qualifier Q>
+static int test_spatial_qualifier()
+{
+    typedef glm::vec<3, float, Q> vec3;
+    typedef glm::vec<3, int, Q> ivec3;
+
+    int Error = 0;
+
+    Error += glm::all(glm::equal(glm::spatialCell(vec3(0.5f, -0.5f, 2.0f), 1.0f), ivec3(0, -1, 2))) ? 0 : 1;
+    Error += glm::all(glm::equal(glm::spatialCell(vec3(0.25f, -0.75f, 1.0f), 0.5f), ivec3(0, -2, 2))) ? 0 : 1;
+    Error += glm::spatialHash(vec3(0.1f, 0.2f, 0.3f), 1.0f) == glm::spatialHash(vec3(0.9f, 0.8f, 0.7f), 1.0f) ? 0 : 1;
+    Error += glm::spatialHash(vec3(0.1f, 0.2f, 0.3f), 1.0f) != glm::spatialHash(vec3(1.1f, 0.2f, 0.3f), 1.0f) ? 0 : 1;
+    Error += glm::spatialHash(vec3(-0.5f), 1.0f) == glm::spatialHash(ivec3(-1)) ? 0 : 1;
+
+    std::vector<vec3> Points;
+    for(int i = 0; i < 100; ++i)
+        Points.push_back(vec3(static_cast<float>(i) * 0.37f - 10.0f, static_cast<float>(i % 7), static_cast<float>(-i)));
+
+    std::vector<std::size_t> Cells(Points.size());
+    std::vector<std::size_t> Values(Points.size());
+    glm::spatialHash(Points.data(), Points.size(), 0.5f, Cells.data());
+    glm::hashValue(Points.data(), Points.size(), Values.data());
+    for(std::size_t i = 0; i < Points.size(); ++i)
+    {
+        Error += Cells[i] == glm::spatialHash(Points[i], 0.5f) ? 0 : 1;
+        Error += Cells[i] == glm::spatialHash(glm::ivec3(glm::floor(glm::vec3(Points[i]) / 0.5f))) ? 0 : 1;
+        Error += Values[i] == std::hash<glm::vec3>()(glm::vec3(Points[i])) ? 0 : 1;
+    }
+
+    return Error;
+}
+
+static int test_spatial()
+{
+    int Error = 0;
+
+    Error += test_spatial_qualifier<glm::defaultp>();
+    Error += test_spatial_qualifier<glm::packed_highp>();
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+    Error += test_spatial_qualifier<glm::aligned_highp>();
+#endif
+
+    return Error;
+}
+
 int main()
 {
     int Error = 0;
 
     Error += test_compile();
+    Error += test_signed_zero();
+    Error += test_distribution();
+    Error += test_spatial();
 
     return Error;
 }
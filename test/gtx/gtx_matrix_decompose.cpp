@@ -4,6 +4,12 @@
 #include <glm/ext/matrix_relational.hpp>
 #include <glm/ext/matrix_transform.hpp>
 #include <glm/ext/scalar_constants.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <vector>
 
 static int test_identity() {
 	int Error = 0;
@@ -48,12 +54,91 @@ static int test_scale_translate() {
 	return Error;
 }
 
+template<glm::qualifier Q>
+static int test_decomposeTRS_qualifier()
+{
+	typedef glm::vec<3, float, Q> vec3Type;
+	typedef glm::qua<float, Q> quatType;
+	typedef glm::mat<4, 4, float, Q> mat4Type;
+
+	int Error = 0;
+
+	vec3Type const T(1.0f, -2.0f, 3.0f);
+	quatType const R = glm::angleAxis(2.5f, glm::normalize(vec3Type(1, -2, 3)));
+
+	vec3Type const Scales[] = {vec3Type(1.0f), vec3Type(2.0f, 0.5f, 3.0f), vec3Type(-2.0f, -0.5f, -3.0f)};
+	for(std::size_t i = 0; i < sizeof(Scales) / sizeof(Scales[0]); ++i)
+	{
+		mat4Type const Matrix = glm::mat4_cast(T, R, Scales[i]);
+
+		vec3Type Scale;
+		quatType Orientation;
+		vec3Type Translation;
+		Error += glm::decomposeTRS(Matrix, Scale, Orientation, Translation) ? 0 : 1;
+
+		Error += glm::all(glm::equal(Scale, Scales[i], 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Translation, T, 0.0001f)) ? 0 : 1;
+		Error += glm::abs(glm::dot(Orientation, R)) > 0.9999f ? 0 : 1;
+		Error += glm::all(glm::equal(glm::recompose(Scale, Orientation, Translation), Matrix, 0.0001f)) ? 0 : 1;
+
+		// Agrees with the general decomposition
+		glm::vec3 GeneralScale;
+		glm::quat GeneralOrientation;
+		glm::vec3 GeneralTranslation;
+		glm::vec3 Skew;
+		glm::vec4 Perspective;
+		Error += glm::decompose(glm::mat4(Matrix), GeneralScale, GeneralOrientation, GeneralTranslation, Skew, Perspective) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::vec3(Scale), GeneralScale, 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::vec3(Translation), GeneralTranslation, 0.0001f)) ? 0 : 1;
+	}
+
+	{
+		mat4Type const Singular = glm::mat4_cast(T, R, vec3Type(1.0f, 0.0f, 1.0f));
+
+		vec3Type Scale;
+		quatType Orientation;
+		vec3Type Translation;
+		Error += glm::decomposeTRS(Singular, Scale, Orientation, Translation) ? 1 : 0;
+		Error += glm::all(glm::equal(Orientation, quatType::wxyz(1, 0, 0, 0))) ? 0 : 1;
+	}
+
+	{
+		std::size_t const Count = 8;
+		std::vector<mat4Type> Matrices(Count), Recomposed(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Matrices[i] = glm::mat4_cast(T * static_cast<float>(i), R, vec3Type(static_cast<float>(i + 1)));
+
+		std::vector<vec3Type> Scale(Count), Translation(Count);
+		std::vector<quatType> Orientation(Count);
+		Error += glm::decomposeTRS(&Matrices[0], Count, &Scale[0], &Orientation[0], &Translation[0]) ? 0 : 1;
+		glm::recompose(&Scale[0], &Orientation[0], &Translation[0], Count, &Recomposed[0]);
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Recomposed[i], Matrices[i], 0.0001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_decomposeTRS()
+{
+	int Error = 0;
+
+	Error += test_decomposeTRS_qualifier<glm::defaultp>();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_decomposeTRS_qualifier<glm::aligned_highp>();
+#	endif
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
 
 	Error += test_identity();
 	Error += test_scale_translate();
+	Error += test_decomposeTRS();
 
 	return Error;
 }
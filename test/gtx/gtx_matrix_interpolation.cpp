@@ -2,6 +2,9 @@
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtx/component_wise.hpp>
 #include <glm/gtx/matrix_interpolation.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/quaternion_relational.hpp>
 
 #include <iostream>
 #include <limits>
@@ -108,6 +111,83 @@ static int test_rotate()
 	return 0;
 }
 
+static int test_polarDecompose()
+{
+	int Error = 0;
+
+	glm::mat3 const Rotation(glm::mat4_cast(glm::angleAxis(0.7f, glm::normalize(glm::vec3(1, 2, 3)))));
+	glm::mat3 const Stretch(
+		2.0f, 0.3f, 0.1f,
+		0.3f, 1.5f, 0.2f,
+		0.1f, 0.2f, 0.5f);
+
+	glm::mat3 R, S;
+	Error += glm::polarDecompose(Rotation * Stretch, R, S) ? 0 : 1;
+	Error += glm::all(glm::equal(R, Rotation, 0.0001f)) ? 0 : 1;
+	Error += glm::all(glm::equal(S, Stretch, 0.0001f)) ? 0 : 1;
+	Error += glm::all(glm::equal(R * S, Rotation * Stretch, 0.0001f)) ? 0 : 1;
+
+	// Accumulated drift is removed with a few fixed iterations
+	glm::mat3 Drift(Rotation);
+	Drift[0] += glm::vec3(0.01f, -0.02f, 0.005f);
+	Drift[2] *= 1.03f;
+	Error += glm::polarDecompose(Drift, R, S, 4) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::transpose(R) * R, glm::mat3(1.0f), 0.0001f)) ? 0 : 1;
+	Error += glm::abs(glm::determinant(R) - 1.0f) < 0.0001f ? 0 : 1;
+
+	glm::mat4 const Transform = glm::translate(glm::mat4(1.0f), glm::vec3(1, 2, 3)) * glm::mat4(Rotation * Stretch);
+	glm::mat4 R4, S4;
+	Error += glm::polarDecompose(Transform, R4, S4) ? 0 : 1;
+	Error += glm::all(glm::equal(R4, glm::mat4(Rotation), 0.0001f)) ? 0 : 1;
+
+	Error += glm::polarDecompose(Transform, R4, S4, 8) ? 0 : 1;
+	Error += glm::all(glm::equal(S4, glm::mat4(Stretch), 0.0001f)) ? 0 : 1;
+
+	Error += glm::polarDecompose(glm::mat3(0.0f), R, S) ? 1 : 0;
+
+	// Rank deficient at any scale: the determinant is only rounding noise relative to the norm
+	glm::mat3 const Flat(
+		1000.0f, 0.0f, 0.0f,
+		0.0f, 1000.0f, 0.0f,
+		0.0f, 0.0f, 0.00001f);
+	Error += glm::polarDecompose(Flat, R, S) ? 1 : 0;
+
+	glm::mat3 Infinite(Rotation);
+	Infinite[1][1] = std::numeric_limits<float>::infinity();
+	Error += glm::polarDecompose(Infinite, R, S) ? 1 : 0;
+
+	return Error;
+}
+
+static int test_extractRotation()
+{
+	int Error = 0;
+
+	glm::quat const Orientation = glm::angleAxis(2.5f, glm::normalize(glm::vec3(-1, 2, 0.5f)));
+	glm::mat3 const Rotation = glm::mat3_cast(Orientation);
+	glm::mat3 const Scaled = Rotation * glm::mat3(glm::scale(glm::mat4(1.0f), glm::vec3(3.0f, 0.5f, 1.2f)));
+
+	glm::quat const Result = glm::extractRotation(Scaled, glm::quat(1, 0, 0, 0), 32);
+	Error += glm::abs(glm::abs(glm::dot(Result, Orientation)) - 1.0f) < 0.0001f ? 0 : 1;
+
+	// Warm start from the answer converges immediately
+	glm::quat const Warm = glm::extractRotation(glm::mat4(Scaled), Orientation, 1);
+	Error += glm::abs(glm::abs(glm::dot(Warm, Orientation)) - 1.0f) < 0.0001f ? 0 : 1;
+
+	// Degenerate input still yields a unit quaternion
+	glm::quat const Degenerate = glm::extractRotation(glm::mat3(0.0f), Orientation, 8);
+	Error += glm::abs(glm::length(Degenerate) - 1.0f) < 0.0001f ? 0 : 1;
+
+	glm::mat3 Matrices[3] = {Scaled, Rotation, glm::mat3(1.0f)};
+	glm::quat Rotations[3] = {glm::quat(1, 0, 0, 0), glm::quat(1, 0, 0, 0), glm::quat(1, 0, 0, 0)};
+	glm::extractRotation(Matrices, 3, Rotations, 32);
+	Error += glm::abs(glm::abs(glm::dot(Rotations[0], Orientation)) - 1.0f) < 0.0001f ? 0 : 1;
+	Error += glm::abs(glm::abs(glm::dot(Rotations[1], Orientation)) - 1.0f) < 0.0001f ? 0 : 1;
+	Error += glm::all(glm::equal(Rotations[2], glm::quat(1, 0, 0, 0), 0.0001f)) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -115,6 +195,8 @@ int main()
 	Error += test_axisAngle();
 	Error += test_axisAngle2();
 	Error += test_rotate();
+	Error += test_polarDecompose();
+	Error += test_extractRotation();
 
 	return Error;
 }
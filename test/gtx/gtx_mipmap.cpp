@@ -0,0 +1,388 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/mipmap.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/vector_uint4_sized.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+static glm::uint32 next(glm::uint32& Seed)
+{
+	Seed = Seed * 1664525u + 1013904223u;
+	return Seed >> 8;
+}
+
+static int test_mipExtent()
+{
+	int Error = 0;
+
+	Error += glm::mipExtent(glm::ivec2(1024, 512), 0) == glm::ivec2(1024, 512) ? 0 : 1;
+	Error += glm::mipExtent(glm::ivec2(1024, 512), 3) == glm::ivec2(128, 64) ? 0 : 1;
+	Error += glm::mipExtent(glm::ivec2(1024, 512), 10) == glm::ivec2(1, 1) ? 0 : 1;
+	Error += glm::mipExtent(glm::ivec3(5, 3, 1), 1) == glm::ivec3(2, 1, 1) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_mipChain()
+{
+	int Error = 0;
+
+	// RGBA8: 4 bytes per texel
+	{
+		glm::ivec2 const Extent(4, 2);
+		glm::ivec2 Extents[3];
+		std::size_t Offsets[3];
+		std::size_t const Size = glm::mipChain(Extent, glm::ivec2(1), 4, Extents, Offsets);
+
+		Error += Size == (8 + 2 + 1) * 4 ? 0 : 1;
+		Error += Size == glm::mipChainSize(Extent, glm::ivec2(1), 4) ? 0 : 1;
+		Error += Extents[1] == glm::ivec2(2, 1) && Extents[2] == glm::ivec2(1, 1) ? 0 : 1;
+		Error += Offsets[0] == 0 && Offsets[1] == 32 && Offsets[2] == 40 ? 0 : 1;
+		for(int Level = 0; Level < 3; ++Level)
+			Error += glm::mipOffset(Extent, Level, glm::ivec2(1), 4) == Offsets[Level] ? 0 : 1;
+	}
+
+	// BC1: 4x4 blocks of 8 bytes, the partial blocks are stored whole
+	{
+		glm::ivec2 const Extent(13, 7);
+		Error += glm::mipSize(Extent, glm::ivec2(4), 8) == 4 * 2 * 8 ? 0 : 1;
+		Error += glm::mipSize(glm::ivec2(1), glm::ivec2(4), 8) == 8 ? 0 : 1;
+
+		// 13x7, 6x3, 3x1, 1x1
+		Error += glm::levels(Extent) == 4 ? 0 : 1;
+		Error += glm::mipChainSize(Extent, glm::ivec2(4), 8) == (8 + 2 + 1 + 1) * 8 ? 0 : 1;
+		Error += glm::mipOffset(Extent, 3, glm::ivec2(4), 8) == (8 + 2 + 1) * 8 ? 0 : 1;
+	}
+
+	// 3D texture
+	{
+		glm::ivec3 const Extent(4, 4, 2);
+		Error += glm::mipChainSize(Extent, glm::ivec3(1), 16) == (32 + 4 + 1) * 16 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Weight of the source texel Source in the destination texel Texel along a dimension of Extent texels:
+// 1/2 for the two texels of the block, 1/4, 1/2 and 1/4 for the last texel of an odd dimension
+static float weight(int Texel, int Source, int Extent)
+{
+	if(Extent == 1)
+		return 1.0f;
+	if(Extent % 2 == 1 && Texel == Extent / 2 - 1)
+		return Source == Texel * 2 + 1 ? 0.5f : Source == Texel * 2 || Source == Texel * 2 + 2 ? 0.25f : 0.0f;
+	return Source / 2 == Texel ? 0.5f : 0.0f;
+}
+
+// Filter computed texel by texel from the weights of the 3x3x3 source texels from Texel * 2
+template<typename T>
+static glm::vec4 reference(std::vector<T> const& Src, glm::ivec3 const& Extent, glm::ivec3 const& Texel)
+{
+	glm::ivec3 const Last = glm::min(Texel * 2 + 2, Extent - 1);
+
+	glm::vec4 Sum(0);
+	for(int z = Texel.z * 2; z <= Last.z; ++z)
+	for(int y = Texel.y * 2; y <= Last.y; ++y)
+	for(int x = Texel.x * 2; x <= Last.x; ++x)
+	{
+		float const Weight = weight(Texel.x, x, Extent.x) * weight(Texel.y, y, Extent.y) * weight(Texel.z, z, Extent.z);
+		if(Weight > 0.0f)
+			Sum += glm::vec4(Src[static_cast<std::size_t>((z * Extent.y + y) * Extent.x + x)]) * Weight;
+	}
+	return Sum;
+}
+
+template<typename texelType, typename extentType>
+static int test_downsample_vec4(extentType const& Extent)
+{
+	int Error = 0;
+
+	glm::ivec3 const Extent3(Extent.x, Extent.y, Extent.length() > 2 ? Extent[Extent.length() - 1] : 1);
+	glm::ivec3 const DstExtent3 = glm::mipExtent(Extent3, 1);
+
+	glm::uint32 Seed = 7;
+	std::vector<texelType> Src(static_cast<std::size_t>(Extent3.x * Extent3.y * Extent3.z));
+	for(std::size_t i = 0; i < Src.size(); ++i)
+		Src[i] = texelType(glm::vec4(next(Seed) % 1000, next(Seed) % 1000, next(Seed) % 1000, next(Seed) % 1000) / 100.0f);
+
+	for(unsigned int Threads = 1; Threads <= 4; Threads *= 4)
+	{
+		std::vector<texelType> Dst(static_cast<std::size_t>(DstExtent3.x * DstExtent3.y * DstExtent3.z));
+		glm::downsample(&Src[0], Extent, &Dst[0], Threads);
+
+		for(int z = 0; z < DstExtent3.z; ++z)
+		for(int y = 0; y < DstExtent3.y; ++y)
+		for(int x = 0; x < DstExtent3.x; ++x)
+		{
+			glm::vec4 const Texel(Dst[static_cast<std::size_t>((z * DstExtent3.y + y) * DstExtent3.x + x)]);
+			Error += glm::all(glm::equal(Texel, reference(Src, Extent3, glm::ivec3(x, y, z)), 0.0001f)) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+template<typename extentType>
+static int test_downsample_u8vec4(extentType const& Extent, bool SRGB)
+{
+	int Error = 0;
+
+	glm::ivec3 const Extent3(Extent.x, Extent.y, Extent.length() > 2 ? Extent[Extent.length() - 1] : 1);
+	glm::ivec3 const DstExtent3 = glm::mipExtent(Extent3, 1);
+
+	glm::uint32 Seed = 11;
+	std::vector<glm::u8vec4> Src(static_cast<std::size_t>(Extent3.x * Extent3.y * Extent3.z));
+	for(std::size_t i = 0; i < Src.size(); ++i)
+		Src[i] = glm::u8vec4(next(Seed) % 256, next(Seed) % 256, next(Seed) % 256, next(Seed) % 256);
+
+	// The sRGB reference converts each texel, the integer averages are exact with floats
+	std::vector<glm::vec4> Linear(Src.size());
+	for(std::size_t i = 0; i < Src.size(); ++i)
+	{
+		glm::vec4 const Color = glm::vec4(Src[i]) / 255.0f;
+		Linear[i] = SRGB ? glm::vec4(glm::convertSRGBToLinear(glm::vec3(Color)), Color.w) * 255.0f : glm::vec4(Src[i]);
+	}
+
+	for(unsigned int Threads = 1; Threads <= 4; Threads *= 4)
+	{
+		std::vector<glm::u8vec4> Dst(static_cast<std::size_t>(DstExtent3.x * DstExtent3.y * DstExtent3.z));
+		if(SRGB)
+			glm::downsampleSRGB(&Src[0], Extent, &Dst[0], Threads);
+		else
+			glm::downsample(&Src[0], Extent, &Dst[0], Threads);
+
+		for(int z = 0; z < DstExtent3.z; ++z)
+		for(int y = 0; y < DstExtent3.y; ++y)
+		for(int x = 0; x < DstExtent3.x; ++x)
+		{
+			glm::vec4 const Average = reference(Linear, Extent3, glm::ivec3(x, y, z));
+			glm::vec4 const Color = SRGB ? glm::vec4(glm::convertLinearToSRGB(glm::vec3(Average) / 255.0f) * 255.0f, Average.w) : Average;
+			glm::ivec4 const Expected(glm::round(Color));
+			glm::ivec4 const Texel(Dst[static_cast<std::size_t>((z * DstExtent3.y + y) * DstExtent3.x + x)]);
+
+			// The sRGB averages may round the other way from the reference conversions
+			int const Tolerance = SRGB ? 1 : 0;
+			Error += glm::all(glm::lessThanEqual(glm::abs(Texel - Expected), glm::ivec4(Tolerance))) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+// The last texel of an odd dimension is folded into the last texel of the destination
+static int test_downsample_odd()
+{
+	int Error = 0;
+
+	{
+		glm::vec4 const Src[3] = {glm::vec4(0), glm::vec4(0), glm::vec4(8)};
+		glm::vec4 Dst[1];
+		glm::downsample(Src, glm::ivec2(3, 1), Dst, 1u);
+		Error += glm::all(glm::equal(Dst[0], glm::vec4(2), 0.0001f)) ? 0 : 1;
+	}
+
+	{
+		glm::u8vec4 Src[5 * 3];
+		for(int i = 0; i < 5 * 3; ++i)
+			Src[i] = glm::u8vec4(0);
+		Src[5 * 3 - 1] = glm::u8vec4(160);
+		glm::u8vec4 Dst[2];
+		glm::downsample(Src, glm::ivec2(5, 3), Dst, 1u);
+		Error += Dst[0] == glm::u8vec4(0) ? 0 : 1;
+		Error += Dst[1] == glm::u8vec4(10) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_downsample()
+{
+	int Error = 0;
+
+	Error += test_downsample_vec4<glm::vec4>(glm::ivec2(64, 32));
+	Error += test_downsample_vec4<glm::vec4>(glm::ivec2(37, 9));
+	Error += test_downsample_vec4<glm::vec4>(glm::ivec2(1, 5));
+	Error += test_downsample_vec4<glm::vec4>(glm::ivec3(17, 6, 5));
+	Error += test_downsample_vec4<glm::vec4>(glm::ivec3(8, 8, 1));
+
+	// Large enough to use several threads
+	Error += test_downsample_vec4<glm::vec4>(glm::ivec2(1024, 513));
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_downsample_vec4<glm::aligned_vec4>(glm::ivec2(37, 9));
+		Error += test_downsample_vec4<glm::aligned_vec4>(glm::ivec3(17, 6, 5));
+#	endif
+
+	for(int SRGB = 0; SRGB < 2; ++SRGB)
+	{
+		Error += test_downsample_u8vec4(glm::ivec2(64, 32), SRGB != 0);
+		Error += test_downsample_u8vec4(glm::ivec2(37, 9), SRGB != 0);
+		Error += test_downsample_u8vec4(glm::ivec2(3, 1), SRGB != 0);
+		Error += test_downsample_u8vec4(glm::ivec3(17, 6, 5), SRGB != 0);
+		Error += test_downsample_u8vec4(glm::ivec2(1023, 512), SRGB != 0);
+	}
+
+	return Error;
+}
+
+// Kaiser filter computed from its definition: I0 from its power series, the sinc and the window in destination texels
+static double kaiser(double x, double Width, double Alpha)
+{
+	if(x <= -Width || x >= Width)
+		return 0.0;
+
+	double const Beta = Alpha * std::sqrt(1.0 - (x / Width) * (x / Width));
+	double I0 = 0.0, I0Alpha = 0.0, Factorial = 1.0;
+	for(int k = 0; k < 40; ++k)
+	{
+		if(k > 0)
+			Factorial *= static_cast<double>(k);
+		I0 += std::pow(Beta / 2.0, 2.0 * k) / (Factorial * Factorial);
+		I0Alpha += std::pow(Alpha / 2.0, 2.0 * k) / (Factorial * Factorial);
+	}
+	double const Pi = 3.14159265358979323846;
+	return (x == 0.0 ? 1.0 : std::sin(Pi * x) / (Pi * x)) * I0 / I0Alpha;
+}
+
+// Normalized weights of the source texels of the destination texel Texel along a dimension of Extent texels, clamped to edge
+static std::vector<double> kaiser_weights(int Texel, int Extent, double Width, double Alpha)
+{
+	double const Scale = static_cast<double>(Extent) / static_cast<double>(glm::max(Extent / 2, 1));
+	double const Center = (Texel + 0.5) * Scale - 0.5;
+
+	std::vector<double> Weights(static_cast<std::size_t>(Extent), 0.0);
+	double Total = 0.0;
+	for(int j = static_cast<int>(Center - Width * Scale) - 1; j <= static_cast<int>(Center + Width * Scale) + 1; ++j)
+	{
+		double const Weight = kaiser((j - Center) / Scale, Width, Alpha);
+		Weights[static_cast<std::size_t>(glm::clamp(j, 0, Extent - 1))] += Weight;
+		Total += Weight;
+	}
+	for(std::size_t i = 0; i < Weights.size(); ++i)
+		Weights[i] /= Total;
+	return Weights;
+}
+
+template<typename extentType>
+static int test_downsampleKaiser_vec4(extentType const& Extent, float Width, float Alpha)
+{
+	int Error = 0;
+
+	glm::ivec3 const Extent3(Extent.x, Extent.y, Extent.length() > 2 ? Extent[Extent.length() - 1] : 1);
+	glm::ivec3 const DstExtent3 = glm::mipExtent(Extent3, 1);
+
+	glm::uint32 Seed = 11;
+	std::vector<glm::vec4> Src(static_cast<std::size_t>(Extent3.x * Extent3.y * Extent3.z));
+	for(std::size_t i = 0; i < Src.size(); ++i)
+		Src[i] = glm::vec4(next(Seed) % 1000, next(Seed) % 1000, next(Seed) % 1000, next(Seed) % 1000) / 100.0f;
+
+	for(unsigned int Threads = 1; Threads <= 4; Threads *= 4)
+	{
+		std::vector<glm::vec4> Dst(static_cast<std::size_t>(DstExtent3.x * DstExtent3.y * DstExtent3.z));
+		glm::downsampleKaiser(&Src[0], Extent, &Dst[0], Width, Alpha, Threads);
+
+		for(int z = 0; z < DstExtent3.z; ++z)
+		for(int y = 0; y < DstExtent3.y; ++y)
+		for(int x = 0; x < DstExtent3.x; ++x)
+		{
+			std::vector<double> const WeightsX = kaiser_weights(x, Extent3.x, Width, Alpha);
+			std::vector<double> const WeightsY = kaiser_weights(y, Extent3.y, Width, Alpha);
+			std::vector<double> const WeightsZ = kaiser_weights(z, Extent3.z, Width, Alpha);
+
+			glm::dvec4 Sum(0);
+			for(int k = 0; k < Extent3.z; ++k)
+			for(int j = 0; j < Extent3.y; ++j)
+			for(int i = 0; i < Extent3.x; ++i)
+			{
+				double const Weight = WeightsX[static_cast<std::size_t>(i)] * WeightsY[static_cast<std::size_t>(j)] * WeightsZ[static_cast<std::size_t>(k)];
+				if(Weight != 0.0)
+					Sum += glm::dvec4(Src[static_cast<std::size_t>((k * Extent3.y + j) * Extent3.x + i)]) * Weight;
+			}
+
+			glm::vec4 const Texel = Dst[static_cast<std::size_t>((z * DstExtent3.y + y) * DstExtent3.x + x)];
+			Error += glm::all(glm::equal(Texel, glm::vec4(Sum), 0.001f)) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+static int test_downsampleKaiser()
+{
+	int Error = 0;
+
+	Error += test_downsampleKaiser_vec4(glm::ivec2(16, 8), 3.0f, 4.0f);
+	Error += test_downsampleKaiser_vec4(glm::ivec2(13, 6), 3.0f, 4.0f);
+	Error += test_downsampleKaiser_vec4(glm::ivec2(1, 5), 2.0f, 2.0f);
+	Error += test_downsampleKaiser_vec4(glm::ivec3(9, 6, 5), 3.0f, 4.0f);
+
+	// A linear ramp is preserved away from the edges, a constant image everywhere
+	{
+		glm::ivec2 const Extent(64, 2);
+		std::vector<glm::vec4> Src(64 * 2);
+		for(std::size_t i = 0; i < Src.size(); ++i)
+			Src[i] = glm::vec4(static_cast<float>(i % 64), 1.0f, 0.5f, 1.0f);
+		std::vector<glm::vec4> Dst(32);
+		glm::downsampleKaiser(&Src[0], Extent, &Dst[0], 3.0f, 4.0f, 1u);
+		for(std::size_t x = 0; x < Dst.size(); ++x)
+		{
+			if(x >= 3 && x < Dst.size() - 3)
+				Error += std::abs(Dst[x].x - (static_cast<float>(x) * 2.0f + 0.5f)) < 0.01f ? 0 : 1;
+			Error += glm::all(glm::equal(glm::vec3(Dst[x].y, Dst[x].z, Dst[x].w), glm::vec3(1.0f, 0.5f, 1.0f), 0.0001f)) ? 0 : 1;
+		}
+	}
+
+	// The overshoot of the negative lobes is clamped to the range of uint8, constant images are exact
+	for(int SRGB = 0; SRGB < 2; ++SRGB)
+	{
+		glm::ivec2 const Extent(32, 4);
+		std::vector<glm::u8vec4> Src(32 * 4);
+		for(std::size_t i = 0; i < Src.size(); ++i)
+			Src[i] = i % 32 < 16 ? glm::u8vec4(0, 255, 77, 200) : glm::u8vec4(255, 255, 77, 200);
+		std::vector<glm::u8vec4> Dst(16 * 2);
+		if(SRGB)
+			glm::downsampleKaiserSRGB(&Src[0], Extent, &Dst[0], 3.0f, 4.0f, 4u);
+		else
+			glm::downsampleKaiser(&Src[0], Extent, &Dst[0], 3.0f, 4.0f, 4u);
+		for(std::size_t i = 0; i < Dst.size(); ++i)
+		{
+			Error += Dst[i].y == 255 && Dst[i].z == 77 && Dst[i].w == 200 ? 0 : 1;
+			Error += Dst[i].x == (i % 16 < 4 ? 0 : i % 16 > 11 ? 255 : Dst[i].x) ? 0 : 1;
+		}
+		Error += Dst[7].x < Dst[8].x ? 0 : 1;
+	}
+
+	// Large enough to use several threads, compared with the single threaded result
+	{
+		glm::ivec2 const Extent(1024, 513);
+		glm::uint32 Seed = 3;
+		std::vector<glm::u8vec4> Src(static_cast<std::size_t>(Extent.x * Extent.y));
+		for(std::size_t i = 0; i < Src.size(); ++i)
+			Src[i] = glm::u8vec4(next(Seed) % 256, next(Seed) % 256, next(Seed) % 256, next(Seed) % 256);
+		std::vector<glm::u8vec4> Single(512 * 256);
+		std::vector<glm::u8vec4> Multi(512 * 256);
+		glm::downsampleKaiserSRGB(&Src[0], Extent, &Single[0], 3.0f, 4.0f, 1u);
+		glm::downsampleKaiserSRGB(&Src[0], Extent, &Multi[0], 3.0f, 4.0f, 4u);
+		Error += Single == Multi ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_mipExtent();
+	Error += test_mipChain();
+	Error += test_downsample_odd();
+	Error += test_downsample();
+	Error += test_downsampleKaiser();
+
+	return Error;
+}
@@ -7,6 +7,9 @@
 #include <cstdio>
 #include <vector>
 #include <random>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 
 #if GLM_COMPILER & GLM_COMPILER_CLANG
 #	pragma clang diagnostic push
@@ -529,6 +532,98 @@ static int testEigenvectors(T epsilon)
 	return 0;
 }
 
+// Computes eigenvalues and eigenvectors from well-known covariance matrix with the Jacobi 3x3 eigensolver
+template<typename T, glm::qualifier Q>
+static int testEigenvectorsJacobi(T epsilon)
+{
+	typedef glm::vec<3, T, Q> vec;
+	typedef glm::mat<3, 3, T, Q> mat;
+
+	mat covarMat(agarose::expectedCovarData());
+
+	vec eigenvalues;
+	mat eigenvectors;
+	unsigned int c = glm::findEigenvaluesSymRealJacobi(covarMat, eigenvalues, eigenvectors);
+	if(c != 3)
+		return failReport(__LINE__);
+	glm::sortEigenvalues(eigenvalues, eigenvectors);
+
+	if(!vectorEpsilonEqual(eigenvalues, vec(agarose::expectedEigenvalues<3>()), epsilon))
+		return failReport(__LINE__);
+
+	for(int i = 0; i < 3; ++i)
+	{
+		vec act = eigenvectors[i];
+		vec exp = glm::normalize(agarose::expectedEigenvectors<3>()[i]);
+		if(!sameSign(act[0], exp[0])) exp = -exp;
+		if(!vectorEpsilonEqual(act, exp, epsilon))
+			return failReport(__LINE__);
+	}
+
+	// A fixed number of sweeps reconstructs the matrix
+	c = glm::findEigenvaluesSymRealJacobi(covarMat, eigenvalues, eigenvectors, 5);
+	if(c != 3)
+		return failReport(__LINE__);
+	mat const diagonal(
+		eigenvalues[0], 0, 0,
+		0, eigenvalues[1], 0,
+		0, 0, eigenvalues[2]);
+	mat const reconstructed = eigenvectors * diagonal * glm::transpose(eigenvectors);
+	if(!matrixEpsilonEqual(reconstructed, covarMat, epsilon))
+		return failReport(__LINE__);
+
+	// Diagonal input is returned as is
+	c = glm::findEigenvaluesSymRealJacobi(diagonal, eigenvalues, eigenvectors);
+	if(!matrixEpsilonEqual(eigenvectors, mat(1), epsilon))
+		return failReport(__LINE__);
+
+	return 0;
+}
+
+// Streaming covariance matches the two-pass computation, also when merging partial results
+template<glm::length_t D, typename T, glm::qualifier Q>
+static int testCovarianceAccumulator(glm::length_t dataSize, unsigned int randomEngineSeed)
+{
+	typedef glm::vec<D, T, Q> vec;
+	typedef glm::mat<D, D, T, Q> mat;
+
+	std::default_random_engine rndEng(randomEngineSeed);
+	std::normal_distribution<T> normalDist;
+	std::vector<vec> testData(dataSize);
+	// large common offset, the two-pass reference is computed around the exact center
+	for(glm::length_t i = 0; i < dataSize; ++i)
+		for(glm::length_t d = 0; d < D; ++d)
+			testData[i][d] = static_cast<T>(1000) + normalDist(rndEng);
+
+	vec const center = computeCenter(testData);
+	mat const expected = glm::computeCovarianceMatrix(testData.data(), testData.size(), center);
+
+	glm::covariance_accumulator<D, T, Q> all;
+	all.add(testData.data(), testData.size());
+	if(all.count != testData.size())
+		return failReport(__LINE__);
+	if(!vectorEpsilonEqual(all.mean, center, static_cast<T>(0.001)))
+		return failReport(__LINE__);
+	if(!matrixEpsilonEqual(all.covariance(), expected, static_cast<T>(0.001)))
+		return failReport(__LINE__);
+
+	size_t const split = testData.size() / 3;
+	glm::covariance_accumulator<D, T, Q> first, second, empty;
+	first.add(testData.data(), split);
+	second.add(testData.data() + split, testData.size() - split);
+	first.merge(second);
+	first.merge(empty);
+	empty.merge(first);
+	if(empty.count != testData.size())
+		return failReport(__LINE__);
+	if(!vectorEpsilonEqual(empty.mean, all.mean, static_cast<T>(0.001)))
+		return failReport(__LINE__);
+	if(!matrixEpsilonEqual(empty.covariance(), all.covariance(), static_cast<T>(0.001)))
+		return failReport(__LINE__);
+
+	return 0;
+}
+
 // A simple small smoke test:
 // - a uniformly sampled block
 // - reconstruct main axes
@@ -705,6 +800,32 @@ int main()
 	if(error != 0)
 		return error;
 
+	if(testEigenvectorsJacobi<float, glm::defaultp>(0.00001f) != 0)
+		error = failReport(__LINE__);
+	if(testEigenvectorsJacobi<double, glm::defaultp>(0.0000000001) != 0)
+		error = failReport(__LINE__);
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	if(testEigenvectorsJacobi<float, glm::aligned_highp>(0.00001f) != 0)
+		error = failReport(__LINE__);
+#endif
+	if(error != 0)
+		return error;
+
+	if(testCovarianceAccumulator<2, float, glm::defaultp>(1000, 12345) != 0)
+		error = failReport(__LINE__);
+	if(testCovarianceAccumulator<3, float, glm::defaultp>(1000, 2021) != 0)
+		error = failReport(__LINE__);
+	if(testCovarianceAccumulator<3, double, glm::defaultp>(1000, 815) != 0)
+		error = failReport(__LINE__);
+	if(testCovarianceAccumulator<4, double, glm::defaultp>(1000, 174) != 0)
+		error = failReport(__LINE__);
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	if(testCovarianceAccumulator<4, float, glm::aligned_highp>(1000, 3141) != 0)
+		error = failReport(__LINE__);
+#endif
+	if(error != 0)
+		return error;
+
 	// Final tests with randomized data
 	if(rndTest(12345) != 0)
 		error = failReport(__LINE__);
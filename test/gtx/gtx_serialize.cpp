@@ -0,0 +1,265 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/serialize.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/ext/vector_int4_sized.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+
+#include <vector>
+#include <cstring>
+
+static glm::serial_endianness other(glm::serial_endianness Endianness)
+{
+	return Endianness == glm::serial_little_endian ? glm::serial_big_endian : glm::serial_little_endian;
+}
+
+template<typename genType>
+static int test_roundtrip(std::vector<genType> const& Values)
+{
+	int Error = 0;
+
+	glm::serial_endianness const Endiannesses[] = {glm::hostEndianness(), other(glm::hostEndianness())};
+	for(std::size_t e = 0; e < 2; ++e)
+	{
+		std::vector<unsigned char> Buffer(glm::serializedSize<genType>(Values.size(), glm::serial_raw));
+		Error += glm::serialize(&Values[0], Values.size(), Endiannesses[e], glm::serial_raw, &Buffer[0], Buffer.size()) == Buffer.size() ? 0 : 1;
+
+		glm::serial_header Header = {};
+		Error += glm::readSerialHeader(&Buffer[0], Buffer.size(), Header) ? 0 : 1;
+		Error += Header.Endianness == Endiannesses[e] ? 0 : 1;
+		Error += Header.Count == Values.size() ? 0 : 1;
+
+		std::vector<genType> Result(Values.size());
+		Error += glm::deserialize(&Buffer[0], Buffer.size(), &Result[0], Result.size()) == Values.size() ? 0 : 1;
+
+		// Compares the components, ignoring the padding of aligned types
+		std::vector<unsigned char> Copy(Buffer.size());
+		Error += glm::serialize(&Result[0], Result.size(), Endiannesses[e], glm::serial_raw, &Copy[0], Copy.size()) == Copy.size() ? 0 : 1;
+		Error += Copy == Buffer ? 0 : 1;
+
+		// Fewer values than serialized
+		Error += glm::deserialize(&Buffer[0], Buffer.size(), &Result[0], 1) == 1 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_roundtrip()
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> Vec3;
+	std::vector<glm::dvec2> DVec2;
+	std::vector<glm::i16vec4> I16Vec4;
+	std::vector<glm::quat> Quat;
+	std::vector<glm::mat4> Mat4;
+	std::vector<glm::mat2x3> Mat2x3;
+	for(int i = 0; i < 100; ++i)
+	{
+		float const f = static_cast<float>(i);
+		Vec3.push_back(glm::vec3(f, -f * 0.5f, f * 1.25f));
+		DVec2.push_back(glm::dvec2(f * 0.1, 1.0 / (f + 1.0)));
+		I16Vec4.push_back(glm::i16vec4(static_cast<glm::int16>(i), static_cast<glm::int16>(-i), static_cast<glm::int16>(i * 300), 7));
+		Quat.push_back(glm::quat::wxyz(f, f + 1.0f, f + 2.0f, f + 3.0f));
+		Mat4.push_back(glm::mat4(f) + glm::mat4(glm::vec4(1, 2, 3, 4), glm::vec4(5, 6, 7, 8), glm::vec4(9, 10, 11, 12), glm::vec4(13, 14, 15, 16)));
+		Mat2x3.push_back(glm::mat2x3(f, 1, 2, 3, 4, -f));
+	}
+
+	Error += test_roundtrip(Vec3);
+	Error += test_roundtrip(DVec2);
+	Error += test_roundtrip(I16Vec4);
+	Error += test_roundtrip(Quat);
+	Error += test_roundtrip(Mat4);
+	Error += test_roundtrip(Mat2x3);
+
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	// Padded types are written component by component and read by packed types
+	std::vector<glm::aligned_vec3> Aligned(Vec3.begin(), Vec3.end());
+	std::vector<unsigned char> Buffer(glm::serializedSize<glm::aligned_vec3>(Aligned.size(), glm::serial_raw));
+	Error += Buffer.size() == glm::serializedSize<glm::vec3>(Vec3.size(), glm::serial_raw) ? 0 : 1;
+	Error += glm::serialize(&Aligned[0], Aligned.size(), glm::serial_big_endian, glm::serial_raw, &Buffer[0], Buffer.size()) == Buffer.size() ? 0 : 1;
+
+	std::vector<glm::vec3> Packed(Vec3.size());
+	Error += glm::deserialize(&Buffer[0], Buffer.size(), &Packed[0], Packed.size()) == Vec3.size() ? 0 : 1;
+	for(std::size_t i = 0; i < Vec3.size(); ++i)
+		Error += glm::all(glm::equal(Packed[i], Vec3[i])) ? 0 : 1;
+
+	std::vector<glm::aligned_vec3> AlignedResult(Aligned.size());
+	Error += glm::deserialize(&Buffer[0], Buffer.size(), &AlignedResult[0], AlignedResult.size()) == Aligned.size() ? 0 : 1;
+	for(std::size_t i = 0; i < Aligned.size(); ++i)
+		Error += glm::all(glm::equal(AlignedResult[i], Aligned[i])) ? 0 : 1;
+#endif
+
+	return Error;
+}
+
+static int test_layout()
+{
+	int Error = 0;
+
+	glm::u16vec2 const Value(0x0102, 0x0304);
+	unsigned char Buffer[glm::serial_header_size + 4];
+	Error += glm::serialize(&Value, 1, glm::serial_big_endian, glm::serial_raw, Buffer, sizeof(Buffer)) == sizeof(Buffer) ? 0 : 1;
+
+	unsigned char const Header[] = {'G', 'L', 'M', 'S', 1, glm::serial_big_endian, glm::serial_vector, glm::serial_uint16, glm::serial_raw, 1, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0};
+	Error += std::memcmp(Buffer, Header, sizeof(Header)) == 0 ? 0 : 1;
+	for(std::size_t i = sizeof(Header); i < glm::serial_header_size; ++i)
+		Error += Buffer[i] == 0 ? 0 : 1;
+
+	unsigned char const Data[] = {0x01, 0x02, 0x03, 0x04};
+	Error += std::memcmp(Buffer + glm::serial_header_size, Data, sizeof(Data)) == 0 ? 0 : 1;
+
+	// Quaternions are stored in x, y, z, w order whatever the memory layout
+	glm::quat const q = glm::quat::wxyz(4.0f, 1.0f, 2.0f, 3.0f);
+	unsigned char QuatBuffer[glm::serial_header_size + 16];
+	Error += glm::serialize(&q, 1, QuatBuffer, sizeof(QuatBuffer)) == sizeof(QuatBuffer) ? 0 : 1;
+	float Components[4];
+	std::memcpy(Components, QuatBuffer + glm::serial_header_size, sizeof(Components));
+	for(int i = 0; i < 4; ++i)
+		Error += glm::equal(Components[i], static_cast<float>(i + 1), 0.0f) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_encoding()
+{
+	int Error = 0;
+
+	std::vector<glm::vec4> Values;
+	for(int i = 0; i <= 100; ++i)
+	{
+		float const f = static_cast<float>(i) / 100.0f;
+		Values.push_back(glm::vec4(f, 1.0f - f, f * 0.5f, 1.0f));
+	}
+
+	struct encoding
+	{
+		glm::serial_encoding Encoding;
+		std::size_t Size;
+		float Epsilon;
+	};
+
+	encoding const Encodings[] = {
+		{glm::serial_half, 2, 1.0f / 1024.0f},
+		{glm::serial_snorm8, 1, 1.0f / 127.0f},
+		{glm::serial_unorm8, 1, 1.0f / 255.0f},
+		{glm::serial_snorm16, 2, 1.0f / 32767.0f},
+		{glm::serial_unorm16, 2, 1.0f / 65535.0f}};
+
+	for(std::size_t e = 0; e < sizeof(Encodings) / sizeof(Encodings[0]); ++e)
+	for(int b = 0; b < 2; ++b)
+	{
+		glm::serial_endianness const Endianness = b ? glm::serial_big_endian : glm::serial_little_endian;
+
+		std::vector<unsigned char> Buffer(glm::serializedSize<glm::vec4>(Values.size(), Encodings[e].Encoding));
+		Error += Buffer.size() == glm::serial_header_size + Values.size() * 4 * Encodings[e].Size ? 0 : 1;
+		Error += glm::serialize(&Values[0], Values.size(), Endianness, Encodings[e].Encoding, &Buffer[0], Buffer.size()) == Buffer.size() ? 0 : 1;
+
+		std::vector<glm::vec4> Result(Values.size());
+		Error += glm::deserialize(&Buffer[0], Buffer.size(), &Result[0], Result.size()) == Values.size() ? 0 : 1;
+		for(std::size_t i = 0; i < Values.size(); ++i)
+			Error += glm::all(glm::equal(Result[i], Values[i], Encodings[e].Epsilon)) ? 0 : 1;
+
+		// Encoded buffers can't be used in place
+		std::size_t Count = 0;
+		Error += glm::serializedData<glm::vec4>(&Buffer[0], Buffer.size(), Count) == nullptr ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_serializedData()
+{
+	int Error = 0;
+
+	std::vector<glm::vec4> Values;
+	for(int i = 0; i < 16; ++i)
+		Values.push_back(glm::vec4(static_cast<float>(i)));
+
+	// Storage of 16 bytes aligned memory, the data starts after the 32 bytes header
+	std::vector<glm::vec4> Storage(2 + Values.size());
+	void* const Buffer = &Storage[0];
+	std::size_t const Size = Storage.size() * sizeof(glm::vec4);
+
+	Error += glm::serialize(&Values[0], Values.size(), Buffer, Size) == glm::serializedSize<glm::vec4>(Values.size(), glm::serial_raw) ? 0 : 1;
+
+	std::size_t Count = 0;
+	glm::vec4 const* Data = glm::serializedData<glm::vec4>(Buffer, Size, Count);
+	Error += Data == reinterpret_cast<glm::vec4 const*>(static_cast<unsigned char const*>(Buffer) + glm::serial_header_size) ? 0 : 1;
+	Error += Count == Values.size() ? 0 : 1;
+	for(std::size_t i = 0; Data && i < Count; ++i)
+		Error += glm::all(glm::equal(Data[i], Values[i])) ? 0 : 1;
+
+	// Other type, other byte order and misaligned data
+	Error += glm::serializedData<glm::ivec4>(Buffer, Size, Count) == nullptr ? 0 : 1;
+	Error += glm::serializedData<glm::vec4>(static_cast<unsigned char const*>(Buffer) + 1, Size - 1, Count) == nullptr ? 0 : 1;
+
+	Error += glm::serialize(&Values[0], Values.size(), other(glm::hostEndianness()), glm::serial_raw, Buffer, Size) != 0 ? 0 : 1;
+	Error += glm::serializedData<glm::vec4>(Buffer, Size, Count) == nullptr ? 0 : 1;
+
+	std::vector<unsigned char> Misaligned(glm::serializedSize<glm::vec4>(Values.size(), glm::serial_raw) + 1);
+	Error += glm::serialize(&Values[0], Values.size(), &Misaligned[1], Misaligned.size() - 1) != 0 ? 0 : 1;
+	if(reinterpret_cast<std::size_t>(&Misaligned[1]) % alignof(glm::vec4) != 0)
+		Error += glm::serializedData<glm::vec4>(&Misaligned[1], Misaligned.size() - 1, Count) == nullptr ? 0 : 1;
+
+	return Error;
+}
+
+static int test_errors()
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> Values(10, glm::vec3(1.0f));
+	std::vector<unsigned char> Buffer(glm::serializedSize<glm::vec3>(Values.size(), glm::serial_raw));
+	std::vector<glm::vec3> Result(Values.size());
+
+	// Buffer too small
+	Error += glm::serialize(&Values[0], Values.size(), &Buffer[0], Buffer.size() - 1) == 0 ? 0 : 1;
+
+	// Encoding of non floating point values
+	glm::ivec3 const Integers(1);
+	Error += glm::serialize(&Integers, 1, glm::serial_little_endian, glm::serial_half, &Buffer[0], Buffer.size()) == 0 ? 0 : 1;
+
+	Error += glm::serialize(&Values[0], Values.size(), &Buffer[0], Buffer.size()) == Buffer.size() ? 0 : 1;
+
+	// Truncated buffer
+	Error += glm::deserialize(&Buffer[0], Buffer.size() - 1, &Result[0], Result.size()) == 0 ? 0 : 1;
+	Error += glm::deserialize(&Buffer[0], glm::serial_header_size - 1, &Result[0], Result.size()) == 0 ? 0 : 1;
+
+	// Type mismatch
+	glm::vec4 Vec4;
+	glm::dvec3 DVec3;
+	glm::mat3 Mat3;
+	glm::quat Quat;
+	Error += glm::deserialize(&Buffer[0], Buffer.size(), &Vec4, 1) == 0 ? 0 : 1;
+	Error += glm::deserialize(&Buffer[0], Buffer.size(), &DVec3, 1) == 0 ? 0 : 1;
+	Error += glm::deserialize(&Buffer[0], Buffer.size(), &Mat3, 1) == 0 ? 0 : 1;
+	Error += glm::deserialize(&Buffer[0], Buffer.size(), &Quat, 1) == 0 ? 0 : 1;
+
+	// Bad magic and version
+	glm::serial_header Header = {};
+	Buffer[0] = 'X';
+	Error += glm::readSerialHeader(&Buffer[0], Buffer.size(), Header) ? 1 : 0;
+	Error += glm::deserialize(&Buffer[0], Buffer.size(), &Result[0], Result.size()) == 0 ? 0 : 1;
+	Buffer[0] = 'G';
+	Buffer[4] = 2;
+	Error += glm::readSerialHeader(&Buffer[0], Buffer.size(), Header) ? 1 : 0;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_roundtrip();
+	Error += test_layout();
+	Error += test_encoding();
+	Error += test_serializedData();
+	Error += test_errors();
+
+	return Error;
+}
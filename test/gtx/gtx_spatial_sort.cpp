@@ -0,0 +1,178 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/spatial_sort.hpp>
+#include <glm/ext/vector_relational.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+
+#include <vector>
+#include <algorithm>
+
+static glm::uint32 next(glm::uint32& Seed)
+{
+	Seed = Seed * 1664525u + 1013904223u;
+	return Seed >> 8;
+}
+
+// Permutation must hold every index once
+static int check_permutation(std::vector<glm::uint32> const& Permutation)
+{
+	std::vector<glm::uint32> Sorted(Permutation);
+	std::sort(Sorted.begin(), Sorted.end());
+
+	int Error = 0;
+	for(std::size_t i = 0; i < Sorted.size(); ++i)
+		Error += Sorted[i] == i ? 0 : 1;
+	return Error;
+}
+
+static int test_sortPermutation()
+{
+	int Error = 0;
+
+	glm::uint32 Seed = 1;
+	std::size_t const Counts[] = {0, 1, 1000, 100000};
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::vector<glm::uint64> Keys(Counts[c]);
+		for(std::size_t i = 0; i < Keys.size(); ++i)
+			Keys[i] = (glm::uint64(next(Seed)) << 40) ^ (glm::uint64(next(Seed) % 64) << 8);
+
+		for(unsigned int Threads = 1; Threads <= 4; Threads *= 2)
+		{
+			std::vector<glm::uint32> Permutation(Keys.size());
+			glm::sortPermutation(Keys.empty() ? nullptr : &Keys[0], Keys.size(), Permutation.empty() ? nullptr : &Permutation[0], Threads);
+
+			Error += check_permutation(Permutation);
+
+			// Sorted and stable
+			for(std::size_t i = 1; i < Permutation.size(); ++i)
+			{
+				glm::uint64 const a = Keys[Permutation[i - 1]];
+				glm::uint64 const b = Keys[Permutation[i]];
+				Error += a < b || (a == b && Permutation[i - 1] < Permutation[i]) ? 0 : 1;
+			}
+		}
+	}
+
+	// Equal keys keep their order
+	std::vector<glm::uint64> Same(100, 42);
+	std::vector<glm::uint32> Permutation(Same.size());
+	glm::sortPermutation(&Same[0], Same.size(), &Permutation[0], 1u);
+	for(std::size_t i = 0; i < Permutation.size(); ++i)
+		Error += Permutation[i] == i ? 0 : 1;
+
+	return Error;
+}
+
+template<glm::qualifier Q>
+static int test_order()
+{
+	typedef glm::vec<3, float, Q> vec3;
+
+	int Error = 0;
+
+	glm::uint32 Seed = 2;
+	std::vector<vec3> Positions(20000);
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+		Positions[i] = vec3(static_cast<float>(next(Seed) % 1000), static_cast<float>(next(Seed) % 1000), static_cast<float>(next(Seed) % 1000));
+
+	vec3 const Min(0.0f);
+	vec3 const Max(1000.0f);
+
+	std::vector<glm::uint64> Keys(Positions.size());
+	std::vector<glm::uint32> Permutation(Positions.size());
+
+	glm::mortonOrder(&Positions[0], Positions.size(), Min, Max, &Permutation[0], 3u);
+	glm::mortonEncode(&Positions[0], Positions.size(), Min, Max, &Keys[0]);
+	Error += check_permutation(Permutation);
+	for(std::size_t i = 1; i < Permutation.size(); ++i)
+		Error += Keys[Permutation[i - 1]] <= Keys[Permutation[i]] ? 0 : 1;
+
+	glm::hilbertOrder(&Positions[0], Positions.size(), Min, Max, &Permutation[0], 1u);
+	glm::hilbertEncode(&Positions[0], Positions.size(), Min, Max, &Keys[0]);
+	Error += check_permutation(Permutation);
+	for(std::size_t i = 1; i < Permutation.size(); ++i)
+		Error += Keys[Permutation[i - 1]] <= Keys[Permutation[i]] ? 0 : 1;
+
+	// Sorting shortens the path through the points
+	float RandomLength = 0.0f;
+	float SortedLength = 0.0f;
+	for(std::size_t i = 1; i < Permutation.size(); ++i)
+	{
+		RandomLength += glm::distance(Positions[i - 1], Positions[i]);
+		SortedLength += glm::distance(Positions[Permutation[i - 1]], Positions[Permutation[i]]);
+	}
+	Error += SortedLength * 4.0f < RandomLength ? 0 : 1;
+
+	return Error;
+}
+
+static int test_applyPermutation()
+{
+	int Error = 0;
+
+	glm::uint32 Seed = 3;
+	std::vector<glm::uint32> Permutation(1000);
+	for(std::size_t i = 0; i < Permutation.size(); ++i)
+		Permutation[i] = static_cast<glm::uint32>(i);
+	for(std::size_t i = Permutation.size() - 1; i > 0; --i)
+		std::swap(Permutation[i], Permutation[next(Seed) % (i + 1)]);
+
+	std::vector<glm::ivec2> Data(Permutation.size());
+	for(std::size_t i = 0; i < Data.size(); ++i)
+		Data[i] = glm::ivec2(static_cast<int>(i), -static_cast<int>(i));
+
+	glm::applyPermutation(&Permutation[0], Data.size(), &Data[0]);
+	for(std::size_t i = 0; i < Data.size(); ++i)
+		Error += Data[i] == glm::ivec2(static_cast<int>(Permutation[i]), -static_cast<int>(Permutation[i])) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_spatialSort()
+{
+	int Error = 0;
+
+	glm::uint32 Seed = 4;
+	std::vector<glm::vec2> Positions(5000);
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+		Positions[i] = glm::vec2(static_cast<float>(next(Seed) % 100), static_cast<float>(next(Seed) % 100)) * 0.5f - 10.0f;
+
+	std::vector<glm::vec2> const Original(Positions);
+	std::vector<glm::uint32> Permutation(Positions.size());
+	glm::spatialSort(&Positions[0], Positions.size(), &Permutation[0], 2u);
+
+	Error += check_permutation(Permutation);
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+		Error += glm::all(glm::equal(Positions[i], Original[Permutation[i]])) ? 0 : 1;
+
+	// Consecutive points along the Hilbert curve are close
+	std::size_t Jumps = 0;
+	for(std::size_t i = 1; i < Positions.size(); ++i)
+		Jumps += glm::distance(Positions[i - 1], Positions[i]) > 5.0f ? 1 : 0;
+	Error += Jumps < Positions.size() / 100 ? 0 : 1;
+
+	// Without permutation output
+	std::vector<glm::vec2> Copy(Original);
+	glm::spatialSort(&Copy[0], Copy.size(), nullptr, 1u);
+	for(std::size_t i = 0; i < Copy.size(); ++i)
+		Error += glm::all(glm::equal(Copy[i], Positions[i])) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_sortPermutation();
+	Error += test_order<glm::defaultp>();
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	Error += test_order<glm::aligned_highp>();
+#endif
+	Error += test_applyPermutation();
+	Error += test_spatialSort();
+
+	return Error;
+}
@@ -3,9 +3,15 @@
 #include <glm/vec4.hpp>
 #include <glm/ext/vector_relational.hpp>
 #include <glm/ext/scalar_constants.hpp>
+#include <glm/ext/scalar_relational.hpp>
 
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/spline.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+
+#include <vector>
 
 namespace catmullRom
 {
@@ -109,6 +115,173 @@ namespace cubic
 	}
 }//catmullRom
 
+namespace spline
+{
+	// Control points on a circle of radius 10
+	template<typename vecType>
+	static std::vector<vecType> circle(int Count)
+	{
+		std::vector<vecType> Points(static_cast<std::size_t>(Count));
+		for(int i = 0; i < Count; ++i)
+		{
+			float const Angle = 2.0f * glm::pi<float>() * static_cast<float>(i) / static_cast<float>(Count - 1);
+			vecType Point(0);
+			Point[0] = static_cast<typename vecType::value_type>(10.0f * glm::cos(Angle));
+			Point[1] = static_cast<typename vecType::value_type>(10.0f * glm::sin(Angle));
+			Points[static_cast<std::size_t>(i)] = Point;
+		}
+		return Points;
+	}
+
+	static int test_segments()
+	{
+		int Error = 0;
+
+		std::vector<glm::vec3> const Points = circle<glm::vec3>(9);
+		glm::catmull_rom_spline<3, float> const Spline(&Points[0], Points.size());
+
+		Error += Spline.segments() == 8 ? 0 : 1;
+		Error += glm::all(glm::equal(Spline.position(0.0f), Points[0], 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Spline.position(8.0f), Points[8], 0.0001f)) ? 0 : 1;
+
+		// The interior segments are the ones of catmullRom
+		for(std::size_t k = 1; k + 2 < Points.size(); ++k)
+		{
+			glm::vec3 const Expected = glm::catmullRom(Points[k - 1], Points[k], Points[k + 1], Points[k + 2], 0.25f);
+			Error += glm::all(glm::equal(Spline.position(static_cast<float>(k) + 0.25f), Expected, 0.0001f)) ? 0 : 1;
+		}
+
+		// A spline through two points is a line
+		glm::vec2 const Line[] = {glm::vec2(1, 2), glm::vec2(4, 6)};
+		glm::catmull_rom_spline<2, float> const Segment(Line, 2);
+		Error += glm::equal(Segment.length(), 5.0f, 0.0001f) ? 0 : 1;
+		Error += glm::equal(Segment.parameter(2.5f), 0.5f, 0.0001f) ? 0 : 1;
+		Error += glm::all(glm::equal(Segment.position(0.5f), glm::vec2(2.5f, 4.0f), 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Segment.tangent(0.3f), glm::vec2(3, 4), 0.0001f)) ? 0 : 1;
+
+		return Error;
+	}
+
+	template<typename vecType>
+	static int test_arc_length()
+	{
+		typedef typename vecType::value_type T;
+
+		int Error = 0;
+
+		std::vector<vecType> const Points = circle<vecType>(33);
+		glm::catmull_rom_spline<vecType::length(), T, glm::defaultp> const Spline(&Points[0], Points.size());
+
+		// Close to the circumference of the circle
+		Error += glm::abs(Spline.length() - static_cast<T>(20) * glm::pi<T>()) < static_cast<T>(0.01) ? 0 : 1;
+
+		for(int i = 0; i <= 64; ++i)
+		{
+			T const Distance = Spline.length() * static_cast<T>(i) / static_cast<T>(64);
+			Error += glm::abs(Spline.distance(Spline.parameter(Distance)) - Distance) < static_cast<T>(0.001) ? 0 : 1;
+		}
+
+		// Points at uniformly spaced arc lengths are uniformly spaced
+		std::size_t const Count = 100;
+		std::vector<T> Distances(Count);
+		std::vector<T> Parameters(Count);
+		std::vector<vecType> Positions(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Distances[i] = Spline.length() * static_cast<T>(i) / static_cast<T>(Count - 1);
+		Spline.parameters(&Distances[0], Count, &Parameters[0]);
+		Spline.positions(&Parameters[0], Count, &Positions[0]);
+
+		T const Spacing = Spline.length() / static_cast<T>(Count - 1);
+		for(std::size_t i = 1; i < Count; ++i)
+			Error += glm::abs(glm::distance(Positions[i], Positions[i - 1]) - Spacing) < Spacing * static_cast<T>(0.01) ? 0 : 1;
+
+		return Error;
+	}
+
+	// The batch evaluations, with SIMD instruction sets, match the single ones
+	template<glm::length_t L, typename T, glm::qualifier Q>
+	static int test_batch()
+	{
+		typedef glm::vec<L, T, Q> vecType;
+
+		int Error = 0;
+
+		std::vector<vecType> const Points = circle<vecType>(17);
+		glm::catmull_rom_spline<L, T, Q> const Spline(&Points[0], Points.size());
+
+		std::size_t const Count = 301;
+		std::vector<T> Parameters(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Parameters[i] = static_cast<T>(i) / static_cast<T>(Count - 1) * static_cast<T>(18) - static_cast<T>(1);
+
+		std::vector<vecType> Positions(Count);
+		std::vector<vecType> Tangents(Count);
+		Spline.positions(&Parameters[0], Count, &Positions[0]);
+		Spline.tangents(&Parameters[0], Count, &Tangents[0]);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::equal(Positions[i], Spline.position(Parameters[i]), static_cast<T>(0.0001))) ? 0 : 1;
+			Error += glm::all(glm::equal(Tangents[i], Spline.tangent(Parameters[i]), static_cast<T>(0.0001))) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	static int test_closest()
+	{
+		int Error = 0;
+
+		std::vector<glm::vec3> const Points = circle<glm::vec3>(33);
+		glm::catmull_rom_spline<3, float> const Spline(&Points[0], Points.size());
+
+		// Points off the spline along its normal in the plane of the circle and along the axis of the circle
+		for(int i = 1; i < 32; ++i)
+		{
+			float const Parameter = static_cast<float>(i) - 0.37f;
+			glm::vec3 const Tangent = Spline.tangent(Parameter);
+			glm::vec3 const Normal = glm::normalize(glm::vec3(-Tangent.y, Tangent.x, 0.0f));
+			glm::vec3 const Point = Spline.position(Parameter) + Normal * 0.5f + glm::vec3(0, 0, 0.25f);
+
+			Error += glm::equal(Spline.closestParameter(Point), Parameter, 0.001f) ? 0 : 1;
+			Error += glm::equal(Spline.closestParameter(Point, Parameter - 1.0f, Parameter + 1.0f), Parameter, 0.001f) ? 0 : 1;
+		}
+
+		// Out of the range, the closest point is a bound of the range
+		Error += glm::equal(Spline.closestParameter(Points[10], 4.0f, 2.0f), 4.0f, 0.0001f) ? 0 : 1;
+
+		// Beyond the ends of a line
+		glm::vec2 const Line[] = {glm::vec2(1, 2), glm::vec2(4, 6)};
+		glm::catmull_rom_spline<2, float> const Segment(Line, 2);
+		Error += glm::equal(Segment.closestParameter(glm::vec2(0, 0)), 0.0f, 0.0001f) ? 0 : 1;
+		Error += glm::equal(Segment.closestParameter(glm::vec2(10, 10)), 1.0f, 0.0001f) ? 0 : 1;
+		Error += glm::equal(Segment.closestParameter(glm::vec2(6.5f, 2)), 0.66f, 0.0001f) ? 0 : 1;
+
+		return Error;
+	}
+
+	static int test()
+	{
+		int Error = 0;
+
+		Error += test_segments();
+		Error += test_arc_length<glm::vec2>();
+		Error += test_arc_length<glm::vec3>();
+		Error += test_arc_length<glm::dvec3>();
+		Error += test_batch<2, float, glm::defaultp>();
+		Error += test_batch<3, float, glm::defaultp>();
+		Error += test_batch<4, float, glm::defaultp>();
+		Error += test_batch<4, double, glm::defaultp>();
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			Error += test_batch<3, float, glm::aligned_highp>();
+			Error += test_batch<4, float, glm::aligned_highp>();
+#		endif
+		Error += test_closest();
+
+		return Error;
+	}
+}//namespace spline
+
 int main()
 {
 	int Error(0);
@@ -116,6 +289,7 @@ int main()
 	Error += catmullRom::test();
 	Error += hermite::test();
 	Error += cubic::test();
+	Error += spline::test();
 
 	return Error;
 }
@@ -1,8 +1,19 @@
+// The fmt formatters are declared when fmt is included before GLM
+#if defined(__has_include)
+#	if __has_include(<fmt/format.h>)
+#		define FMT_HEADER_ONLY
+#		include <fmt/format.h>
+#	endif
+#endif
+
 #include <glm/glm.hpp>
 
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/string_cast.hpp>
 #include <limits>
+#include <cstdio>
+#include <cstring>
+#include <vector>
 
 static int test_string_cast_vector()
 {
@@ -141,6 +152,302 @@ static int test_string_cast_dual_quaternion()
 	return Error;
 }
 
+#if GLM_LANG & GLM_LANG_CXX17_FLAG
+static std::string to_chars_string(char* First, std::to_chars_result const& Result)
+{
+	return Result.ec == std::errc() ? std::string(First, Result.ptr) : std::string("error");
+}
+
+template<typename genType>
+static std::string to_chars_string(genType const& x)
+{
+	char Buffer[512];
+	return to_chars_string(Buffer, glm::to_chars(Buffer, Buffer + sizeof(Buffer), x));
+}
+
+// The text fits in the buffers of the formatters
+template<typename genType>
+static int check_to_chars_capacity(genType const& x)
+{
+	char Buffer[1024];
+	std::to_chars_result const Result = glm::to_chars(Buffer, Buffer + sizeof(Buffer), x);
+	return Result.ec == std::errc() && static_cast<std::size_t>(Result.ptr - Buffer) <= glm::detail::compute_to_chars<genType>::capacity ? 0 : 1;
+}
+
+static int test_to_chars()
+{
+	int Error = 0;
+
+	// Shortest representation reading back to the same value
+	Error += to_chars_string(glm::vec3(1.0f, 0.1f, -2.5e-7f)) != std::string("vec3(1, 0.1, -2.5e-07)") ? 1 : 0;
+	Error += to_chars_string(glm::dvec2(0.1, 1e300)) != std::string("dvec2(0.1, 1e+300)") ? 1 : 0;
+	Error += to_chars_string(glm::ivec4(1, -2, 3, -4)) != std::string("ivec4(1, -2, 3, -4)") ? 1 : 0;
+	Error += to_chars_string(glm::i8vec2(-128, 127)) != std::string("i8vec2(-128, 127)") ? 1 : 0;
+	Error += to_chars_string(glm::u64vec1(18446744073709551615ull)) != std::string("u64vec1(18446744073709551615)") ? 1 : 0;
+	Error += to_chars_string(glm::bvec2(false, true)) != std::string("bvec2(false, true)") ? 1 : 0;
+
+	Error += to_chars_string(glm::mat2x3(1, 2, 3, 4, 5, 6.5f)) != std::string("mat2x3((1, 2, 3), (4, 5, 6.5))") ? 1 : 0;
+	Error += to_chars_string(glm::quat(1.0f, 2.0f, 3.0f, 4.0f)) != std::string("quat(1, {2, 3, 4})") ? 1 : 0;
+	Error += to_chars_string(glm::dualquat(glm::quat(1.0f, 2.0f, 3.0f, 4.0f), glm::quat(5.0f, 6.0f, 7.0f, 8.0f))) != std::string("dualquat((1, {2, 3, 4}), (5, {6, 7, 8}))") ? 1 : 0;
+
+	// Every float reads back to the same value
+	float const Values[] = {0.1f, 1.0f / 3.0f, 3.14159274f, 1e-38f, 3.4028235e38f, -0.0f, 16777217.0f};
+	for(std::size_t i = 0; i < sizeof(Values) / sizeof(Values[0]); ++i)
+	{
+		char Buffer[64];
+		std::to_chars_result const Result = glm::to_chars(Buffer, Buffer + sizeof(Buffer), glm::vec1(Values[i]));
+		Error += Result.ec == std::errc() ? 0 : 1;
+		*Result.ptr = '\0';
+
+		float Value = 0.0f;
+		Error += std::sscanf(Buffer, "vec1(%f)", &Value) == 1 && Value == Values[i] ? 0 : 1;
+	}
+
+	// The formatters write the longest texts of each type in buffers of capacity characters
+	{
+		double const Double = -std::numeric_limits<double>::min() * 1.2345678901234567;
+		float const Float = -std::numeric_limits<float>::min() * 1.2345679f;
+		glm::dquat const Quat(Double, Double, Double, Double);
+		Error += check_to_chars_capacity(glm::dmat4(glm::dvec4(Double), glm::dvec4(Double), glm::dvec4(Double), glm::dvec4(Double)));
+		Error += check_to_chars_capacity(glm::mat4(glm::vec4(Float), glm::vec4(Float), glm::vec4(Float), glm::vec4(Float)));
+		Error += check_to_chars_capacity(glm::dmat2x4(glm::dvec4(Double), glm::dvec4(Double)));
+		Error += check_to_chars_capacity(glm::i64vec4(std::numeric_limits<glm::int64>::min()));
+		Error += check_to_chars_capacity(glm::u64vec4(std::numeric_limits<glm::uint64>::max()));
+		Error += check_to_chars_capacity(glm::i8vec4(-128));
+		Error += check_to_chars_capacity(glm::bvec4(false));
+		Error += check_to_chars_capacity(Quat);
+		Error += check_to_chars_capacity(glm::ddualquat(Quat, Quat));
+	}
+
+	// Too small ranges
+	{
+		char Buffer[16];
+		std::to_chars_result const Result = glm::to_chars(Buffer, Buffer + sizeof(Buffer), glm::vec4(0.1f));
+		Error += Result.ec == std::errc::value_too_large && Result.ptr == Buffer + sizeof(Buffer) ? 0 : 1;
+
+		std::to_chars_result const Short = glm::to_chars(Buffer, Buffer + 10, glm::ivec2(1, 2));
+		Error += Short.ec == std::errc::value_too_large ? 0 : 1;
+
+		std::to_chars_result const Fit = glm::to_chars(Buffer, Buffer + 11, glm::ivec2(1, 2));
+		Error += to_chars_string(Buffer, Fit) == std::string("ivec2(1, 2)") ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename genType>
+static int check_from_chars(std::string const& Text, genType const& Expected)
+{
+	genType Value;
+	std::from_chars_result const Result = glm::from_chars(Text.data(), Text.data() + Text.size(), Value);
+	return Result.ec == std::errc() && Result.ptr == Text.data() + Text.size() && Value == Expected ? 0 : 1;
+}
+
+static int test_from_chars()
+{
+	int Error = 0;
+
+	// to_string output
+	Error += check_from_chars("vec3(1.000000, -2.500000, 3.000000)", glm::vec3(1.0f, -2.5f, 3.0f));
+	Error += check_from_chars("i8vec2(-128, 127)", glm::i8vec2(-128, 127));
+	Error += check_from_chars("bvec3(false, true, false)", glm::bvec3(false, true, false));
+	Error += check_from_chars(glm::to_string(glm::mat2x3(1, 2, 3, 4, 5, 6)), glm::mat2x3(1, 2, 3, 4, 5, 6));
+	Error += check_from_chars(glm::to_string(glm::quat(1.0f, 2.0f, 3.0f, 4.0f)), glm::quat(1.0f, 2.0f, 3.0f, 4.0f));
+	Error += check_from_chars(glm::to_string(glm::dualquat(glm::quat(1.0f, 2.0f, 3.0f, 4.0f), glm::quat(5.0f, 6.0f, 7.0f, 8.0f))), glm::dualquat(glm::quat(1.0f, 2.0f, 3.0f, 4.0f), glm::quat(5.0f, 6.0f, 7.0f, 8.0f)));
+
+	// Plain delimited numbers
+	Error += check_from_chars("1 2 3", glm::ivec3(1, 2, 3));
+	Error += check_from_chars("1,2,3", glm::ivec3(1, 2, 3));
+	Error += check_from_chars("  [1.5, +2, -3e2]", glm::dvec3(1.5, 2.0, -300.0));
+	Error += check_from_chars("1;0;0;1", glm::mat2(1.0f));
+	Error += check_from_chars("inf nan", glm::bvec2(false)) == 1 ? 0 : 1;
+
+	// to_chars output reads back to the same bits
+	{
+		glm::mat4 const m(glm::vec4(0.1f, 1.0f / 3.0f, -1e-30f, 3.4028235e38f), glm::vec4(7.0f), glm::vec4(-0.0f), glm::vec4(1e-45f));
+		char Buffer[512];
+		std::to_chars_result const Written = glm::to_chars(Buffer, Buffer + sizeof(Buffer), m);
+
+		glm::mat4 Read(0.0f);
+		std::from_chars_result const Result = glm::from_chars(Buffer, Written.ptr, Read);
+		Error += Result.ec == std::errc() && Result.ptr == Written.ptr ? 0 : 1;
+		Error += std::memcmp(&m, &Read, sizeof(m)) == 0 ? 0 : 1;
+	}
+
+	// Errors leave the value unchanged
+	{
+		std::string const Texts[] = {"", "vec3(1, 2)", "1 2 x", "ivec3(1, -, 3)", "ivec2(1, 99999999999)"};
+		for(std::size_t i = 0; i < sizeof(Texts) / sizeof(Texts[0]); ++i)
+		{
+			glm::ivec3 Value(7);
+			std::from_chars_result const Result = glm::from_chars(Texts[i].data(), Texts[i].data() + Texts[i].size(), Value);
+			Error += Result.ec == std::errc::invalid_argument && Result.ptr == Texts[i].data() && Value == glm::ivec3(7) ? 0 : 1;
+		}
+	}
+
+	// The type name and the brackets must match the value
+	{
+		std::string const Texts[] = {"vec3(1, 2, 3)", "(1, 2, 3)", "[1, 2, 3]", "vec2(1, 2", "mat2(1, 2)", "dualquat(1, 2)", "vec2x(1, 2)"};
+		for(std::size_t i = 0; i < sizeof(Texts) / sizeof(Texts[0]); ++i)
+		{
+			glm::vec2 Value(7);
+			std::from_chars_result const Result = glm::from_chars(Texts[i].data(), Texts[i].data() + Texts[i].size(), Value);
+			Error += Result.ec == std::errc::invalid_argument && Result.ptr == Texts[i].data() && Value == glm::vec2(7) ? 0 : 1;
+		}
+
+		Error += check_from_chars("dvec2(1, 2)", glm::vec2(1, 2));
+		Error += check_from_chars("u8vec2(1, 2)", glm::ivec2(1, 2));
+		Error += check_from_chars("mat2((1, 0), (0, 1))", glm::mat2(1.0f));
+		Error += check_from_chars("dmat2x2((1, 0), (0, 1))", glm::mat2(1.0f));
+		Error += check_from_chars("mat2x3(1, 2, 3, 4, 5, 6)", glm::mat2x2(1.0f)) == 1 ? 0 : 1;
+		Error += check_from_chars("quat(1, 0, 0, 0)", glm::dualquat()) == 1 ? 0 : 1;
+	}
+
+	// Values followed by other characters
+	{
+		std::string const Text("vec2(1, 2) tail");
+		glm::vec2 Value;
+		std::from_chars_result const Result = glm::from_chars(Text.data(), Text.data() + Text.size(), Value);
+		Error += Result.ec == std::errc() && std::string(Result.ptr) == "tail" && Value == glm::vec2(1, 2) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_from_chars_bulk()
+{
+	int Error = 0;
+
+	// One value per line, as CSV
+	{
+		std::string const Text("0.5,1,2\r\n3,4,5\r\n-6,7.25,8\r\n\r\n");
+		std::vector<glm::vec3> Values;
+		std::from_chars_result const Result = glm::from_chars(Text.data(), Text.data() + Text.size(), Values);
+		Error += Result.ec == std::errc() && Result.ptr == Text.data() + Text.size() ? 0 : 1;
+		Error += Values.size() == 3 ? 0 : 1;
+		Error += Values.size() == 3 && Values[0] == glm::vec3(0.5f, 1, 2) && Values[2] == glm::vec3(-6, 7.25f, 8) ? 0 : 1;
+	}
+
+	// JSON array of arrays
+	{
+		std::string const Text("[[1, 2], [3, 4], [5, 6]]");
+		std::vector<glm::ivec2> Values;
+		std::from_chars_result const Result = glm::from_chars(Text.data(), Text.data() + Text.size(), Values);
+		Error += Result.ec == std::errc() && Values.size() == 3 ? 0 : 1;
+		Error += Values.size() == 3 && Values[1] == glm::ivec2(3, 4) ? 0 : 1;
+	}
+
+	// Many to_chars values
+	{
+		std::vector<glm::dvec4> Expected(1000);
+		std::string Text;
+		for(std::size_t i = 0; i < Expected.size(); ++i)
+		{
+			double const x = static_cast<double>(i);
+			Expected[i] = glm::dvec4(x / 7.0, -x * 1e10, 1.0 / (x + 1.0), x);
+			char Buffer[256];
+			Text.append(Buffer, glm::to_chars(Buffer, Buffer + sizeof(Buffer), Expected[i]).ptr);
+			Text.push_back('\n');
+		}
+
+		std::vector<glm::dvec4> Values;
+		std::from_chars_result const Result = glm::from_chars(Text.data(), Text.data() + Text.size(), Values);
+		Error += Result.ec == std::errc() && Values == Expected ? 0 : 1;
+	}
+
+	// A value with more numbers than the type stops the reading
+	{
+		std::string const Text("vec2(1, 2)\nvec3(1, 2, 3)\nvec2(3, 4)\n");
+		std::vector<glm::vec2> Values;
+		std::from_chars_result const Result = glm::from_chars(Text.data(), Text.data() + Text.size(), Values);
+		Error += Result.ec == std::errc::invalid_argument && Result.ptr == Text.data() + 11 && Values.size() == 1 ? 0 : 1;
+	}
+
+	// Incomplete last value
+	{
+		std::string const Text("1 2 3\n4 5 6\n7 8");
+		std::vector<glm::uvec3> Values;
+		std::from_chars_result const Result = glm::from_chars(Text.data(), Text.data() + Text.size(), Values);
+		Error += Result.ec == std::errc::invalid_argument && Result.ptr == Text.data() + 12 && Values.size() == 2 ? 0 : 1;
+	}
+
+	return Error;
+}
+#endif//GLM_LANG & GLM_LANG_CXX17_FLAG
+
+#if defined(__cpp_lib_format)
+static int test_format()
+{
+	int Error = 0;
+
+	Error += std::format("{}", glm::vec2(1.0f, 0.5f)) != std::string("vec2(1, 0.5)") ? 1 : 0;
+	Error += std::format("p = {}", glm::ivec3(1, 2, 3)) != std::string("p = ivec3(1, 2, 3)") ? 1 : 0;
+	Error += std::format("{}", glm::dmat2(1.0)) != std::string("dmat2x2((1, 0), (0, 1))") ? 1 : 0;
+	Error += std::format("{}", glm::quat(1.0f, 0.0f, 0.0f, 0.0f)) != std::string("quat(1, {0, 0, 0})") ? 1 : 0;
+
+	// Without memory allocation
+	char Buffer[64];
+	std::format_to_n_result<char*> const Result = std::format_to_n(Buffer, sizeof(Buffer), "{}", glm::uvec2(4, 2));
+	Error += std::string(Buffer, Result.out) != std::string("uvec2(4, 2)") ? 1 : 0;
+
+	// The longest text of a GLM type
+	glm::dmat4 Large;
+	for(glm::length_t i = 0; i < 4; ++i)
+		Large[i] = glm::dvec4(-std::numeric_limits<double>::min() * 1.2345678901234567);
+	std::vector<char> Chars(1024);
+	std::to_chars_result const Expected = glm::to_chars(Chars.data(), Chars.data() + Chars.size(), Large);
+	Error += Expected.ec == std::errc() ? 0 : 1;
+	Error += std::format("{}", Large) != std::string(Chars.data(), Expected.ptr) ? 1 : 0;
+
+	// Format specifications are rejected
+	try
+	{
+		std::string const Text = std::vformat("{:x}", std::make_format_args(glm::vec2(1.0f)));
+		Error += 1;
+	}
+	catch(std::format_error const&)
+	{}
+
+	return Error;
+}
+#endif//defined(__cpp_lib_format)
+
+#if (GLM_LANG & GLM_LANG_CXX17_FLAG) && defined(FMT_VERSION)
+static int test_fmt()
+{
+	int Error = 0;
+
+	Error += fmt::format("{}", glm::vec2(1.0f, 0.5f)) != std::string("vec2(1, 0.5)") ? 1 : 0;
+	Error += fmt::format("p = {}", glm::ivec3(1, 2, 3)) != std::string("p = ivec3(1, 2, 3)") ? 1 : 0;
+	Error += fmt::format("{}", glm::dmat2(1.0)) != std::string("dmat2x2((1, 0), (0, 1))") ? 1 : 0;
+	Error += fmt::format("{}", glm::quat(1.0f, 0.0f, 0.0f, 0.0f)) != std::string("quat(1, {0, 0, 0})") ? 1 : 0;
+
+	char Buffer[64];
+	fmt::format_to_n_result<char*> const Result = fmt::format_to_n(Buffer, sizeof(Buffer), "{}", glm::uvec2(4, 2));
+	Error += std::string(Buffer, Result.out) != std::string("uvec2(4, 2)") ? 1 : 0;
+
+	// The longest text of a GLM type
+	glm::dmat4 Large;
+	for(glm::length_t i = 0; i < 4; ++i)
+		Large[i] = glm::dvec4(-std::numeric_limits<double>::min() * 1.2345678901234567);
+	std::vector<char> Chars(1024);
+	std::to_chars_result const Expected = glm::to_chars(Chars.data(), Chars.data() + Chars.size(), Large);
+	Error += Expected.ec == std::errc() ? 0 : 1;
+	Error += fmt::format("{}", Large) != std::string(Chars.data(), Expected.ptr) ? 1 : 0;
+
+	// Format specifications are rejected
+	try
+	{
+		std::string const Text = fmt::format(fmt::runtime("{:x}"), glm::vec2(1.0f));
+		Error += 1;
+	}
+	catch(fmt::format_error const&)
+	{}
+
+	return Error;
+}
+#endif//(GLM_LANG & GLM_LANG_CXX17_FLAG) && defined(FMT_VERSION)
+
 int main()
 {
 	int Error = 0;
@@ -149,6 +456,17 @@ int main()
 	Error += test_string_cast_matrix();
 	Error += test_string_cast_quaternion();
 	Error += test_string_cast_dual_quaternion();
+#	if GLM_LANG & GLM_LANG_CXX17_FLAG
+		Error += test_to_chars();
+		Error += test_from_chars();
+		Error += test_from_chars_bulk();
+#	endif
+#	if defined(__cpp_lib_format)
+		Error += test_format();
+#	endif
+#	if (GLM_LANG & GLM_LANG_CXX17_FLAG) && defined(FMT_VERSION)
+		Error += test_fmt();
+#	endif
 
 	return Error;
 }
@@ -0,0 +1,192 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/vertex_weld.hpp>
+#include <glm/ext/vector_relational.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+
+#include <vector>
+
+// Every vertex must be within epsilon of its unique vertex
+template<typename vecType>
+static int check_weld(std::vector<vecType> const& Positions, std::vector<glm::uint32> const& Remap, std::vector<vecType> const& Unique, std::size_t UniqueCount, float Epsilon)
+{
+	int Error = 0;
+
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+	{
+		Error += Remap[i] < UniqueCount ? 0 : 1;
+		Error += glm::all(glm::lessThanEqual(glm::abs(Positions[i] - Unique[Remap[i]]), vecType(Epsilon))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<glm::qualifier Q>
+static int test_weld_qualifier()
+{
+	typedef glm::vec<3, float, Q> vec3;
+
+	int Error = 0;
+
+	// A 10 x 10 x 10 grid, each point repeated three times with a jitter smaller than epsilon
+	std::vector<vec3> Positions;
+	for(int z = -5; z < 5; ++z)
+	for(int y = -5; y < 5; ++y)
+	for(int x = -5; x < 5; ++x)
+	for(int k = 0; k < 3; ++k)
+		Positions.push_back(vec3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)) + vec3(static_cast<float>(k - 1) * 0.0004f));
+
+	float const Epsilon = 0.001f;
+	for(unsigned int Threads = 1; Threads <= 4; ++Threads)
+	{
+		std::vector<glm::uint32> Remap(Positions.size());
+		std::vector<vec3> Unique(Positions.size());
+		std::size_t const UniqueCount = glm::weldVertices(Positions.data(), Positions.size(), Epsilon, Remap.data(), Unique.data(), Threads);
+
+		Error += UniqueCount == 1000 ? 0 : 1;
+		Error += check_weld(Positions, Remap, Unique, UniqueCount, Epsilon);
+
+		// Unique vertices are numbered by order of first occurrence
+		for(std::size_t i = 0; i < Positions.size(); ++i)
+			Error += Remap[i] == i / 3 ? 0 : 1;
+	}
+
+	// Exact welding
+	std::vector<vec3> Exact;
+	Exact.push_back(vec3(1, 2, 3));
+	Exact.push_back(vec3(1, 2, 3.0001f));
+	Exact.push_back(vec3(-0.0f, 0, 0));
+	Exact.push_back(vec3(1, 2, 3));
+	Exact.push_back(vec3(0, 0, 0));
+
+	std::vector<glm::uint32> Remap(Exact.size());
+	std::vector<vec3> Unique(Exact.size());
+	std::size_t const UniqueCount = glm::weldVertices(Exact.data(), Exact.size(), 0.0f, Remap.data(), Unique.data());
+	Error += UniqueCount == 3 ? 0 : 1;
+	Error += Remap[0] == 0 && Remap[1] == 1 && Remap[2] == 2 && Remap[3] == 0 && Remap[4] == 2 ? 0 : 1;
+	Error += check_weld(Exact, Remap, Unique, UniqueCount, 0.0f);
+
+	return Error;
+}
+
+static int test_weld()
+{
+	int Error = 0;
+
+	Error += test_weld_qualifier<glm::defaultp>();
+	Error += test_weld_qualifier<glm::packed_highp>();
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	Error += test_weld_qualifier<glm::aligned_highp>();
+#endif
+
+	return Error;
+}
+
+static int test_weld_chain()
+{
+	int Error = 0;
+
+	// Points spaced by less than epsilon along X must not collapse transitively
+	std::vector<glm::vec2> Positions;
+	for(int i = 0; i < 1000; ++i)
+		Positions.push_back(glm::vec2(static_cast<float>(i) * 0.3f, 0.0f));
+
+	for(unsigned int Threads = 1; Threads <= 8; Threads *= 2)
+	{
+		std::vector<glm::uint32> Remap(Positions.size());
+		std::vector<glm::vec2> Unique(Positions.size());
+		std::size_t const UniqueCount = glm::weldVertices(Positions.data(), Positions.size(), 0.5f, Remap.data(), Unique.data(), Threads);
+
+		Error += UniqueCount >= 300 && UniqueCount <= 500 ? 0 : 1;
+		Error += check_weld(Positions, Remap, Unique, UniqueCount, 0.5f);
+	}
+
+	return Error;
+}
+
+static int test_weld_attributes()
+{
+	int Error = 0;
+
+	// Two faces of a cube corner share positions but not normals
+	std::vector<glm::vec3> Positions;
+	std::vector<glm::vec3> Normals;
+	std::vector<glm::vec2> Texcoords;
+	for(int Face = 0; Face < 2; ++Face)
+	for(int Corner = 0; Corner < 4; ++Corner)
+	for(int Copy = 0; Copy < 2; ++Copy)
+	{
+		Positions.push_back(glm::vec3(static_cast<float>(Corner & 1), static_cast<float>(Corner >> 1), 0.0f));
+		Normals.push_back(Face == 0 ? glm::vec3(0, 0, 1) : glm::vec3(1, 0, 0));
+		Texcoords.push_back(glm::vec2(static_cast<float>(Face), static_cast<float>(Corner)));
+	}
+
+	std::vector<glm::uint32> Remap(Positions.size());
+	std::vector<glm::vec3> UniquePositions(Positions.size());
+	std::vector<glm::vec3> UniqueNormals(Positions.size());
+	std::size_t const UniqueCount = glm::weldVertices(
+		Positions.data(), Normals.data(), Positions.size(), 0.0001f, 0.01f,
+		Remap.data(), UniquePositions.data(), UniqueNormals.data(), 1u);
+
+	Error += UniqueCount == 8 ? 0 : 1;
+	Error += check_weld(Positions, Remap, UniquePositions, UniqueCount, 0.0001f);
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+		Error += glm::all(glm::equal(Normals[i], UniqueNormals[Remap[i]])) ? 0 : 1;
+
+	std::vector<glm::vec2> UniqueTexcoords(UniqueCount);
+	glm::remapVertices(Texcoords.data(), Texcoords.size(), Remap.data(), UniqueTexcoords.data());
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+		Error += glm::all(glm::equal(Texcoords[i], UniqueTexcoords[Remap[i]])) ? 0 : 1;
+
+	return Error;
+}
+
+// The unique position and the unique attribute of a unique vertex come from the same vertex
+static int test_weld_attributes_threads()
+{
+	int Error = 0;
+
+	// With epsilon 0.5 and two threads the cells 0 and 1 are welded by the first thread, 2 and 3 by the second.
+	// The first vertex is closest to cell 2 so it is deferred, the second vertex becomes the representative of both.
+	std::vector<glm::vec3> Positions;
+	std::vector<glm::vec3> Normals;
+	Positions.push_back(glm::vec3(1.6f, 0.0f, 0.0f));
+	Normals.push_back(glm::vec3(0.0f, 0.0f, 1.0f));
+	Positions.push_back(glm::vec3(1.2f, 0.0f, 0.0f));
+	Normals.push_back(glm::vec3(0.0f, 0.005f, 1.0f));
+	Positions.push_back(glm::vec3(0.2f, 0.0f, 0.0f));
+	Normals.push_back(glm::vec3(1.0f, 0.0f, 0.0f));
+	Positions.push_back(glm::vec3(3.2f, 0.0f, 0.0f));
+	Normals.push_back(glm::vec3(1.0f, 0.0f, 0.0f));
+
+	std::vector<glm::uint32> Remap(Positions.size());
+	std::vector<glm::vec3> UniquePositions(Positions.size());
+	std::vector<glm::vec3> UniqueNormals(Positions.size());
+	std::size_t const UniqueCount = glm::weldVertices(
+		Positions.data(), Normals.data(), Positions.size(), 0.5f, 0.01f,
+		Remap.data(), UniquePositions.data(), UniqueNormals.data(), 2u);
+
+	Error += UniqueCount == 3 ? 0 : 1;
+	Error += Remap[0] == 0 && Remap[1] == 0 ? 0 : 1;
+	Error += check_weld(Positions, Remap, UniquePositions, UniqueCount, 0.5f);
+
+	Error += glm::all(glm::equal(UniquePositions[0], Positions[1])) ? 0 : 1;
+	Error += glm::all(glm::equal(UniqueNormals[0], Normals[1])) ? 0 : 1;
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+		Error += glm::all(glm::lessThanEqual(glm::abs(Normals[i] - UniqueNormals[Remap[i]]), glm::vec3(0.01f))) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_weld();
+	Error += test_weld_chain();
+	Error += test_weld_attributes();
+	Error += test_weld_attributes_threads();
+
+	return Error;
+}
@@ -0,0 +1,128 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/dual_quaternion.hpp>
+#include <glm/ext/vector_relational.hpp>
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+static std::size_t const Influences = 4;
+
+template <typename T, glm::qualifier Q>
+static std::vector<glm::tdualquat<T, Q> > make_palette(std::size_t Bones)
+{
+	std::vector<glm::tdualquat<T, Q> > Palette(Bones);
+	for(std::size_t i = 0; i < Bones; ++i)
+	{
+		T const Angle = static_cast<T>(i) * static_cast<T>(0.1);
+		glm::vec<3, T, Q> const Axis = glm::normalize(glm::vec<3, T, Q>(1, static_cast<T>(i % 3), 2));
+		Palette[i] = glm::tdualquat<T, Q>(glm::angleAxis(Angle, Axis), glm::vec<3, T, Q>(static_cast<T>(i), 1, -1));
+	}
+	return Palette;
+}
+
+// Baseline: blend, convert with mat3x4_cast and transform through the matrix
+template <typename T, glm::qualifier Q>
+static int launch_mat3x4_cast(std::vector<glm::vec<3, T, Q> >& O, std::vector<glm::tdualquat<T, Q> > const& Palette, std::vector<unsigned short> const& Indices, std::vector<T> const& Weights, std::vector<glm::vec<3, T, Q> > const& I)
+{
+	O.resize(I.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0, n = I.size(); i < n; ++i)
+	{
+		glm::tdualquat<T, Q> Blend = Palette[Indices[i * Influences]] * Weights[i * Influences];
+		for(std::size_t j = 1; j < Influences; ++j)
+		{
+			glm::tdualquat<T, Q> const& Bone = Palette[Indices[i * Influences + j]];
+			T const Weight = glm::dot(Palette[Indices[i * Influences]].real, Bone.real) < static_cast<T>(0) ? -Weights[i * Influences + j] : Weights[i * Influences + j];
+			Blend = Blend + Bone * Weight;
+		}
+		glm::mat<3, 4, T, Q> const M = glm::mat3x4_cast(Blend);
+		glm::vec<4, T, Q> const P(I[i], 1);
+		O[i] = glm::vec<3, T, Q>(glm::dot(M[0], P), glm::dot(M[1], P), glm::dot(M[2], P));
+	}
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename T, glm::qualifier Q>
+static int launch_dualquat_skin(std::vector<glm::vec<3, T, Q> >& O, std::vector<glm::tdualquat<T, Q> > const& Palette, std::vector<unsigned short> const& Indices, std::vector<T> const& Weights, std::vector<glm::vec<3, T, Q> > const& I)
+{
+	O.resize(I.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	glm::dualquat_skin(&Palette[0], &Indices[0], &Weights[0], static_cast<glm::length_t>(Influences), &I[0], static_cast<glm::vec<3, T, Q> const*>(nullptr), I.size(), &O[0], static_cast<glm::vec<3, T, Q>*>(nullptr));
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int comp_dualquat_skinning(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::size_t const Bones = 64;
+	std::vector<glm::dualquat> const PackedPalette = make_palette<float, glm::packed_highp>(Bones);
+	std::vector<glm::tdualquat<float, glm::aligned_highp> > const AlignedPalette = make_palette<float, glm::aligned_highp>(Bones);
+
+	std::vector<unsigned short> Indices(Samples * Influences);
+	std::vector<float> Weights(Samples * Influences);
+	std::vector<glm::vec3> PackedPositions(Samples);
+	std::vector<glm::aligned_vec3> AlignedPositions(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		for(std::size_t j = 0; j < Influences; ++j)
+		{
+			Indices[i * Influences + j] = static_cast<unsigned short>((i * 7 + j * 13) % Bones);
+			Weights[i * Influences + j] = 1.0f / static_cast<float>(Influences);
+		}
+		PackedPositions[i] = glm::vec3(static_cast<float>(i % 17), static_cast<float>(i % 5), 1.0f);
+		AlignedPositions[i] = PackedPositions[i];
+	}
+
+	std::vector<glm::vec3> Baseline;
+	std::printf("- mat3x4_cast: %d us\n", launch_mat3x4_cast(Baseline, PackedPalette, Indices, Weights, PackedPositions));
+
+	std::vector<glm::vec3> SISD;
+	std::printf("- dualquat_skin SISD: %d us\n", launch_dualquat_skin(SISD, PackedPalette, Indices, Weights, PackedPositions));
+
+	std::vector<glm::aligned_vec3> SIMD;
+	std::printf("- dualquat_skin SIMD: %d us\n", launch_dualquat_skin(SIMD, AlignedPalette, Indices, Weights, AlignedPositions));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		glm::vec3 const A = Baseline[i];
+		glm::vec3 const B = SISD[i];
+		glm::vec3 const C = SIMD[i];
+		Error += glm::all(glm::equal(A, B, 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(A, C, 0.001f)) ? 0 : 1;
+		assert(!Error);
+	}
+
+	return Error;
+}
+
+int main()
+{
+	std::size_t const Samples = 100000;
+
+	int Error = 0;
+
+	std::printf("glm::dualquat_skin(%d influences):\n", static_cast<int>(Influences));
+	Error += comp_dualquat_skinning(Samples);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,113 @@
+// Compares the compilation of a workload source with and without GLM_FORCE_EXTERN_TEMPLATE.
+// The workload is this file compiled with GLM_PERF_EXTERN_TEMPLATE_WORKLOAD defined.
+
+#ifdef GLM_PERF_EXTERN_TEMPLATE_WORKLOAD
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+template<typename vecType>
+static vecType shade(vecType const& N, vecType const& L, vecType const& V)
+{
+	typedef typename vecType::value_type T;
+
+	vecType const H = glm::normalize(L + V);
+	T const Diffuse = glm::max(glm::dot(N, L), static_cast<T>(0));
+	T const Specular = glm::pow(glm::max(glm::dot(N, H), static_cast<T>(0)), static_cast<T>(32));
+	return glm::clamp(N * Diffuse + glm::reflect(-L, N) * Specular, static_cast<T>(0), static_cast<T>(1)) + glm::fract(V) - glm::floor(L);
+}
+
+template<typename T>
+static glm::vec<4, T, glm::defaultp> transform(glm::mat<4, 4, T, glm::defaultp> const& M, glm::vec<4, T, glm::defaultp> const& v)
+{
+	glm::mat<4, 4, T, glm::defaultp> const N = glm::inverse(glm::transpose(M)) * M;
+	return N * v + v * M - glm::determinant(N) * v;
+}
+
+glm::vec3 workload(glm::vec3 const& a, glm::vec3 const& b);
+glm::vec3 workload(glm::vec3 const& a, glm::vec3 const& b)
+{
+	glm::vec4 const f = transform(glm::mat4(a.x), glm::vec4(b, 1.0f));
+	glm::dvec4 const d = transform(glm::dmat4(b.y), glm::dvec4(a, 1.0));
+	glm::mat3 const m = glm::inverse(glm::mat3(a.x)) * glm::mat3(b.y) + glm::transpose(glm::mat3(b.z));
+	glm::ivec3 const i = glm::clamp(glm::ivec3(a) * 3 / glm::ivec3(2), glm::ivec3(0), glm::ivec3(16));
+	glm::quat const q = glm::angleAxis(a.x, glm::normalize(b));
+
+	return shade(a, b, glm::cross(a, b)) + glm::vec3(shade(glm::dvec3(a), glm::dvec3(b), glm::dvec3(f))) + m * glm::vec3(i) + q * glm::vec3(d) + glm::vec3(shade(glm::vec4(a, 0), glm::vec4(b, 0), f));
+}
+
+#else//GLM_PERF_EXTERN_TEMPLATE_WORKLOAD
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+// The compiler is known with GCC and Clang builds
+#if defined(GLM_PERF_CXX_COMPILER)
+
+static long objectSize(char const* Path)
+{
+	std::ifstream File(Path, std::ios::binary | std::ios::ate);
+	return File ? static_cast<long>(File.tellg()) : -1;
+}
+
+static int compile(char const* Options, char const* Object, int& Duration)
+{
+	std::string const Command = std::string("\"") + GLM_PERF_CXX_COMPILER + "\" " + GLM_PERF_CXX_STANDARD + " -c -I\"" + GLM_PERF_INCLUDE_DIR + "\" -DGLM_PERF_EXTERN_TEMPLATE_WORKLOAD " + Options + " \"" + __FILE__ + "\" -o " + Object;
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	int const Result = std::system(Command.c_str());
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	Duration = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count());
+	return Result;
+}
+
+static int launch_extern_template(char const* Level, std::size_t Samples)
+{
+	int Error = 0;
+
+	int Inline = 0;
+	int Extern = 0;
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		int Duration = 0;
+		Error += compile(Level, "perf_extern_template_inline.o", Duration) == 0 ? 0 : 1;
+		Inline += Duration;
+		Error += compile((std::string(Level) + " -DGLM_FORCE_EXTERN_TEMPLATE").c_str(), "perf_extern_template_extern.o", Duration) == 0 ? 0 : 1;
+		Extern += Duration;
+	}
+
+	long const InlineSize = objectSize("perf_extern_template_inline.o");
+	long const ExternSize = objectSize("perf_extern_template_extern.o");
+
+	std::printf("%s:\n", Level);
+	std::printf("- Implicit instantiations: %d ms, %ld bytes\n", Inline / static_cast<int>(Samples), InlineSize);
+	std::printf("- GLM_FORCE_EXTERN_TEMPLATE: %d ms, %ld bytes\n", Extern / static_cast<int>(Samples), ExternSize);
+
+	// Without optimization the instantiations are not emitted in the workload object
+	if(std::string(Level) == "-O0")
+		Error += ExternSize < InlineSize ? 0 : 1;
+
+	return Error;
+}
+
+#endif//defined(GLM_PERF_CXX_COMPILER)
+
+int main()
+{
+	int Error = 0;
+
+#	if defined(GLM_PERF_CXX_COMPILER)
+		std::size_t const Samples = 4;
+
+		Error += launch_extern_template("-O0", Samples);
+		Error += launch_extern_template("-O2", Samples);
+#	endif
+
+	return Error;
+}
+
+#endif//GLM_PERF_EXTERN_TEMPLATE_WORKLOAD
@@ -0,0 +1,179 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/fast_square_root.hpp>
+#include <glm/gtx/fast_trigonometry.hpp>
+#include <glm/trigonometric.hpp>
+#include <glm/exponential.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef void (*batch)(float const* In, std::size_t Count, float* Out);
+
+static void precise_sin(float const* In, std::size_t Count, float* Out)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::sin(In[i]);
+}
+
+static void precise_cos(float const* In, std::size_t Count, float* Out)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::cos(In[i]);
+}
+
+static void precise_inversesqrt(float const* In, std::size_t Count, float* Out)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::inversesqrt(In[i]);
+}
+
+static void precise_sqrt(float const* In, std::size_t Count, float* Out)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::sqrt(In[i]);
+}
+
+// The scalar functions applied to each value, as the vector functions did before the SIMD kernels
+static void scalar_sin(float const* In, std::size_t Count, float* Out)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::fastSin(In[i]);
+}
+
+static void scalar_cos(float const* In, std::size_t Count, float* Out)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::fastCos(In[i]);
+}
+
+static void scalar_inversesqrt(float const* In, std::size_t Count, float* Out)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::fastInverseSqrt(In[i]);
+}
+
+static void scalar_sqrt(float const* In, std::size_t Count, float* Out)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::fastSqrt(In[i]);
+}
+
+static int launch_batch(batch Function, std::vector<float> const& I, std::vector<float>& O)
+{
+	O.resize(I.size());
+	Function(&I[0], I.size(), &O[0]);
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	Function(&I[0], I.size(), &O[0]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int comp_batch(char const* Name, batch Precise, batch Scalar, batch Fast, std::vector<float> const& I, float Epsilon)
+{
+	int Error = 0;
+
+	std::vector<float> PreciseOut, ScalarOut, FastOut;
+	int const PreciseTime = launch_batch(Precise, I, PreciseOut);
+	int const ScalarTime = launch_batch(Scalar, I, ScalarOut);
+	int const FastTime = launch_batch(Fast, I, FastOut);
+
+	std::printf("%s:\n", Name);
+	std::printf("- precise: %d us\n", PreciseTime);
+	std::printf("- fast, scalar: %d us\n", ScalarTime);
+	std::printf("- fast, batch: %d us, %.1fx faster than precise\n", FastTime, static_cast<double>(PreciseTime) / static_cast<double>(FastTime > 0 ? FastTime : 1));
+
+	for(std::size_t i = 0; i < I.size(); ++i)
+		Error += glm::equal(PreciseOut[i], FastOut[i], Epsilon * glm::max(1.0f, glm::abs(PreciseOut[i]))) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename vecType>
+static int launch_normalize(bool Fast, std::vector<vecType> const& I, std::vector<vecType>& O)
+{
+	O.resize(I.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	if(Fast)
+	{
+		for(std::size_t i = 0, n = I.size(); i < n; ++i)
+			O[i] = glm::fastNormalize(I[i]);
+	}
+	else
+	{
+		for(std::size_t i = 0, n = I.size(); i < n; ++i)
+			O[i] = glm::normalize(I[i]);
+	}
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int comp_normalize(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::vec4> PackedIn(Samples);
+	std::vector<glm::aligned_vec4> AlignedIn(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		PackedIn[i] = glm::vec4(static_cast<float>(i % 17) + 1.0f, static_cast<float>(i % 5), -2.0f, static_cast<float>(i % 3));
+		AlignedIn[i] = PackedIn[i];
+	}
+
+	std::vector<glm::vec4> Precise, PackedFast;
+	std::vector<glm::aligned_vec4> AlignedFast;
+	std::printf("glm::fastNormalize(vec4):\n");
+	std::printf("- normalize: %d us\n", launch_normalize(false, PackedIn, Precise));
+	std::printf("- fastNormalize, packed: %d us\n", launch_normalize(true, PackedIn, PackedFast));
+	std::printf("- fastNormalize, aligned: %d us\n", launch_normalize(true, AlignedIn, AlignedFast));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		glm::vec4 const A = Precise[i];
+		glm::vec4 const B = AlignedFast[i];
+		Error += glm::all(glm::equal(A, B, 1e-5f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	std::size_t const Samples = 1000000;
+
+	int Error = 0;
+
+	std::vector<float> Angles(Samples);
+	std::vector<float> Values(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Angles[i] = -100.0f + 200.0f * static_cast<float>(i) / static_cast<float>(Samples);
+		Values[i] = 0.001f + 1000.0f * static_cast<float>(i) / static_cast<float>(Samples);
+	}
+
+	Error += comp_batch("glm::fastSin(float const*, std::size_t, float*)", precise_sin, scalar_sin, glm::fastSin<float>, Angles, 1e-5f);
+	Error += comp_batch("glm::fastCos(float const*, std::size_t, float*)", precise_cos, scalar_cos, glm::fastCos<float>, Angles, 1e-5f);
+	Error += comp_batch("glm::fastInverseSqrt(float const*, std::size_t, float*)", precise_inversesqrt, scalar_inversesqrt, glm::fastInverseSqrt<float>, Values, 1e-6f);
+	Error += comp_batch("glm::fastSqrt(float const*, std::size_t, float*)", precise_sqrt, scalar_sqrt, glm::fastSqrt<float>, Values, 1e-6f);
+	Error += comp_normalize(Samples);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,105 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/matrix_decompose.hpp>
+#include <glm/ext/vector_relational.hpp>
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+template <typename T, glm::qualifier Q>
+static std::vector<glm::mat<4, 4, T, Q> > make_matrices(std::size_t Samples)
+{
+	std::vector<glm::mat<4, 4, T, Q> > Matrices(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		glm::vec<3, T, Q> const Translation(static_cast<T>(i), 1, -1);
+		glm::qua<T, Q> const Orientation = glm::angleAxis(static_cast<T>(i) * static_cast<T>(0.01), glm::normalize(glm::vec<3, T, Q>(1, 2, 3)));
+		glm::vec<3, T, Q> const Scale(1 + static_cast<T>(i % 7), 2, static_cast<T>(0.5));
+		Matrices[i] = glm::mat4_cast(Translation, Orientation, Scale);
+	}
+	return Matrices;
+}
+
+static int launch_decompose(std::vector<glm::vec3>& O, std::vector<glm::mat4> const& I)
+{
+	O.resize(I.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0, n = I.size(); i < n; ++i)
+	{
+		glm::quat Orientation;
+		glm::vec3 Translation, Skew;
+		glm::vec4 Perspective;
+		glm::decompose(I[i], O[i], Orientation, Translation, Skew, Perspective);
+	}
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename T, glm::qualifier Q>
+static int launch_decomposeTRS(std::vector<glm::vec<3, T, Q> >& O, std::vector<glm::mat<4, 4, T, Q> > const& I)
+{
+	O.resize(I.size());
+	std::vector<glm::qua<T, Q> > Orientation(I.size());
+	std::vector<glm::vec<3, T, Q> > Translation(I.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	glm::decomposeTRS(&I[0], I.size(), &O[0], &Orientation[0], &Translation[0]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int comp_decompose(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> const Packed = make_matrices<float, glm::packed_highp>(Samples);
+	std::vector<glm::aligned_mat4> const Aligned = make_matrices<float, glm::aligned_highp>(Samples);
+
+	std::vector<glm::vec3> Baseline;
+	std::printf("- decompose: %d us\n", launch_decompose(Baseline, Packed));
+
+	std::vector<glm::vec3> SISD;
+	std::printf("- decomposeTRS SISD: %d us\n", launch_decomposeTRS(SISD, Packed));
+
+	std::vector<glm::aligned_vec3> SIMD;
+	std::printf("- decomposeTRS SIMD: %d us\n", launch_decomposeTRS(SIMD, Aligned));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		glm::vec3 const A = Baseline[i];
+		glm::vec3 const B = SISD[i];
+		glm::vec3 const C = SIMD[i];
+		Error += glm::all(glm::equal(A, B, 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(A, C, 0.001f)) ? 0 : 1;
+		assert(!Error);
+	}
+
+	return Error;
+}
+
+int main()
+{
+	std::size_t const Samples = 100000;
+
+	int Error = 0;
+
+	std::printf("glm::decomposeTRS(mat4):\n");
+	Error += comp_decompose(Samples);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
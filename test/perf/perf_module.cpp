@@ -0,0 +1,131 @@
+// Compares the compilation of translation units importing the glm module with translation units including glm/ext.hpp.
+// The workload is this file compiled with GLM_PERF_MODULE_WORKLOAD defined, and GLM_PERF_MODULE_IMPORT to import the module.
+
+#ifdef GLM_PERF_MODULE_WORKLOAD
+
+#ifdef GLM_PERF_MODULE_IMPORT
+import glm;
+#else
+#	include <glm/ext.hpp>
+#endif
+
+template<typename T>
+static glm::vec<3, T, glm::defaultp> shade(glm::vec<3, T, glm::defaultp> const& N, glm::vec<3, T, glm::defaultp> const& L, glm::vec<3, T, glm::defaultp> const& V)
+{
+	glm::vec<3, T, glm::defaultp> const H = glm::normalize(L + V);
+	T const Diffuse = glm::max(glm::dot(N, L), static_cast<T>(0));
+	T const Specular = glm::pow(glm::max(glm::dot(N, H), static_cast<T>(0)), static_cast<T>(32));
+	return glm::clamp(N * Diffuse + glm::reflect(-L, N) * Specular, static_cast<T>(0), static_cast<T>(1));
+}
+
+glm::vec4 workload(glm::vec3 const& a, glm::vec3 const& b);
+glm::vec4 workload(glm::vec3 const& a, glm::vec3 const& b)
+{
+	glm::mat4 const Projection = glm::perspective(glm::radians(45.0f), 4.0f / 3.0f, 0.1f, 100.f);
+	glm::mat4 const View = glm::lookAt(a, b, glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::mat4 const Model = glm::scale(glm::rotate(glm::translate(glm::mat4(1.0f), a), b.x, b), glm::vec3(0.5f));
+	glm::quat const q = glm::slerp(glm::quat_cast(Model), glm::angleAxis(a.y, glm::normalize(b)), 0.5f);
+	glm::dmat3 const m = glm::inverse(glm::dmat3(glm::mat3_cast(q))) * glm::transpose(glm::dmat3(b.y));
+	glm::u32vec3 const i = glm::clamp(glm::u32vec3(glm::abs(a)), glm::u32vec3(0), glm::u32vec3(0x1FFFFF));
+	glm::vec3 const Color = shade(a, b, glm::cross(a, b)) + glm::vec3(shade(glm::dvec3(a), glm::dvec3(b), m * glm::dvec3(b)));
+
+	return Projection * View * Model * glm::vec4(Color, 1.0f) + glm::vec4(static_cast<float>(glm::bitfieldInterleave(i.x, i.y, i.z) & 0xFF)) + glm::vec4(glm::compMax(b), glm::length2(a), glm::fastInverseSqrt(b.z + 2.0f), glm::packHalf2x16(glm::vec2(a)));
+}
+
+#else//GLM_PERF_MODULE_WORKLOAD
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+// The compiler is known with GCC and Clang builds
+#if defined(GLM_PERF_CXX_COMPILER)
+
+// The module is built with the configuration of the glm-module target, exposing the extensions in namespace glm
+#define GLM_PERF_MODULE_DEFINES " -DGLM_ENABLE_EXPERIMENTAL -DGLM_EXT_INLINE_NAMESPACE -DGLM_GTC_INLINE_NAMESPACE -DGLM_GTX_INLINE_NAMESPACE"
+
+#if defined(__clang__)
+#	define GLM_PERF_MODULE_BUILD " --precompile -x c++-module"
+#	define GLM_PERF_MODULE_OUTPUT "perf_module_glm.pcm"
+#	define GLM_PERF_MODULE_USE " -fmodule-file=glm=perf_module_glm.pcm"
+#else
+	// GCC writes the compiled module interface in gcm.cache
+#	define GLM_PERF_MODULE_BUILD " -fmodules-ts -c -x c++"
+#	define GLM_PERF_MODULE_OUTPUT "perf_module_glm.o"
+#	define GLM_PERF_MODULE_USE " -fmodules-ts"
+#endif
+
+static int compile(std::string const& Options, int& Duration)
+{
+	std::string const Command = std::string("\"") + GLM_PERF_CXX_COMPILER + "\" -std=c++20 -I\"" + GLM_PERF_INCLUDE_DIR + "\"" + GLM_PERF_MODULE_DEFINES + Options;
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	int const Result = std::system(Command.c_str());
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	Duration = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count());
+	return Result;
+}
+
+static int compile_workload(char const* Options, std::size_t Units, int& Duration)
+{
+	int Error = 0;
+
+	Duration = 0;
+	for(std::size_t i = 0; i < Units; ++i)
+	{
+		int Unit = 0;
+		Error += compile(std::string(" -c -DGLM_PERF_MODULE_WORKLOAD") + Options + " \"" + __FILE__ + "\" -o perf_module_workload.o", Unit) == 0 ? 0 : 1;
+		Duration += Unit;
+	}
+
+	return Error;
+}
+
+static int launch_module(std::size_t Units)
+{
+	int Error = 0;
+
+	int Include = 0;
+	Error += compile_workload("", Units, Include);
+
+	std::printf("%d translation units:\n", static_cast<int>(Units));
+	std::printf("- #include <glm/ext.hpp>: %d ms, %d ms per unit\n", Include, Include / static_cast<int>(Units));
+
+	// Compilers without named module support, or unable to import the interface of glm (GCC 12), only measure the inclusion
+	int Build = 0;
+	if(compile(std::string(GLM_PERF_MODULE_BUILD) + " \"" + GLM_PERF_INCLUDE_DIR + "/glm/glm.cppm\" -o " GLM_PERF_MODULE_OUTPUT, Build) != 0)
+	{
+		std::printf("- import glm: the compiler doesn't build the glm module, skipped\n");
+		return Error;
+	}
+
+	// The diagnostics of the first import are kept in perf_module_import.log
+	int Import = 0;
+	if(compile(std::string(" -c -DGLM_PERF_MODULE_WORKLOAD -DGLM_PERF_MODULE_IMPORT" GLM_PERF_MODULE_USE " \"") + __FILE__ + "\" -o perf_module_workload.o 2> perf_module_import.log", Import) != 0)
+	{
+		std::printf("- import glm: the compiler doesn't import the glm module, see perf_module_import.log, skipped\n");
+		return Error;
+	}
+	Error += compile_workload(" -DGLM_PERF_MODULE_IMPORT" GLM_PERF_MODULE_USE, Units, Import);
+
+	std::printf("- import glm: %d ms, %d ms per unit, %d ms to build the module\n", Import + Build, Import / static_cast<int>(Units), Build);
+
+	return Error;
+}
+
+#endif//defined(GLM_PERF_CXX_COMPILER)
+
+int main()
+{
+	int Error = 0;
+
+#	if defined(GLM_PERF_CXX_COMPILER)
+		Error += launch_module(4);
+#	endif
+
+	return Error;
+}
+
+#endif//GLM_PERF_MODULE_WORKLOAD